@@ -0,0 +1,215 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+//
+// Compares boost::container::spsc_queue and boost::container::mpmc_queue
+// against a boost::container::deque protected by a std::mutex:
+//
+//  - Throughput: producers push N integers that consumers pop, one by one and in batches.
+//  - Latency: two threads bounce a value through two queues (round trip time).
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/container/deque.hpp>
+#include <boost/container/mpmc_queue.hpp>
+#include <boost/container/spsc_queue.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using boost::move_detail::nanosecond_type;
+using boost::move_detail::nsec_clock;
+
+namespace bc = boost::container;
+
+static const std::size_t QueueCapacity = 1024u;
+static const std::size_t BatchSize     = 32u;
+
+//A deque protected by a mutex, bounded to the capacity of the other queues
+class locked_deque
+{
+   public:
+   std::size_t capacity() const
+   {  return QueueCapacity;  }
+
+   bool try_push(std::size_t v)
+   {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if(m_deque.size() == QueueCapacity)
+         return false;
+      m_deque.push_back(v);
+      return true;
+   }
+
+   bool try_pop(std::size_t &v)
+   {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if(m_deque.empty())
+         return false;
+      v = m_deque.front();
+      m_deque.pop_front();
+      return true;
+   }
+
+   std::size_t push_n(const std::size_t *p, std::size_t n)
+   {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if(n > QueueCapacity - m_deque.size())
+         n = QueueCapacity - m_deque.size();
+      m_deque.insert(m_deque.end(), p, p + n);
+      return n;
+   }
+
+   std::size_t pop_n(std::size_t *p, std::size_t n)
+   {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if(n > m_deque.size())
+         n = m_deque.size();
+      for(std::size_t i = 0; i != n; ++i){
+         p[i] = m_deque.front();
+         m_deque.pop_front();
+      }
+      return n;
+   }
+
+   private:
+   std::mutex                    m_mutex;
+   bc::deque<std::size_t>        m_deque;
+};
+
+template<class Queue>
+void producer(Queue &q, std::size_t first, std::size_t n, bool batch)
+{
+   std::size_t buf[BatchSize];
+   for(std::size_t i = 0; i != n; ){
+      if(batch){
+         const std::size_t k = (n - i) < BatchSize ? (n - i) : BatchSize;
+         for(std::size_t j = 0; j != k; ++j)
+            buf[j] = first + i + j;
+         const std::size_t pushed = q.push_n(&buf[0], k);
+         if(!pushed)
+            std::this_thread::yield();
+         i += pushed;
+      }
+      else if(q.try_push(first + i)){
+         ++i;
+      }
+      else{
+         std::this_thread::yield();
+      }
+   }
+}
+
+template<class Queue>
+void consumer(Queue &q, std::atomic<std::size_t> &remaining, bool batch, std::size_t &checksum)
+{
+   std::size_t buf[BatchSize];
+   std::size_t sum = 0;
+   while(remaining.load(std::memory_order_relaxed)){
+      std::size_t k = 0;
+      if(batch){
+         k = q.pop_n(&buf[0], BatchSize);
+      }
+      else if(q.try_pop(buf[0])){
+         k = 1u;
+      }
+      for(std::size_t j = 0; j != k; ++j)
+         sum += buf[j];
+      if(k)
+         remaining.fetch_sub(k, std::memory_order_relaxed);
+      else
+         std::this_thread::yield();
+   }
+   checksum = sum;
+}
+
+template<class Queue>
+void throughput_test(const char *name, std::size_t producers, std::size_t consumers, std::size_t n, bool batch)
+{
+   Queue q;
+   std::atomic<std::size_t> remaining(producers*n);
+   std::vector<std::size_t> checksums(consumers);
+   std::vector<std::thread> threads;
+
+   const nanosecond_type start = nsec_clock();
+   for(std::size_t p = 0; p != producers; ++p)
+      threads.push_back(std::thread([&q, p, n, batch]{ producer(q, p*n, n, batch); }));
+   for(std::size_t c = 0; c != consumers; ++c)
+      threads.push_back(std::thread([&q, &remaining, &checksums, c, batch]{ consumer(q, remaining, batch, checksums[c]); }));
+   for(std::size_t t = 0; t != threads.size(); ++t)
+      threads[t].join();
+   const nanosecond_type elapsed = nsec_clock() - start;
+
+   std::size_t sum = 0;
+   for(std::size_t c = 0; c != consumers; ++c)
+      sum += checksums[c];
+   const std::size_t total = producers*n;
+   if(sum != total*(total - 1u)/2u)
+      std::cout << "ERROR: wrong checksum" << std::endl;
+
+   std::cout << "  " << name << (batch ? " (batch)" : "        ")
+             << "  " << producers << "P/" << consumers << "C: "
+             << double(total)*1000.0/double(elapsed) << " Mops/s" << std::endl;
+}
+
+template<class Queue>
+void latency_test(const char *name, std::size_t round_trips)
+{
+   Queue ping, pong;
+   std::thread echo([&]{
+      std::size_t v;
+      for(std::size_t i = 0; i != round_trips; ++i){
+         while(!ping.try_pop(v)){ std::this_thread::yield(); }
+         while(!pong.try_push(v)){ std::this_thread::yield(); }
+      }
+   });
+   const nanosecond_type start = nsec_clock();
+   std::size_t v;
+   for(std::size_t i = 0; i != round_trips; ++i){
+      while(!ping.try_push(i)){ std::this_thread::yield(); }
+      while(!pong.try_pop(v)){ std::this_thread::yield(); }
+   }
+   const nanosecond_type elapsed = nsec_clock() - start;
+   echo.join();
+   std::cout << "  " << name << ": " << double(elapsed)/double(round_trips) << " ns/round trip" << std::endl;
+}
+
+typedef bc::spsc_queue<std::size_t, QueueCapacity>   spsc_t;
+typedef bc::mpmc_queue<std::size_t, QueueCapacity>   mpmc_t;
+
+int main()
+{
+   #ifdef NDEBUG
+   const std::size_t n = 5000000u;
+   const std::size_t round_trips = 200000u;
+   #else
+   const std::size_t n = 200000u;
+   const std::size_t round_trips = 20000u;
+   #endif
+
+   std::cout << "Throughput:" << std::endl;
+   for(int b = 0; b != 2; ++b){
+      throughput_test<locked_deque>("deque+mutex", 1u, 1u, n, b != 0);
+      throughput_test<spsc_t>      ("spsc_queue ", 1u, 1u, n, b != 0);
+      throughput_test<mpmc_t>      ("mpmc_queue ", 1u, 1u, n, b != 0);
+      throughput_test<locked_deque>("deque+mutex", 2u, 2u, n/2u, b != 0);
+      throughput_test<mpmc_t>      ("mpmc_queue ", 2u, 2u, n/2u, b != 0);
+   }
+
+   std::cout << "Latency:" << std::endl;
+   latency_test<locked_deque>("deque+mutex", round_trips);
+   latency_test<spsc_t>      ("spsc_queue ", round_trips);
+   latency_test<mpmc_t>      ("mpmc_queue ", round_trips);
+   return 0;
+}
@@ -0,0 +1,93 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+//
+// Compares boost::container::flat_string_map against flat_map<std::string, int>
+// when looking up metric-like keys that share long prefixes. Also reports
+// the memory used by each container.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/container/flat_string_map.hpp>
+#include <boost/container/flat_map.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using boost::move_detail::nanosecond_type;
+using boost::move_detail::nsec_clock;
+
+std::vector<std::string> make_keys(std::size_t n, std::size_t salt)
+{
+   static const char *const groups[] = { "cpu", "memory", "disk", "network" };
+   std::vector<std::string> keys;
+   char buf[96];
+   for(std::size_t i = 0; i != n; ++i){
+      const std::size_t v = (i*7919u + salt) % (n*2u);
+      std::sprintf(buf, "service.frontend.%s.host%04u.counter%u", groups[v % 4u], unsigned(v/4u % 1000u), unsigned(v/4000u));
+      keys.push_back(buf);
+   }
+   return keys;
+}
+
+std::size_t heap_bytes(const boost::container::flat_map<std::string, int> &m)
+{
+   std::size_t bytes = m.capacity()*sizeof(std::pair<std::string, int>);
+   for(boost::container::flat_map<std::string, int>::const_iterator it = m.begin(); it != m.end(); ++it){
+      //Assume libstdc++/libc++ short string buffers of 15 characters
+      if(it->first.capacity() > 15u)
+         bytes += it->first.capacity() + 1u;
+   }
+   return bytes;
+}
+
+std::size_t heap_bytes(const boost::container::flat_string_map<int> &m)
+{
+   //Each element stores the key prefix, offset and length and the mapped value
+   typedef boost::container::dtl::flat_string_entry<std::size_t, int> entry_t;
+   return m.capacity()*sizeof(entry_t) + m.key_storage_size();
+}
+
+template<class Map>
+void bench_find(const char *type, const std::vector<std::string> &keys, const std::vector<std::string> &lookups, std::size_t n)
+{
+   Map m;
+   for(std::size_t i = 0; i != keys.size(); ++i){
+      m[keys[i]] = int(i);
+   }
+   std::size_t found = 0;
+   const nanosecond_type start = nsec_clock();
+   for(std::size_t r = 0; r != n; ++r){
+      for(std::size_t i = 0; i != lookups.size(); ++i){
+         found += std::size_t(m.find(lookups[i]) != m.end());
+      }
+   }
+   const nanosecond_type elapsed = nsec_clock() - start;
+   std::cout << "  find " << type << ": "
+             << double(elapsed)/double(n*lookups.size()) << " ns/lookup (found " << found/n
+             << ", ~" << heap_bytes(m)/1024u << " KiB)" << std::endl;
+}
+
+int main()
+{
+   #ifdef NDEBUG
+   const std::size_t n = 100000u, reps = 10u;
+   #else
+   const std::size_t n = 10000u, reps = 1u;
+   #endif
+   const std::vector<std::string> keys = make_keys(n, 0u);
+   const std::vector<std::string> lookups = make_keys(n, 1u);
+   bench_find<boost::container::flat_string_map<int> >            ("flat_string_map<int>         ", keys, lookups, reps);
+   bench_find<boost::container::flat_map<std::string, int> >      ("flat_map<std::string, int>   ", keys, lookups, reps);
+   return 0;
+}
@@ -0,0 +1,96 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+//
+// Compares flat_map lookups keyed by boost::container::string against
+// lookups keyed by interned_string handles, and measures the cost of
+// interning strings that are already in the table.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/container/interned_string.hpp>
+#include <boost/container/flat_map.hpp>
+#include <boost/container/string.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <iostream>
+
+using boost::move_detail::nanosecond_type;
+using boost::move_detail::nsec_clock;
+using namespace boost::container;
+
+//Orders handles by identity: constant time, but not lexicographical
+struct id_less
+{
+   bool operator()(const interned_string &x, const interned_string &y) const
+   {  return x.id() < y.id();  }
+};
+
+string make_key(std::size_t i)
+{
+   char buf[64];
+   std::sprintf(buf, "tenant/%u/metric/requests_total/%u", unsigned(i % 97u), unsigned(i));
+   return string(buf);
+}
+
+template<class Map, class Keys>
+void bench_find(const char *name, const Map &m, const Keys &keys, std::size_t reps)
+{
+   std::size_t checksum = 0;
+   const nanosecond_type start = nsec_clock();
+   for(std::size_t r = 0; r != reps; ++r){
+      for(std::size_t i = 0; i != keys.size(); ++i){
+         checksum += std::size_t(m.find(keys[i])->second);
+      }
+   }
+   const nanosecond_type elapsed = nsec_clock() - start;
+   std::cout << "  " << name << ": "
+             << double(elapsed)/double(reps*keys.size()) << " ns/find (checksum " << checksum << ")" << std::endl;
+}
+
+int main()
+{
+   #ifdef NDEBUG
+   const std::size_t n = 100000u, reps = 10u;
+   #else
+   const std::size_t n = 10000u, reps = 1u;
+   #endif
+   intern_table table;
+   vector<string> strings;
+   vector<interned_string> handles;
+   flat_map<string, int> string_map;
+   flat_map<interned_string, int> interned_map;
+   flat_map<interned_string, int, id_less> id_map;
+   for(std::size_t i = 0; i != n; ++i){
+      strings.push_back(make_key(i));
+      handles.push_back(table.intern(strings.back()));
+      string_map.emplace(strings.back(), int(i));
+      interned_map.emplace(handles.back(), int(i));
+      id_map.emplace(handles.back(), int(i));
+   }
+
+   bench_find("flat_map<string>                 ", string_map, strings, reps);
+   bench_find("flat_map<interned_string>        ", interned_map, handles, reps);
+   bench_find("flat_map<interned_string, id_less>", id_map, handles, reps);
+
+   std::size_t checksum = 0;
+   const nanosecond_type start = nsec_clock();
+   for(std::size_t r = 0; r != reps; ++r){
+      for(std::size_t i = 0; i != n; ++i){
+         checksum += table.intern(strings[i]).size();
+      }
+   }
+   const nanosecond_type elapsed = nsec_clock() - start;
+   std::cout << "  intern (already interned)         : "
+             << double(elapsed)/double(reps*n) << " ns/string (checksum " << checksum << ")" << std::endl;
+   return 0;
+}
@@ -0,0 +1,74 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+//
+// Compares boost::container::rope against boost::container::string when
+// building a large text from small fragments and when editing its middle.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/container/rope.hpp>
+#include <boost/container/string.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+
+#include <cstddef>
+#include <iostream>
+
+using boost::move_detail::nanosecond_type;
+using boost::move_detail::nsec_clock;
+
+static const char fragment[] = "GET /api/v1/items?id=42 HTTP/1.1 200 OK\n";
+static const std::size_t fragment_size = sizeof(fragment) - 1u;
+
+template<class String>
+void bench_append(const char *type, std::size_t n)
+{
+   const nanosecond_type start = nsec_clock();
+   String s;
+   for(std::size_t i = 0; i != n; ++i){
+      s.append(fragment, fragment_size);
+   }
+   const nanosecond_type elapsed = nsec_clock() - start;
+   std::cout << "  append " << type << ": "
+             << double(elapsed)/double(n) << " ns/fragment (size " << s.size() << ")" << std::endl;
+}
+
+template<class String>
+void bench_edit(const char *type, std::size_t fragments, std::size_t n)
+{
+   String s;
+   for(std::size_t i = 0; i != fragments; ++i){
+      s.append(fragment, fragment_size);
+   }
+   unsigned state = 1u;
+   const nanosecond_type start = nsec_clock();
+   for(std::size_t i = 0; i != n; ++i){
+      state = state*1103515245u + 12345u;
+      const std::size_t pos = std::size_t(state >> 8u) % s.size();
+      s.insert(pos, "hello");
+      s.erase((pos*7u) % s.size(), 5u);
+   }
+   const nanosecond_type elapsed = nsec_clock() - start;
+   std::cout << "  insert+erase " << type << ": "
+             << double(elapsed)/double(n) << " ns/edit (size " << s.size() << ")" << std::endl;
+}
+
+int main()
+{
+   #ifdef NDEBUG
+   const std::size_t fragments = 200000u;
+   #else
+   const std::size_t fragments = 20000u;
+   #endif
+   bench_append<boost::container::rope>  ("boost::container::rope  ", fragments);
+   bench_append<boost::container::string>("boost::container::string", fragments);
+   bench_edit<boost::container::rope>    ("boost::container::rope  ", fragments, 10000u);
+   bench_edit<boost::container::string>  ("boost::container::string", fragments, 1000u);
+   return 0;
+}
@@ -0,0 +1,171 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+//
+// Compares the sequential segmented algorithms against their parallel
+// overloads (boost::container::segmented_par) on big segtor and hub ranges,
+// as used by batch jobs that score every element of a container.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/container/experimental/segmented_parallel.hpp>
+#include <boost/container/hub.hpp>
+#include <boost/container/segtor.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+
+#include <cstddef>
+#include <iostream>
+
+using boost::move_detail::nanosecond_type;
+using boost::move_detail::nsec_clock;
+namespace bc = boost::container;
+
+struct score
+{
+   void operator()(float &x) const { x = x*0.75f + 1.0f/(1.0f + x*x); }
+};
+
+struct above
+{
+   explicit above(float v) : v_(v) {}
+   bool operator()(float x) const { return x > v_; }
+   float v_;
+};
+
+struct scale
+{
+   float operator()(float x) const { return x*2.0f + 1.0f; }
+};
+
+class timer
+{
+   public:
+   timer(const char *cont, const char *algo)
+      : m_cont(cont), m_algo(algo)
+   {}
+
+   template<class F>
+   nanosecond_type measure(F f, std::size_t reps) const
+   {
+      nanosecond_type best = nanosecond_type(-1);
+      for(std::size_t r = 0; r != reps; ++r){
+         const nanosecond_type start = nsec_clock();
+         f();
+         const nanosecond_type elapsed = nsec_clock() - start;
+         best = elapsed < best ? elapsed : best;
+      }
+      return best;
+   }
+
+   void report(nanosecond_type seq, nanosecond_type par, std::size_t n) const
+   {
+      std::cout << "  " << m_cont << " " << m_algo << ": seq " << double(seq)/double(n) << " ns/elem, par "
+                << double(par)/double(n) << " ns/elem (x" << double(seq)/double(par ? par : 1u) << ")" << std::endl;
+   }
+
+   private:
+   const char *m_cont;
+   const char *m_algo;
+};
+
+template<class C, class Policy>
+struct run_for_each
+{
+   void operator()() const
+   {
+      if(par) bc::segmented_for_each(*policy, c->begin(), c->end(), score());
+      else    bc::segmented_for_each(c->begin(), c->end(), score());
+   }
+   C *c; const Policy *policy; bool par;
+};
+
+template<class C, class Policy>
+struct run_count_if
+{
+   void operator()() const
+   {
+      *result += std::size_t(par ? bc::segmented_count_if(*policy, c->begin(), c->end(), above(1.0f))
+                                 : bc::segmented_count_if(c->begin(), c->end(), above(1.0f)));
+   }
+   C *c; const Policy *policy; bool par; std::size_t *result;
+};
+
+template<class C, class Policy>
+struct run_find_if
+{
+   void operator()() const
+   {
+      //No element matches: the whole range is searched
+      *result += std::size_t(par ? bc::segmented_find_if(*policy, c->begin(), c->end(), above(1e30f)) == c->end()
+                                 : bc::segmented_find_if(c->begin(), c->end(), above(1e30f)) == c->end());
+   }
+   C *c; const Policy *policy; bool par; std::size_t *result;
+};
+
+template<class C, class Policy>
+struct run_transform
+{
+   void operator()() const
+   {
+      if(par) bc::segmented_transform(*policy, c->begin(), c->end(), out->begin(), scale());
+      else    bc::segmented_transform(c->begin(), c->end(), out->begin(), scale());
+   }
+   C *c; const Policy *policy; bool par; bc::vector<float> *out;
+};
+
+template<class C, class Policy>
+void bench_container(const char *name, C &c, const Policy &policy, std::size_t reps)
+{
+   const std::size_t n = c.size();
+   std::size_t result = 0;
+   bc::vector<float> out(n);
+   {
+      const timer t(name, "for_each  ");
+      run_for_each<C, Policy> s = { &c, &policy, false }, p = { &c, &policy, true };
+      t.report(t.measure(s, reps), t.measure(p, reps), n);
+   }
+   {
+      const timer t(name, "count_if  ");
+      run_count_if<C, Policy> s = { &c, &policy, false, &result }, p = { &c, &policy, true, &result };
+      t.report(t.measure(s, reps), t.measure(p, reps), n);
+   }
+   {
+      const timer t(name, "find_if   ");
+      run_find_if<C, Policy> s = { &c, &policy, false, &result }, p = { &c, &policy, true, &result };
+      t.report(t.measure(s, reps), t.measure(p, reps), n);
+   }
+   {
+      const timer t(name, "transform ");
+      run_transform<C, Policy> s = { &c, &policy, false, &out }, p = { &c, &policy, true, &out };
+      t.report(t.measure(s, reps), t.measure(p, reps), n);
+   }
+   std::cout << "  (checksum " << result + std::size_t(out[n/2u]) << ")" << std::endl;
+}
+
+int main()
+{
+   #ifdef NDEBUG
+   const std::size_t n = 20000000u, reps = 5u;
+   #else
+   const std::size_t n = 200000u, reps = 1u;
+   #endif
+   const bc::segmented_parallel_policy<> policy;
+   std::cout << "segmented_par with " << policy.executor().concurrency() << " threads, " << n << " elements" << std::endl;
+
+   bc::segtor<float> s;
+   bc::hub<float> h;
+   for(std::size_t i = 0; i != n; ++i){
+      s.push_back(float(i % 1000u)/1000.0f);
+      h.insert(float(i % 1000u)/1000.0f);
+   }
+   bench_container("segtor<float>", s, policy, reps);
+   bench_container("hub<float>   ", h, policy, reps);
+   return 0;
+}
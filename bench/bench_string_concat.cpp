@@ -0,0 +1,52 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+//
+// Compares chained operator+ of boost::container::string using lazy
+// concatenation expressions against std::string.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#define BOOST_CONTAINER_STRING_LAZY_CONCAT
+#include <boost/container/string.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+using boost::move_detail::nanosecond_type;
+using boost::move_detail::nsec_clock;
+
+template<class String>
+void bench(const char *type, std::size_t n)
+{
+   const String host("api.example.com"), path("v1/items/by-owner"), query("id=42&sort=asc&limit=100");
+   std::size_t checksum = 0;
+   const nanosecond_type start = nsec_clock();
+   for(std::size_t i = 0; i != n; ++i){
+      const String url = host + "/" + path + '?' + query + "&page=" + path;
+      checksum += url.size() + std::size_t(url[i % url.size()]);
+   }
+   const nanosecond_type elapsed = nsec_clock() - start;
+   std::cout << "  " << type << ": "
+             << double(elapsed)/double(n) << " ns/expression (checksum " << checksum << ")" << std::endl;
+}
+
+int main()
+{
+   #ifdef NDEBUG
+   const std::size_t n = 2000000u;
+   #else
+   const std::size_t n = 100000u;
+   #endif
+   bench<boost::container::string>("boost::container::string", n);
+   bench<std::string>             ("std::string             ", n);
+   return 0;
+}
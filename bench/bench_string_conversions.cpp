@@ -0,0 +1,108 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+//
+// Serializes numbers in a comma separated line with append_integer/append_float
+// and with std::to_string followed by an append.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/container/string_conversions.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+using boost::move_detail::nanosecond_type;
+using boost::move_detail::nsec_clock;
+
+void report(const char *type, nanosecond_type elapsed, std::size_t n, std::size_t checksum)
+{
+   std::cout << "  " << type << ": "
+             << double(elapsed)/double(n) << " ns/number (checksum " << checksum << ")" << std::endl;
+}
+
+void bench_integers(std::size_t n)
+{
+   std::size_t checksum = 0;
+   {
+      boost::container::string line;
+      const nanosecond_type start = nsec_clock();
+      for(std::size_t i = 0; i != n; ++i){
+         if((i & 1023u) == 0u){
+            checksum += line.size();
+            line.clear();
+         }
+         boost::container::append_integer(line, (long long)(i*2654435761u) - 1000000000);
+         line.push_back(',');
+      }
+      report("append_integer        ", nsec_clock() - start, n, checksum + line.size());
+   }
+   checksum = 0;
+   {
+      std::string line;
+      const nanosecond_type start = nsec_clock();
+      for(std::size_t i = 0; i != n; ++i){
+         if((i & 1023u) == 0u){
+            checksum += line.size();
+            line.clear();
+         }
+         line += std::to_string((long long)(i*2654435761u) - 1000000000);
+         line.push_back(',');
+      }
+      report("std::to_string + append", nsec_clock() - start, n, checksum + line.size());
+   }
+}
+
+void bench_floats(std::size_t n)
+{
+   std::size_t checksum = 0;
+   {
+      boost::container::string line;
+      const nanosecond_type start = nsec_clock();
+      for(std::size_t i = 0; i != n; ++i){
+         if((i & 1023u) == 0u){
+            checksum += line.size();
+            line.clear();
+         }
+         boost::container::append_float(line, double(i)*0.37);
+         line.push_back(',');
+      }
+      report("append_float          ", nsec_clock() - start, n, checksum + line.size());
+   }
+   checksum = 0;
+   {
+      std::string line;
+      const nanosecond_type start = nsec_clock();
+      for(std::size_t i = 0; i != n; ++i){
+         if((i & 1023u) == 0u){
+            checksum += line.size();
+            line.clear();
+         }
+         line += std::to_string(double(i)*0.37);
+         line.push_back(',');
+      }
+      report("std::to_string + append", nsec_clock() - start, n, checksum + line.size());
+   }
+}
+
+int main()
+{
+   #ifdef NDEBUG
+   const std::size_t n = 10000000u;
+   #else
+   const std::size_t n = 100000u;
+   #endif
+   std::cout << "Integers:" << std::endl;
+   bench_integers(n);
+   std::cout << "Floating point (std::to_string uses \"%f\", append_float the shortest round trip):" << std::endl;
+   bench_floats(n);
+   return 0;
+}
@@ -0,0 +1,118 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+//
+// Compares the searches of boost::container::string against std::string
+// on log-like lines: single char, substring and character class searches.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/container/string.hpp>
+#include <boost/move/detail/nsec_clock.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using boost::move_detail::nanosecond_type;
+using boost::move_detail::nsec_clock;
+
+template<class String>
+std::vector<String> make_lines(std::size_t n)
+{
+   static const char *const fields[] =
+      { "2026-10-19T12:00:00.123Z", "INFO", "WARN", "service=frontend", "latency_ms=12"
+      , "path=/api/v1/items?id=42&sort=asc", "user_agent=\"Mozilla/5.0 (X11; Linux x86_64)\"" };
+   std::vector<String> lines;
+   unsigned state = 1u;
+   for(std::size_t i = 0; i != n; ++i){
+      String s;
+      for(std::size_t f = 0; f != 8u; ++f){
+         state = state*1103515245u + 12345u;
+         s += fields[(state >> 16u) % (sizeof(fields)/sizeof(fields[0]))];
+         s += ' ';
+      }
+      s += "status=200";
+      lines.push_back(s);
+   }
+   return lines;
+}
+
+template<class String, class Search>
+void bench(const char *name, const char *type, const std::vector<String> &lines, Search search, std::size_t reps)
+{
+   std::size_t checksum = 0;
+   const nanosecond_type start = nsec_clock();
+   for(std::size_t r = 0; r != reps; ++r){
+      for(std::size_t i = 0; i != lines.size(); ++i){
+         checksum += search(lines[i]);
+      }
+   }
+   const nanosecond_type elapsed = nsec_clock() - start;
+   std::cout << "  " << name << " " << type << ": "
+             << double(elapsed)/double(reps*lines.size()) << " ns/line (checksum " << checksum << ")" << std::endl;
+}
+
+struct find_char
+{
+   template<class String> std::size_t operator()(const String &s) const { return s.find('?'); }
+};
+
+struct find_substring
+{
+   template<class String> std::size_t operator()(const String &s) const { return s.find("status="); }
+};
+
+struct rfind_substring
+{
+   template<class String> std::size_t operator()(const String &s) const { return s.rfind("latency_ms="); }
+};
+
+struct find_first_of
+{
+   template<class String> std::size_t operator()(const String &s) const { return s.find_first_of("=&?\""); }
+};
+
+struct find_first_not_of
+{
+   template<class String> std::size_t operator()(const String &s) const
+   {  return s.find_first_not_of("0123456789-:.TZ abcdefghijklmnopqrstuvwxyzINFOWARN");  }
+};
+
+struct find_last_of
+{
+   template<class String> std::size_t operator()(const String &s) const { return s.find_last_of("()"); }
+};
+
+template<class Search>
+void bench_both(const char *name, const std::vector<boost::container::string> &bl, const std::vector<std::string> &sl, std::size_t reps)
+{
+   bench(name, "boost::container::string", bl, Search(), reps);
+   bench(name, "std::string             ", sl, Search(), reps);
+}
+
+int main()
+{
+   #ifdef NDEBUG
+   const std::size_t reps = 200u;
+   #else
+   const std::size_t reps = 10u;
+   #endif
+   const std::vector<boost::container::string> bl = make_lines<boost::container::string>(10000u);
+   const std::vector<std::string> sl = make_lines<std::string>(10000u);
+
+   bench_both<find_char>         ("find(char)        ", bl, sl, reps);
+   bench_both<find_substring>    ("find(str)         ", bl, sl, reps);
+   bench_both<rfind_substring>   ("rfind(str)        ", bl, sl, reps);
+   bench_both<find_first_of>     ("find_first_of     ", bl, sl, reps);
+   bench_both<find_first_not_of> ("find_first_not_of ", bl, sl, reps);
+   bench_both<find_last_of>      ("find_last_of      ", bl, sl, reps);
+   return 0;
+}
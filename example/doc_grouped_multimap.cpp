@@ -0,0 +1,52 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026-2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+//[doc_grouped_multimap
+#include <boost/container/grouped_multimap.hpp>
+
+#include <utility>
+
+//Make sure assertions are active
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+int main ()
+{
+   using namespace boost::container;
+
+   grouped_multimap<int, int> gm;
+
+   //Each distinct key is stored once, its mapped values are
+   //appended to a contiguous sequence in insertion order.
+   for(int i = 0; i != 100; ++i)
+      gm.insert(i % 4, i);
+
+   assert(gm.size() == 100);     //Number of mapped values
+   assert(gm.key_count() == 4);  //Number of tree nodes
+   assert(gm.count(1) == 25);
+
+   //equal_range returns the contiguous sequence of mapped values
+   typedef grouped_multimap<int, int>::mapped_iterator mapped_iterator;
+   std::pair<mapped_iterator, mapped_iterator> r = gm.equal_range(1);
+   assert(r.second - r.first == 25);
+   assert(*r.first == 1 && *(r.second - 1) == 97);
+
+   //Iteration is performed by groups
+   for(grouped_multimap<int, int>::const_iterator it = gm.begin(); it != gm.end(); ++it)
+      assert(it->second.size() == 25);
+
+   //Erasing a key erases all its mapped values in a single step
+   assert(gm.erase(1) == 25);
+   assert(gm.size() == 75);
+   assert(gm.key_count() == 3);
+   return 0;
+}
+//]
@@ -35,6 +35,7 @@
 #include <typeinfo>
 
 #include <boost/container/deque.hpp>
+#include <boost/container/hub.hpp>
 #include <boost/container/experimental/nest.hpp>
 
 #include <boost/container/experimental/segmented_all_of.hpp>
@@ -94,38 +95,6 @@ namespace bc = boost::container;
 // Value types
 //////////////////////////////////////////////////////////////////////////////
 
-class MyInt
-{
-   int int_;
-
-   public:
-   inline explicit MyInt(int i = 0)
-      : int_(i)
-   {}
-
-   inline MyInt(const MyInt &other)
-      :  int_(other.int_)
-   {}
-
-   inline MyInt & operator=(const MyInt &other)
-   {
-      int_ = other.int_;
-      return *this;
-   }
-
-   inline ~MyInt()
-   {
-      int_ = 0;
-   }
-
-   inline int int_value() const { return int_; }
-
-   friend inline bool operator==(const MyInt& a, const MyInt& b) { return a.int_ == b.int_; }
-   friend inline bool operator!=(const MyInt& a, const MyInt& b) { return a.int_ != b.int_; }
-   friend inline bool operator<(const MyInt& a, const MyInt& b) { return a.int_ < b.int_; }
-   friend inline bool operator>(const MyInt& a, const MyInt& b) { return a.int_ > b.int_; }
-};
-
 class MyFatInt
 {
    int int0_;
@@ -657,6 +626,28 @@ void fill_test_data(bc::nest<T,A,O>& c, std::size_t n)
       c.insert(T(static_cast<int>(i)));
 }
 
+template<class T, class A>
+void fill_test_data(bc::hub<T,A>& c, std::size_t n)
+{
+   for (std::size_t i = 0; i < n; ++i)
+      c.insert(T(static_cast<int>(i)));
+}
+
+//Fills c with n elements leaving one out of every four slots empty, the typical
+//state of a hub or nest after erasures, so local iterators must skip holes.
+template<class C>
+void fill_sparse_test_data(C& c, std::size_t n)
+{
+   fill_test_data(c, n + n/3u);
+   std::size_t i = 0;
+   for (typename C::iterator it = c.begin(); it != c.end(); ++i){
+      if (i % 4u == 3u)
+         it = c.erase(it);
+      else
+         ++it;
+   }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // Benchmark helpers
 //////////////////////////////////////////////////////////////////////////////
@@ -745,6 +736,18 @@ inline void print_ratio(const char* algo, const char*,
              << '\n';
 }
 
+inline void print_geomean()
+{
+   std::cout << '\n';
+   print_subheader();
+
+   std::cout << std::left  << std::setw(24) << "algo geomean"
+             << std::right << std::setw(16) << std::fixed << std::setprecision(2) << g_geomean.nsg_over_seg_result()
+             << std::right << std::setw(16) << std::fixed << std::setprecision(2) << g_geomean.std_over_seg_result()
+             << std::right << std::setw(16) << std::fixed << std::setprecision(2) << g_geomean.std_over_nsg_result()
+             << '\n';
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // Measurement infrastructure
 //////////////////////////////////////////////////////////////////////////////
@@ -2521,14 +2524,82 @@ void run_all(const C& c, std::size_t iters, const char* cname)
 
 #endif
 
-   std::cout << '\n';
-   print_subheader();
+   print_geomean();
+}
 
-   std::cout << std::left  << std::setw(24) << "algo geomean"
-             << std::right << std::setw(16) << std::fixed << std::setprecision(2) << g_geomean.nsg_over_seg_result()
-             << std::right << std::setw(16) << std::fixed << std::setprecision(2) << g_geomean.std_over_seg_result()
-             << std::right << std::setw(16) << std::fixed << std::setprecision(2) << g_geomean.std_over_nsg_result()
-             << '\n';
+//////////////////////////////////////////////////////////////////////////////
+// Arithmetic types: segmented algorithms on a deque, that compare each
+// segment with SIMD kernels, against std algorithms on a flat vector
+// holding the same elements.
+//    std: std algorithm on the vector
+//    seg: segmented algorithm on the deque
+//    nsg: std algorithm on the deque
+//////////////////////////////////////////////////////////////////////////////
+
+template<class T>
+void run_simd_benchmarks()
+{
+   #if defined(NDEBUG)
+   const std::size_t N    = 100000;
+   const std::size_t iter = 3000;
+   #else
+   const std::size_t N    = 10000;
+   const std::size_t iter = 1;
+   #endif
+   typedef typename bc::deque_options < bc::block_size<128> >::type block_size_opt_t;
+   typedef bc::deque<T, void, block_size_opt_t> deque_t;
+   typedef bc::vector<T> vec_t;
+
+   std::cout << "\n=== SIMD segmented algorithms vs std on vector [" << typeid(T).name() << "] ===\n"
+             << "Elements: " << N << "   Iterations: " << iter << "\n\n";
+
+   deque_t dq, dq2;
+   fill_test_data(dq, N);
+   fill_test_data(dq2, N);
+   const vec_t v(dq.begin(), dq.end()), v2(v);
+   deque_t dqf(dq);
+   vec_t vf(v);
+
+   const T zero(0);
+   const T min1(-1);
+   const T half((int)N/2);
+   int result = 0;
+
+   g_geomean.reset();
+   print_subheader();
+   compare_batch(iter, N,
+      bench_ops::std_count<vec_t>(v, zero, result),
+      bench_ops::seg_count<deque_t>(dq, zero, result),
+      bench_ops::std_count<deque_t>(dq, zero, result), "count(hit)", "deque");
+   compare_batch(iter, N,
+      bench_ops::std_count<vec_t>(v, min1, result),
+      bench_ops::seg_count<deque_t>(dq, min1, result),
+      bench_ops::std_count<deque_t>(dq, min1, result), "count(miss)", "deque");
+   compare_batch(iter, N,
+      bench_ops::std_find<vec_t>(v, half, result),
+      bench_ops::seg_find<deque_t>(dq, half, result),
+      bench_ops::std_find<deque_t>(dq, half, result), "find(hit)", "deque");
+   compare_batch(iter, N,
+      bench_ops::std_find<vec_t>(v, min1, result),
+      bench_ops::seg_find<deque_t>(dq, min1, result),
+      bench_ops::std_find<deque_t>(dq, min1, result), "find(miss)", "deque");
+   compare_batch(iter, N,
+      bench_ops::std_fill<vec_t>(vf, half),
+      bench_ops::seg_fill<deque_t>(dqf, half),
+      bench_ops::std_fill<deque_t>(dqf, half), "fill", "deque");
+   compare_batch(iter, N,
+      bench_ops::std_equal<vec_t, vec_t>(v, v2, result),
+      bench_ops::seg_equal<deque_t, deque_t>(dq, dq2, result),
+      bench_ops::std_equal<deque_t, deque_t>(dq, dq2, result), "equal(2xS)", "deque");
+   compare_batch(iter, N,
+      bench_ops::std_equal<vec_t, vec_t>(v, v2, result),
+      bench_ops::seg_equal<deque_t, vec_t>(dq, v2, result),
+      bench_ops::std_equal<deque_t, vec_t>(dq, v2, result), "equal(1S)", "deque");
+   compare_batch(iter, N,
+      bench_ops::std_mismatch<vec_t, vec_t>(v, v2, result),
+      bench_ops::seg_mismatch<deque_t, deque_t>(dq, dq2, result),
+      bench_ops::std_mismatch<deque_t, deque_t>(dq, dq2, result), "mismatch(2xS)", "deque");
+   print_geomean();
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -2558,7 +2629,6 @@ void run_benchmarks()
       run_all(dq, iter, "deque");
          std::cout << "\n";
    }
-/*
    {
       std::cout << "--- bc::nest<" << typeid(T).name() << "> ---\n";
       bc::nest<T> nt;
@@ -2566,7 +2636,27 @@ void run_benchmarks()
       run_all(nt, iter, "nest");
       std::cout << "\n";
    }
-*/
+   {
+      std::cout << "--- bc::nest<" << typeid(T).name() << "> (75% occupancy) ---\n";
+      bc::nest<T> nt;
+      fill_sparse_test_data(nt, N);
+      run_all(nt, iter, "nest");
+      std::cout << "\n";
+   }
+   {
+      std::cout << "--- bc::hub<" << typeid(T).name() << "> ---\n";
+      bc::hub<T> hb;
+      fill_test_data(hb, N);
+      run_all(hb, iter, "hub");
+      std::cout << "\n";
+   }
+   {
+      std::cout << "--- bc::hub<" << typeid(T).name() << "> (75% occupancy) ---\n";
+      bc::hub<T> hb;
+      fill_sparse_test_data(hb, N);
+      run_all(hb, iter, "hub");
+      std::cout << "\n";
+   }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -2578,5 +2668,7 @@ int main()
    //run_benchmarks<int>();
    run_benchmarks<MyInt>();
    run_benchmarks<MyFatInt>();
+   run_simd_benchmarks<int>();
+   run_simd_benchmarks<float>();
    return 0;
 }
@@ -0,0 +1,230 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/container/experimental/segmented_parallel.hpp>
+#include <boost/container/deque.hpp>
+#include <boost/container/hub.hpp>
+#include <boost/container/list.hpp>
+#include <boost/container/segtor.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "segmented_test_helper.hpp"
+#include <stdexcept>
+
+using namespace boost::container;
+
+//Runs tasks in reverse order, so that later tasks find elements first
+class reverse_executor
+{
+   public:
+   explicit reverse_executor(std::size_t &tasks)
+      : m_tasks(&tasks)
+   {}
+
+   std::size_t concurrency() const { return 4u; }
+
+   template<class Fn>
+   void run(std::size_t ntasks, Fn &fn) const
+   {
+      *m_tasks += ntasks;
+      for(std::size_t i = ntasks; i != 0; --i)
+         fn(i - 1u);
+   }
+
+   private:
+   std::size_t *m_tasks;
+};
+
+struct is_multiple
+{
+   explicit is_multiple(int d) : d_(d) {}
+   bool operator()(int x) const { return x % d_ == 0; }
+   int d_;
+};
+
+struct is_greater
+{
+   explicit is_greater(int v) : v_(v) {}
+   bool operator()(int x) const { return x > v_; }
+   int v_;
+};
+
+struct increment
+{
+   void operator()(int &x) const { ++x; }
+};
+
+struct twice
+{
+   int operator()(int x) const { return 2*x; }
+};
+
+struct throw_if_equal
+{
+   explicit throw_if_equal(int v) : v_(v) {}
+   void operator()(int x) const
+   {
+      if(x == v_)
+         throw std::runtime_error("throw_if_equal");
+   }
+   int v_;
+};
+
+template<class Policy, class C>
+void test_algorithms(const Policy &policy, C &c, std::size_t n)
+{
+   typedef typename C::iterator iterator;
+   //Values are their position in the range
+   int v = 0;
+   for(iterator it = c.begin(); it != c.end(); ++it)
+      *it = v++;
+   BOOST_TEST_EQ(std::size_t(v), n);
+
+   BOOST_TEST_EQ(std::size_t(segmented_count_if(policy, c.begin(), c.end(), is_multiple(3))), (n + 2u)/3u);
+   BOOST_TEST_EQ(segmented_count(policy, c.begin(), c.end(), int(n/2u)), n ? 1 : 0);
+   BOOST_TEST_EQ(segmented_count(policy, c.begin(), c.end(), -1), 0);
+
+   //Find returns the first match even if later tasks finished first
+   for(std::size_t i = 0; i < n; i += 1u + n/7u){
+      const iterator f = segmented_find(policy, c.begin(), c.end(), int(i));
+      BOOST_TEST(f != c.end() && *f == int(i));
+      const iterator fi = segmented_find_if(policy, c.begin(), c.end(), is_greater(int(i)));
+      BOOST_TEST(i + 1u == n ? fi == c.end() : *fi == int(i + 1u));
+   }
+   BOOST_TEST(segmented_find(policy, c.begin(), c.end(), -1) == c.end());
+   BOOST_TEST(segmented_find_if_not(policy, c.begin(), c.end(), is_greater(-1)) == c.end());
+   if(n){
+      BOOST_TEST(*segmented_find_if_not(policy, c.begin(), c.end(), is_greater(0)) == 0);
+      BOOST_TEST(*segmented_find_if(policy, c.begin(), c.end(), is_multiple(1)) == 0);
+   }
+   BOOST_TEST(segmented_all_of(policy, c.begin(), c.end(), is_greater(-1)));
+   BOOST_TEST(segmented_none_of(policy, c.begin(), c.end(), is_greater(int(n))));
+   BOOST_TEST_EQ(segmented_any_of(policy, c.begin(), c.end(), is_multiple(1)), n != 0u);
+
+   //Mutating algorithms
+   segmented_for_each(policy, c.begin(), c.end(), increment());
+   BOOST_TEST_EQ(std::size_t(segmented_count_if(policy, c.begin(), c.end(), is_greater(0))), n);
+   BOOST_TEST(segmented_find(policy, c.begin(), c.end(), int(n)) == (n ? segmented_find(c.begin(), c.end(), int(n)) : c.end()));
+
+   vector<int> out(n + 1u, -1);
+   BOOST_TEST(segmented_transform(policy, c.begin(), c.end(), out.begin(), twice()) == out.begin() + std::ptrdiff_t(n));
+   BOOST_TEST_EQ(out[n], -1);
+   for(std::size_t i = 0; i != n; ++i)
+      BOOST_TEST_EQ(out[i], 2*int(i + 1u));
+   BOOST_TEST(segmented_copy(policy, c.begin(), c.end(), out.begin() + 1) == out.end());
+   for(std::size_t i = 0; i != n; ++i)
+      BOOST_TEST_EQ(out[i + 1u], int(i + 1u));
+
+   //Non random-access outputs are written sequentially
+   list<int> lout(n);
+   BOOST_TEST(segmented_copy(policy, c.begin(), c.end(), lout.begin()) == lout.end());
+   BOOST_TEST(segmented_transform(policy, c.begin(), c.end(), lout.begin(), twice()) == lout.end());
+   BOOST_TEST(n == 0u || lout.back() == 2*int(n));
+
+   segmented_replace_if(policy, c.begin(), c.end(), is_multiple(2), 0);
+   BOOST_TEST_EQ(std::size_t(segmented_count(policy, c.begin(), c.end(), 0)), n/2u);
+   segmented_replace(policy, c.begin(), c.end(), 0, -2);
+   BOOST_TEST_EQ(std::size_t(segmented_count(policy, c.begin(), c.end(), -2)), n/2u);
+   segmented_fill(policy, c.begin(), c.end(), 7);
+   BOOST_TEST_EQ(std::size_t(segmented_count(policy, c.begin(), c.end(), 7)), n);
+
+   //The exception of the first throwing element is propagated
+   if(n){
+      int p = 0;
+      for(iterator it = c.begin(); it != c.end(); ++it)
+         *it = p++ % 5;
+      bool thrown = false;
+      BOOST_CONTAINER_TRY{
+         segmented_for_each(policy, c.begin(), c.end(), throw_if_equal(int(n < 5u ? n - 1u : 4u)));
+      }
+      BOOST_CONTAINER_CATCH(const std::runtime_error &){
+         thrown = true;
+      }
+      BOOST_CONTAINER_CATCH_END
+      BOOST_TEST(thrown);
+   }
+}
+
+template<class Policy, class C>
+void test_sizes(const Policy &policy)
+{
+   static const std::size_t sizes[] = { 0u, 1u, 7u, 64u, 1000u, 4099u, 20000u };
+   for(std::size_t i = 0; i != sizeof(sizes)/sizeof(sizes[0]); ++i){
+      C c(sizes[i]);
+      test_algorithms(policy, c, sizes[i]);
+   }
+}
+
+template<class Policy>
+void test_containers(const Policy &policy)
+{
+   test_sizes<Policy, vector<int> >(policy);
+   test_sizes<Policy, list<int> >(policy);
+   test_sizes<Policy, deque<int> >(policy);
+   test_sizes<Policy, segtor<int> >(policy);
+   test_sizes<Policy, hub<int> >(policy);
+
+   //Hub with unoccupied slots
+   hub<int> h(5000u);
+   std::size_t i = 0;
+   for(hub<int>::iterator it = h.begin(); it != h.end(); ++i){
+      if(i % 3u)
+         ++it;
+      else
+         it = h.erase(it);
+   }
+   test_algorithms(policy, h, h.size());
+
+   //Segmented ranges whose segments are not random-access
+   test_detail::seg_vector<int> sv;
+   for(std::size_t j = 0; j != 300u; ++j)
+      sv.add_segment(1u + j % 17u, 0);
+   test_algorithms(policy, sv, sv.total_size());
+}
+
+void test_partition()
+{
+   std::size_t tasks = 0;
+   const segmented_parallel_policy<reverse_executor> policy = segmented_par_on(reverse_executor(tasks), 100u);
+   //Small ranges are not split
+   deque<int> d(150u);
+   test_algorithms(policy, d, d.size());
+   BOOST_TEST_EQ(tasks, 0u);
+   //At most TASKS_PER_THREAD tasks per thread
+   vector<int> v(100000u);
+   BOOST_TEST_EQ(segmented_count(policy, v.begin(), v.end(), 0), 100000);
+   BOOST_TEST_EQ(tasks, 4u*BOOST_CONTAINER_SEGMENTED_PARALLEL_TASKS_PER_THREAD);
+   //Non-segmented ranges without random access are not split
+   tasks = 0;
+   list<int> l(1000u);
+   BOOST_TEST_EQ(segmented_count(policy, l.begin(), l.end(), 0), 1000);
+   BOOST_TEST_EQ(tasks, 0u);
+   //Partial ranges
+   d.resize(5000u);
+   test_algorithms(policy, d, d.size());
+   const deque<int>::iterator f = d.begin() + 37, l2 = d.end() - 1001;
+   segmented_fill(policy, f, l2, -5);
+   BOOST_TEST_EQ(std::size_t(segmented_count(d.begin(), d.end(), -5)), std::size_t(l2 - f));
+   BOOST_TEST(segmented_find(policy, d.begin(), d.end(), -5) == f);
+   BOOST_TEST(segmented_find_if(policy, f, d.end(), is_greater(-5)) == l2);
+   BOOST_TEST(tasks > 1u);
+}
+
+int main()
+{
+   test_containers(segmented_par);
+   test_containers(segmented_par_on(segmented_thread_executor(3u), 64u));
+   test_containers(segmented_par_on(segmented_thread_executor(1u), 1u));
+   std::size_t tasks = 0;
+   test_containers(segmented_par_on(reverse_executor(tasks), 16u));
+   BOOST_TEST(tasks > 0u);
+   test_partition();
+   return boost::report_errors();
+}
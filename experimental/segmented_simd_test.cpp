@@ -0,0 +1,147 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Segments of arithmetic types stored in contiguous memory are processed
+// with SIMD kernels by segmented_find/count/fill/equal/mismatch. Results
+// must be identical to the ones of the scalar algorithms for every
+// segment size, alignment and position of the searched elements.
+
+#include <boost/container/experimental/segmented_count.hpp>
+#include <boost/container/experimental/segmented_equal.hpp>
+#include <boost/container/experimental/segmented_fill.hpp>
+#include <boost/container/experimental/segmented_find.hpp>
+#include <boost/container/experimental/segmented_mismatch.hpp>
+#include <boost/container/deque.hpp>
+#include <boost/container/segtor.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/container/options.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <limits>
+#include <cstddef>
+
+using namespace boost::container;
+
+template<class C>
+typename C::iterator nth(C &c, std::size_t n)
+{  return c.begin() + typename C::difference_type(n);  }
+
+template<class T, class C>
+void test_container(C &c)
+{
+   typedef typename C::iterator        iterator;
+   typedef typename C::const_iterator  const_iterator;
+   static const std::size_t sizes[] = { 0u, 1u, 3u, 15u, 16u, 17u, 31u, 32u, 33u, 63u, 64u, 65u, 130u, 401u, 1000u };
+   static const std::size_t offsets[] = { 0u, 1u, 5u, 40u };
+
+   for(std::size_t s = 0; s != sizeof(sizes)/sizeof(sizes[0]); ++s){
+      const std::size_t n = sizes[s];
+      for(std::size_t o = 0; o != sizeof(offsets)/sizeof(offsets[0]); ++o){
+         const std::size_t off = offsets[o];
+         c.clear();
+         for(std::size_t i = 0; i != off + n + 3u; ++i)
+            c.push_back(T(i % 3u));
+         vector<T> v(nth(c, off), nth(c, off + n));
+
+         //fill only touches [first, last)
+         const iterator first = nth(c, off), last = nth(c, off + n);
+         segmented_fill(first, last, T(7));
+         BOOST_TEST(std::size_t(segmented_count(c.begin(), c.end(), T(7))) == n);
+         BOOST_TEST(off == 0u || c[off - 1u] != T(7));
+         BOOST_TEST(c[off + n] != T(7));
+         std::copy(v.begin(), v.end(), first);
+
+         //A single match at every position of the range
+         for(std::size_t p = 0; p <= n; p += 1u + p/4u){
+            if(p < n)
+               *nth(c, off + p) = T(9);
+            const const_iterator cfirst = first, clast = last;
+            const const_iterator f = segmented_find(cfirst, clast, T(9));
+            BOOST_TEST(f == (p < n ? nth(c, off + p) : last));
+            BOOST_TEST(segmented_find(first, last, T(9)) == f);
+            BOOST_TEST(std::size_t(segmented_count(cfirst, clast, T(9))) == (p < n ? 1u : 0u));
+            BOOST_TEST(std::size_t(segmented_count(cfirst, clast, T(1))) ==
+                       std::size_t(std::count(v.begin(), v.end(), T(1))) - (p < n && v[p] == T(1) ? 1u : 0u));
+
+            //Mismatch against contiguous and segmented ranges
+            const std::pair<const_iterator, T*> mv = segmented_mismatch(cfirst, clast, v.data());
+            BOOST_TEST(mv.first == f);
+            BOOST_TEST(mv.second == v.data() + (mv.first - cfirst));
+            const vector<T> cur(cfirst, clast), other(c.begin() + std::ptrdiff_t(o), c.end());
+            const std::pair<iterator, iterator> mc = segmented_mismatch(first, last, c.begin() + std::ptrdiff_t(o), c.end());
+            const std::size_t ms = std::size_t(std::mismatch(cur.begin(), cur.end(), other.begin()).first - cur.begin());
+            BOOST_TEST(mc.first == nth(c, off + ms));
+            BOOST_TEST(mc.second == nth(c, o + ms));
+            BOOST_TEST(segmented_equal(first, last, c.begin() + std::ptrdiff_t(o)) == (ms == n));
+            BOOST_TEST(segmented_equal(cfirst, clast, v.data()) == (p == n));
+            if(n){
+               //Bounded second range shorter than the first one
+               T *const vlast = v.data() + (v.size() - 1u);
+               const std::pair<const_iterator, T*> mb = segmented_mismatch(cfirst, clast, v.data(), vlast);
+               BOOST_TEST(mb.second == (p + 1u < n ? v.data() + p : vlast));
+            }
+            if(p < n)
+               *nth(c, off + p) = v[p];
+         }
+      }
+   }
+}
+
+template<class T>
+void test_type()
+{
+   {
+      deque<T> d;
+      test_container<T>(d);
+   }
+   {
+      deque<T, void, typename deque_options<block_size<13u> >::type> d;
+      test_container<T>(d);
+   }
+   {
+      segtor<T> s;
+      test_container<T>(s);
+   }
+}
+
+template<class T>
+void test_floating_point()
+{
+   deque<T, void, typename deque_options<block_size<37u> >::type> d(100u, T(1));
+   d[50] = -T(0);
+   d[70] = std::numeric_limits<T>::quiet_NaN();
+   //-0.0 == +0.0 and NaN never compares equal
+   BOOST_TEST(segmented_find(d.begin(), d.end(), T(0)) == d.begin() + 50);
+   BOOST_TEST(segmented_find(d.begin(), d.end(), std::numeric_limits<T>::quiet_NaN()) == d.end());
+   BOOST_TEST_EQ(segmented_count(d.begin(), d.end(), -T(0)), 1);
+   vector<T> v(d.begin(), d.end());
+   v[50] = T(0);
+   BOOST_TEST(segmented_mismatch(d.begin(), d.end(), v.data()).first == d.begin() + 70);
+   BOOST_TEST(!segmented_equal(d.begin(), d.end(), v.data()));
+   d[70] = T(1);
+   v[70] = T(1);
+   BOOST_TEST(segmented_equal(d.begin(), d.end(), v.data()));
+}
+
+int main()
+{
+   test_type<char>();
+   test_type<unsigned char>();
+   test_type<short>();
+   test_type<unsigned short>();
+   test_type<int>();
+   test_type<unsigned int>();
+   test_type<long long>();
+   test_type<float>();
+   test_type<double>();
+   test_floating_point<float>();
+   test_floating_point<double>();
+   return boost::report_errors();
+}
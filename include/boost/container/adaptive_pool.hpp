@@ -209,7 +209,7 @@ class adaptive_pool
    size_type size(pointer p) const BOOST_NOEXCEPT_OR_NOTHROW
    {
       BOOST_CONTAINER_STATIC_ASSERT(( Version > 1 ));
-      return dlmalloc_size(p);
+      return dlmalloc_size(p)/sizeof(T);
    }
 
    //!Allocates just one object. Memory allocated with this function
@@ -511,7 +511,7 @@ class private_adaptive_pool
    //!Returns maximum the number of objects the previously allocated memory
    //!pointed by p can hold.
    size_type size(pointer p) const BOOST_NOEXCEPT_OR_NOTHROW
-   {  return dlmalloc_size(p);  }
+   {  return dlmalloc_size(p)/sizeof(T);  }
 
    //!Allocates just one object. Memory allocated with this function
    //!must be deallocated only with deallocate_one().
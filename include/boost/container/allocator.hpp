@@ -22,6 +22,7 @@
 #include <boost/container/detail/config_begin.hpp>
 #include <boost/container/detail/workaround.hpp>
 #include <boost/container/container_fwd.hpp>
+#include <boost/container/detail/allocation_type.hpp>
 #include <boost/container/detail/version_type.hpp>
 #include <boost/container/throw_exception.hpp>
 #include <boost/container/detail/dlmalloc.hpp>
@@ -189,6 +190,19 @@ class allocator
       return static_cast<pointer>(ret);
    }
 
+   //!Allocates memory for an array of at least count elements. The returned count
+   //!reflects the usable size of the underlying memory chunk, so the slack
+   //!of the chunk can be used as capacity.
+   //!Throws bad_alloc if there is no enough memory
+   BOOST_CONTAINER_NODISCARD allocation_result<pointer, size_type> allocate_at_least(size_type count)
+   {
+      allocation_result<pointer, size_type> ret = { this->allocate(count), count };
+      const size_type usable = size_type(dlmalloc_size(ret.ptr)/sizeof(T));
+      if(usable > count)
+         ret.count = usable;
+      return ret;
+   }
+
    //!Deallocates previously allocated memory.
    //!Never throws
    inline void deallocate(pointer ptr, size_type) BOOST_NOEXCEPT_OR_NOTHROW
@@ -242,7 +256,7 @@ class allocator
    BOOST_CONTAINER_NODISCARD size_type size(pointer p) const BOOST_NOEXCEPT_OR_NOTHROW
    {
       BOOST_CONTAINER_STATIC_ASSERT(( Version > 1 ));
-      return dlmalloc_size(p);
+      return dlmalloc_size(p)/sizeof(T);
    }
 
    //!Allocates just one object. Memory allocated with this function
@@ -34,6 +34,7 @@
 #include <boost/container/detail/placement_new.hpp>
 #include <boost/container/detail/is_pair.hpp>
 #include <boost/container/detail/addressof.hpp>
+#include <boost/container/detail/allocation_type.hpp>
 #ifndef BOOST_CONTAINER_DETAIL_STD_FWD_HPP
 #include <boost/container/detail/std_fwd.hpp>
 #endif
@@ -64,6 +65,20 @@
 #define BOOST_INTRUSIVE_HAS_MEMBER_FUNCTION_CALLABLE_WITH_MAX 2
 #include <boost/intrusive/detail/has_member_function_callable_with.hpp>
 
+#define BOOST_INTRUSIVE_HAS_MEMBER_FUNCTION_CALLABLE_WITH_FUNCNAME allocate_at_least
+#define BOOST_INTRUSIVE_HAS_MEMBER_FUNCTION_CALLABLE_WITH_NS_BEG namespace boost { namespace container { namespace dtl {
+#define BOOST_INTRUSIVE_HAS_MEMBER_FUNCTION_CALLABLE_WITH_NS_END   }}}
+#define BOOST_INTRUSIVE_HAS_MEMBER_FUNCTION_CALLABLE_WITH_MIN 1
+#define BOOST_INTRUSIVE_HAS_MEMBER_FUNCTION_CALLABLE_WITH_MAX 1
+#include <boost/intrusive/detail/has_member_function_callable_with.hpp>
+
+#define BOOST_INTRUSIVE_HAS_MEMBER_FUNCTION_CALLABLE_WITH_FUNCNAME on_relocation
+#define BOOST_INTRUSIVE_HAS_MEMBER_FUNCTION_CALLABLE_WITH_NS_BEG namespace boost { namespace container { namespace dtl {
+#define BOOST_INTRUSIVE_HAS_MEMBER_FUNCTION_CALLABLE_WITH_NS_END   }}}
+#define BOOST_INTRUSIVE_HAS_MEMBER_FUNCTION_CALLABLE_WITH_MIN 1
+#define BOOST_INTRUSIVE_HAS_MEMBER_FUNCTION_CALLABLE_WITH_MAX 1
+#include <boost/intrusive/detail/has_member_function_callable_with.hpp>
+
 #define BOOST_INTRUSIVE_HAS_MEMBER_FUNCTION_CALLABLE_WITH_FUNCNAME destroy
 #define BOOST_INTRUSIVE_HAS_MEMBER_FUNCTION_CALLABLE_WITH_NS_BEG namespace boost { namespace container { namespace dtl {
 #define BOOST_INTRUSIVE_HAS_MEMBER_FUNCTION_CALLABLE_WITH_NS_END   }}}
@@ -103,8 +118,14 @@ class allocator_traits_dummy
 #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
 
 template<class T, class ...Args>
-BOOST_CONTAINER_FORCEINLINE void construct_type(T *p, BOOST_FWD_REF(Args) ...args)
+BOOST_CONTAINER_FORCEINLINE BOOST_CONTAINER_CONSTEXPR20 void construct_type(T *p, BOOST_FWD_REF(Args) ...args)
 {
+   #if defined(BOOST_CONTAINER_HAS_CXX20_CONSTEXPR)
+   if(BOOST_CONTAINER_IS_CONSTANT_EVALUATED()){
+      ::std::construct_at(p, ::boost::forward<Args>(args)...);
+      return;
+   }
+   #endif
    BOOST_CONTAINER_ASSUME(p != 0);   //elide the new-expression's null check on placement new
    ::new(const_cast<void*>(static_cast<const volatile void*>(p)), boost_container_new_t()) T(::boost::forward<Args>(args)...);
 }
@@ -442,6 +463,20 @@ struct allocator_traits
    inline static void deallocate(Allocator &a, pointer p, size_type n)
    {  a.deallocate(p, n);  }
 
+   //! <b>Returns</b>: <code>a.allocate_at_least(n)</code> (converted to <code>allocation_result</code>)
+   //!   if that call is well-formed; otherwise, <code>{a.allocate(n), n}</code>.
+   //!
+   //! <b>Note</b>: The storage must be deallocated with <code>deallocate(a, ret.ptr, ret.count)</code>.
+   BOOST_CONTAINER_NODISCARD
+   inline static allocation_result<pointer, size_type> allocate_at_least(Allocator &a, size_type n)
+   {
+      const bool value = boost::container::dtl::
+         has_member_function_callable_with_allocate_at_least
+            <Allocator, const size_type>::value;
+      dtl::bool_<value> flag;
+      return allocator_traits::priv_allocate_at_least(flag, a, n);
+   }
+
    //! <b>Effects</b>: calls <code>a.allocate(n, p)</code> if that call is well-formed;
    //! otherwise, invokes <code>a.allocate(n)</code>
    BOOST_CONTAINER_NODISCARD
@@ -457,7 +492,7 @@ struct allocator_traits
    //! <b>Effects</b>: calls <code>a.destroy(p)</code> if that call is well-formed;
    //! otherwise, invokes <code>p->~T()</code>.
    template<class T>
-   inline static void destroy(Allocator &a, T*p) BOOST_NOEXCEPT_OR_NOTHROW
+   inline static BOOST_CONTAINER_CONSTEXPR20 void destroy(Allocator &a, T*p) BOOST_NOEXCEPT_OR_NOTHROW
    {
       typedef T* destroy_pointer;
       const bool value = boost::container::dtl::
@@ -470,7 +505,7 @@ struct allocator_traits
    //! <b>Returns</b>: <code>a.max_size()</code> if that expression is well-formed; otherwise,
    //! <code>numeric_limits<size_type>::max()</code>.
    BOOST_CONTAINER_NODISCARD
-   inline static size_type max_size(const Allocator &a) BOOST_NOEXCEPT_OR_NOTHROW
+   inline static BOOST_CONTAINER_CONSTEXPR20 size_type max_size(const Allocator &a) BOOST_NOEXCEPT_OR_NOTHROW
    {
       const bool value = allocator_traits_detail::has_max_size<Allocator, size_type (Allocator::*)() const>::value;
       dtl::bool_<value> flag;
@@ -479,7 +514,7 @@ struct allocator_traits
 
    //! <b>Returns</b>: <code>a.select_on_container_copy_construction()</code> if that expression is well-formed;
    //! otherwise, a.
-   inline static BOOST_CONTAINER_DOC1ST(Allocator,
+   inline static BOOST_CONTAINER_CONSTEXPR20 BOOST_CONTAINER_DOC1ST(Allocator,
       typename dtl::if_c
          < allocator_traits_detail::has_select_on_container_copy_construction<Allocator BOOST_MOVE_I Allocator (Allocator::*)() const>::value
          BOOST_MOVE_I Allocator BOOST_MOVE_I const Allocator & >::type)
@@ -497,7 +532,7 @@ struct allocator_traits
    //! 
    //! <b>Note</b>: Non-standard extension .
    template <class T>
-   inline static void construct(Allocator & a, T* p, const value_init_t &)
+   inline static BOOST_CONTAINER_CONSTEXPR20 void construct(Allocator & a, T* p, const value_init_t &)
    {  allocator_traits::construct(a, p);  }
 
    #endif
@@ -506,9 +541,9 @@ struct allocator_traits
       //! <b>Effects</b>: calls <code>a.construct(p, std::forward<Args>(args)...)</code> if that call is well-formed;
       //! otherwise, invokes <code>`placement new` (static_cast<void*>(p)) T(std::forward<Args>(args)...)</code>
       template <class T, class ...Args>
-      inline static void construct(Allocator & a, T* p, BOOST_FWD_REF(Args)... args)
+      inline static BOOST_CONTAINER_CONSTEXPR20 void construct(Allocator & a, T* p, BOOST_FWD_REF(Args)... args)
       {
-         BOOST_STATIC_CONSTEXPR bool value = ::boost::move_detail::and_
+         const bool value = ::boost::move_detail::and_
             < dtl::is_not_std_allocator<Allocator>
             , boost::container::dtl::has_member_function_callable_with_construct
                   < Allocator, T*, Args... >
@@ -521,7 +556,7 @@ struct allocator_traits
    #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) && !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
 
       template < class Pair, class KeyType, class ... Args>
-      static typename dtl::enable_if< dtl::is_pair<Pair>, void >::type construct
+      BOOST_CONTAINER_CONSTEXPR20 static typename dtl::enable_if< dtl::is_pair<Pair>, void >::type construct
          (Allocator & a, Pair* p, try_emplace_t, BOOST_FWD_REF(KeyType) k, BOOST_FWD_REF(Args) ...args)
       {
          allocator_traits::construct(a, dtl::addressof(p->first), ::boost::forward<KeyType>(k));
@@ -539,7 +574,7 @@ struct allocator_traits
 
    //! <b>Returns</b>: <code>a.storage_is_unpropagable(p)</code> if is_partially_propagable::value is true; otherwise,
    //! <code>false</code>.
-   inline static bool storage_is_unpropagable(const Allocator &a, pointer p) BOOST_NOEXCEPT_OR_NOTHROW
+   inline static BOOST_CONTAINER_CONSTEXPR20 bool storage_is_unpropagable(const Allocator &a, pointer p) BOOST_NOEXCEPT_OR_NOTHROW
    {
       dtl::bool_<is_partially_propagable::value> flag;
       return allocator_traits::priv_storage_is_unpropagable(flag, a, p);
@@ -547,12 +582,26 @@ struct allocator_traits
 
    //! <b>Returns</b>: <code>true</code> if <code>is_always_equal::value == true</code>, otherwise,
    //! <code>a == b</code>.
-   inline static bool equal(const Allocator &a, const Allocator &b) BOOST_NOEXCEPT_OR_NOTHROW
+   inline static BOOST_CONTAINER_CONSTEXPR20 bool equal(const Allocator &a, const Allocator &b) BOOST_NOEXCEPT_OR_NOTHROW
    {
       dtl::bool_<is_always_equal::value> flag;
       return allocator_traits::priv_equal(flag, a, b);
    }
 
+   //! <b>Effects</b>: calls <code>a.on_relocation(n)</code> if that call is well-formed; otherwise,
+   //!   does nothing. Containers call it when n elements are moved from a buffer to a newly allocated
+   //!   one because the old buffer was too small.
+   //!
+   //! <b>Note</b>: Non-standard extension used to instrument container growth.
+   inline static BOOST_CONTAINER_CONSTEXPR20 void on_relocation(Allocator &a, size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const bool value = boost::container::dtl::
+         has_member_function_callable_with_on_relocation
+            <Allocator, const size_type>::value;
+      dtl::bool_<value> flag;
+      allocator_traits::priv_on_relocation(flag, a, n);
+   }
+
    #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
    private:
    inline static pointer priv_allocate(dtl::true_type, Allocator &a, size_type n, const_void_pointer p)
@@ -561,13 +610,36 @@ struct allocator_traits
    inline static pointer priv_allocate(dtl::false_type, Allocator &a, size_type n, const_void_pointer)
    {  return a.allocate(n);  }
 
+   inline static BOOST_CONTAINER_CONSTEXPR20 void priv_on_relocation(dtl::true_type, Allocator &a, size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {  a.on_relocation(n);  }
+
+   inline static BOOST_CONTAINER_CONSTEXPR20 void priv_on_relocation(dtl::false_type, Allocator &, size_type) BOOST_NOEXCEPT_OR_NOTHROW
+   {}
+
+   inline static allocation_result<pointer, size_type> priv_allocate_at_least(dtl::true_type, Allocator &a, size_type n)
+   {  return allocator_traits::priv_to_allocation_result(a.allocate_at_least(n));  }
+
+   inline static allocation_result<pointer, size_type> priv_allocate_at_least(dtl::false_type, Allocator &a, size_type n)
+   {
+      allocation_result<pointer, size_type> ret = { a.allocate(n), n };
+      return ret;
+   }
+
+   //Accepts any type with "ptr" and "count" members (e.g. std::allocation_result)
+   template<class AllocationResult>
+   inline static allocation_result<pointer, size_type> priv_to_allocation_result(const AllocationResult &r)
+   {
+      allocation_result<pointer, size_type> ret = { pointer(r.ptr), size_type(r.count) };
+      return ret;
+   }
+
    #if defined(BOOST_CONTAINER_GCC_COMPATIBLE_HAS_DIAGNOSTIC_IGNORED)
    #pragma GCC diagnostic push
    #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
    #endif
 
    template<class T>
-   inline static void priv_destroy(dtl::true_type, Allocator &a, T* p) BOOST_NOEXCEPT_OR_NOTHROW
+   inline static BOOST_CONTAINER_CONSTEXPR20 void priv_destroy(dtl::true_type, Allocator &a, T* p) BOOST_NOEXCEPT_OR_NOTHROW
    {  a.destroy(p);  }
 
    #if defined(BOOST_CONTAINER_GCC_COMPATIBLE_HAS_DIAGNOSTIC_IGNORED)
@@ -575,7 +647,7 @@ struct allocator_traits
    #endif
 
    template<class T>
-   inline static void priv_destroy(dtl::false_type, Allocator &, T* p) BOOST_NOEXCEPT_OR_NOTHROW
+   inline static BOOST_CONTAINER_CONSTEXPR20 void priv_destroy(dtl::false_type, Allocator &, T* p) BOOST_NOEXCEPT_OR_NOTHROW
    {  p->~T(); (void)p;  }
 
    #if defined(BOOST_CONTAINER_GCC_COMPATIBLE_HAS_DIAGNOSTIC_IGNORED)
@@ -583,20 +655,20 @@ struct allocator_traits
    #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
    #endif
 
-   inline static size_type priv_max_size(dtl::true_type, const Allocator &a) BOOST_NOEXCEPT_OR_NOTHROW
+   inline static BOOST_CONTAINER_CONSTEXPR20 size_type priv_max_size(dtl::true_type, const Allocator &a) BOOST_NOEXCEPT_OR_NOTHROW
    {  return a.max_size();  }
 
    #if defined(BOOST_CONTAINER_GCC_COMPATIBLE_HAS_DIAGNOSTIC_IGNORED)
    #pragma GCC diagnostic pop
    #endif
 
-   inline static size_type priv_max_size(dtl::false_type, const Allocator &) BOOST_NOEXCEPT_OR_NOTHROW
+   inline static BOOST_CONTAINER_CONSTEXPR20 size_type priv_max_size(dtl::false_type, const Allocator &) BOOST_NOEXCEPT_OR_NOTHROW
    {  return size_type(-1)/sizeof(value_type);  }
 
-   inline static Allocator priv_select_on_container_copy_construction(dtl::true_type, const Allocator &a)
+   inline static BOOST_CONTAINER_CONSTEXPR20 Allocator priv_select_on_container_copy_construction(dtl::true_type, const Allocator &a)
    {  return a.select_on_container_copy_construction();  }
 
-   inline static const Allocator &priv_select_on_container_copy_construction(dtl::false_type, const Allocator &a) BOOST_NOEXCEPT_OR_NOTHROW
+   inline static BOOST_CONTAINER_CONSTEXPR20 const Allocator &priv_select_on_container_copy_construction(dtl::false_type, const Allocator &a) BOOST_NOEXCEPT_OR_NOTHROW
    {  return a;  }
 
 
@@ -607,11 +679,11 @@ struct allocator_traits
 
    #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
       template<class T, class ...Args>
-      inline static void priv_construct(dtl::true_type, Allocator &a, T *p, BOOST_FWD_REF(Args) ...args)
+      inline static BOOST_CONTAINER_CONSTEXPR20 void priv_construct(dtl::true_type, Allocator &a, T *p, BOOST_FWD_REF(Args) ...args)
       {  a.construct( p, ::boost::forward<Args>(args)...);  }
 
       template<class T, class KeyType, class ...Args>
-      inline static typename dtl::enable_if< dtl::is_pair<T>, void >::type
+      inline static BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if< dtl::is_pair<T>, void >::type
          priv_construct(dtl::true_type, Allocator &a, T *p, try_emplace_t, BOOST_FWD_REF(KeyType) k, BOOST_FWD_REF(Args) ...args)
       {
          a.construct(dtl::addressof(p->first), ::boost::forward<KeyType>(k));
@@ -627,7 +699,7 @@ struct allocator_traits
       }
 
       template<class T, class ...Args>
-      inline static void priv_construct(dtl::false_type, Allocator &, T *p, BOOST_FWD_REF(Args) ...args)
+      inline static BOOST_CONTAINER_CONSTEXPR20 void priv_construct(dtl::false_type, Allocator &, T *p, BOOST_FWD_REF(Args) ...args)
       {  dtl::construct_type(p, ::boost::forward<Args>(args)...); }
    #else // #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
       public:
@@ -694,23 +766,40 @@ struct allocator_traits
 
 
    template<class T>
-   inline static void priv_construct(dtl::false_type, Allocator &, T *p, const ::boost::container::default_init_t&)
-   {  ::new((void*)p, boost_container_new_t()) T; }
+   inline static BOOST_CONTAINER_CONSTEXPR20 void priv_construct(dtl::false_type, Allocator &, T *p, const ::boost::container::default_init_t&)
+   {
+      #if defined(BOOST_CONTAINER_HAS_CXX20_CONSTEXPR)
+      //Constant expressions can't hold indeterminate values
+      if(BOOST_CONTAINER_IS_CONSTANT_EVALUATED()){
+         ::std::construct_at(p);
+         return;
+      }
+      #endif
+      ::new((void*)p, boost_container_new_t()) T;
+   }
 
    template<class T>
-   inline static void priv_construct(dtl::false_type, Allocator &, T *p, const ::boost::container::value_init_t&)
-   {  ::new((void*)p, boost_container_new_t()) T(); }
+   inline static BOOST_CONTAINER_CONSTEXPR20 void priv_construct(dtl::false_type, Allocator &, T *p, const ::boost::container::value_init_t&)
+   {
+      #if defined(BOOST_CONTAINER_HAS_CXX20_CONSTEXPR)
+      if(BOOST_CONTAINER_IS_CONSTANT_EVALUATED()){
+         ::std::construct_at(p);
+         return;
+      }
+      #endif
+      ::new((void*)p, boost_container_new_t()) T();
+   }
 
-   inline static bool priv_storage_is_unpropagable(dtl::true_type, const Allocator &a, pointer p)
+   inline static BOOST_CONTAINER_CONSTEXPR20 bool priv_storage_is_unpropagable(dtl::true_type, const Allocator &a, pointer p)
    {  return a.storage_is_unpropagable(p);  }
 
-   inline static bool priv_storage_is_unpropagable(dtl::false_type, const Allocator &, pointer)
+   inline static BOOST_CONTAINER_CONSTEXPR20 bool priv_storage_is_unpropagable(dtl::false_type, const Allocator &, pointer)
    {  return false;  }
 
-   inline static bool priv_equal(dtl::true_type,  const Allocator &, const Allocator &)
+   inline static BOOST_CONTAINER_CONSTEXPR20 bool priv_equal(dtl::true_type,  const Allocator &, const Allocator &)
    {  return true;  }
 
-   inline static bool priv_equal(dtl::false_type, const Allocator &a, const Allocator &b)
+   inline static BOOST_CONTAINER_CONSTEXPR20 bool priv_equal(dtl::false_type, const Allocator &a, const Allocator &b)
    {  return a == b;  }
 
    #endif   //#if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
@@ -730,6 +819,29 @@ struct real_allocator<T, void>
    typedef new_allocator<T> type;
 };
 
+namespace dtl {
+
+//Allocates at least n (n <= max) elements and updates n with the number of elements the storage
+//can hold. Storage must be deallocated with the received count, so if it's bigger than max (e.g.
+//it's not representable by the container's stored_size_type) the storage is returned and
+//exactly n elements are allocated.
+template<class Allocator>
+typename allocator_traits<Allocator>::pointer allocate_at_least_up_to
+   (Allocator &a, typename allocator_traits<Allocator>::size_type &n, typename allocator_traits<Allocator>::size_type max)
+{
+   typedef allocator_traits<Allocator> traits_t;
+   const allocation_result<typename traits_t::pointer, typename traits_t::size_type>
+      r = traits_t::allocate_at_least(a, n);
+   if (BOOST_UNLIKELY(r.count > max)) {
+      traits_t::deallocate(a, r.ptr, r.count);
+      return traits_t::allocate(a, n);
+   }
+   n = r.count;
+   return r.ptr;
+}
+
+}  //namespace dtl {
+
 #endif   //#if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
 
 }  //namespace container {
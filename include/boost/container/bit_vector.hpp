@@ -0,0 +1,1078 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_BIT_VECTOR_HPP
+#define BOOST_CONTAINER_BIT_VECTOR_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/new_allocator.hpp>
+#include <boost/container/options.hpp>
+#include <boost/container/small_vector.hpp>
+#include <boost/container/throw_exception.hpp>
+#include <boost/container/vector.hpp>
+// container/detail
+#include <boost/container/detail/bit_algo.hpp>
+#include <boost/container/detail/iterators.hpp>
+#include <boost/container/detail/min_max.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// move
+#include <boost/move/adl_move_swap.hpp>
+#include <boost/move/utility_core.hpp>
+#include <boost/move/detail/to_raw_pointer.hpp>
+// other
+#include <boost/assert.hpp>
+// std
+#include <cstddef>
+#include <iterator>
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+#include <initializer_list>   //for std::initializer_list
+#endif
+
+namespace boost {
+namespace container {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace dtl {
+
+template<class Options, class SizeType>
+struct bit_vector_stored_size
+{
+   typedef typename default_if_void<typename Options::stored_size_type, SizeType>::type type;
+};
+
+template<class SizeType>
+struct bit_vector_stored_size<void, SizeType>
+{
+   typedef SizeType type;
+};
+
+//Proxy returned by non-const bit_vector accesses
+class bit_reference
+{
+   public:
+   bit_reference(bit_block_t *block, bit_block_t mask) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_block(block), m_mask(mask)
+   {}
+
+   operator bool() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return (*m_block & m_mask) != 0u;  }
+
+   bool operator~() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return (*m_block & m_mask) == 0u;  }
+
+   bit_reference& operator=(bool x) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(x) *m_block |= m_mask;
+      else  *m_block &= ~m_mask;
+      return *this;
+   }
+
+   bit_reference& operator=(const bit_reference &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return *this = bool(x);  }
+
+   bit_reference& operator|=(bool x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  if(x) *m_block |= m_mask;  return *this;  }
+
+   bit_reference& operator&=(bool x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  if(!x) *m_block &= ~m_mask;  return *this;  }
+
+   bit_reference& operator^=(bool x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  if(x) *m_block ^= m_mask;  return *this;  }
+
+   bit_reference& flip() BOOST_NOEXCEPT_OR_NOTHROW
+   {  *m_block ^= m_mask;  return *this;  }
+
+   private:
+   bit_block_t *m_block;
+   bit_block_t m_mask;
+};
+
+template<bool IsConst>
+class bit_iterator
+{
+   typedef typename if_c<IsConst, const bit_block_t*, bit_block_t*>::type block_ptr;
+
+   public:
+   typedef std::random_access_iterator_tag                           iterator_category;
+   typedef bool                                                      value_type;
+   typedef std::ptrdiff_t                                            difference_type;
+   typedef void                                                      pointer;
+   typedef typename if_c<IsConst, bool, bit_reference>::type         reference;
+
+   bit_iterator() BOOST_NOEXCEPT_OR_NOTHROW
+      : m_blocks(), m_pos()
+   {}
+
+   bit_iterator(block_ptr blocks, std::size_t pos) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_blocks(blocks), m_pos(pos)
+   {}
+
+   //Conversion from iterator to const_iterator
+   bit_iterator(const bit_iterator<false> &other) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_blocks(other.blocks()), m_pos(other.pos())
+   {}
+
+   reference operator*() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      return priv_deref
+         ( m_blocks + m_pos/bits_per_bit_block
+         , bit_block_t(bit_block_t(1u) << (m_pos % bits_per_bit_block)));
+   }
+
+   reference operator[](difference_type n) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return *(*this + n);  }
+
+   bit_iterator& operator++() BOOST_NOEXCEPT_OR_NOTHROW
+   {  ++m_pos;  return *this;  }
+
+   bit_iterator operator++(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {  bit_iterator tmp(*this);  ++m_pos;  return tmp;  }
+
+   bit_iterator& operator--() BOOST_NOEXCEPT_OR_NOTHROW
+   {  --m_pos;  return *this;  }
+
+   bit_iterator operator--(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {  bit_iterator tmp(*this);  --m_pos;  return tmp;  }
+
+   bit_iterator& operator+=(difference_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {  m_pos = std::size_t(difference_type(m_pos) + n);  return *this;  }
+
+   bit_iterator& operator-=(difference_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return *this += -n;  }
+
+   friend bit_iterator operator+(bit_iterator it, difference_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return it += n;  }
+
+   friend bit_iterator operator+(difference_type n, bit_iterator it) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return it += n;  }
+
+   friend bit_iterator operator-(bit_iterator it, difference_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return it -= n;  }
+
+   friend difference_type operator-(const bit_iterator &a, const bit_iterator &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return difference_type(a.m_pos) - difference_type(b.m_pos);  }
+
+   friend bool operator==(const bit_iterator &a, const bit_iterator &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return a.m_pos == b.m_pos;  }
+
+   friend bool operator!=(const bit_iterator &a, const bit_iterator &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return a.m_pos != b.m_pos;  }
+
+   friend bool operator<(const bit_iterator &a, const bit_iterator &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return a.m_pos < b.m_pos;  }
+
+   friend bool operator>(const bit_iterator &a, const bit_iterator &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return a.m_pos > b.m_pos;  }
+
+   friend bool operator<=(const bit_iterator &a, const bit_iterator &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return a.m_pos <= b.m_pos;  }
+
+   friend bool operator>=(const bit_iterator &a, const bit_iterator &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return a.m_pos >= b.m_pos;  }
+
+   block_ptr blocks() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_blocks;  }
+
+   std::size_t pos() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_pos;  }
+
+   private:
+   static bit_reference priv_deref(bit_block_t *block, bit_block_t mask) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return bit_reference(block, mask);  }
+
+   static bool priv_deref(const bit_block_t *block, bit_block_t mask) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return (*block & mask) != 0u;  }
+
+   block_ptr m_blocks;
+   std::size_t m_pos;
+};
+
+}  //namespace dtl {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! bit_vector_base is the common implementation of bit_vector and small_bit_vector.
+//! It stores bits packed in 64 bit blocks held by BlockContainer.
+//!
+//! Bits beyond size() in the last block are always zero, so bulk operations (count, find_first,
+//! bitwise operators) work on whole blocks. They are vectorized with SSE2/SSSE3 when available.
+//!
+//! \tparam BlockContainer The vector-like container of blocks (vector or small_vector)
+//! \tparam StoredSizeType The unsigned integer type used to store the number of bits
+template<class BlockContainer, class StoredSizeType>
+class bit_vector_base
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   BOOST_COPYABLE_AND_MOVABLE(bit_vector_base)
+
+   template<class BC, class SST>
+   friend class bit_vector_base;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+   typedef BlockContainer                                                  block_container_type;
+   typedef typename BlockContainer::value_type                             block_type;
+   typedef bool                                                            value_type;
+   typedef typename BlockContainer::allocator_type                         allocator_type;
+   typedef typename BlockContainer::size_type                              size_type;
+   typedef typename BlockContainer::difference_type                        difference_type;
+   typedef StoredSizeType                                                  stored_size_type;
+   typedef BOOST_CONTAINER_IMPDEF(dtl::bit_reference)                      reference;
+   typedef bool                                                            const_reference;
+   typedef BOOST_CONTAINER_IMPDEF(dtl::bit_iterator<false>)                iterator;
+   typedef BOOST_CONTAINER_IMPDEF(dtl::bit_iterator<true>)                 const_iterator;
+   typedef BOOST_CONTAINER_IMPDEF(boost::container::reverse_iterator<iterator>)        reverse_iterator;
+   typedef BOOST_CONTAINER_IMPDEF(boost::container::reverse_iterator<const_iterator>)  const_reverse_iterator;
+
+   //! Number of bits stored in each block
+   BOOST_STATIC_CONSTEXPR size_type bits_per_block = dtl::bits_per_bit_block;
+
+   //! Value returned by find_first and find_next when no set bit is found
+   BOOST_STATIC_CONSTEXPR size_type npos = size_type(-1);
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   BOOST_CONTAINER_STATIC_ASSERT((dtl::is_same<block_type, dtl::bit_block_t>::value));
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   protected:
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   bit_vector_base()
+      : m_blocks(), m_size(0u)
+   {}
+
+   explicit bit_vector_base(const allocator_type &a)
+      : m_blocks(a), m_size(0u)
+   {}
+
+   bit_vector_base(const bit_vector_base &x)
+      : m_blocks(x.m_blocks), m_size(x.m_size)
+   {}
+
+   bit_vector_base(const bit_vector_base &x, const allocator_type &a)
+      : m_blocks(x.m_blocks, a), m_size(x.m_size)
+   {}
+
+   bit_vector_base(BOOST_RV_REF(bit_vector_base) x)
+      : m_blocks(boost::move(x.m_blocks)), m_size(x.m_size)
+   {
+      x.m_blocks.clear();
+      x.m_size = 0u;
+   }
+
+   bit_vector_base(BOOST_RV_REF(bit_vector_base) x, const allocator_type &a)
+      : m_blocks(boost::move(x.m_blocks), a), m_size(x.m_size)
+   {
+      x.m_blocks.clear();
+      x.m_size = 0u;
+   }
+
+   bit_vector_base& operator=(BOOST_COPY_ASSIGN_REF(bit_vector_base) x)
+   {
+      m_blocks = x.m_blocks;
+      m_size = x.m_size;
+      return *this;
+   }
+
+   bit_vector_base& operator=(BOOST_RV_REF(bit_vector_base) x)
+   {
+      if(this != &x){
+         m_blocks = boost::move(x.m_blocks);
+         m_size = x.m_size;
+         x.m_blocks.clear();
+         x.m_size = 0u;
+      }
+      return *this;
+   }
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //          iterators and capacity
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns a copy of the internal allocator.
+   //!
+   //! <b>Throws</b>: If allocator's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD allocator_type get_allocator() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_blocks.get_allocator();  }
+
+   //! <b>Effects</b>: Returns an iterator to the first bit.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD iterator begin() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return iterator(this->priv_blocks(), 0u);  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first bit.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD const_iterator begin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_iterator(this->priv_blocks(), 0u);  }
+
+   //! <b>Effects</b>: Returns an iterator to the end of the bit_vector.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD iterator end() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return iterator(this->priv_blocks(), m_size);  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the bit_vector.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD const_iterator end() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_iterator(this->priv_blocks(), m_size);  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first bit.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD const_iterator cbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->begin();  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the bit_vector.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD const_iterator cend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->end();  }
+
+   //! <b>Effects</b>: Returns a reverse_iterator to the last bit.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD reverse_iterator rbegin() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return reverse_iterator(this->end());  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator to the last bit.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD const_reverse_iterator rbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_reverse_iterator(this->end());  }
+
+   //! <b>Effects</b>: Returns a reverse_iterator to the end of the reversed bit_vector.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD reverse_iterator rend() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return reverse_iterator(this->begin());  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator to the end of the reversed bit_vector.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD const_reverse_iterator rend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_reverse_iterator(this->begin());  }
+
+   //! <b>Effects</b>: Returns true if the bit_vector contains no bits.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD bool empty() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !m_size;  }
+
+   //! <b>Effects</b>: Returns the number of bits.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD size_type size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_size;  }
+
+   //! <b>Effects</b>: Returns the number of bits that can be held without reallocating.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD size_type capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return dtl::min_value<size_type>(this->max_size(), size_type(m_blocks.capacity()*bits_per_block));  }
+
+   //! <b>Effects</b>: Returns the largest possible number of bits, limited by the allocator
+   //!   and the stored_size type.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD size_type max_size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const size_type max_blocks = m_blocks.max_size();
+      const size_type max_bits = max_blocks > size_type(size_type(-1)/bits_per_block)
+         ? size_type(-1) : size_type(max_blocks*bits_per_block);
+      return dtl::min_value<size_type>(max_bits, size_type(stored_size_type(-1)));
+   }
+
+   //! <b>Returns</b>: The number of blocks used to store the bits.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD size_type num_blocks() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_blocks.size();  }
+
+   //! <b>Returns</b>: A pointer to the first block. Bit i is stored in bit (i % bits_per_block)
+   //!   of block (i / bits_per_block). Unused bits of the last block are zero.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD const block_type *data() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->priv_blocks();  }
+
+   //! <b>Effects</b>: If n is greater than capacity(), allocates storage for at least n bits.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or n > max_size().
+   void reserve(size_type n)
+   {
+      this->priv_check_size(n);
+      m_blocks.reserve(priv_num_blocks(n));
+   }
+
+   //! <b>Effects</b>: Tries to deallocate the excess of memory created with previous allocations.
+   //!
+   //! <b>Throws</b>: If memory allocation throws.
+   void shrink_to_fit()
+   {  m_blocks.shrink_to_fit();  }
+
+   //! <b>Effects</b>: Inserts or erases bits at the end such that the size becomes n.
+   //!   New bits are set to value.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or n > max_size().
+   //!
+   //! <b>Complexity</b>: Linear to the difference between size() and n.
+   void resize(size_type n, bool value = false)
+   {
+      this->priv_check_size(n);
+      const size_type old_size = m_size;
+      const size_type old_blocks = m_blocks.size();
+      //Blocks are allocated first so that no bit is modified if allocation throws
+      m_blocks.resize(priv_num_blocks(n), value ? ~block_type(0u) : block_type(0u));
+      if(n > old_size && value && (old_size % bits_per_block)){
+         m_blocks[old_blocks - 1u] |= ~block_type(0u) << (old_size % bits_per_block);
+      }
+      m_size = stored_size_type(n);
+      this->priv_clear_unused_bits();
+   }
+
+   //! <b>Effects</b>: Erases all bits. Does not free memory.
+   //!
+   //! <b>Complexity</b>: Constant.
+   void clear() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      m_blocks.clear();
+      m_size = 0u;
+   }
+
+   //! <b>Effects</b>: Assigns n bits set to value.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or n > max_size().
+   void assign(size_type n, bool value)
+   {
+      this->clear();
+      this->resize(n, value);
+   }
+
+   //! <b>Effects</b>: Assigns the bits in the range [first, last).
+   //!
+   //! <b>Throws</b>: If memory allocation throws or the range is longer than max_size().
+   template<class InIt>
+   void assign(InIt first, InIt last
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename dtl::disable_if_convertible<InIt BOOST_MOVE_I size_type>::type * = 0)
+      )
+   {
+      this->clear();
+      for(; first != last; ++first){
+         this->push_back(bool(*first));
+      }
+   }
+
+   //! <b>Effects</b>: Appends a bit set to value.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or size() == max_size().
+   //!
+   //! <b>Complexity</b>: Amortized constant time.
+   void push_back(bool value)
+   {
+      const size_type sz = m_size;
+      if(!(sz % bits_per_block)){
+         this->priv_check_size(size_type(sz + 1u));
+         m_blocks.push_back(block_type(0u));
+      }
+      else if(sz == size_type(stored_size_type(-1))){
+         //The bit fits in the last block, but not in the stored size
+         throw_length_error("bit_vector: max_size() exceeded");
+      }
+      if(value){
+         m_blocks.back() |= block_type(1u) << (sz % bits_per_block);
+      }
+      m_size = stored_size_type(sz + 1u);
+   }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Removes the last bit.
+   //!
+   //! <b>Complexity</b>: Constant.
+   void pop_back() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      const size_type sz = size_type(m_size - 1u);
+      m_size = stored_size_type(sz);
+      if(!(sz % bits_per_block)){
+         m_blocks.pop_back();
+      }
+      else{
+         this->priv_clear_unused_bits();
+      }
+   }
+
+   //////////////////////////////////////////////
+   //
+   //               element access
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Requires</b>: pos < size()
+   //!
+   //! <b>Returns</b>: A proxy reference to the bit at position pos.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD reference operator[](size_type pos) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(pos < m_size);
+      return reference(this->priv_blocks() + pos/bits_per_block, priv_mask(pos));
+   }
+
+   //! <b>Requires</b>: pos < size()
+   //!
+   //! <b>Returns</b>: The value of the bit at position pos.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD bool operator[](size_type pos) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(pos < m_size);
+      return (this->priv_blocks()[pos/bits_per_block] & priv_mask(pos)) != 0u;
+   }
+
+   //! <b>Returns</b>: The value of the bit at position pos.
+   //!
+   //! <b>Throws</b>: out_of_range if pos >= size().
+   BOOST_CONTAINER_NODISCARD bool test(size_type pos) const
+   {
+      if(pos >= m_size)
+         throw_out_of_range("bit_vector::test out of range");
+      return (*this)[pos];
+   }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Returns</b>: A proxy reference to the first bit.
+   BOOST_CONTAINER_NODISCARD reference front() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return (*this)[0u];  }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Returns</b>: The value of the first bit.
+   BOOST_CONTAINER_NODISCARD bool front() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return (*this)[0u];  }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Returns</b>: A proxy reference to the last bit.
+   BOOST_CONTAINER_NODISCARD reference back() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return (*this)[size_type(m_size - 1u)];  }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Returns</b>: The value of the last bit.
+   BOOST_CONTAINER_NODISCARD bool back() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return (*this)[size_type(m_size - 1u)];  }
+
+   //////////////////////////////////////////////
+   //
+   //              bit operations
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Sets all bits.
+   //!
+   //! <b>Complexity</b>: Linear to num_blocks().
+   bit_vector_base& set() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      block_type *const p = this->priv_blocks();
+      for(size_type i = 0u, n = this->num_blocks(); i != n; ++i){
+         p[i] = ~block_type(0u);
+      }
+      this->priv_clear_unused_bits();
+      return *this;
+   }
+
+   //! <b>Requires</b>: pos < size()
+   //!
+   //! <b>Effects</b>: Sets the bit at position pos to value.
+   bit_vector_base& set(size_type pos, bool value = true) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      (*this)[pos] = value;
+      return *this;
+   }
+
+   //! <b>Effects</b>: Clears all bits.
+   //!
+   //! <b>Complexity</b>: Linear to num_blocks().
+   bit_vector_base& reset() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      block_type *const p = this->priv_blocks();
+      for(size_type i = 0u, n = this->num_blocks(); i != n; ++i){
+         p[i] = block_type(0u);
+      }
+      return *this;
+   }
+
+   //! <b>Requires</b>: pos < size()
+   //!
+   //! <b>Effects</b>: Clears the bit at position pos.
+   bit_vector_base& reset(size_type pos) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      (*this)[pos] = false;
+      return *this;
+   }
+
+   //! <b>Effects</b>: Toggles all bits.
+   //!
+   //! <b>Complexity</b>: Linear to num_blocks().
+   bit_vector_base& flip() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      dtl::bit_flip_blocks(this->priv_blocks(), this->num_blocks());
+      this->priv_clear_unused_bits();
+      return *this;
+   }
+
+   //! <b>Requires</b>: pos < size()
+   //!
+   //! <b>Effects</b>: Toggles the bit at position pos.
+   bit_vector_base& flip(size_type pos) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      (*this)[pos].flip();
+      return *this;
+   }
+
+   //! <b>Returns</b>: The number of set bits.
+   //!
+   //! <b>Complexity</b>: Linear to num_blocks().
+   BOOST_CONTAINER_NODISCARD size_type count() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return size_type(dtl::bit_count_blocks(this->priv_blocks(), this->num_blocks()));  }
+
+   //! <b>Returns</b>: true if any bit is set.
+   //!
+   //! <b>Complexity</b>: Linear to num_blocks().
+   BOOST_CONTAINER_NODISCARD bool any() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return dtl::bit_find_block_not_filled(this->priv_blocks(), 0u, this->num_blocks(), false) != this->num_blocks();  }
+
+   //! <b>Returns</b>: true if no bit is set.
+   //!
+   //! <b>Complexity</b>: Linear to num_blocks().
+   BOOST_CONTAINER_NODISCARD bool none() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !this->any();  }
+
+   //! <b>Returns</b>: true if all bits are set (also if the bit_vector is empty).
+   //!
+   //! <b>Complexity</b>: Linear to num_blocks().
+   BOOST_CONTAINER_NODISCARD bool all() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const size_type full_blocks = size_type(m_size/bits_per_block);
+      if(dtl::bit_find_block_not_filled(this->priv_blocks(), 0u, full_blocks, true) != full_blocks)
+         return false;
+      const size_type tail = size_type(m_size % bits_per_block);
+      return !tail || this->priv_blocks()[full_blocks] == ((block_type(1u) << tail) - 1u);
+   }
+
+   //! <b>Returns</b>: The position of the first set bit or npos if no bit is set.
+   //!
+   //! <b>Complexity</b>: Linear to num_blocks().
+   BOOST_CONTAINER_NODISCARD size_type find_first() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->priv_find_from_block(0u);  }
+
+   //! <b>Returns</b>: The position of the first set bit after pos or npos if there is none.
+   //!
+   //! <b>Complexity</b>: Linear to num_blocks().
+   BOOST_CONTAINER_NODISCARD size_type find_next(size_type pos) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(pos >= m_size || ++pos == m_size)
+         return npos;
+      const size_type blk = size_type(pos/bits_per_block);
+      const block_type b = this->priv_blocks()[blk] & (~block_type(0u) << (pos % bits_per_block));
+      if(b)
+         return size_type(blk*bits_per_block + size_type(dtl::unchecked_countr_zero(b)));
+      return this->priv_find_from_block(size_type(blk + 1u));
+   }
+
+   //! <b>Requires</b>: x.size() == size()
+   //!
+   //! <b>Effects</b>: Bitwise AND of *this and x.
+   //!
+   //! <b>Complexity</b>: Linear to num_blocks().
+   template<class BC, class SST>
+   bit_vector_base& operator&=(const bit_vector_base<BC, SST> &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->priv_transform(x, dtl::bit_and_op());  }
+
+   //! <b>Requires</b>: x.size() == size()
+   //!
+   //! <b>Effects</b>: Bitwise OR of *this and x.
+   //!
+   //! <b>Complexity</b>: Linear to num_blocks().
+   template<class BC, class SST>
+   bit_vector_base& operator|=(const bit_vector_base<BC, SST> &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->priv_transform(x, dtl::bit_or_op());  }
+
+   //! <b>Requires</b>: x.size() == size()
+   //!
+   //! <b>Effects</b>: Bitwise XOR of *this and x.
+   //!
+   //! <b>Complexity</b>: Linear to num_blocks().
+   template<class BC, class SST>
+   bit_vector_base& operator^=(const bit_vector_base<BC, SST> &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->priv_transform(x, dtl::bit_xor_op());  }
+
+   //! <b>Requires</b>: x.size() == size()
+   //!
+   //! <b>Effects</b>: Clears the bits of *this that are set in x (set difference).
+   //!
+   //! <b>Complexity</b>: Linear to num_blocks().
+   template<class BC, class SST>
+   bit_vector_base& operator-=(const bit_vector_base<BC, SST> &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->priv_transform(x, dtl::bit_and_not_op());  }
+
+   //! <b>Effects</b>: Swaps the contents of *this and x.
+   //!
+   //! <b>Complexity</b>: Constant for bit_vector.
+   void swap(bit_vector_base &x)
+   {
+      m_blocks.swap(x.m_blocks);
+      boost::adl_move_swap(m_size, x.m_size);
+   }
+
+   //! <b>Returns</b>: true if x and y have the same size and bits.
+   //!
+   //! <b>Complexity</b>: Linear to num_blocks().
+   BOOST_CONTAINER_NODISCARD friend bool operator==(const bit_vector_base &x, const bit_vector_base &y) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return x.m_size == y.m_size && x.m_blocks == y.m_blocks;  }
+
+   //! <b>Returns</b>: !(x == y)
+   BOOST_CONTAINER_NODISCARD friend bool operator!=(const bit_vector_base &x, const bit_vector_base &y) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !(x == y);  }
+
+   //! <b>Effects</b>: x.swap(y)
+   friend void swap(bit_vector_base &x, bit_vector_base &y)
+   {  x.swap(y);  }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   static size_type priv_num_blocks(size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return size_type(n/bits_per_block + size_type((n % bits_per_block) != 0u));  }
+
+   static block_type priv_mask(size_type pos) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return block_type(block_type(1u) << (pos % bits_per_block));  }
+
+   block_type *priv_blocks() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return boost::movelib::to_raw_pointer(m_blocks.data());  }
+
+   const block_type *priv_blocks() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return boost::movelib::to_raw_pointer(m_blocks.data());  }
+
+   void priv_check_size(size_type n) const
+   {
+      if(n > this->max_size())
+         throw_length_error("bit_vector: max_size() exceeded");
+   }
+
+   void priv_clear_unused_bits() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const size_type tail = size_type(m_size % bits_per_block);
+      if(tail){
+         m_blocks.back() &= (block_type(1u) << tail) - 1u;
+      }
+   }
+
+   size_type priv_find_from_block(size_type blk) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const block_type *const p = this->priv_blocks();
+      const size_type n = this->num_blocks();
+      blk = size_type(dtl::bit_find_block_not_filled(p, blk, n, false));
+      return blk == n ? npos : size_type(blk*bits_per_block + size_type(dtl::unchecked_countr_zero(p[blk])));
+   }
+
+   template<class BC, class SST, class Op>
+   bit_vector_base& priv_transform(const bit_vector_base<BC, SST> &x, Op op) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(x.size() == this->size());
+      dtl::bit_transform_blocks(this->priv_blocks(), x.priv_blocks(), this->num_blocks(), op);
+      return *this;
+   }
+
+   protected:
+   BlockContainer    m_blocks;
+   stored_size_type  m_size;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace dtl {
+
+template<class Allocator>
+struct bit_vector_block_allocator
+{
+   typedef typename allocator_traits<typename real_allocator<bit_block_t, Allocator>::type>
+      ::template portable_rebind_alloc<bit_block_t>::type type;
+};
+
+template<class Allocator, class Options>
+struct bit_vector_types
+{
+   typedef typename bit_vector_block_allocator<Allocator>::type               block_allocator;
+   typedef vector<bit_block_t, block_allocator, Options>                     block_container;
+   typedef typename bit_vector_stored_size
+      <Options, typename block_container::size_type>::type                   stored_size_type;
+   typedef bit_vector_base<block_container, stored_size_type>                base;
+};
+
+template<std::size_t N, class Allocator, class Options>
+struct small_bit_vector_types
+{
+   typedef typename bit_vector_block_allocator<Allocator>::type               block_allocator;
+   typedef small_vector
+      < bit_block_t, (N + bits_per_bit_block - 1u)/bits_per_bit_block
+      , block_allocator, Options>                                            block_container;
+   typedef typename bit_vector_stored_size
+      <Options, typename block_container::size_type>::type                   stored_size_type;
+   typedef bit_vector_base<block_container, stored_size_type>                base;
+};
+
+}  //namespace dtl {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A dynamically sized sequence of bits packed in 64 bit blocks (a dynamic bitset),
+//! that uses 1 bit per element instead of the byte used by `vector<bool>`.
+//!
+//! Bulk operations (count, any/none/all, find_first/find_next and the bitwise operators)
+//! process whole blocks and are vectorized with SSE2/SSSE3 when the target supports them.
+//!
+//! \tparam Allocator An allocator, rebound to allocate blocks. If void, new_allocator is used.
+//! \tparam Options A type produced from \c boost::container::vector_options (growth_factor
+//!   and stored_size are supported). The stored_size type limits both the number of blocks
+//!   and the number of bits.
+template<class Allocator BOOST_CONTAINER_DOCONLY(= void), class Options BOOST_CONTAINER_DOCONLY(= void)>
+class bit_vector
+   : public dtl::bit_vector_types<Allocator, Options>::base
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   BOOST_COPYABLE_AND_MOVABLE(bit_vector)
+   typedef typename dtl::bit_vector_types<Allocator, Options>::base   base_t;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   typedef typename base_t::allocator_type   allocator_type;
+   typedef typename base_t::size_type        size_type;
+
+   //! <b>Effects</b>: Constructs an empty bit_vector.
+   bit_vector() BOOST_NOEXCEPT_IF(dtl::is_nothrow_default_constructible<allocator_type>::value)
+      : base_t()
+   {}
+
+   //! <b>Effects</b>: Constructs an empty bit_vector using the specified allocator.
+   explicit bit_vector(const allocator_type &a) BOOST_NOEXCEPT_OR_NOTHROW
+      : base_t(a)
+   {}
+
+   //! <b>Effects</b>: Constructs a bit_vector with n bits set to value.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or n > max_size().
+   explicit bit_vector(size_type n, bool value = false)
+      : base_t()
+   {  this->resize(n, value);  }
+
+   //! <b>Effects</b>: Constructs a bit_vector with n bits set to value using the specified allocator.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or n > max_size().
+   bit_vector(size_type n, bool value, const allocator_type &a)
+      : base_t(a)
+   {  this->resize(n, value);  }
+
+   //! <b>Effects</b>: Constructs a bit_vector with the bits of the range [first, last).
+   template<class InIt>
+   bit_vector(InIt first, InIt last
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename dtl::disable_if_convertible<InIt BOOST_MOVE_I size_type>::type * = 0)
+      )
+      : base_t()
+   {  this->assign(first, last);  }
+
+   //! <b>Effects</b>: Constructs a bit_vector with the bits of the range [first, last)
+   //!   using the specified allocator.
+   template<class InIt>
+   bit_vector(InIt first, InIt last, const allocator_type &a
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename dtl::disable_if_convertible<InIt BOOST_MOVE_I size_type>::type * = 0)
+      )
+      : base_t(a)
+   {  this->assign(first, last);  }
+
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Constructs a bit_vector with the bits of il.
+   bit_vector(std::initializer_list<bool> il, const allocator_type &a = allocator_type())
+      : base_t(a)
+   {  this->assign(il.begin(), il.end());  }
+   #endif
+
+   //! <b>Effects</b>: Copy constructs a bit_vector.
+   bit_vector(const bit_vector &x)
+      : base_t(static_cast<const base_t&>(x))
+   {}
+
+   //! <b>Effects</b>: Copy constructs a bit_vector using the specified allocator.
+   bit_vector(const bit_vector &x, const allocator_type &a)
+      : base_t(static_cast<const base_t&>(x), a)
+   {}
+
+   //! <b>Effects</b>: Move constructs a bit_vector. x is left empty.
+   //!
+   //! <b>Complexity</b>: Constant.
+   bit_vector(BOOST_RV_REF(bit_vector) x) BOOST_NOEXCEPT_OR_NOTHROW
+      : base_t(BOOST_MOVE_BASE(base_t, x))
+   {}
+
+   //! <b>Effects</b>: Move constructs a bit_vector using the specified allocator. x is left empty.
+   bit_vector(BOOST_RV_REF(bit_vector) x, const allocator_type &a)
+      : base_t(BOOST_MOVE_BASE(base_t, x), a)
+   {}
+
+   //! <b>Effects</b>: Copy assignment.
+   bit_vector& operator=(BOOST_COPY_ASSIGN_REF(bit_vector) x)
+   {  return static_cast<bit_vector&>(this->base_t::operator=(static_cast<const base_t&>(x)));  }
+
+   //! <b>Effects</b>: Move assignment. x is left empty.
+   bit_vector& operator=(BOOST_RV_REF(bit_vector) x)
+   {  return static_cast<bit_vector&>(this->base_t::operator=(BOOST_MOVE_BASE(base_t, x)));  }
+
+   //! <b>Returns</b>: A copy of x with all bits toggled.
+   BOOST_CONTAINER_NODISCARD friend bit_vector operator~(const bit_vector &x)
+   {  bit_vector r(x);  r.flip();  return boost::move(r);  }
+
+   //! <b>Requires</b>: x.size() == y.size()
+   //!
+   //! <b>Returns</b>: The bitwise AND of x and y.
+   BOOST_CONTAINER_NODISCARD friend bit_vector operator&(const bit_vector &x, const bit_vector &y)
+   {  bit_vector r(x);  r &= y;  return boost::move(r);  }
+
+   //! <b>Requires</b>: x.size() == y.size()
+   //!
+   //! <b>Returns</b>: The bitwise OR of x and y.
+   BOOST_CONTAINER_NODISCARD friend bit_vector operator|(const bit_vector &x, const bit_vector &y)
+   {  bit_vector r(x);  r |= y;  return boost::move(r);  }
+
+   //! <b>Requires</b>: x.size() == y.size()
+   //!
+   //! <b>Returns</b>: The bitwise XOR of x and y.
+   BOOST_CONTAINER_NODISCARD friend bit_vector operator^(const bit_vector &x, const bit_vector &y)
+   {  bit_vector r(x);  r ^= y;  return boost::move(r);  }
+
+   //! <b>Requires</b>: x.size() == y.size()
+   //!
+   //! <b>Returns</b>: The bits of x that are not set in y.
+   BOOST_CONTAINER_NODISCARD friend bit_vector operator-(const bit_vector &x, const bit_vector &y)
+   {  bit_vector r(x);  r -= y;  return boost::move(r);  }
+};
+
+//! A bit_vector that stores up to N bits inside the object, like small_vector,
+//! and allocates blocks dynamically only when more bits are needed.
+//!
+//! \tparam N The number of bits that can be stored without allocating (rounded up to whole blocks)
+//! \tparam Allocator An allocator, rebound to allocate blocks. If void, new_allocator is used.
+//! \tparam Options A type produced from \c boost::container::small_vector_options.
+template<std::size_t N, class Allocator BOOST_CONTAINER_DOCONLY(= void), class Options BOOST_CONTAINER_DOCONLY(= void)>
+class small_bit_vector
+   : public dtl::small_bit_vector_types<N, Allocator, Options>::base
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   BOOST_COPYABLE_AND_MOVABLE(small_bit_vector)
+   typedef typename dtl::small_bit_vector_types<N, Allocator, Options>::base   base_t;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   typedef typename base_t::allocator_type   allocator_type;
+   typedef typename base_t::size_type        size_type;
+
+   //! Number of bits stored inside the object
+   BOOST_STATIC_CONSTEXPR size_type static_capacity =
+      size_type((N + base_t::bits_per_block - 1u)/base_t::bits_per_block*base_t::bits_per_block);
+
+   //! <b>Effects</b>: Constructs an empty small_bit_vector.
+   small_bit_vector()
+      : base_t()
+   {}
+
+   //! <b>Effects</b>: Constructs an empty small_bit_vector using the specified allocator.
+   explicit small_bit_vector(const allocator_type &a)
+      : base_t(a)
+   {}
+
+   //! <b>Effects</b>: Constructs a small_bit_vector with n bits set to value.
+   explicit small_bit_vector(size_type n, bool value = false)
+      : base_t()
+   {  this->resize(n, value);  }
+
+   //! <b>Effects</b>: Constructs a small_bit_vector with n bits set to value using the specified allocator.
+   small_bit_vector(size_type n, bool value, const allocator_type &a)
+      : base_t(a)
+   {  this->resize(n, value);  }
+
+   //! <b>Effects</b>: Constructs a small_bit_vector with the bits of the range [first, last).
+   template<class InIt>
+   small_bit_vector(InIt first, InIt last
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename dtl::disable_if_convertible<InIt BOOST_MOVE_I size_type>::type * = 0)
+      )
+      : base_t()
+   {  this->assign(first, last);  }
+
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Constructs a small_bit_vector with the bits of il.
+   small_bit_vector(std::initializer_list<bool> il)
+      : base_t()
+   {  this->assign(il.begin(), il.end());  }
+   #endif
+
+   //! <b>Effects</b>: Copy constructs a small_bit_vector.
+   small_bit_vector(const small_bit_vector &x)
+      : base_t(static_cast<const base_t&>(x))
+   {}
+
+   //! <b>Effects</b>: Move constructs a small_bit_vector. x is left empty.
+   small_bit_vector(BOOST_RV_REF(small_bit_vector) x)
+      : base_t(BOOST_MOVE_BASE(base_t, x))
+   {}
+
+   //! <b>Effects</b>: Copy assignment.
+   small_bit_vector& operator=(BOOST_COPY_ASSIGN_REF(small_bit_vector) x)
+   {  return static_cast<small_bit_vector&>(this->base_t::operator=(static_cast<const base_t&>(x)));  }
+
+   //! <b>Effects</b>: Move assignment. x is left empty.
+   small_bit_vector& operator=(BOOST_RV_REF(small_bit_vector) x)
+   {  return static_cast<small_bit_vector&>(this->base_t::operator=(BOOST_MOVE_BASE(base_t, x)));  }
+};
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_BIT_VECTOR_HPP
@@ -0,0 +1,1723 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_CIRCULAR_DEVECTOR_HPP
+#define BOOST_CONTAINER_CIRCULAR_DEVECTOR_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+#include <boost/assert.hpp>
+
+// container
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/new_allocator.hpp>
+#include <boost/container/options.hpp>
+#include <boost/container/throw_exception.hpp>
+#include <boost/container/trivially_relocatable.hpp>
+#include <boost/container/devector.hpp>   //get_devector_opt
+// container/detail
+#include <boost/container/detail/advanced_insert_int.hpp>
+#include <boost/container/detail/algorithm.hpp>
+#include <boost/container/detail/alloc_helpers.hpp>
+#include <boost/container/detail/copy_move_algo.hpp>
+#include <boost/container/detail/destroyers.hpp>
+#include <boost/container/detail/guards_dended.hpp>
+#include <boost/container/detail/iterator.hpp>
+#include <boost/container/detail/iterators.hpp>
+#include <boost/container/detail/min_max.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/next_capacity.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// intrusive
+#include <boost/intrusive/pointer_traits.hpp>
+// move
+#if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+#include <boost/move/detail/fwd_macros.hpp>
+#endif
+#include <boost/move/detail/move_helpers.hpp>
+#include <boost/move/adl_move_swap.hpp>
+#include <boost/move/iterator.hpp>
+#include <boost/move/traits.hpp>
+#include <boost/move/utility_core.hpp>
+#include <boost/move/detail/to_raw_pointer.hpp>
+#include <boost/move/algo/detail/merge.hpp>
+// std
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+#include <initializer_list>   //for std::initializer_list
+#endif
+
+namespace boost {
+namespace container {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//Iterator of circular_devector. The position of an element is stored "unwrapped":
+//it's the index in the buffer of the element, plus the capacity if the live range
+//wrapped around the end of the buffer before reaching it. As head + size <= 2*capacity,
+//a single subtraction maps it to the buffer.
+template <class Pointer, bool IsConst>
+class circular_devector_iterator
+{
+   public:
+   typedef std::random_access_iterator_tag                                          iterator_category;
+   typedef typename boost::intrusive::pointer_traits<Pointer>::element_type         value_type;
+   typedef typename boost::intrusive::pointer_traits<Pointer>::difference_type      difference_type;
+   typedef typename boost::intrusive::pointer_traits<Pointer>::size_type            size_type;
+   typedef typename dtl::if_c
+      < IsConst
+      , typename boost::intrusive::pointer_traits<Pointer>::template
+                                 rebind_pointer<const value_type>::type
+      , Pointer
+      >::type                                                                       pointer;
+   typedef typename boost::intrusive::pointer_traits<pointer>::reference            reference;
+
+   private:
+   class nat
+   {
+      public:
+      Pointer get_buffer() const   {  return Pointer();  }
+      size_type get_capacity() const {  return 0u;  }
+      size_type get_pos() const    {  return 0u;  }
+   };
+   typedef typename dtl::if_c< IsConst
+                             , circular_devector_iterator<Pointer, false>
+                             , nat>::type                                           nonconst_iterator;
+
+   public:
+   inline circular_devector_iterator() BOOST_NOEXCEPT_OR_NOTHROW
+      : m_buffer(), m_capacity(0u), m_pos(0u)
+   {}
+
+   inline circular_devector_iterator(Pointer buffer, size_type capacity, size_type pos) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_buffer(buffer), m_capacity(capacity), m_pos(pos)
+   {}
+
+   inline circular_devector_iterator(const circular_devector_iterator &other) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_buffer(other.m_buffer), m_capacity(other.m_capacity), m_pos(other.m_pos)
+   {}
+
+   inline circular_devector_iterator(const nonconst_iterator &other) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_buffer(other.get_buffer()), m_capacity(other.get_capacity()), m_pos(other.get_pos())
+   {}
+
+   inline circular_devector_iterator & operator=(const circular_devector_iterator &other) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      m_buffer = other.m_buffer;
+      m_capacity = other.m_capacity;
+      m_pos = other.m_pos;
+      return *this;
+   }
+
+   inline const Pointer &get_buffer() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_buffer;  }
+
+   inline size_type get_capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_capacity;  }
+
+   inline size_type get_pos() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_pos;  }
+
+   //Pointer like operators
+   BOOST_CONTAINER_NODISCARD inline reference operator*() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_buffer[difference_type(this->priv_index())];  }
+
+   BOOST_CONTAINER_NODISCARD inline pointer operator->() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_buffer + difference_type(this->priv_index());  }
+
+   BOOST_CONTAINER_NODISCARD inline reference operator[](difference_type off) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return *(*this + off);  }
+
+   //Increment / Decrement
+   inline circular_devector_iterator& operator++() BOOST_NOEXCEPT_OR_NOTHROW
+   {  ++m_pos;  return *this;  }
+
+   inline circular_devector_iterator operator++(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {  circular_devector_iterator tmp(*this);  ++m_pos;  return tmp;  }
+
+   inline circular_devector_iterator& operator--() BOOST_NOEXCEPT_OR_NOTHROW
+   {  --m_pos;  return *this;  }
+
+   inline circular_devector_iterator operator--(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {  circular_devector_iterator tmp(*this);  --m_pos;  return tmp;  }
+
+   //Arithmetic
+   inline circular_devector_iterator& operator+=(difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
+   {  m_pos = size_type(difference_type(m_pos) + off);  return *this;  }
+
+   inline circular_devector_iterator& operator-=(difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
+   {  m_pos = size_type(difference_type(m_pos) - off);  return *this;  }
+
+   BOOST_CONTAINER_NODISCARD inline
+      friend circular_devector_iterator operator+(circular_devector_iterator x, difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return x += off;  }
+
+   BOOST_CONTAINER_NODISCARD inline
+      friend circular_devector_iterator operator+(difference_type off, circular_devector_iterator x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return x += off;  }
+
+   BOOST_CONTAINER_NODISCARD inline
+      friend circular_devector_iterator operator-(circular_devector_iterator x, difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return x -= off;  }
+
+   BOOST_CONTAINER_NODISCARD inline
+      friend difference_type operator-(const circular_devector_iterator &l, const circular_devector_iterator &r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return difference_type(l.m_pos) - difference_type(r.m_pos);  }
+
+   //Comparison operators
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator==(const circular_devector_iterator &l, const circular_devector_iterator &r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos == r.m_pos;  }
+
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator!=(const circular_devector_iterator &l, const circular_devector_iterator &r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos != r.m_pos;  }
+
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator<(const circular_devector_iterator &l, const circular_devector_iterator &r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos < r.m_pos;  }
+
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator<=(const circular_devector_iterator &l, const circular_devector_iterator &r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos <= r.m_pos;  }
+
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator>(const circular_devector_iterator &l, const circular_devector_iterator &r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos > r.m_pos;  }
+
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator>=(const circular_devector_iterator &l, const circular_devector_iterator &r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos >= r.m_pos;  }
+
+   private:
+   inline size_type priv_index() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_pos < m_capacity ? m_pos : size_type(m_pos - m_capacity);  }
+
+   Pointer     m_buffer;
+   size_type   m_capacity;
+   size_type   m_pos;
+};
+
+//Segment of a circular_devector: index 0 is the part of the live range placed
+//before the end of the buffer, index 1 the part that wrapped to the buffer start.
+template <class Pointer>
+class circular_devector_segment
+{
+   public:
+   typedef typename boost::intrusive::pointer_traits<Pointer>::size_type            size_type;
+
+   inline circular_devector_segment() BOOST_NOEXCEPT_OR_NOTHROW
+      : m_buffer(), m_capacity(0u), m_index(0u)
+   {}
+
+   inline circular_devector_segment(Pointer buffer, size_type capacity, size_type index) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_buffer(buffer), m_capacity(capacity), m_index(index)
+   {}
+
+   inline const Pointer &get_buffer() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_buffer;  }
+
+   inline size_type get_capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_capacity;  }
+
+   inline size_type get_index() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_index;  }
+
+   inline circular_devector_segment& operator++() BOOST_NOEXCEPT_OR_NOTHROW
+   {  ++m_index;  return *this;  }
+
+   inline circular_devector_segment operator++(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {  circular_devector_segment tmp(*this);  ++m_index;  return tmp;  }
+
+   inline circular_devector_segment& operator--() BOOST_NOEXCEPT_OR_NOTHROW
+   {  --m_index;  return *this;  }
+
+   inline circular_devector_segment operator--(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {  circular_devector_segment tmp(*this);  --m_index;  return tmp;  }
+
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator==(const circular_devector_segment &l, const circular_devector_segment &r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_index == r.m_index;  }
+
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator!=(const circular_devector_segment &l, const circular_devector_segment &r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_index != r.m_index;  }
+
+   private:
+   Pointer     m_buffer;
+   size_type   m_capacity;
+   size_type   m_index;
+};
+
+////////////////////////////////////////////////////////////////////////////
+//
+// Specialization of segmented_iterator_traits
+//
+////////////////////////////////////////////////////////////////////////////
+
+template<class Iterator>
+struct segmented_iterator_traits;
+
+struct segmented_iterator_tag;
+
+//Exposes the (at most) two contiguous halves of the live range, so that
+//segmented algorithms run plain pointer loops instead of wrapping each access.
+template<class Pointer, bool IsConst>
+struct segmented_iterator_traits< circular_devector_iterator<Pointer, IsConst> >
+{
+   typedef segmented_iterator_tag                           is_segmented_iterator;
+   typedef circular_devector_iterator<Pointer, IsConst>     iterator;
+   typedef typename iterator::pointer                       local_iterator;
+   typedef circular_devector_segment<Pointer>               segment_iterator;
+   typedef typename iterator::size_type                     size_type;
+   typedef typename iterator::difference_type               difference_type;
+
+   BOOST_CONTAINER_FORCEINLINE static segment_iterator segment(const iterator &it)
+   {
+      return segment_iterator
+         (it.get_buffer(), it.get_capacity(), size_type(it.get_pos() >= it.get_capacity()));
+   }
+
+   BOOST_CONTAINER_FORCEINLINE static local_iterator local(const iterator &it)
+   {  return it.operator->();  }
+
+   BOOST_CONTAINER_FORCEINLINE static iterator compose(const segment_iterator &s, local_iterator l)
+   {
+      const size_type off = size_type(l - local_iterator(s.get_buffer()));
+      return iterator(s.get_buffer(), s.get_capacity(), size_type(off + s.get_index()*s.get_capacity()));
+   }
+
+   BOOST_CONTAINER_FORCEINLINE static local_iterator begin(const segment_iterator &s)
+   {  return local_iterator(s.get_buffer());  }
+
+   BOOST_CONTAINER_FORCEINLINE static local_iterator end(const segment_iterator &s)
+   {  return local_iterator(s.get_buffer() + difference_type(s.get_capacity()));  }
+};
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A sequence container with the interface of devector that stores its elements in a
+//! ring buffer: the live range can wrap around the end of the buffer.
+//!
+//! Insertions and erasures at both ends never move elements unless the buffer is full and
+//! must grow, so a steady-state FIFO (`push_back`/`pop_front`) never relocates elements,
+//! unlike devector, that must recenter its elements when one end of the buffer is exhausted.
+//!
+//! Iterators are random-access and also model segmented iterators (see
+//! `boost/container/experimental/segmented_iterator_traits.hpp`): segmented algorithms
+//! process the two contiguous halves of the live range with plain pointers.
+//!
+//! Any insertion or erasure invalidates all iterators, but references and pointers to
+//! elements are only invalidated by reallocations and by insertions and erasures in the
+//! middle of the sequence.
+//!
+//! \tparam T The type of object that is stored in the circular_devector
+//! \tparam A The allocator used for all internal memory management, use void
+//!   for the default allocator
+//! \tparam Options A type produced from \c boost::container::devector_options.
+//!   \c growth_factor and \c stored_size are supported, \c relocate_on has no effect
+//!   as elements are never recentered.
+template < typename T, class A BOOST_CONTAINER_DOCONLY(= void), class Options BOOST_CONTAINER_DOCONLY(= void)>
+class circular_devector
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   typedef boost::container::allocator_traits
+      <typename real_allocator<T, A>::type>                                      allocator_traits_type;
+   typedef typename allocator_traits_type::size_type                             alloc_size_type;
+   typedef typename get_devector_opt<Options, alloc_size_type>::type             options_type;
+   typedef typename options_type::growth_factor_type                             growth_factor_type;
+   typedef typename options_type::stored_size_type                               stored_size_type;
+   #endif // ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   typedef T                                                                     value_type;
+   typedef BOOST_CONTAINER_IMPDEF
+      (typename real_allocator<T BOOST_MOVE_I A>::type)                          allocator_type;
+   typedef allocator_type                                                        stored_allocator_type;
+   typedef typename    allocator_traits<allocator_type>::pointer                 pointer;
+   typedef typename    allocator_traits<allocator_type>::const_pointer           const_pointer;
+   typedef typename    allocator_traits<allocator_type>::reference               reference;
+   typedef typename    allocator_traits<allocator_type>::const_reference         const_reference;
+   typedef typename    allocator_traits<allocator_type>::size_type               size_type;
+   typedef typename    allocator_traits<allocator_type>::difference_type         difference_type;
+   typedef BOOST_CONTAINER_IMPDEF
+      (circular_devector_iterator<pointer BOOST_MOVE_I false>)                   iterator;
+   typedef BOOST_CONTAINER_IMPDEF
+      (circular_devector_iterator<pointer BOOST_MOVE_I true>)                    const_iterator;
+   typedef BOOST_CONTAINER_IMPDEF
+      (boost::container::reverse_iterator<iterator>)                             reverse_iterator;
+   typedef BOOST_CONTAINER_IMPDEF
+      (boost::container::reverse_iterator<const_iterator>)                       const_reverse_iterator;
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   BOOST_CONTAINER_STATIC_ASSERT((dtl::is_same<value_type, typename allocator_traits<allocator_type>::value_type>::value));
+
+   BOOST_COPYABLE_AND_MOVABLE(circular_devector)
+
+   typedef typename detail::allocation_guard<allocator_type>   allocation_guard;
+   typedef typename array_destructor<allocator_type>::type     array_destructor_t;
+   typedef constant_iterator<T>                                cvalue_iterator;
+   typedef dtl::bool_<dtl::is_memtransfer_relocatable<pointer, pointer>::value>   relocate_with_memmove_t;
+   #endif // ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //          construct/copy/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Constructs an empty circular_devector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   circular_devector() BOOST_NOEXCEPT_IF(dtl::is_nothrow_default_constructible<allocator_type>::value)
+      : m_()
+   {}
+
+   //! <b>Effects</b>: Constructs an empty circular_devector, using the specified allocator.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   explicit circular_devector(const allocator_type& a) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_(a)
+   {}
+
+   //! <b>Effects</b>: Constructs a circular_devector with n value initialized elements.
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation or T's value initialization throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   explicit circular_devector(size_type n, const allocator_type& a = allocator_type())
+      : m_(a)
+   {  this->resize(n);  }
+
+   //! <b>Effects</b>: Constructs a circular_devector with n default initialized elements.
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation or T's default initialization throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   circular_devector(size_type n, default_init_t, const allocator_type& a = allocator_type())
+      : m_(a)
+   {  this->resize(n, default_init);  }
+
+   //! <b>Effects</b>: Constructs a circular_devector with n copies of value.
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   circular_devector(size_type n, const T& value, const allocator_type& a = allocator_type())
+      : m_(a)
+   {  this->resize(n, value);  }
+
+   //! <b>Effects</b>: Constructs a circular_devector with a copy of the range [first, last).
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation or T's constructor taking a dereferenced InIt throws.
+   //!
+   //! <b>Complexity</b>: Linear to the range [first, last).
+   template <class InIt>
+   circular_devector(InIt first, InIt last, const allocator_type& a = allocator_type()
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename dtl::disable_if_convertible<InIt BOOST_MOVE_I size_type>::type * = 0)
+      )
+      : m_(a)
+   {  this->insert(this->cend(), first, last);  }
+
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Constructs a circular_devector with a copy of il.
+   //!
+   //! <b>Complexity</b>: Linear to il.size().
+   circular_devector(std::initializer_list<T> il, const allocator_type& a = allocator_type())
+      : m_(a)
+   {  this->insert(this->cend(), il.begin(), il.end());  }
+   #endif
+
+   //! <b>Effects</b>: Copy constructs a circular_devector. The elements are stored
+   //!   contiguously from the start of the new buffer.
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to x.size().
+   circular_devector(const circular_devector& x)
+      : m_(allocator_traits_type::select_on_container_copy_construction(x.get_allocator_ref()))
+   {  this->insert(this->cend(), x.begin(), x.end());  }
+
+   //! <b>Effects</b>: Copy constructs a circular_devector using the specified allocator.
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to x.size().
+   circular_devector(const circular_devector& x, const BOOST_CONTAINER_DOC1ST(allocator_type, typename dtl::type_identity<allocator_type>::type)& a)
+      : m_(a)
+   {  this->insert(this->cend(), x.begin(), x.end());  }
+
+   //! <b>Effects</b>: Move constructor. Moves x's resources to *this.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   circular_devector(BOOST_RV_REF(circular_devector) x) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_(::boost::move(x.m_))
+   {}
+
+   //! <b>Effects</b>: Move constructor using the specified allocator.
+   //!   Moves x's resources to *this if a == x.get_allocator(), otherwise elements are moved one by one.
+   //!
+   //! <b>Throws</b>: If allocation or T's move constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant if a == x.get_allocator(), linear otherwise.
+   circular_devector(BOOST_RV_REF(circular_devector) x, const BOOST_CONTAINER_DOC1ST(allocator_type, typename dtl::type_identity<allocator_type>::type)& a)
+      : m_(a)
+   {
+      if(this->get_allocator_ref() == x.get_allocator_ref()){
+         this->priv_steal(x);
+      }
+      else{
+         this->insert(this->cend(), boost::make_move_iterator(x.begin()), boost::make_move_iterator(x.end()));
+      }
+   }
+
+   //! <b>Effects</b>: Destroys the elements and deallocates the buffer.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to size().
+   ~circular_devector() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      this->priv_destroy_all();
+      this->deallocate_buffer();
+   }
+
+   //! <b>Effects</b>: Makes *this contain the same elements as x.
+   //!
+   //! <b>Throws</b>: If allocation or T's copy constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: Linear to size() and x.size().
+   circular_devector& operator=(BOOST_COPY_ASSIGN_REF(circular_devector) x)
+   {
+      if (BOOST_LIKELY(this != &x)) {
+         const bool do_propagate = allocator_traits_type::propagate_on_container_copy_assignment::value;
+         BOOST_IF_CONSTEXPR(do_propagate){
+            allocator_type &this_alloc = this->get_allocator_ref();
+            const allocator_type &other_alloc = x.get_allocator_ref();
+            if (this_alloc != other_alloc){
+               //The new allocator can't free existing storage
+               this->priv_destroy_all();
+               this->deallocate_buffer();
+               this->priv_reset();
+            }
+            dtl::assign_alloc(this_alloc, other_alloc, dtl::bool_<do_propagate>());
+         }
+         this->assign(x.begin(), x.end());
+      }
+      return *this;
+   }
+
+   //! <b>Effects</b>: Move assignment. All x's values are transferred to *this.
+   //!
+   //! <b>Throws</b>: If allocators don't propagate and are not equal, T's move constructor.
+   //!
+   //! <b>Complexity</b>: Constant if allocators propagate or are equal, linear otherwise.
+   circular_devector& operator=(BOOST_RV_REF(circular_devector) x)
+      BOOST_NOEXCEPT_IF(allocator_traits_type::propagate_on_container_move_assignment::value
+                     || allocator_traits_type::is_always_equal::value)
+   {
+      if (BOOST_LIKELY(this != &x)) {
+         const bool propagate_alloc = allocator_traits_type::propagate_on_container_move_assignment::value;
+         if(propagate_alloc || this->get_allocator_ref() == x.get_allocator_ref()){
+            this->priv_destroy_all();
+            this->deallocate_buffer();
+            this->priv_reset();
+            dtl::move_alloc(this->get_allocator_ref(), x.get_allocator_ref(), dtl::bool_<propagate_alloc>());
+            this->priv_steal(x);
+         }
+         else{
+            this->assign(boost::make_move_iterator(x.begin()), boost::make_move_iterator(x.end()));
+         }
+      }
+      return *this;
+   }
+
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Makes *this contain the same elements as il.
+   //!
+   //! <b>Complexity</b>: Linear to size() and il.size().
+   circular_devector& operator=(std::initializer_list<T> il)
+   {
+      this->assign(il.begin(), il.end());
+      return *this;
+   }
+   #endif
+
+   //! <b>Effects</b>: Assigns the range [first, last) to *this.
+   //!
+   //! <b>Throws</b>: If allocation or T's constructor taking a dereferenced InIt throws.
+   //!
+   //! <b>Complexity</b>: Linear to the range [first, last) and size().
+   template <class InIt>
+   void assign(InIt first, InIt last
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename dtl::disable_if_convertible<InIt BOOST_MOVE_I size_type>::type * = 0)
+      )
+   {
+      //Elements are overwritten in place, the rest is appended or erased
+      iterator cur = this->begin();
+      const iterator e = this->end();
+      for(; first != last && cur != e; ++first, ++cur){
+         *cur = *first;
+      }
+      if(cur != e){
+         this->erase(cur, e);
+      }
+      else{
+         this->insert(this->cend(), first, last);
+      }
+   }
+
+   //! <b>Effects</b>: Assigns n copies of value to *this.
+   //!
+   //! <b>Complexity</b>: Linear to n and size().
+   void assign(size_type n, const T& value)
+   {  this->assign(cvalue_iterator(value, n), cvalue_iterator());  }
+
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Assigns the elements of il to *this.
+   //!
+   //! <b>Complexity</b>: Linear to il.size() and size().
+   void assign(std::initializer_list<T> il)
+   {  this->assign(il.begin(), il.end());  }
+   #endif
+
+   //! <b>Effects</b>: Returns a copy of the internal allocator.
+   //!
+   //! <b>Throws</b>: If allocator's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline
+      allocator_type get_allocator() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->get_allocator_ref();  }
+
+   //! <b>Effects</b>: Returns a reference to the internal allocator.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   BOOST_CONTAINER_NODISCARD inline
+      const stored_allocator_type& get_stored_allocator() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->get_allocator_ref();  }
+
+   //! <b>Effects</b>: Returns a reference to the internal allocator.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   BOOST_CONTAINER_NODISCARD inline
+      stored_allocator_type& get_stored_allocator() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->get_allocator_ref();  }
+
+   //////////////////////////////////////////////
+   //
+   //                iterators
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns an iterator to the first element.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline iterator begin() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->nth(0u);  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first element.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline const_iterator begin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->nth(0u);  }
+
+   //! <b>Effects</b>: Returns an iterator to the end of the circular_devector.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline iterator end() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->nth(this->size());  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the circular_devector.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline const_iterator end() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->nth(this->size());  }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the beginning of the reversed circular_devector.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline reverse_iterator rbegin() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return reverse_iterator(this->end());  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning of the reversed circular_devector.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline const_reverse_iterator rbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_reverse_iterator(this->end());  }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the end of the reversed circular_devector.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline reverse_iterator rend() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return reverse_iterator(this->begin());  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end of the reversed circular_devector.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline const_reverse_iterator rend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_reverse_iterator(this->begin());  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first element.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline const_iterator cbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->begin();  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the circular_devector.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline const_iterator cend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->end();  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning of the reversed circular_devector.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline const_reverse_iterator crbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->rbegin();  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end of the reversed circular_devector.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline const_reverse_iterator crend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->rend();  }
+
+   //////////////////////////////////////////////
+   //
+   //                capacity
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns true if the circular_devector contains no elements.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline bool empty() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !m_.size;  }
+
+   //! <b>Effects</b>: Returns the number of elements.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline size_type size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_.size;  }
+
+   //! <b>Effects</b>: Returns the number of elements that can be held without reallocating.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline size_type capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_.capacity;  }
+
+   //! <b>Effects</b>: Returns the largest possible size of the circular_devector.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline size_type max_size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      size_type alloc_max = allocator_traits_type::max_size(this->get_allocator_ref());
+      size_type size_type_max = (size_type)-1;
+      return (alloc_max <= size_type_max) ? size_type(alloc_max) : size_type_max;
+   }
+
+   //! <b>Returns</b>: true if the live range wraps around the end of the buffer, that is,
+   //!   if the elements are not stored in a single contiguous range.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   BOOST_CONTAINER_NODISCARD inline bool is_wrapped() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return size_type(size_type(m_.head) + m_.size) > m_.capacity;  }
+
+   //! <b>Effects</b>: If new_capacity is greater than capacity(), reallocates the buffer
+   //!   and stores the elements contiguously from the start of the new buffer.
+   //!
+   //! <b>Throws</b>: If memory allocation or T's move constructor throws, or new_capacity > max_size().
+   //!
+   //! <b>Complexity</b>: Linear to size() if a reallocation happens.
+   void reserve(size_type new_capacity)
+   {
+      if (new_capacity > m_.capacity){
+         if (new_capacity > this->max_size())
+            boost::container::throw_length_error("circular_devector::reserve max_size() exceeded");
+         this->priv_reallocate(new_capacity);
+      }
+   }
+
+   //! <b>Effects</b>: Tries to deallocate the excess of memory, storing the elements
+   //!   contiguously from the start of the new buffer.
+   //!
+   //! <b>Throws</b>: If memory allocation or T's move constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to size().
+   void shrink_to_fit()
+   {
+      dtl::growth_factor_on_shrink_to_fit<growth_factor_type>(size_type(m_.capacity), this->size());
+      if(m_.capacity > m_.size){
+         if(m_.size){
+            this->priv_reallocate(m_.size);
+         }
+         else{
+            this->deallocate_buffer();
+            this->priv_reset();
+         }
+      }
+   }
+
+   //! <b>Effects</b>: Inserts or erases elements at the end such that
+   //!   the size becomes sz. New elements are value initialized.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or T's value initialization throws.
+   //!
+   //! <b>Complexity</b>: Linear to the difference between size() and sz.
+   void resize(size_type sz)
+   {
+      typedef dtl::insert_value_initialized_n_proxy<allocator_type> proxy_t;
+      this->priv_resize(sz, proxy_t());
+   }
+
+   //! <b>Effects</b>: Inserts or erases elements at the end such that
+   //!   the size becomes sz. New elements are default initialized.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or T's default initialization throws.
+   //!
+   //! <b>Complexity</b>: Linear to the difference between size() and sz.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   void resize(size_type sz, default_init_t)
+   {
+      typedef dtl::insert_default_initialized_n_proxy<allocator_type> proxy_t;
+      this->priv_resize(sz, proxy_t());
+   }
+
+   //! <b>Effects</b>: Inserts or erases elements at the end such that
+   //!   the size becomes sz. New elements are copy constructed from c.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to the difference between size() and sz.
+   void resize(size_type sz, const T& c)
+   {
+      typedef dtl::insert_n_copies_proxy<allocator_type> proxy_t;
+      this->priv_resize(sz, proxy_t(c));
+   }
+
+   //////////////////////////////////////////////
+   //
+   //               element access
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Requires</b>: n < size().
+   //!
+   //! <b>Effects</b>: Returns a reference to the nth element.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline reference operator[](size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(n < m_.size);
+      return m_.buffer[difference_type(this->priv_index(n))];
+   }
+
+   //! <b>Requires</b>: n < size().
+   //!
+   //! <b>Effects</b>: Returns a const reference to the nth element.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline const_reference operator[](size_type n) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(n < m_.size);
+      return m_.buffer[difference_type(this->priv_index(n))];
+   }
+
+   //! <b>Effects</b>: Returns a reference to the nth element.
+   //!
+   //! <b>Throws</b>: out_of_range if n >= size().
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD reference at(size_type n)
+   {
+      if (n >= m_.size)
+         throw_out_of_range("circular_devector::at out of range");
+      return (*this)[n];
+   }
+
+   //! <b>Effects</b>: Returns a const reference to the nth element.
+   //!
+   //! <b>Throws</b>: out_of_range if n >= size().
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD const_reference at(size_type n) const
+   {
+      if (n >= m_.size)
+         throw_out_of_range("circular_devector::at out of range");
+      return (*this)[n];
+   }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns a reference to the first element.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline reference front() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      return m_.buffer[difference_type(m_.head)];
+   }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns a const reference to the first element.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline const_reference front() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      return m_.buffer[difference_type(m_.head)];
+   }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns a reference to the last element.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline reference back() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      return (*this)[size_type(m_.size - 1u)];
+   }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns a const reference to the last element.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline const_reference back() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      return (*this)[size_type(m_.size - 1u)];
+   }
+
+   //! <b>Requires</b>: n <= size().
+   //!
+   //! <b>Effects</b>: Returns an iterator to the nth element, or end() if n == size().
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   BOOST_CONTAINER_NODISCARD inline iterator nth(size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(n <= m_.size);
+      return iterator(m_.buffer, m_.capacity, size_type(m_.head + n));
+   }
+
+   //! <b>Requires</b>: n <= size().
+   //!
+   //! <b>Effects</b>: Returns a const_iterator to the nth element, or end() if n == size().
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   BOOST_CONTAINER_NODISCARD inline const_iterator nth(size_type n) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(n <= m_.size);
+      return const_iterator(m_.buffer, m_.capacity, size_type(m_.head + n));
+   }
+
+   //! <b>Requires</b>: begin() <= p <= end().
+   //!
+   //! <b>Effects</b>: Returns the index of the element pointed by p, or size() if p == end().
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension
+   BOOST_CONTAINER_NODISCARD inline size_type index_of(const_iterator p) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(p >= this->begin() && p <= this->end());
+      return size_type(p - this->begin());
+   }
+
+   //////////////////////////////////////////////
+   //
+   //                modifiers
+   //
+   //////////////////////////////////////////////
+
+   #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Effects</b>: Inserts an object of type T constructed with
+   //!   std::forward<Args>(args)... at the beginning of the circular_devector.
+   //!
+   //! <b>Returns</b>: A reference to the created object.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or the in-place constructor throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time. Constant if size() < capacity().
+   template <class... Args>
+   reference emplace_front(BOOST_FWD_REF(Args)... args)
+   {
+      if (BOOST_LIKELY(m_.size != m_.capacity)){
+         const size_type new_head = this->priv_prev_head(1u);
+         pointer const p = m_.buffer + difference_type(new_head);
+         this->alloc_construct(p, boost::forward<Args>(args)...);
+         m_.head = static_cast<stored_size_type>(new_head);
+         ++m_.size;
+         return *p;
+      }
+      typedef dtl::insert_emplace_proxy<allocator_type, Args...> proxy_t;
+      return *this->priv_insert_reallocate(0u, 1u, proxy_t(::boost::forward<Args>(args)...));
+   }
+
+   //! <b>Effects</b>: Inserts an object of type T constructed with
+   //!   std::forward<Args>(args)... at the end of the circular_devector.
+   //!
+   //! <b>Returns</b>: A reference to the created object.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or the in-place constructor throws.
+   //!
+   //! <b>Complexity</b>: Amortized constant time. Constant if size() < capacity().
+   template <class... Args>
+   reference emplace_back(BOOST_FWD_REF(Args)... args)
+   {
+      if (BOOST_LIKELY(m_.size != m_.capacity)){
+         pointer const p = m_.buffer + difference_type(this->priv_index(m_.size));
+         this->alloc_construct(p, boost::forward<Args>(args)...);
+         ++m_.size;
+         return *p;
+      }
+      typedef dtl::insert_emplace_proxy<allocator_type, Args...> proxy_t;
+      return *this->priv_insert_reallocate(this->size(), 1u, proxy_t(::boost::forward<Args>(args)...));
+   }
+
+   //! <b>Requires</b>: position must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Inserts an object of type T constructed with
+   //!   std::forward<Args>(args)... before position, moving the elements of the shorter side.
+   //!
+   //! <b>Returns</b>: An iterator to the new element.
+   //!
+   //! <b>Throws</b>: If memory allocation throws or the in-place constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to the minimum of the distances from position to begin() and end().
+   template <class... Args>
+   iterator emplace(const_iterator position, BOOST_FWD_REF(Args)... args)
+   {
+      typedef dtl::insert_emplace_proxy<allocator_type, Args...> proxy_t;
+      return this->priv_insert_aux(this->index_of(position), 1u, proxy_t(::boost::forward<Args>(args)...));
+   }
+
+   #else //!defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   #define BOOST_CONTAINER_CIRCULAR_DEVECTOR_EMPLACE_CODE(N) \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   reference emplace_front(BOOST_MOVE_UREF##N)\
+   {\
+      if (BOOST_LIKELY(m_.size != m_.capacity)){\
+         const size_type new_head = this->priv_prev_head(1u);\
+         pointer const p = m_.buffer + difference_type(new_head);\
+         this->alloc_construct(p BOOST_MOVE_I##N BOOST_MOVE_FWD##N);\
+         m_.head = static_cast<stored_size_type>(new_head);\
+         ++m_.size;\
+         return *p;\
+      }\
+      typedef dtl::insert_emplace_proxy_arg##N<allocator_type BOOST_MOVE_I##N BOOST_MOVE_TARG##N> proxy_t;\
+      return *this->priv_insert_reallocate(0u, 1u, proxy_t(BOOST_MOVE_FWD##N));\
+   }\
+   \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   reference emplace_back(BOOST_MOVE_UREF##N)\
+   {\
+      if (BOOST_LIKELY(m_.size != m_.capacity)){\
+         pointer const p = m_.buffer + difference_type(this->priv_index(m_.size));\
+         this->alloc_construct(p BOOST_MOVE_I##N BOOST_MOVE_FWD##N);\
+         ++m_.size;\
+         return *p;\
+      }\
+      typedef dtl::insert_emplace_proxy_arg##N<allocator_type BOOST_MOVE_I##N BOOST_MOVE_TARG##N> proxy_t;\
+      return *this->priv_insert_reallocate(this->size(), 1u, proxy_t(BOOST_MOVE_FWD##N));\
+   }\
+   \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   iterator emplace(const_iterator position BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+   {\
+      typedef dtl::insert_emplace_proxy_arg##N<allocator_type BOOST_MOVE_I##N BOOST_MOVE_TARG##N> proxy_t;\
+      return this->priv_insert_aux(this->index_of(position), 1u, proxy_t(BOOST_MOVE_FWD##N));\
+   }\
+   //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_CONTAINER_CIRCULAR_DEVECTOR_EMPLACE_CODE)
+   #undef BOOST_CONTAINER_CIRCULAR_DEVECTOR_EMPLACE_CODE
+
+   #endif   //!defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Effects</b>: Inserts a copy of x at the beginning of the circular_devector.
+   //!
+   //! <b>Complexity</b>: Amortized constant time. Constant if size() < capacity().
+   void push_front(const T &x);
+
+   //! <b>Effects</b>: Inserts x at the beginning of the circular_devector, constructing
+   //!   the new element with T's move constructor.
+   //!
+   //! <b>Complexity</b>: Amortized constant time. Constant if size() < capacity().
+   void push_front(T &&x);
+   #else
+   BOOST_MOVE_CONVERSION_AWARE_CATCH(push_front, T, void, priv_push_front)
+   #endif
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Effects</b>: Inserts a copy of x at the end of the circular_devector.
+   //!
+   //! <b>Complexity</b>: Amortized constant time. Constant if size() < capacity().
+   void push_back(const T &x);
+
+   //! <b>Effects</b>: Inserts x at the end of the circular_devector, constructing
+   //!   the new element with T's move constructor.
+   //!
+   //! <b>Complexity</b>: Amortized constant time. Constant if size() < capacity().
+   void push_back(T &&x);
+   #else
+   BOOST_MOVE_CONVERSION_AWARE_CATCH(push_back, T, void, priv_push_back)
+   #endif
+
+   #if defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Requires</b>: position must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Inserts a copy of x before position.
+   //!
+   //! <b>Returns</b>: An iterator to the new element.
+   //!
+   //! <b>Complexity</b>: Linear to the minimum of the distances from position to begin() and end().
+   iterator insert(const_iterator position, const T &x);
+
+   //! <b>Requires</b>: position must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Inserts a new element before position with x's resources.
+   //!
+   //! <b>Returns</b>: An iterator to the new element.
+   //!
+   //! <b>Complexity</b>: Linear to the minimum of the distances from position to begin() and end().
+   iterator insert(const_iterator position, T &&x);
+   #else
+   BOOST_MOVE_CONVERSION_AWARE_CATCH_1ARG(insert, T, iterator, priv_insert, const_iterator, const_iterator)
+   #endif
+
+   //! <b>Requires</b>: position must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Inserts n copies of x before position.
+   //!
+   //! <b>Returns</b>: An iterator to the first inserted element or position if n is 0.
+   //!
+   //! <b>Complexity</b>: Linear to n plus the minimum of the distances from position to begin() and end().
+   iterator insert(const_iterator position, size_type n, const T& x)
+   {
+      typedef dtl::insert_n_copies_proxy<allocator_type> proxy_t;
+      return this->priv_insert_aux(this->index_of(position), n, proxy_t(x));
+   }
+
+   //! <b>Requires</b>: position must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Inserts a copy of the [first, last) range before position.
+   //!
+   //! <b>Returns</b>: An iterator to the first inserted element or position if first == last.
+   //!
+   //! <b>Complexity</b>: Linear to the range plus the minimum of the distances from position to begin() and end().
+   template <class InIt>
+   iterator insert(const_iterator position, InIt first, InIt last
+      //Input iterators
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename dtl::disable_if_or
+            < void
+            BOOST_MOVE_I dtl::is_convertible<InIt BOOST_MOVE_I size_type>
+            BOOST_MOVE_I dtl::is_not_input_iterator<InIt>
+            >::type * = 0)
+      )
+   {
+      //Single pass ranges are appended and then rotated to their position
+      const size_type idx = this->index_of(position);
+      const size_type old_size = this->size();
+      BOOST_CONTAINER_TRY{
+         for(; first != last; ++first){
+            this->emplace_back(*first);
+         }
+      }
+      BOOST_CONTAINER_CATCH(...){
+         this->erase(this->nth(old_size), this->end());
+         BOOST_CONTAINER_RETHROW
+      }
+      BOOST_CONTAINER_CATCH_END
+      boost::movelib::rotate_gcd(this->nth(idx), this->nth(old_size), this->end());
+      return this->nth(idx);
+   }
+
+   #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   template <class FwdIt>
+   iterator insert(const_iterator position, FwdIt first, FwdIt last
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename dtl::disable_if_or
+            < void
+            BOOST_MOVE_I dtl::is_convertible<FwdIt BOOST_MOVE_I size_type>
+            BOOST_MOVE_I dtl::is_input_iterator<FwdIt>
+            >::type * = 0)
+      )
+   {
+      typedef dtl::insert_range_proxy<allocator_type, FwdIt> proxy_t;
+      const size_type n = boost::container::iterator_udistance(first, last);
+      return this->priv_insert_aux(this->index_of(position), n, proxy_t(first));
+   }
+   #endif
+
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Requires</b>: position must be a valid iterator of *this.
+   //!
+   //! <b>Effects</b>: Inserts a copy of the il elements before position.
+   //!
+   //! <b>Returns</b>: An iterator to the first inserted element or position if il is empty.
+   iterator insert(const_iterator position, std::initializer_list<T> il)
+   {  return this->insert(position, il.begin(), il.end());  }
+   #endif
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Removes the first element. Other elements are not moved.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   void pop_front() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      allocator_traits_type::destroy
+         (this->get_allocator_ref(), boost::movelib::to_raw_pointer(m_.buffer + difference_type(m_.head)));
+      const size_type new_head = size_type(m_.head + 1u);
+      m_.head = static_cast<stored_size_type>(new_head == m_.capacity ? 0u : new_head);
+      --m_.size;
+   }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Removes the last element. Other elements are not moved.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   void pop_back() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(!this->empty());
+      --m_.size;
+      allocator_traits_type::destroy
+         (this->get_allocator_ref(), boost::movelib::to_raw_pointer(m_.buffer + difference_type(this->priv_index(m_.size))));
+   }
+
+   //! <b>Requires</b>: position must be a valid dereferenceable iterator of *this.
+   //!
+   //! <b>Effects</b>: Erases the element at position, moving the elements of the shorter side.
+   //!
+   //! <b>Returns</b>: An iterator to the element that followed the erased one.
+   //!
+   //! <b>Complexity</b>: Linear to the minimum of the distances from position to begin() and end().
+   iterator erase(const_iterator position)
+   {  return this->erase(position, position + 1);  }
+
+   //! <b>Requires</b>: [first, last) must be a valid range of *this.
+   //!
+   //! <b>Effects</b>: Erases the elements of [first, last), moving the elements of the shorter side.
+   //!
+   //! <b>Returns</b>: An iterator to the element that followed the last erased one.
+   //!
+   //! <b>Complexity</b>: Linear to the distance between first and last plus the minimum
+   //!   of the number of elements before first and after last.
+   iterator erase(const_iterator first, const_iterator last)
+   {
+      const size_type idx = this->index_of(first);
+      const size_type n   = size_type(last - first);
+      if(!n){
+         return this->nth(idx);
+      }
+      const size_type elems_after = size_type(m_.size - idx - n);
+      if(idx < elems_after){
+         //Move [begin(), first) n positions forward and destroy the first n elements
+         boost::container::move_backward(this->begin(), this->nth(idx), this->nth(size_type(idx + n)));
+         this->priv_destroy_n(this->begin(), n);
+         const size_type new_head = size_type(m_.head + n);
+         m_.head = static_cast<stored_size_type>(new_head >= m_.capacity ? size_type(new_head - m_.capacity) : new_head);
+      }
+      else{
+         //Move [last, end()) n positions backwards and destroy the last n elements
+         boost::container::move(this->nth(size_type(idx + n)), this->end(), this->nth(idx));
+         this->priv_destroy_n(this->nth(size_type(m_.size - n)), n);
+      }
+      m_.size = static_cast<stored_size_type>(m_.size - n);
+      return this->nth(idx);
+   }
+
+   //! <b>Effects</b>: Swaps the contents of *this and x.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   void swap(circular_devector& x)
+      BOOST_NOEXCEPT_IF( allocator_traits_type::propagate_on_container_swap::value
+                      || allocator_traits_type::is_always_equal::value)
+   {
+      BOOST_CONSTEXPR_OR_CONST bool propagate_alloc = allocator_traits_type::propagate_on_container_swap::value;
+      BOOST_ASSERT(propagate_alloc || this->get_allocator_ref() == x.get_allocator_ref()); // else it's undefined behavior
+      boost::adl_move_swap(m_.buffer,   x.m_.buffer);
+      boost::adl_move_swap(m_.head,     x.m_.head);
+      boost::adl_move_swap(m_.size,     x.m_.size);
+      boost::adl_move_swap(m_.capacity, x.m_.capacity);
+      dtl::swap_alloc(this->get_allocator_ref(), x.get_allocator_ref(), dtl::bool_<propagate_alloc>());
+   }
+
+   //! <b>Effects</b>: Erases all the elements. Does not free memory.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to size().
+   void clear() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      this->priv_destroy_all();
+      m_.head = 0u;
+      m_.size = 0u;
+   }
+
+   //! <b>Effects</b>: Returns true if x and y are equal
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator==(const circular_devector& x, const circular_devector& y)
+   {  return x.size() == y.size() && ::boost::container::algo_equal(x.begin(), x.end(), y.begin());  }
+
+   //! <b>Effects</b>: Returns true if x and y are unequal
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator!=(const circular_devector& x, const circular_devector& y)
+   {  return !(x == y);  }
+
+   //! <b>Effects</b>: Returns true if x is less than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator<(const circular_devector& x, const circular_devector& y)
+   {  return ::boost::container::algo_lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());  }
+
+   //! <b>Effects</b>: Returns true if x is greater than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator>(const circular_devector& x, const circular_devector& y)
+   {  return y < x;  }
+
+   //! <b>Effects</b>: Returns true if x is equal or less than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator<=(const circular_devector& x, const circular_devector& y)
+   {  return !(y < x);  }
+
+   //! <b>Effects</b>: Returns true if x is equal or greater than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator>=(const circular_devector& x, const circular_devector& y)
+   {  return !(x < y);  }
+
+   //! <b>Effects</b>: x.swap(y)
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline friend void swap(circular_devector& x, circular_devector& y)
+      BOOST_NOEXCEPT_IF( allocator_traits_type::propagate_on_container_swap::value
+                      || allocator_traits_type::is_always_equal::value)
+   {  x.swap(y);  }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+
+   inline allocator_type& get_allocator_ref() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return static_cast<allocator_type&>(m_);  }
+
+   inline const allocator_type& get_allocator_ref() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return static_cast<const allocator_type&>(m_);  }
+
+   //Buffer index of the element placed n positions after the first one
+   inline size_type priv_index(size_type n) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const size_type i = size_type(m_.head + n);
+      return i < m_.capacity ? i : size_type(i - m_.capacity);
+   }
+
+   //Buffer index of the position placed n positions before the first element
+   inline size_type priv_prev_head(size_type n) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(n <= m_.capacity);
+      return m_.head >= n ? size_type(m_.head - n) : size_type(m_.head + m_.capacity - n);
+   }
+
+   inline void priv_reset() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      m_.buffer = pointer();
+      m_.head = 0u;
+      m_.size = 0u;
+      m_.capacity = 0u;
+   }
+
+   inline void priv_steal(circular_devector &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      m_.buffer   = x.m_.buffer;
+      m_.head     = x.m_.head;
+      m_.size     = x.m_.size;
+      m_.capacity = x.m_.capacity;
+      x.priv_reset();
+   }
+
+   template <class U>
+   inline void priv_push_front(BOOST_FWD_REF(U) u)
+   {  this->emplace_front(boost::forward<U>(u));  }
+
+   template <class U>
+   inline void priv_push_back(BOOST_FWD_REF(U) u)
+   {  this->emplace_back(boost::forward<U>(u));  }
+
+   template <class U>
+   inline iterator priv_insert(const_iterator pos, BOOST_FWD_REF(U) u)
+   {  return this->emplace(pos, boost::forward<U>(u));  }
+
+   #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+   template <class... Args>
+   inline void alloc_construct(pointer dst, BOOST_FWD_REF(Args)... args)
+   {
+      allocator_traits_type::construct
+         (this->get_allocator_ref(), boost::movelib::to_raw_pointer(dst), boost::forward<Args>(args)...);
+   }
+   #else
+   #define BOOST_CONTAINER_CIRCULAR_DEVECTOR_ALLOC_CONSTRUCT(N) \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   inline void alloc_construct(pointer dst BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+   {\
+      allocator_traits_type::construct\
+         (this->get_allocator_ref(), boost::movelib::to_raw_pointer(dst) BOOST_MOVE_I##N BOOST_MOVE_FWD##N);\
+   }\
+   //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_CONTAINER_CIRCULAR_DEVECTOR_ALLOC_CONSTRUCT)
+   #undef BOOST_CONTAINER_CIRCULAR_DEVECTOR_ALLOC_CONSTRUCT
+   #endif
+
+   void priv_destroy_n(iterator first, size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_IF_CONSTEXPR(!dtl::is_trivially_destructible<T>::value){
+         for(; n; --n, ++first){
+            allocator_traits_type::destroy(this->get_allocator_ref(), boost::movelib::iterator_to_raw_pointer(first));
+         }
+      }
+   }
+
+   inline void priv_destroy_all() BOOST_NOEXCEPT_OR_NOTHROW
+   {  this->priv_destroy_n(this->begin(), this->size());  }
+
+   void deallocate_buffer() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if (m_.buffer) {
+         allocator_traits_type::deallocate(this->get_allocator_ref(), m_.buffer, m_.capacity);
+      }
+   }
+
+   pointer allocate_at_least(size_type &cap)
+   {
+      if (cap > size_type(stored_size_type(-1))){
+         boost::container::throw_length_error("circular_devector: get_next_capacity, allocator's max size reached");
+      }
+      //Received size must be representable by stored_size_type
+      return dtl::allocate_at_least_up_to(this->get_allocator_ref(), cap, size_type(stored_size_type(-1)));
+   }
+
+   size_type calculate_new_capacity(size_type requested_capacity)
+   {
+      size_type max = allocator_traits_type::max_size(this->get_allocator_ref());
+      (clamp_by_stored_size_type)(max, stored_size_type());
+      const size_type remaining_additional_cap = size_type(max - size_type(m_.capacity));
+      const size_type min_additional_cap = size_type(requested_capacity - size_type(m_.capacity));
+      if ( remaining_additional_cap < min_additional_cap )
+         boost::container::throw_length_error("circular_devector: get_next_capacity, max size exceeded");
+
+      return dtl::growth_factor_next_capacity<growth_factor_type, sizeof(T)>
+         ( size_type(m_.capacity), min_additional_cap, max);
+   }
+
+   //Constructs n elements starting at dst from the n elements starting at first.
+   //Trivially relocatable elements are memmoved one contiguous half at a time,
+   //otherwise elements are move constructed and sources must be destroyed later.
+   void priv_transfer_n(iterator first, size_type n, pointer dst, dtl::true_)
+   {
+      while(n){
+         pointer const src = first.operator->();
+         const size_type chunk = dtl::min_value
+            (n, size_type(m_.capacity - size_type(src - m_.buffer)));
+         (void)dtl::memmove_n(boost::movelib::to_raw_pointer(src), chunk, boost::movelib::to_raw_pointer(dst));
+         first += difference_type(chunk);
+         dst += difference_type(chunk);
+         n = size_type(n - chunk);
+      }
+   }
+
+   void priv_transfer_n(iterator first, size_type n, pointer dst, dtl::false_)
+   {  (void)boost::container::uninitialized_move_alloc_n(this->get_allocator_ref(), first, n, dst);  }
+
+   inline void priv_destroy_transferred(dtl::true_) BOOST_NOEXCEPT_OR_NOTHROW
+   {}
+
+   inline void priv_destroy_transferred(dtl::false_) BOOST_NOEXCEPT_OR_NOTHROW
+   {  this->priv_destroy_all();  }
+
+   //Moves the elements to a new buffer of (at least) new_capacity elements,
+   //storing them from the start of the new buffer
+   void priv_reallocate(size_type new_capacity)
+   {
+      BOOST_ASSERT(new_capacity >= m_.size);
+      pointer const new_buffer = this->allocate_at_least(new_capacity);
+      {
+         allocation_guard new_buffer_guard(new_buffer, new_capacity, this->get_allocator_ref());
+         this->priv_transfer_n(this->begin(), this->size(), new_buffer, relocate_with_memmove_t());
+         new_buffer_guard.release();
+      }
+      this->priv_destroy_transferred(relocate_with_memmove_t());
+      this->priv_replace_buffer(new_buffer, new_capacity);
+   }
+
+   void priv_replace_buffer(pointer new_buffer, size_type new_capacity) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if (m_.buffer) {
+         //shrink_to_fit also replaces the buffer, but that is not a relocation due to growth
+         if (new_capacity > m_.capacity)
+            allocator_traits_type::on_relocation(this->get_allocator_ref(), this->size());
+         allocator_traits_type::deallocate(this->get_allocator_ref(), m_.buffer, m_.capacity);
+      }
+      m_.buffer = new_buffer;
+      m_.head = 0u;
+      m_.capacity = static_cast<stored_size_type>(new_capacity);
+   }
+
+   //Inserts n elements in position idx allocating a new buffer. New elements are
+   //constructed first, so that proxies referencing existing elements see them untouched.
+   template <class InsertionProxy>
+   iterator priv_insert_reallocate(size_type idx, size_type n, InsertionProxy proxy)
+   {
+      size_type new_capacity = this->calculate_new_capacity(size_type(m_.size + n));
+      pointer const new_buffer = this->allocate_at_least(new_capacity);
+      {
+         allocator_type &a = this->get_allocator_ref();
+         allocation_guard new_buffer_guard(new_buffer, new_capacity, a);
+         pointer const new_pos = new_buffer + difference_type(idx);
+         proxy.uninitialized_copy_n_and_update(a, new_pos, n);
+         array_destructor_t new_values_destroyer(new_pos, new_pos + difference_type(n), a);
+         this->priv_transfer_n(this->begin(), idx, new_buffer, relocate_with_memmove_t());
+         new_values_destroyer.set_begin(new_buffer);
+         this->priv_transfer_n(this->nth(idx), size_type(m_.size - idx), new_pos + difference_type(n), relocate_with_memmove_t());
+         new_values_destroyer.release();
+         new_buffer_guard.release();
+      }
+      this->priv_destroy_transferred(relocate_with_memmove_t());
+      this->priv_replace_buffer(new_buffer, new_capacity);
+      m_.size = static_cast<stored_size_type>(m_.size + n);
+      return this->nth(idx);
+   }
+
+   template <class InsertionProxy>
+   iterator priv_insert_aux(size_type idx, size_type n, InsertionProxy proxy)
+   {
+      BOOST_ASSERT(idx <= m_.size);
+      if(!n){
+         return this->nth(idx);
+      }
+      else if(size_type(m_.capacity - m_.size) < n){
+         return this->priv_insert_reallocate(idx, n, proxy);
+      }
+
+      allocator_type &a = this->get_allocator_ref();
+      const size_type elems_after = size_type(m_.size - idx);
+      if(!elems_after){
+         //Insertion at the back, constructing in the free space
+         proxy.uninitialized_copy_n_and_update(a, this->end(), n);
+         m_.size = static_cast<stored_size_type>(m_.size + n);
+         return this->nth(idx);
+      }
+      else if(!idx){
+         //Insertion at the front, constructing in the free space
+         const size_type new_head = this->priv_prev_head(n);
+         proxy.uninitialized_copy_n_and_update(a, iterator(m_.buffer, m_.capacity, new_head), n);
+         m_.head = static_cast<stored_size_type>(new_head);
+         m_.size = static_cast<stored_size_type>(m_.size + n);
+         return this->begin();
+      }
+      else if(idx < elems_after){
+         //Open a gap moving [begin(), pos) n positions backwards. Unwrapped positions
+         //of the live range are offset by the capacity so that begin() - n is valid.
+         const size_type new_head = this->priv_prev_head(n);
+         const size_type base = m_.head >= n ? size_type(m_.head) : size_type(m_.head + m_.capacity);
+         const iterator old_start(m_.buffer, m_.capacity, base);
+         const iterator new_start(old_start - difference_type(n));
+         if(idx >= n){
+            (void)boost::container::uninitialized_move_alloc_n(a, old_start, n, new_start);
+            m_.head = static_cast<stored_size_type>(new_head);
+            m_.size = static_cast<stored_size_type>(m_.size + n);
+            const iterator pos = boost::container::move(old_start + difference_type(n), old_start + difference_type(idx), old_start);
+            proxy.copy_n_and_update(a, pos, n);
+            return this->nth(idx);
+         }
+         else{
+            const size_type mid_count = size_type(n - idx);
+            const iterator mid_start(old_start - difference_type(mid_count));
+            proxy.uninitialized_copy_n_and_update(a, mid_start, mid_count);
+            BOOST_CONTAINER_TRY{
+               (void)boost::container::uninitialized_move_alloc_n(a, old_start, idx, new_start);
+            }
+            BOOST_CONTAINER_CATCH(...){
+               this->priv_destroy_n(mid_start, mid_count);
+               BOOST_CONTAINER_RETHROW
+            }
+            BOOST_CONTAINER_CATCH_END
+            m_.head = static_cast<stored_size_type>(new_head);
+            m_.size = static_cast<stored_size_type>(m_.size + n);
+            proxy.copy_n_and_update(a, old_start, idx);
+            return this->nth(idx);
+         }
+      }
+      else{
+         //Open a gap moving [pos, end()) n positions forward
+         const iterator old_finish(this->end());
+         if(elems_after >= n){
+            const iterator finish_n(old_finish - difference_type(n));
+            (void)boost::container::uninitialized_move_alloc_n(a, finish_n, n, old_finish);
+            m_.size = static_cast<stored_size_type>(m_.size + n);
+            const iterator pos = this->nth(idx);
+            boost::container::move_backward(pos, finish_n, old_finish);
+            proxy.copy_n_and_update(a, pos, n);
+            return pos;
+         }
+         else{
+            const size_type raw_gap = size_type(n - elems_after);
+            const iterator pos(old_finish - difference_type(elems_after));
+            (void)boost::container::uninitialized_move_alloc_n(a, pos, elems_after, old_finish + difference_type(raw_gap));
+            BOOST_CONTAINER_TRY{
+               proxy.copy_n_and_update(a, pos, elems_after);
+               proxy.uninitialized_copy_n_and_update(a, old_finish, raw_gap);
+            }
+            BOOST_CONTAINER_CATCH(...){
+               this->priv_destroy_n(old_finish + difference_type(raw_gap), elems_after);
+               BOOST_CONTAINER_RETHROW
+            }
+            BOOST_CONTAINER_CATCH_END
+            m_.size = static_cast<stored_size_type>(m_.size + n);
+            return pos;
+         }
+      }
+   }
+
+   template <class InsertionProxy>
+   void priv_resize(size_type sz, InsertionProxy proxy)
+   {
+      const size_type old_size = this->size();
+      if(sz > old_size){
+         this->priv_insert_aux(old_size, size_type(sz - old_size), proxy);
+      }
+      else{
+         this->erase(this->nth(sz), this->end());
+      }
+   }
+
+   struct impl : allocator_type
+   {
+      BOOST_MOVABLE_BUT_NOT_COPYABLE(impl)
+
+      public:
+      impl()
+         : allocator_type(), buffer(), head(0u), size(0u), capacity(0u)
+      {}
+
+      explicit impl(const allocator_type &a)
+         : allocator_type(a), buffer(), head(0u), size(0u), capacity(0u)
+      {}
+
+      impl(BOOST_RV_REF(impl) m)
+         : allocator_type(BOOST_MOVE_BASE(allocator_type, m))
+         , buffer(m.buffer), head(m.head), size(m.size), capacity(m.capacity)
+      {
+         m.buffer = pointer();
+         m.head = 0u;
+         m.size = 0u;
+         m.capacity = 0u;
+      }
+
+      pointer           buffer;
+      stored_size_type  head;
+      stored_size_type  size;
+      stored_size_type  capacity;
+   } m_;
+   #endif // ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+//! <b>Effects</b>: Erases all elements that compare equal to v from the container c.
+//!
+//! <b>Complexity</b>: Linear.
+template <class T, class A, class O, class U>
+inline typename circular_devector<T, A, O>::size_type erase(circular_devector<T, A, O>& c, const U& v)
+{
+   typename circular_devector<T, A, O>::size_type old_size = c.size();
+   c.erase(boost::container::remove(c.begin(), c.end(), v), c.end());
+   return old_size - c.size();
+}
+
+//! <b>Effects</b>: Erases all elements that satisfy the predicate pred from the container c.
+//!
+//! <b>Complexity</b>: Linear.
+template <class T, class A, class O, class Pred>
+inline typename circular_devector<T, A, O>::size_type erase_if(circular_devector<T, A, O>& c, Pred pred)
+{
+   typename circular_devector<T, A, O>::size_type old_size = c.size();
+   c.erase(boost::container::remove_if(c.begin(), c.end(), pred), c.end());
+   return old_size - c.size();
+}
+
+}  //namespace container {
+}  //namespace boost {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace boost {
+
+//!has_trivial_destructor_after_move<> == true_type
+//!specialization for optimizations
+template <class T, class Allocator, class Options>
+struct has_trivial_destructor_after_move<boost::container::circular_devector<T, Allocator, Options> >
+{
+   typedef typename boost::container::real_allocator<T, Allocator>::type allocator_type;
+   typedef typename ::boost::container::allocator_traits<allocator_type>::pointer pointer;
+   BOOST_STATIC_CONSTEXPR bool value = ::boost::has_trivial_destructor_after_move<allocator_type>::value &&
+                                       ::boost::has_trivial_destructor_after_move<pointer>::value;
+};
+
+}  //namespace boost {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_CIRCULAR_DEVECTOR_HPP
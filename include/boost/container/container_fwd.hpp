@@ -28,15 +28,22 @@
 //!   - boost::container::static_vector
 //!   - boost::container::small_vector_base
 //!   - boost::container::small_vector
+//!   - boost::container::pinned_vector
 //!   - boost::container::devector
+//!   - boost::container::circular_devector
+//!   - boost::container::bit_vector
+//!   - boost::container::small_bit_vector
 //!   - boost::container::deque
 //!   - boost::container::segtor
 //!   - boost::container::slist
 //!   - boost::container::list
+//!   - boost::container::spsc_queue
+//!   - boost::container::mpmc_queue
 //!   - boost::container::set
 //!   - boost::container::multiset
 //!   - boost::container::map
 //!   - boost::container::multimap
+//!   - boost::container::grouped_multimap
 //!   - boost::container::flat_set
 //!   - boost::container::flat_multiset
 //!   - boost::container::flat_map
@@ -44,6 +51,17 @@
 //!   - boost::container::basic_string
 //!   - boost::container::string
 //!   - boost::container::wstring
+//!   - boost::container::basic_rope
+//!   - boost::container::rope
+//!   - boost::container::wrope
+//!   - boost::container::basic_interned_string
+//!   - boost::container::interned_string
+//!   - boost::container::winterned_string
+//!   - boost::container::basic_intern_table
+//!   - boost::container::intern_table
+//!   - boost::container::wintern_table
+//!   - boost::container::flat_string_key
+//!   - boost::container::flat_string_map
 //!
 //! Forward declares the following allocators:
 //!   - boost::container::allocator
@@ -124,11 +142,29 @@ template < class T
          , class Options   = void  >
 class small_vector;
 
+template <class T
+         ,class Options   = void>
+class pinned_vector;
+
 template <class T
          ,class Allocator = void
          ,class Options   = void>
 class devector;
 
+template <class T
+         ,class Allocator = void
+         ,class Options   = void>
+class circular_devector;
+
+template <class Allocator = void
+         ,class Options   = void>
+class bit_vector;
+
+template <std::size_t N
+         ,class Allocator = void
+         ,class Options   = void>
+class small_bit_vector;
+
 template <class T
          ,class Allocator = void
          ,class Options   = void>
@@ -151,6 +187,16 @@ template <class T
          ,class Allocator = void >
 class hub;
 
+template <class T
+         ,std::size_t Capacity = 0u
+         ,class Allocator = void >
+class spsc_queue;
+
+template <class T
+         ,std::size_t Capacity = 0u
+         ,class Allocator = void >
+class mpmc_queue;
+
 template <class Key
          ,class Compare  = std::less<Key>
          ,class Allocator = void
@@ -177,6 +223,13 @@ template <class Key
          ,class Options = void >
 class multimap;
 
+template <class Key
+         ,class T
+         ,class Compare  = std::less<Key>
+         ,class Allocator = void
+         ,class Options = void >
+class grouped_multimap;
+
 template <class Key
          ,class Compare  = std::less<Key>
          ,class Allocator = void >
@@ -291,6 +344,37 @@ class basic_string;
 typedef basic_string <char>   string;
 typedef basic_string<wchar_t> wstring;
 
+template <class CharT
+         ,class Traits     = std::char_traits<CharT>
+         ,class Allocator  = void
+         ,class Options    = void >
+class basic_rope;
+
+typedef basic_rope <char>   rope;
+typedef basic_rope<wchar_t> wrope;
+
+template <class CharT
+         ,class Traits     = std::char_traits<CharT> >
+class basic_interned_string;
+
+typedef basic_interned_string <char>   interned_string;
+typedef basic_interned_string<wchar_t> winterned_string;
+
+template <class CharT
+         ,class Traits     = std::char_traits<CharT>
+         ,class Allocator  = void >
+class basic_intern_table;
+
+typedef basic_intern_table <char>   intern_table;
+typedef basic_intern_table<wchar_t> wintern_table;
+
+class flat_string_key;
+
+template <class T
+         ,class Allocator  = void
+         ,class Options    = void >
+class flat_string_map;
+
 BOOST_STATIC_CONSTEXPR std::size_t ADP_nodes_per_block    = 256u;
 BOOST_STATIC_CONSTEXPR std::size_t ADP_max_free_blocks    = 2u;
 BOOST_STATIC_CONSTEXPR std::size_t ADP_overhead_percent   = 1u;
@@ -366,6 +450,15 @@ struct default_init_t
 //! Value used to tag that the inserted values
 //! should be default initialized
 BOOST_CONTAINER_CONSTANT_VAR default_init_t default_init = default_init_t();
+
+//! Type used to tag that the inserted values
+//! should be constructed concurrently by several threads
+struct parallel_init_t
+{};
+
+//! Value used to tag that the inserted values
+//! should be constructed concurrently by several threads
+BOOST_CONTAINER_CONSTANT_VAR parallel_init_t parallel_init = parallel_init_t();
 #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 
 //! Type used to tag that the inserted values
@@ -388,6 +481,7 @@ struct dummy
       (void)ordered_range;
       (void)ordered_unique_range;
       (void)default_init;
+      (void)parallel_init;
    }
 };
 
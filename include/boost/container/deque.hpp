@@ -26,6 +26,7 @@
 // container
 #include <boost/container/container_fwd.hpp>
 #include <boost/container/detail/deque_impl.hpp>
+#include <boost/container/trivially_relocatable.hpp>
 #include <boost/container/allocator_traits.hpp>
 
 #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
@@ -988,6 +989,19 @@ struct has_trivial_destructor_after_move<boost::container::deque<T, Allocator, O
    : has_trivial_destructor_after_move<boost::container::deque_impl<T, Allocator, false, Options> >
 {};
 
+namespace container {
+
+//!is_trivially_relocatable<> == true_type
+//!specialization for optimizations
+template <class T, class Allocator, class Options>
+struct is_trivially_relocatable<boost::container::deque<T, Allocator, Options> >
+   : dtl::is_trivially_relocatable_holder
+      < typename boost::container::deque<T, Allocator, Options>::allocator_type
+      , typename boost::container::deque<T, Allocator, Options>::pointer>
+{};
+
+}  //namespace container {
+
 }  //namespace boost {
 
 #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
@@ -45,53 +45,93 @@
 
 namespace boost { namespace container { namespace dtl {
 
+//Base of the proxies that check themselves if the values they write might be
+//read from a buffer (see insert_proxy_alias)
+struct insert_alias_checking_proxy
+{};
+
+inline bool insert_address_in_range(const void *p, const void *b, const void *e)
+{
+   return static_cast<const char*>(b) <= static_cast<const char*>(p)
+       && static_cast<const char*>(p)  <  static_cast<const char*>(e);
+}
+
+//A range can't span two buffers, so only the first element of contiguous ranges is checked.
+//Other iterators (e.g. adaptors) might read from the buffer through any element.
+template<class FwdIt>
+inline bool insert_range_may_alias(const FwdIt &first, const void *b, const void *e, true_type)
+{  return insert_address_in_range(boost::movelib::iterator_to_raw_pointer(first), b, e);  }
+
+template<class FwdIt>
+inline bool insert_range_may_alias(const FwdIt &, const void *, const void *, false_type)
+{  return true;  }
+
+//Only arguments that are values are checked. Pointers, iterators, views and other
+//class types might refer to the buffer.
+template<class ValueType, class Arg>
+inline bool insert_emplace_arg_may_alias(const Arg &a, const void *b, const void *e)
+{
+   typedef typename remove_cvref<Arg>::type arg_t;
+   return !( is_integral<arg_t>::value || is_floating_point<arg_t>::value
+          || is_enum<arg_t>::value || is_same<arg_t, ValueType>::value )
+      || insert_address_in_range(&a, b, e);
+}
+
 template<class Allocator, class FwdIt>
 struct move_insert_range_proxy
+   :  public insert_alias_checking_proxy
 {
    typedef typename allocator_traits<Allocator>::value_type value_type;
 
-   inline explicit move_insert_range_proxy(FwdIt first)
+   inline BOOST_CONTAINER_CONSTEXPR20 explicit move_insert_range_proxy(FwdIt first)
       :  first_(first)
    {}
 
    template<class Iterator>
-   inline void uninitialized_copy_n_and_update(Allocator &a, Iterator p, std::size_t n)
+   inline BOOST_CONTAINER_CONSTEXPR20 void uninitialized_copy_n_and_update(Allocator &a, Iterator p, std::size_t n)
    {
       this->first_ = ::boost::container::uninitialized_move_alloc_n_source
          (a, this->first_, n, p);
    }
 
    template<class Iterator>
-   inline void copy_n_and_update(Allocator &, Iterator p, std::size_t n)
+   inline BOOST_CONTAINER_CONSTEXPR20 void copy_n_and_update(Allocator &, Iterator p, std::size_t n)
    {
       this->first_ = ::boost::container::move_n_source(this->first_, n, p);
    }
 
+   bool may_alias(const void *b, const void *e) const
+   {  return (insert_range_may_alias)(this->first_, b, e, bool_<are_elements_contiguous<FwdIt>::value>());  }
+
    FwdIt first_;
 };
 
 
 template<class Allocator, class FwdIt>
 struct insert_range_proxy
+   :  public insert_alias_checking_proxy
 {
    typedef typename allocator_traits<Allocator>::value_type value_type;
 
-   inline explicit insert_range_proxy(FwdIt first)
+   inline BOOST_CONTAINER_CONSTEXPR20 explicit insert_range_proxy(FwdIt first)
       :  first_(first)
    {}
 
    template<class Iterator>
-   inline void uninitialized_copy_n_and_update(Allocator &a, Iterator p, std::size_t n)
+   inline BOOST_CONTAINER_CONSTEXPR20 void uninitialized_copy_n_and_update(Allocator &a, Iterator p, std::size_t n)
    {
       this->first_ = ::boost::container::uninitialized_copy_alloc_n_source(a, this->first_, n, p);
    }
 
    template<class Iterator>
-   inline void copy_n_and_update(Allocator &, Iterator p, std::size_t n)
+   inline BOOST_CONTAINER_CONSTEXPR20 void copy_n_and_update(Allocator &, Iterator p, std::size_t n)
    {
       this->first_ = ::boost::container::copy_n_source(this->first_, n, p);
    }
 
+   bool may_alias(const void *b, const void *e) const
+   {  return (insert_range_may_alias)(this->first_, b, e, bool_<are_elements_contiguous<FwdIt>::value>());  }
+
    FwdIt first_;
 };
 
@@ -101,16 +141,16 @@ struct insert_n_copies_proxy
 {
    typedef typename allocator_traits<Allocator>::value_type value_type;
 
-   inline explicit insert_n_copies_proxy(const value_type &v)
+   inline BOOST_CONTAINER_CONSTEXPR20 explicit insert_n_copies_proxy(const value_type &v)
       :  v_(v)
    {}
 
    template<class Iterator>
-   inline void uninitialized_copy_n_and_update(Allocator &a, Iterator p, std::size_t n) const
+   inline BOOST_CONTAINER_CONSTEXPR20 void uninitialized_copy_n_and_update(Allocator &a, Iterator p, std::size_t n) const
    {  boost::container::uninitialized_fill_alloc_n(a, v_, n, p);  }
 
    template<class Iterator>
-   inline void copy_n_and_update(Allocator &, Iterator p, std::size_t n) const
+   inline BOOST_CONTAINER_CONSTEXPR20 void copy_n_and_update(Allocator &, Iterator p, std::size_t n) const
    {
       while (n){
          --n;
@@ -130,12 +170,20 @@ struct insert_value_initialized_n_proxy
    typedef typename dtl::aligned_storage<sizeof(value_type), dtl::alignment_of<value_type>::value>::type storage_t;
 
    template<class Iterator>
-   inline void uninitialized_copy_n_and_update(Allocator &a, Iterator p, std::size_t n) const
+   inline BOOST_CONTAINER_CONSTEXPR20 void uninitialized_copy_n_and_update(Allocator &a, Iterator p, std::size_t n) const
    {  boost::container::uninitialized_value_init_alloc_n(a, n, p);  }
 
    template<class Iterator>
-   void copy_n_and_update(Allocator &a, Iterator p, std::size_t n) const
+   inline BOOST_CONTAINER_CONSTEXPR20 void copy_n_and_update(Allocator &a, Iterator p, std::size_t n) const
    {
+      #if defined(BOOST_CONTAINER_HAS_CXX20_CONSTEXPR)
+      if(BOOST_CONTAINER_IS_CONSTANT_EVALUATED()){
+         for (; n; --n, ++p){
+            *p = value_type();
+         }
+         return;
+      }
+      #endif
       while (n){
          --n;
          storage_t v;
@@ -156,13 +204,13 @@ struct insert_default_initialized_n_proxy
    typedef typename dtl::aligned_storage<sizeof(value_type), dtl::alignment_of<value_type>::value>::type storage_t;
 
    template<class Iterator>
-   inline void uninitialized_copy_n_and_update(Allocator &a, Iterator p, std::size_t n) const
+   inline BOOST_CONTAINER_CONSTEXPR20 void uninitialized_copy_n_and_update(Allocator &a, Iterator p, std::size_t n) const
    {  boost::container::uninitialized_default_init_alloc_n(a, n, p);  }
 
    template<class Iterator>
-   void copy_n_and_update(Allocator &a, Iterator p, std::size_t n) const
+   inline BOOST_CONTAINER_CONSTEXPR20 void copy_n_and_update(Allocator &a, Iterator p, std::size_t n) const
    {
-      if(!is_pod<value_type>::value){
+      if(!is_pod<value_type>::value && !BOOST_CONTAINER_IS_CONSTANT_EVALUATED()){
          while (n){
             --n;
             typename dtl::aligned_storage<sizeof(value_type), dtl::alignment_of<value_type>::value>::type v;
@@ -184,19 +232,19 @@ struct insert_copy_proxy
 
    BOOST_STATIC_CONSTEXPR bool single_value = true;
 
-   inline explicit insert_copy_proxy(const value_type &v)
+   inline BOOST_CONTAINER_CONSTEXPR20 explicit insert_copy_proxy(const value_type &v)
       :  v_(v)
    {}
 
    template<class Iterator>
-   inline void uninitialized_copy_n_and_update(Allocator &a, Iterator p, std::size_t n) const
+   inline BOOST_CONTAINER_CONSTEXPR20 void uninitialized_copy_n_and_update(Allocator &a, Iterator p, std::size_t n) const
    {
       BOOST_ASSERT(n == 1);  (void)n;
       alloc_traits::construct( a, boost::movelib::iterator_to_raw_pointer(p), v_);
    }
 
    template<class Iterator>
-   inline void copy_n_and_update(Allocator &, Iterator p, std::size_t n) const
+   inline BOOST_CONTAINER_CONSTEXPR20 void copy_n_and_update(Allocator &, Iterator p, std::size_t n) const
    {
       BOOST_ASSERT(n == 1);  (void)n;
       *p = v_;
@@ -214,19 +262,19 @@ struct insert_move_proxy
 
    BOOST_STATIC_CONSTEXPR bool single_value = true;
 
-   inline explicit insert_move_proxy(value_type &v)
+   inline BOOST_CONTAINER_CONSTEXPR20 explicit insert_move_proxy(value_type &v)
       :  v_(v)
    {}
 
    template<class Iterator>
-   inline void uninitialized_copy_n_and_update(Allocator &a, Iterator p, std::size_t n) const
+   inline BOOST_CONTAINER_CONSTEXPR20 void uninitialized_copy_n_and_update(Allocator &a, Iterator p, std::size_t n) const
    {
       BOOST_ASSERT(n == 1);  (void)n;
       alloc_traits::construct( a, boost::movelib::iterator_to_raw_pointer(p), ::boost::move(v_) );
    }
 
    template<class Iterator>
-   inline void copy_n_and_update(Allocator &, Iterator p, std::size_t n) const
+   inline BOOST_CONTAINER_CONSTEXPR20 void copy_n_and_update(Allocator &, Iterator p, std::size_t n) const
    {
       BOOST_ASSERT(n == 1);  (void)n;
       *p = ::boost::move(v_);
@@ -236,17 +284,68 @@ struct insert_move_proxy
 };
 
 template<class It, class Allocator>
-inline insert_move_proxy<Allocator> get_insert_value_proxy(BOOST_RV_REF(typename boost::container::iterator_traits<It>::value_type) v)
+inline BOOST_CONTAINER_CONSTEXPR20 insert_move_proxy<Allocator> get_insert_value_proxy(BOOST_RV_REF(typename boost::container::iterator_traits<It>::value_type) v)
 {
    return insert_move_proxy<Allocator>(v);
 }
 
 template<class It, class Allocator>
-inline insert_copy_proxy<Allocator> get_insert_value_proxy(const typename boost::container::iterator_traits<It>::value_type &v)
+inline BOOST_CONTAINER_CONSTEXPR20 insert_copy_proxy<Allocator> get_insert_value_proxy(const typename boost::container::iterator_traits<It>::value_type &v)
 {
    return insert_copy_proxy<Allocator>(v);
 }
 
+//Tells if the values written by an insertion proxy might be read from [b, e), the
+//storage of the container. Used before asking the allocator to move the buffer
+//(allow_relocation), as a relocation invalidates references and iterators into it.
+//Range and emplace proxies check the addresses of their arguments, other proxies
+//conservatively report that they might alias the buffer.
+template<class Allocator, class Proxy>
+class insert_proxy_alias
+{
+   typedef typename allocator_traits<Allocator>::value_type value_type;
+   typedef integral_constant<unsigned, 0u> may_alias_t;
+   typedef integral_constant<unsigned, 1u> no_alias_t;
+   typedef integral_constant<unsigned, 2u> copy_t;
+   typedef integral_constant<unsigned, 3u> move_t;
+   typedef integral_constant<unsigned, 4u> n_copies_t;
+   typedef integral_constant<unsigned, 5u> self_check_t;
+
+   BOOST_STATIC_CONSTEXPR unsigned kind =
+        is_convertible<const Proxy*, const insert_copy_proxy<Allocator>*>::value ? 2u
+      : is_convertible<const Proxy*, const insert_move_proxy<Allocator>*>::value ? 3u
+      : is_convertible<const Proxy*, const insert_n_copies_proxy<Allocator>*>::value ? 4u
+      : (  is_same<Proxy, insert_value_initialized_n_proxy<Allocator> >::value
+        || is_same<Proxy, insert_default_initialized_n_proxy<Allocator> >::value) ? 1u
+      : is_convertible<const Proxy*, const insert_alias_checking_proxy*>::value ? 5u
+      : 0u;
+
+   static bool in_range(const value_type &v, const value_type *b, const value_type *e)
+   {  return b <= &v && &v < e;  }
+
+   static bool priv_check(const Proxy &, const value_type *, const value_type *, may_alias_t)
+   {  return true;  }
+
+   static bool priv_check(const Proxy &, const value_type *, const value_type *, no_alias_t)
+   {  return false;  }
+
+   static bool priv_check(const Proxy &p, const value_type *b, const value_type *e, copy_t)
+   {  return in_range(static_cast<const insert_copy_proxy<Allocator>&>(p).v_, b, e);  }
+
+   static bool priv_check(const Proxy &p, const value_type *b, const value_type *e, move_t)
+   {  return in_range(static_cast<const insert_move_proxy<Allocator>&>(p).v_, b, e);  }
+
+   static bool priv_check(const Proxy &p, const value_type *b, const value_type *e, n_copies_t)
+   {  return in_range(static_cast<const insert_n_copies_proxy<Allocator>&>(p).v_, b, e);  }
+
+   static bool priv_check(const Proxy &p, const value_type *b, const value_type *e, self_check_t)
+   {  return p.may_alias(b, e);  }
+
+   public:
+   static bool check(const Proxy &p, const value_type *b, const value_type *e)
+   {  return priv_check(p, b, e, integral_constant<unsigned, kind>());  }
+};
+
 }}}   //namespace boost { namespace container { namespace dtl {
 
 #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
@@ -260,6 +359,7 @@ namespace dtl {
 
 template<class Allocator, class ...Args>
 struct insert_nonmovable_emplace_proxy
+   :  public insert_alias_checking_proxy
 {
    typedef boost::container::allocator_traits<Allocator>   alloc_traits;
    typedef typename alloc_traits::value_type       value_type;
@@ -267,22 +367,37 @@ struct insert_nonmovable_emplace_proxy
 
    BOOST_STATIC_CONSTEXPR bool single_value = true;
 
-   inline explicit insert_nonmovable_emplace_proxy(BOOST_FWD_REF(Args)... args)
+   inline BOOST_CONTAINER_CONSTEXPR20 explicit insert_nonmovable_emplace_proxy(BOOST_FWD_REF(Args)... args)
       : args_(args...)
    {}
 
    template<class Iterator>
-   BOOST_CONTAINER_FORCEINLINE void uninitialized_copy_n_and_update(Allocator &a, Iterator p, std::size_t n)
+   BOOST_CONTAINER_FORCEINLINE BOOST_CONTAINER_CONSTEXPR20 void uninitialized_copy_n_and_update(Allocator &a, Iterator p, std::size_t n)
    {  this->priv_uninitialized_copy_some_and_update(a, index_tuple_t(), p, n);  }
 
    private:
    template<std::size_t ...IdxPack, class Iterator>
-   inline void priv_uninitialized_copy_some_and_update(Allocator &a, const index_tuple<IdxPack...>&, Iterator p, std::size_t n)
+   inline BOOST_CONTAINER_CONSTEXPR20 void priv_uninitialized_copy_some_and_update(Allocator &a, const index_tuple<IdxPack...>&, Iterator p, std::size_t n)
    {
       BOOST_ASSERT(n == 1); (void)n;
       alloc_traits::construct( a, boost::movelib::iterator_to_raw_pointer(p), ::boost::forward<Args>(get<IdxPack>(this->args_))... );
    }
 
+   template<std::size_t ...IdxPack>
+   bool priv_may_alias(const index_tuple<IdxPack...>&, const void *b, const void *e) const
+   {
+      const bool alias[] = { false, (insert_emplace_arg_may_alias<value_type>)(get<IdxPack>(this->args_), b, e)... };
+      for(std::size_t i = 0; i != sizeof(alias)/sizeof(alias[0]); ++i){
+         if(alias[i])
+            return true;
+      }
+      return false;
+   }
+
+   public:
+   bool may_alias(const void *b, const void *e) const
+   {  return this->priv_may_alias(index_tuple_t(), b, e);  }
+
    protected:
    tuple<Args&...> args_;
 };
@@ -298,20 +413,27 @@ struct insert_emplace_proxy
 
    BOOST_STATIC_CONSTEXPR bool single_value = true;
 
-   inline explicit insert_emplace_proxy(BOOST_FWD_REF(Args)... args)
+   inline BOOST_CONTAINER_CONSTEXPR20 explicit insert_emplace_proxy(BOOST_FWD_REF(Args)... args)
       : base_t(::boost::forward<Args>(args)...)
    {}
 
    template<class Iterator>
-   BOOST_CONTAINER_FORCEINLINE void copy_n_and_update(Allocator &a, Iterator p, std::size_t n)
+   BOOST_CONTAINER_FORCEINLINE BOOST_CONTAINER_CONSTEXPR20 void copy_n_and_update(Allocator &a, Iterator p, std::size_t n)
    {  this->priv_copy_some_and_update(a, index_tuple_t(), p, n);  }
 
    private:
 
    template<std::size_t ...IdxPack, class Iterator>
-   inline void priv_copy_some_and_update(Allocator &a, const index_tuple<IdxPack...>&, Iterator p, std::size_t n)
+   inline BOOST_CONTAINER_CONSTEXPR20 void priv_copy_some_and_update(Allocator &a, const index_tuple<IdxPack...>&, Iterator p, std::size_t n)
    {
       BOOST_ASSERT(n ==1); (void)n;
+      #if defined(BOOST_CONTAINER_HAS_CXX20_CONSTEXPR)
+      if(BOOST_CONTAINER_IS_CONSTANT_EVALUATED()){
+         //Raw storage can't be reinterpreted in constant expressions
+         *p = value_type(::boost::forward<Args>(get<IdxPack>(this->args_))...);
+         return;
+      }
+      #endif
       typename dtl::aligned_storage<sizeof(value_type), dtl::alignment_of<value_type>::value>::type v;
       alloc_traits::construct(a, (value_type*)&v, ::boost::forward<Args>(get<IdxPack>(this->args_))...);
       value_type *vp = move_detail::launder_cast<value_type *>(&v);
@@ -335,7 +457,7 @@ struct insert_emplace_proxy<Allocator, typename boost::container::allocator_trai
 {
    BOOST_STATIC_CONSTEXPR bool single_value = true;
 
-   inline explicit insert_emplace_proxy(typename boost::container::allocator_traits<Allocator>::value_type &&v)
+   inline BOOST_CONTAINER_CONSTEXPR20 explicit insert_emplace_proxy(typename boost::container::allocator_traits<Allocator>::value_type &&v)
    : insert_move_proxy<Allocator>(v)
    {}
 };
@@ -352,7 +474,7 @@ struct insert_emplace_proxy<Allocator
 
    BOOST_STATIC_CONSTEXPR bool single_value = true;
 
-   inline explicit insert_emplace_proxy(const typename boost::container::allocator_traits<Allocator>::value_type &v)
+   inline BOOST_CONTAINER_CONSTEXPR20 explicit insert_emplace_proxy(const typename boost::container::allocator_traits<Allocator>::value_type &v)
    : insert_copy_proxy<Allocator>(v)
    {}
 };
@@ -363,7 +485,7 @@ struct insert_emplace_proxy<Allocator, typename boost::container::allocator_trai
 {
    BOOST_STATIC_CONSTEXPR bool single_value = true;
 
-   inline explicit insert_emplace_proxy(const typename boost::container::allocator_traits<Allocator>::value_type &v)
+   inline BOOST_CONTAINER_CONSTEXPR20 explicit insert_emplace_proxy(const typename boost::container::allocator_traits<Allocator>::value_type &v)
    : insert_copy_proxy<Allocator>(v)
    {}
 };
@@ -376,7 +498,7 @@ struct insert_emplace_proxy<Allocator
 {
    BOOST_STATIC_CONSTEXPR bool single_value = true;
 
-   inline explicit insert_emplace_proxy(const typename boost::container::allocator_traits<Allocator>::value_type &v)
+   inline BOOST_CONTAINER_CONSTEXPR20 explicit insert_emplace_proxy(const typename boost::container::allocator_traits<Allocator>::value_type &v)
    : insert_copy_proxy<Allocator>(v)
    {}
 };
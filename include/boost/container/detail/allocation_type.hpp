@@ -21,6 +21,7 @@
 
 #include <boost/container/detail/config_begin.hpp>
 #include <boost/container/detail/workaround.hpp>
+#include <cstddef>
 
 namespace boost {
 namespace container {
@@ -37,7 +38,8 @@ enum allocation_type_v
    shrink_in_place_v = 0x08,
    nothrow_allocation_v = 0x10,
    zero_memory_v = 0x20,
-   try_shrink_in_place_v = 0x40
+   try_shrink_in_place_v = 0x40,
+   allow_relocation_v = 0x80
 };
 
 typedef unsigned int allocation_type;
@@ -49,6 +51,21 @@ BOOST_CONTAINER_CONSTANT_VAR allocation_type shrink_in_place    = (allocation_ty
 BOOST_CONTAINER_CONSTANT_VAR allocation_type try_shrink_in_place= (allocation_type)try_shrink_in_place_v;
 BOOST_CONTAINER_CONSTANT_VAR allocation_type nothrow_allocation = (allocation_type)nothrow_allocation_v;
 BOOST_CONTAINER_CONSTANT_VAR allocation_type zero_memory        = (allocation_type)zero_memory_v;
+//! Combined with `expand_fwd`, allows the allocator to move the buffer to a new address together
+//! with its contents (e.g. remapping memory pages) if it can't be expanded in place. In that
+//! case the new address is returned and also stored in the `reuse` argument. Containers pass
+//! this flag only for trivially relocatable elements.
+BOOST_CONTAINER_CONSTANT_VAR allocation_type allow_relocation   = (allocation_type)allow_relocation_v;
+
+//! The return type of `allocate_at_least` functions: a pointer to the allocated storage
+//! and the number of elements that storage can hold, which is at least the requested number.
+//! Mimics C++23 `std::allocation_result`.
+template<class Pointer, class SizeType = std::size_t>
+struct allocation_result
+{
+   Pointer ptr;
+   SizeType count;
+};
 
 }  //namespace container {
 }  //namespace boost {
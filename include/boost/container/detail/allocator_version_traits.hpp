@@ -139,7 +139,11 @@ struct allocator_version_traits<Allocator, 1>
       }
       else{
          BOOST_CONTAINER_TRY{
-            ret = a.allocate(prefer_in_recvd_out_size);
+            //Ask for the real size of the allocation so that callers can use it
+            const allocation_result<pointer, size_type> r =
+               boost::container::allocator_traits<Allocator>::allocate_at_least(a, prefer_in_recvd_out_size);
+            ret = r.ptr;
+            prefer_in_recvd_out_size = r.count;
          }
          BOOST_CONTAINER_CATCH(...){
             if(!(command & nothrow_allocation)){
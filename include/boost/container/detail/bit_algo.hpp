@@ -0,0 +1,194 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#ifndef BOOST_CONTAINER_DETAIL_BIT_ALGO_HPP
+#define BOOST_CONTAINER_DETAIL_BIT_ALGO_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/detail/bit_utilities.hpp>
+#include <boost/cstdint.hpp>
+#include <cstddef>
+
+//Block kernels used by bit_vector. SSE2 is used for bitwise operations and
+//block searches, SSSE3 (nibble lookup) for population counts.
+#if !defined(BOOST_CONTAINER_BIT_ALGO_DISABLE_SIMD)
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#     define BOOST_CONTAINER_BIT_ALGO_SSE2
+#     include <emmintrin.h>
+#  endif
+#  if defined(BOOST_CONTAINER_BIT_ALGO_SSE2) && (defined(__SSSE3__) || defined(__AVX__))
+#     define BOOST_CONTAINER_BIT_ALGO_SSSE3
+#     include <tmmintrin.h>
+#  endif
+#endif
+
+namespace boost {
+namespace container {
+namespace dtl {
+
+typedef boost::uint64_t bit_block_t;
+
+BOOST_STATIC_CONSTEXPR std::size_t bits_per_bit_block = 64u;
+
+//Returns the number of set bits in [p, p + n)
+inline std::size_t bit_count_blocks(const bit_block_t *p, std::size_t n)
+{
+   std::size_t i = 0u;
+   std::size_t r = 0u;
+   #if defined(BOOST_CONTAINER_BIT_ALGO_SSSE3)
+   if(n >= 4u){
+      const __m128i lookup   = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+      const __m128i low_mask = _mm_set1_epi8(0x0f);
+      const __m128i zero     = _mm_setzero_si128();
+      __m128i acc = zero;
+      for(; i + 4u <= n; i += 4u){
+         const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+         const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + 2u));
+         const __m128i ca = _mm_add_epi8
+            ( _mm_shuffle_epi8(lookup, _mm_and_si128(a, low_mask))
+            , _mm_shuffle_epi8(lookup, _mm_and_si128(_mm_srli_epi16(a, 4), low_mask)));
+         const __m128i cb = _mm_add_epi8
+            ( _mm_shuffle_epi8(lookup, _mm_and_si128(b, low_mask))
+            , _mm_shuffle_epi8(lookup, _mm_and_si128(_mm_srli_epi16(b, 4), low_mask)));
+         //Each byte holds at most 8 + 8, so the sum can't overflow before the horizontal add
+         acc = _mm_add_epi64(acc, _mm_sad_epu8(_mm_add_epi8(ca, cb), zero));
+      }
+      boost::uint64_t lanes[2];
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+      r = std::size_t(lanes[0] + lanes[1]);
+   }
+   #endif
+   //Independent accumulators so that several popcounts are in flight
+   std::size_t r0 = 0u, r1 = 0u, r2 = 0u, r3 = 0u;
+   for(; i + 4u <= n; i += 4u){
+      r0 += std::size_t(dtl::popcount(p[i]));
+      r1 += std::size_t(dtl::popcount(p[i + 1u]));
+      r2 += std::size_t(dtl::popcount(p[i + 2u]));
+      r3 += std::size_t(dtl::popcount(p[i + 3u]));
+   }
+   for(; i != n; ++i){
+      r0 += std::size_t(dtl::popcount(p[i]));
+   }
+   return r + r0 + r1 + r2 + r3;
+}
+
+//Returns the index of the first block in [first, n) that is not all zeros
+//(or all ones if ones is true), or n if there is no such block
+inline std::size_t bit_find_block_not_filled
+   (const bit_block_t *p, std::size_t first, std::size_t n, const bool ones)
+{
+   std::size_t i = first;
+   #if defined(BOOST_CONTAINER_BIT_ALGO_SSE2)
+   const __m128i v = _mm_set1_epi32(ones ? -1 : 0);
+   for(; i + 4u <= n; i += 4u){
+      const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+      const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + 2u));
+      const __m128i eq = _mm_and_si128(_mm_cmpeq_epi32(a, v), _mm_cmpeq_epi32(b, v));
+      if(_mm_movemask_epi8(eq) != 0xFFFF)
+         break;
+   }
+   #endif
+   const bit_block_t value = ones ? ~bit_block_t(0u) : bit_block_t(0u);
+   for(; i != n && p[i] == value; ++i){}
+   return i;
+}
+
+struct bit_and_op
+{
+   bit_block_t operator()(bit_block_t a, bit_block_t b) const
+   {  return a & b;  }
+
+   #if defined(BOOST_CONTAINER_BIT_ALGO_SSE2)
+   __m128i operator()(__m128i a, __m128i b) const
+   {  return _mm_and_si128(a, b);  }
+   #endif
+};
+
+struct bit_or_op
+{
+   bit_block_t operator()(bit_block_t a, bit_block_t b) const
+   {  return a | b;  }
+
+   #if defined(BOOST_CONTAINER_BIT_ALGO_SSE2)
+   __m128i operator()(__m128i a, __m128i b) const
+   {  return _mm_or_si128(a, b);  }
+   #endif
+};
+
+struct bit_xor_op
+{
+   bit_block_t operator()(bit_block_t a, bit_block_t b) const
+   {  return a ^ b;  }
+
+   #if defined(BOOST_CONTAINER_BIT_ALGO_SSE2)
+   __m128i operator()(__m128i a, __m128i b) const
+   {  return _mm_xor_si128(a, b);  }
+   #endif
+};
+
+struct bit_and_not_op
+{
+   bit_block_t operator()(bit_block_t a, bit_block_t b) const
+   {  return a & ~b;  }
+
+   #if defined(BOOST_CONTAINER_BIT_ALGO_SSE2)
+   __m128i operator()(__m128i a, __m128i b) const
+   {  return _mm_andnot_si128(b, a);  }
+   #endif
+};
+
+//d[i] = op(d[i], s[i]) for i in [0, n)
+template<class Op>
+inline void bit_transform_blocks(bit_block_t *d, const bit_block_t *s, std::size_t n, Op op)
+{
+   std::size_t i = 0u;
+   #if defined(BOOST_CONTAINER_BIT_ALGO_SSE2)
+   for(; i + 2u <= n; i += 2u){
+      const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(d + i));
+      const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(d + i), op(a, b));
+   }
+   #endif
+   for(; i != n; ++i){
+      d[i] = op(d[i], s[i]);
+   }
+}
+
+//d[i] = ~d[i] for i in [0, n)
+inline void bit_flip_blocks(bit_block_t *d, std::size_t n)
+{
+   std::size_t i = 0u;
+   #if defined(BOOST_CONTAINER_BIT_ALGO_SSE2)
+   const __m128i ones = _mm_set1_epi32(-1);
+   for(; i + 2u <= n; i += 2u){
+      const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(d + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(d + i), _mm_xor_si128(a, ones));
+   }
+   #endif
+   for(; i != n; ++i){
+      d[i] = ~d[i];
+   }
+}
+
+}  //namespace dtl {
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_DETAIL_BIT_ALGO_HPP
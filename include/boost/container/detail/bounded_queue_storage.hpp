@@ -0,0 +1,152 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_DETAIL_BOUNDED_QUEUE_STORAGE_HPP
+#define BOOST_CONTAINER_DETAIL_BOUNDED_QUEUE_STORAGE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+#if defined(BOOST_NO_CXX11_HDR_ATOMIC) || defined(BOOST_NO_CXX11_ALIGNAS)
+#  error "Boost.Container bounded queues require C++11 <atomic> and alignas"
+#endif
+
+// container
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/new_allocator.hpp>
+#include <boost/container/throw_exception.hpp>
+// container/detail
+#include <boost/container/detail/math_functions.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// move
+#include <boost/move/detail/to_raw_pointer.hpp>
+// std
+#include <atomic>
+#include <cstddef>
+
+//! Size of the cache line used to separate the indices written by producers from
+//! the ones written by consumers, so that they don't invalidate each other's cache lines.
+#ifndef BOOST_CONTAINER_CACHE_LINE_SIZE
+#  define BOOST_CONTAINER_CACHE_LINE_SIZE 64u
+#endif
+
+namespace boost {
+namespace container {
+namespace dtl {
+
+//An index updated by one side of the queue plus data only accessed by that side,
+//placed alone in a cache line
+template<class Cached>
+struct alignas(BOOST_CONTAINER_CACHE_LINE_SIZE) queue_index
+{
+   queue_index() BOOST_NOEXCEPT_OR_NOTHROW
+      : index(0u), cached()
+   {}
+
+   std::atomic<std::size_t> index;
+   Cached                   cached;
+};
+
+template<>
+struct alignas(BOOST_CONTAINER_CACHE_LINE_SIZE) queue_index<void>
+{
+   queue_index() BOOST_NOEXCEPT_OR_NOTHROW
+      : index(0u)
+   {}
+
+   std::atomic<std::size_t> index;
+};
+
+//Slot storage of bounded queues. If Capacity is not zero, slots are stored
+//inline, otherwise they are obtained from the allocator when the queue is constructed.
+template<class Slot, std::size_t Capacity, class Allocator>
+class bounded_queue_storage
+{
+   BOOST_CONTAINER_STATIC_ASSERT_MSG((Capacity & (Capacity - 1u)) == 0u, "Capacity must be a power of two");
+
+   public:
+   typedef Allocator allocator_type;
+
+   bounded_queue_storage() BOOST_NOEXCEPT_OR_NOTHROW
+   {}
+
+   BOOST_CONTAINER_FORCEINLINE Slot *slots() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_cast<Slot*>(static_cast<const Slot*>(static_cast<const void*>(m_storage.data)));  }
+
+   BOOST_CONTAINER_FORCEINLINE static std::size_t capacity() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return Capacity;  }
+
+   allocator_type get_allocator() const
+   {  return allocator_type();  }
+
+   private:
+   typename dtl::aligned_storage<sizeof(Slot)*Capacity, dtl::alignment_of<Slot>::value>::type m_storage;
+};
+
+template<class Slot, class Allocator>
+class bounded_queue_storage<Slot, 0u, Allocator>
+   : private allocator_traits<Allocator>::template portable_rebind_alloc<Slot>::type
+{
+   typedef typename allocator_traits<Allocator>::template portable_rebind_alloc<Slot>::type  slot_allocator_type;
+   typedef allocator_traits<slot_allocator_type>                                           slot_allocator_traits;
+   typedef typename slot_allocator_traits::pointer                                         slot_pointer;
+
+   public:
+   typedef Allocator allocator_type;
+
+   //Capacity is rounded up to a power of two
+   bounded_queue_storage(std::size_t capacity, const allocator_type &a)
+      : slot_allocator_type(a), m_slots(), m_capacity()
+   {
+      if(!capacity || capacity > (std::size_t(-1)/2u + 1u)){
+         throw_length_error("bounded queue: invalid capacity");
+      }
+      m_capacity = upper_power_of_2(capacity);
+      m_slots = slot_allocator_traits::allocate(this->slot_alloc(), m_capacity);
+   }
+
+   ~bounded_queue_storage()
+   {  slot_allocator_traits::deallocate(this->slot_alloc(), m_slots, m_capacity);  }
+
+   BOOST_CONTAINER_FORCEINLINE Slot *slots() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return boost::movelib::to_raw_pointer(m_slots);  }
+
+   BOOST_CONTAINER_FORCEINLINE std::size_t capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_capacity;  }
+
+   allocator_type get_allocator() const
+   {  return allocator_type(this->slot_alloc());  }
+
+   private:
+   slot_allocator_type &slot_alloc() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return *this;  }
+
+   const slot_allocator_type &slot_alloc() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return *this;  }
+
+   slot_pointer   m_slots;
+   std::size_t    m_capacity;
+};
+
+}  //namespace dtl {
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_DETAIL_BOUNDED_QUEUE_STORAGE_HPP
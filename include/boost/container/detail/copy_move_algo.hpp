@@ -20,6 +20,7 @@
 
 // container
 #include <boost/container/allocator_traits.hpp>
+#include <boost/container/trivially_relocatable.hpp>
 // container/detail
 #include <boost/container/detail/iterator.hpp>
 #include <boost/move/detail/iterator_to_raw_pointer.hpp>
@@ -176,6 +177,24 @@ struct disable_if_memtransfer_copy_assignable
    : disable_if<dtl::is_memtransfer_copy_assignable<I, O>, R>
 {};
 
+template <typename I, typename O>
+struct is_memtransfer_relocatable
+   : boost::move_detail::and_
+      < are_contiguous_and_same<I, O>
+      , ::boost::container::is_trivially_relocatable< typename ::boost::container::iter_value<I>::type >
+      >
+{};
+
+template <typename I, typename O, typename R>
+struct enable_if_memtransfer_relocatable
+   : enable_if<dtl::is_memtransfer_relocatable<I, O>, R>
+{};
+
+template <typename I, typename O, typename R>
+struct disable_if_memtransfer_relocatable
+   : disable_if<dtl::is_memtransfer_relocatable<I, O>, R>
+{};
+
 template <class T>
 struct has_single_value
 {
@@ -216,10 +235,48 @@ struct disable_if_single_value_proxy
    : disable_if<is_single_value_proxy<P>, R>
 {};
 
+//std::memmove for n elements of a trivially copyable type, also usable in constant expressions
+template<class T>
+BOOST_CONTAINER_FORCEINLINE BOOST_CONTAINER_CONSTEXPR20 void memmove_elements(T *dst, const T *src, std::size_t n) BOOST_NOEXCEPT_OR_NOTHROW
+{
+   #if defined(BOOST_CONTAINER_HAS_CXX20_CONSTEXPR)
+   if(BOOST_CONTAINER_IS_CONSTANT_EVALUATED()){
+      //Pointers to distinct objects can't be ordered in constant expressions,
+      //so the copy direction is chosen checking if dst points inside the source
+      if(dst != src){
+         bool backwards = false;
+         for(std::size_t i = 1u; i < n && !backwards; ++i){
+            backwards = src + i == dst;
+         }
+         if(backwards){
+            while(n){
+               --n;
+               ::std::construct_at(dst + n, src[n]);
+            }
+         }
+         else{
+            for(std::size_t i = 0u; i != n; ++i){
+               ::std::construct_at(dst + i, src[i]);
+            }
+         }
+      }
+      return;
+   }
+   #endif
+   std::memmove(reinterpret_cast<void *>(dst), src, sizeof(T)*n);
+}
+
+//Untyped source (e.g. move_iterator), not usable in constant expressions
+template<class T>
+BOOST_CONTAINER_FORCEINLINE void memmove_elements(T *dst, const void *src, std::size_t n) BOOST_NOEXCEPT_OR_NOTHROW
+{
+   std::memmove(reinterpret_cast<void *>(dst), src, sizeof(T)*n);
+}
+
 template
    <typename I, // I models InputIterator
     typename F> // F models ForwardIterator
-inline F memmove(I f, I l, F r) BOOST_NOEXCEPT_OR_NOTHROW
+inline BOOST_CONTAINER_CONSTEXPR20 F memmove(I f, I l, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {
    typedef typename boost::container::iter_value<I>::type      value_type;
    typedef typename boost::container::iterator_traits<F>::difference_type r_difference_type;
@@ -228,7 +285,7 @@ inline F memmove(I f, I l, F r) BOOST_NOEXCEPT_OR_NOTHROW
    const value_type *const end_raw = boost::movelib::iterator_to_raw_pointer(l);
    if(BOOST_LIKELY(beg_raw != end_raw && dest_raw && beg_raw)){
       const std::size_t n = std::size_t(end_raw - beg_raw)   ;
-      std::memmove(reinterpret_cast<void *>(dest_raw), beg_raw, sizeof(value_type)*n);
+      dtl::memmove_elements(dest_raw, beg_raw, n);
       r += static_cast<r_difference_type>(n);
    }
    return r;
@@ -237,15 +294,15 @@ inline F memmove(I f, I l, F r) BOOST_NOEXCEPT_OR_NOTHROW
 template
    <typename I, // I models InputIterator
     typename F> // F models ForwardIterator
-inline F memmove_n(I f, std::size_t n, F r) BOOST_NOEXCEPT_OR_NOTHROW
+inline BOOST_CONTAINER_CONSTEXPR20 F memmove_n(I f, std::size_t n, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {
    typedef typename boost::container::iter_value<I>::type value_type;
    typedef typename boost::container::iterator_traits<F>::difference_type r_difference_type;
    if(BOOST_LIKELY(n != 0)){
-      void *dst = boost::movelib::iterator_to_raw_pointer(r);
-      const void *src = boost::movelib::iterator_to_raw_pointer(f);
+      value_type *dst = boost::movelib::iterator_to_raw_pointer(r);
+      typename boost::movelib::detail::iterator_to_element_ptr<I>::type src = boost::movelib::iterator_to_raw_pointer(f);
       if (dst && src)
-         std::memmove(dst, src, sizeof(value_type)*n);
+         dtl::memmove_elements(dst, src, n);
       r += static_cast<r_difference_type>(n);
    }
 
@@ -255,15 +312,15 @@ inline F memmove_n(I f, std::size_t n, F r) BOOST_NOEXCEPT_OR_NOTHROW
 template
    <typename I, // I models InputIterator
     typename F> // F models ForwardIterator
-inline I memmove_n_source(I f, std::size_t n, F r) BOOST_NOEXCEPT_OR_NOTHROW
+inline BOOST_CONTAINER_CONSTEXPR20 I memmove_n_source(I f, std::size_t n, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {
    if(BOOST_LIKELY(n != 0)){
       typedef typename boost::container::iter_value<I>::type value_type;
       typedef typename boost::container::iterator_traits<I>::difference_type i_difference_type;
-      void *dst = boost::movelib::iterator_to_raw_pointer(r);
-      const void *src = boost::movelib::iterator_to_raw_pointer(f);
+      value_type *dst = boost::movelib::iterator_to_raw_pointer(r);
+      typename boost::movelib::detail::iterator_to_element_ptr<I>::type src = boost::movelib::iterator_to_raw_pointer(f);
       if (dst && src)
-         std::memmove(dst, src, sizeof(value_type)*n);
+         dtl::memmove_elements(dst, src, n);
       f += static_cast<i_difference_type>(n);
    }
    return f;
@@ -272,17 +329,17 @@ inline I memmove_n_source(I f, std::size_t n, F r) BOOST_NOEXCEPT_OR_NOTHROW
 template
    <typename I, // I models InputIterator
     typename F> // F models ForwardIterator
-inline I memmove_n_source_dest(I f, std::size_t n, F &r) BOOST_NOEXCEPT_OR_NOTHROW
+inline BOOST_CONTAINER_CONSTEXPR20 I memmove_n_source_dest(I f, std::size_t n, F &r) BOOST_NOEXCEPT_OR_NOTHROW
 {
    typedef typename boost::container::iter_value<I>::type value_type;
    typedef typename boost::container::iterator_traits<F>::difference_type i_difference_type;
    typedef typename boost::container::iterator_traits<F>::difference_type f_difference_type;
 
    if(BOOST_LIKELY(n != 0)){
-      void *dst = boost::movelib::iterator_to_raw_pointer(r);
-      const void *src = boost::movelib::iterator_to_raw_pointer(f);
+      value_type *dst = boost::movelib::iterator_to_raw_pointer(r);
+      typename boost::movelib::detail::iterator_to_element_ptr<I>::type src = boost::movelib::iterator_to_raw_pointer(f);
       if (dst && src)
-         std::memmove(dst, src, sizeof(value_type)*n);
+         dtl::memmove_elements(dst, src, n);
       f += i_difference_type(n);
       r += f_difference_type(n);
    }
@@ -348,7 +405,7 @@ template
    <typename Allocator,
     typename I, // I models InputIterator
     typename F> // F models ForwardIterator
-inline typename dtl::disable_if_memtransfer_copy_constructible<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_constructible<I, F, F>::type
    uninitialized_move_alloc(Allocator &a, I f, I l, F r)
 {
    F back = r;
@@ -372,7 +429,7 @@ template
    <typename Allocator,
     typename I, // I models InputIterator
     typename F> // F models ForwardIterator
-inline typename dtl::enable_if_memtransfer_copy_constructible<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_copy_constructible<I, F, F>::type
    uninitialized_move_alloc(Allocator &, I f, I l, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {  return dtl::memmove(f, l, r); }
 
@@ -393,7 +450,7 @@ template
    <typename Allocator,
     typename I, // I models InputIterator
     typename F> // F models ForwardIterator
-inline typename dtl::disable_if_memtransfer_copy_constructible<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_constructible<I, F, F>::type
    uninitialized_move_alloc_n(Allocator &a, I f, std::size_t n, F r)
 {
    F back = r;
@@ -418,7 +475,7 @@ template
    <typename Allocator,
     typename I, // I models InputIterator
     typename F> // F models ForwardIterator
-inline typename dtl::enable_if_memtransfer_copy_constructible<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_copy_constructible<I, F, F>::type
    uninitialized_move_alloc_n(Allocator &, I f, std::size_t n, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {  return dtl::memmove_n(f, n, r); }
 
@@ -439,7 +496,7 @@ template
    <typename Allocator,
     typename I, // I models InputIterator
     typename F> // F models ForwardIterator
-inline typename dtl::disable_if_memtransfer_copy_constructible<I, F, I>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_constructible<I, F, I>::type
    uninitialized_move_alloc_n_source(Allocator &a, I f, std::size_t n, F r)
 {
    F back = r;
@@ -464,7 +521,7 @@ template
    <typename Allocator,
     typename I, // I models InputIterator
     typename F> // F models ForwardIterator
-inline typename dtl::enable_if_memtransfer_copy_constructible<I, F, I>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_copy_constructible<I, F, I>::type
    uninitialized_move_alloc_n_source(Allocator &, I f, std::size_t n, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {  return dtl::memmove_n_source(f, n, r); }
 
@@ -485,7 +542,7 @@ template
    <typename Allocator,
     typename I, // I models InputIterator
     typename F> // F models ForwardIterator
-inline typename dtl::disable_if_memtransfer_copy_constructible<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_constructible<I, F, F>::type
    uninitialized_copy_alloc(Allocator &a, I f, I l, F r)
 {
    F back = r;
@@ -509,7 +566,7 @@ template
    <typename Allocator,
     typename I, // I models InputIterator
     typename F> // F models ForwardIterator
-inline typename dtl::enable_if_memtransfer_copy_constructible<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_copy_constructible<I, F, F>::type
    uninitialized_copy_alloc(Allocator &, I f, I l, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {  return dtl::memmove(f, l, r); }
 
@@ -530,7 +587,7 @@ template
    <typename Allocator,
     typename I, // I models InputIterator
     typename F> // F models ForwardIterator
-inline typename dtl::disable_if_memtransfer_copy_constructible<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_constructible<I, F, F>::type
    uninitialized_copy_alloc_n(Allocator &a, I f, std::size_t n, F r)
 {
    F back = r;
@@ -566,7 +623,7 @@ template
    <typename Allocator,
     typename I, // I models InputIterator
     typename F> // F models ForwardIterator
-inline typename dtl::enable_if_memtransfer_copy_constructible<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_copy_constructible<I, F, F>::type
    uninitialized_copy_alloc_n(Allocator &, I f, std::size_t n, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {  return dtl::memmove_n(f, n, r); }
 
@@ -587,7 +644,7 @@ template
    <typename Allocator,
     typename I, // I models InputIterator
     typename F> // F models ForwardIterator
-inline typename dtl::disable_if_memtransfer_copy_constructible<I, F, I>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_constructible<I, F, I>::type
    uninitialized_copy_alloc_n_source(Allocator &a, I f, std::size_t n, F r)
 {
    F back = r;
@@ -611,7 +668,7 @@ template
    <typename Allocator,
     typename I, // I models InputIterator
     typename F> // F models ForwardIterator
-inline typename dtl::enable_if_memtransfer_copy_constructible<I, F, I>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_copy_constructible<I, F, I>::type
    uninitialized_copy_alloc_n_source(Allocator &, I f, std::size_t n, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {  return dtl::memmove_n_source(f, n, r); }
 
@@ -631,7 +688,7 @@ inline typename dtl::enable_if_memtransfer_copy_constructible<I, F, I>::type
 template
    <typename Allocator,
     typename F> // F models ForwardIterator
-inline typename dtl::disable_if_memzero_initializable<F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memzero_initializable<F, F>::type
    uninitialized_value_init_alloc_n(Allocator &a, std::size_t n, F r)
 {
    F back = r;
@@ -655,13 +712,21 @@ inline typename dtl::disable_if_memzero_initializable<F, F>::type
 template
    <typename Allocator,
     typename F> // F models ForwardIterator
-inline typename dtl::enable_if_memzero_initializable<F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memzero_initializable<F, F>::type
    uninitialized_value_init_alloc_n(Allocator &, std::size_t n, F r)
 {
    typedef typename boost::container::iterator_traits<F>::value_type value_type;
    typedef typename boost::container::iterator_traits<F>::difference_type r_difference_type;
 
    if (BOOST_LIKELY(n != 0)){
+      #if defined(BOOST_CONTAINER_HAS_CXX20_CONSTEXPR)
+      if(BOOST_CONTAINER_IS_CONSTANT_EVALUATED()){
+         for(std::size_t i = 0u; i != n; ++i){
+            ::std::construct_at(boost::movelib::iterator_to_raw_pointer(r) + i);
+         }
+         return r += static_cast<r_difference_type>(n);
+      }
+      #endif
       std::memset((void*)boost::movelib::iterator_to_raw_pointer(r), 0, sizeof(value_type)*n);
       r += static_cast<r_difference_type>(n);
    }
@@ -684,7 +749,7 @@ inline typename dtl::enable_if_memzero_initializable<F, F>::type
 template
    <typename Allocator,
     typename F> // F models ForwardIterator
-inline F uninitialized_default_init_alloc_n(Allocator &a, std::size_t n, F r)
+inline BOOST_CONTAINER_CONSTEXPR20 F uninitialized_default_init_alloc_n(Allocator &a, std::size_t n, F r)
 {
    F back = r;
    BOOST_CONTAINER_TRY{
@@ -721,7 +786,7 @@ template
    <typename Allocator,
     typename F, // F models ForwardIterator
     typename T>
-inline void uninitialized_fill_alloc(Allocator &a, F f, F l, const T &t)
+inline BOOST_CONTAINER_CONSTEXPR20 void uninitialized_fill_alloc(Allocator &a, F f, F l, const T &t)
 {
    F back = f;
    BOOST_CONTAINER_TRY{
@@ -757,7 +822,7 @@ template
    <typename Allocator,
     typename T,
     typename F> // F models ForwardIterator
-inline F uninitialized_fill_alloc_n(Allocator &a, const T &v, std::size_t n, F r)
+inline BOOST_CONTAINER_CONSTEXPR20 F uninitialized_fill_alloc_n(Allocator &a, const T &v, std::size_t n, F r)
 {
    F back = r;
    BOOST_CONTAINER_TRY{
@@ -786,7 +851,7 @@ inline F uninitialized_fill_alloc_n(Allocator &a, const T &v, std::size_t n, F r
 template
 <typename I,   // I models InputIterator
 typename F>    // F models ForwardIterator
-inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
    copy(I f, I l, F r)
 {
    while (f != l) {
@@ -799,7 +864,7 @@ inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
 template
 <typename I,   // I models InputIterator
 typename F>    // F models ForwardIterator
-inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
    copy(I f, I l, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {  return dtl::memmove(f, l, r); }
 
@@ -812,7 +877,7 @@ inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
 template
 <typename I,   // I models InputIterator
 typename F>   // F models ForwardIterator
-inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
    copy_n(I f, std::size_t n, F r)
 {
    while (n) {
@@ -826,7 +891,7 @@ inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
 template
 <typename I,   // I models InputIterator
 typename F>   // F models ForwardIterator
-inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
    copy_n(I f, std::size_t n, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {  return dtl::memmove_n(f, n, r); }
 
@@ -839,7 +904,7 @@ inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
 template
 <typename I,   // I models InputIterator
 typename F>   // F models ForwardIterator
-inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, I>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_assignable<I, F, I>::type
    copy_n_source(I f, std::size_t n, F r)
 {
    while (n) {
@@ -853,7 +918,7 @@ inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, I>::type
 template
 <typename I,   // I models InputIterator
 typename F>   // F models ForwardIterator
-inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, I>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_copy_assignable<I, F, I>::type
    copy_n_source(I f, std::size_t n, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {  return dtl::memmove_n_source(f, n, r); }
 
@@ -866,7 +931,7 @@ inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, I>::type
 template
 <typename I,   // I models InputIterator
 typename F>   // F models ForwardIterator
-inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, I>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_assignable<I, F, I>::type
    copy_n_source_dest(I f, std::size_t n, F &r)
 {
    while (n) {
@@ -880,7 +945,7 @@ inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, I>::type
 template
 <typename I,   // I models InputIterator
 typename F>   // F models ForwardIterator
-inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, I>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_copy_assignable<I, F, I>::type
    copy_n_source_dest(I f, std::size_t n, F &r) BOOST_NOEXCEPT_OR_NOTHROW
 {  return dtl::memmove_n_source_dest(f, n, r);  }
 
@@ -893,7 +958,7 @@ inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, I>::type
 template
 <typename I,   // I models InputIterator
 typename F>   // F models ForwardIterator
-inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
    move(I f, I l, F r)
 {
    while (f != l) {
@@ -906,7 +971,7 @@ inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
 template
 <typename I,   // I models InputIterator
 typename F>   // F models ForwardIterator
-inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
    move(I f, I l, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {  return dtl::memmove(f, l, r); }
 
@@ -919,7 +984,7 @@ inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
 template
 <typename I,   // I models InputIterator
 typename F>   // F models ForwardIterator
-inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
    move_n(I f, std::size_t n, F r)
 {
    while (n) {
@@ -933,7 +998,7 @@ inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
 template
 <typename I,   // I models InputIterator
 typename F>   // F models ForwardIterator
-inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
    move_n(I f, std::size_t n, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {  return dtl::memmove_n(f, n, r); }
 
@@ -946,7 +1011,7 @@ inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
 template
 <typename I,   // I models BidirectionalIterator
 typename F>    // F models ForwardIterator
-inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
    move_backward(I f, I l, F r)
 {
    while (f != l) {
@@ -959,14 +1024,14 @@ inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
 template
 <typename I,   // I models InputIterator
 typename F>   // F models ForwardIterator
-inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
    move_backward(I f, I l, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {
    typedef typename boost::container::iter_value<I>::type value_type;
    const std::size_t n = boost::container::iterator_udistance(f, l);
    if (BOOST_LIKELY(n != 0)){
       r -= n;
-      std::memmove(reinterpret_cast<void *>((boost::movelib::iterator_to_raw_pointer)(r)), (boost::movelib::iterator_to_raw_pointer)(f), sizeof(value_type)*n);
+      dtl::memmove_elements<value_type>((boost::movelib::iterator_to_raw_pointer)(r), (boost::movelib::iterator_to_raw_pointer)(f), n);
    }
    return r;
 }
@@ -980,7 +1045,7 @@ inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
 template
 <typename I,   // I models BidirectionalIterator
 typename F>    // F models ForwardIterator
-inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
    move_backward_n(I l, std::size_t n, F r)
 {
    while (n) {
@@ -994,15 +1059,13 @@ inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, F>::type
 template
 <typename I,   // I models InputIterator
 typename F>   // F models ForwardIterator
-inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
    move_backward_n(I l, std::size_t n, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {
    typedef typename boost::container::iter_value<I>::type value_type;
    if (BOOST_LIKELY(n != 0)){
       r -= n;
-      std::memmove (reinterpret_cast<void *>((boost::movelib::iterator_to_raw_pointer)(r))
-                  , reinterpret_cast<const void *>((boost::movelib::iterator_to_raw_pointer)(l) - n)
-                  , sizeof(value_type)*n);
+      dtl::memmove_elements<value_type>((boost::movelib::iterator_to_raw_pointer)(r), (boost::movelib::iterator_to_raw_pointer)(l) - n, n);
    }
    return r;
 }
@@ -1016,7 +1079,7 @@ inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, F>::type
 template
 <typename I,   // I models BidirectionalIterator
 typename F>    // F models ForwardIterator
-inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, I>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_assignable<I, F, I>::type
    move_backward_n_source(I l, std::size_t n, F r)
 {
    while (n) {
@@ -1030,7 +1093,7 @@ inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, I>::type
 template
 <typename I,   // I models InputIterator
 typename F>   // F models ForwardIterator
-inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, I>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_copy_assignable<I, F, I>::type
    move_backward_n_source(I l, std::size_t n, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {
    typedef typename boost::container::iter_value<I>::type value_type;
@@ -1038,9 +1101,7 @@ inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, I>::type
    if (BOOST_LIKELY(n != 0)){
       r -= n;
       l -= n;
-      std::memmove( reinterpret_cast<void *>((boost::movelib::iterator_to_raw_pointer)(r))
-                  , l
-                  , sizeof(value_type)*n);
+      dtl::memmove_elements<value_type>((boost::movelib::iterator_to_raw_pointer)(r), (boost::movelib::iterator_to_raw_pointer)(l), n);
    }
    return l;
 }
@@ -1055,7 +1116,7 @@ inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, I>::type
 template
 <typename I    // I models InputIterator
 ,typename F>   // F models ForwardIterator
-inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, I>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_assignable<I, F, I>::type
    move_n_source_dest(I f, std::size_t n, F &r)
 {
    while (n) {
@@ -1069,7 +1130,7 @@ inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, I>::type
 template
 <typename I    // I models InputIterator
 ,typename F>   // F models ForwardIterator
-inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, I>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_copy_assignable<I, F, I>::type
    move_n_source_dest(I f, std::size_t n, F &r) BOOST_NOEXCEPT_OR_NOTHROW
 {  return dtl::memmove_n_source_dest(f, n, r); }
 
@@ -1082,7 +1143,7 @@ inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, I>::type
 template
 <typename I    // I models InputIterator
 ,typename F>   // F models ForwardIterator
-inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, I>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_assignable<I, F, I>::type
    move_n_source(I f, std::size_t n, F r)
 {
    while (n) {
@@ -1096,18 +1157,18 @@ inline typename dtl::disable_if_memtransfer_copy_assignable<I, F, I>::type
 template
 <typename I    // I models InputIterator
 ,typename F>   // F models ForwardIterator
-inline typename dtl::enable_if_memtransfer_copy_assignable<I, F, I>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_copy_assignable<I, F, I>::type
    move_n_source(I f, std::size_t n, F r) BOOST_NOEXCEPT_OR_NOTHROW
 {  return dtl::memmove_n_source(f, n, r); }
 
 template<typename F>   // F models ForwardIterator
-inline F move_forward_overlapping(F f, F l, F r)
+inline BOOST_CONTAINER_CONSTEXPR20 F move_forward_overlapping(F f, F l, F r)
 {
    return (f != r) ? (move)(f, l, r) : l;
 }
 
 template<typename B>   // B models BidirIterator
-inline B move_backward_overlapping(B f, B l, B rl)
+inline BOOST_CONTAINER_CONSTEXPR20 B move_backward_overlapping(B f, B l, B rl)
 {
    return (l != rl) ? (move_backward)(f, l, rl) : f;
 }
@@ -1122,7 +1183,7 @@ inline B move_backward_overlapping(B f, B l, B rl)
 template
    <typename Allocator
    ,typename I>  // I models InputIterator
-inline typename dtl::disable_if_trivially_destructible<I, void>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_trivially_destructible<I, void>::type
    destroy_alloc_n(Allocator &a, I f, std::size_t n)
 {
    while(n){
@@ -1135,7 +1196,7 @@ inline typename dtl::disable_if_trivially_destructible<I, void>::type
 template
    <typename Allocator
    ,typename I>   // I models InputIterator
-inline typename dtl::enable_if_trivially_destructible<I, void>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_trivially_destructible<I, void>::type
    destroy_alloc_n(Allocator &, I, std::size_t)
 {}
 
@@ -1148,7 +1209,7 @@ inline typename dtl::enable_if_trivially_destructible<I, void>::type
 template
    <typename Allocator
    ,typename I>   // I models InputIterator
-inline typename dtl::disable_if_trivially_destructible<I, void>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_trivially_destructible<I, void>::type
    destroy_alloc(Allocator &a, I f, I l)
 {
    while(f != l){
@@ -1160,10 +1221,132 @@ inline typename dtl::disable_if_trivially_destructible<I, void>::type
 template
    <typename Allocator
    ,typename I >  // I models InputIterator
-inline typename dtl::enable_if_trivially_destructible<I, void>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_trivially_destructible<I, void>::type
    destroy_alloc(Allocator &, I, I)
 {}
 
+//////////////////////////////////////////////////////////////////////////////
+//
+//                         uninitialized_relocate_alloc
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Relocates [f, l) to the uninitialized range starting at r: after the call
+//[f, l) is raw storage and the caller must not destroy it. Returns the end of
+//the destination range. If an exception is thrown [f, l) is left initialized.
+template
+   <typename Allocator,
+    typename I, // I models InputIterator
+    typename F> // F models ForwardIterator
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_relocatable<I, F, F>::type
+   uninitialized_relocate_alloc(Allocator &a, I f, I l, F r)
+{
+   typedef typename boost::container::iter_value<I>::type value_type;
+   F const r_end = ::boost::container::uninitialized_move_alloc(a, f, l, r);
+   BOOST_IF_CONSTEXPR(!has_trivial_destructor_after_move<value_type>::value)
+      ::boost::container::destroy_alloc(a, f, l);
+   return r_end;
+}
+
+template
+   <typename Allocator,
+    typename I, // I models InputIterator
+    typename F> // F models ForwardIterator
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_relocatable<I, F, F>::type
+   uninitialized_relocate_alloc(Allocator &, I f, I l, F r) BOOST_NOEXCEPT_OR_NOTHROW
+{  return dtl::memmove(f, l, r); }
+
+template
+   <typename Allocator,
+    typename I, // I models InputIterator
+    typename F> // F models ForwardIterator
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_relocatable<I, F, F>::type
+   uninitialized_relocate_alloc_n(Allocator &a, I f, std::size_t n, F r)
+{
+   typedef typename boost::container::iter_value<I>::type value_type;
+   F const r_end = ::boost::container::uninitialized_move_alloc_n(a, f, n, r);
+   BOOST_IF_CONSTEXPR(!has_trivial_destructor_after_move<value_type>::value)
+      ::boost::container::destroy_alloc_n(a, f, n);
+   return r_end;
+}
+
+template
+   <typename Allocator,
+    typename I, // I models InputIterator
+    typename F> // F models ForwardIterator
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_relocatable<I, F, F>::type
+   uninitialized_relocate_alloc_n(Allocator &, I f, std::size_t n, F r) BOOST_NOEXCEPT_OR_NOTHROW
+{  return dtl::memmove_n(f, n, r); }
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//                         shift_erase_alloc
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Erases [f, l) from the initialized range [f, e) shifting [l, e) to f.
+//Returns the new end of the range.
+template
+   <typename Allocator,
+    typename F> // F models RandomAccessIterator
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_relocatable<F, F, F>::type
+   shift_erase_forward_alloc(Allocator &a, F f, F l, F e)
+{
+   typedef typename boost::container::iter_value<F>::type value_type;
+   F const new_e = ::boost::container::move(l, e, f);
+   if(!has_trivial_destructor_after_move<value_type>::value){
+      ::boost::container::destroy_alloc(a, new_e, e);
+   }
+   else if(new_e < l){
+      //Erased elements that were not overwritten still own their resources
+      ::boost::container::destroy_alloc(a, new_e, l);
+   }
+   return new_e;
+}
+
+template
+   <typename Allocator,
+    typename F> // F models ForwardIterator
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_relocatable<F, F, F>::type
+   shift_erase_forward_alloc(Allocator &a, F f, F l, F e) BOOST_NOEXCEPT_OR_NOTHROW
+{
+   ::boost::container::destroy_alloc(a, f, l);
+   return dtl::memmove(l, e, f);
+}
+
+//Erases [f, l) from the initialized range [b, l) shifting [b, f) to the end.
+//Returns the new beginning of the range.
+template
+   <typename Allocator,
+    typename B> // B models RandomAccessIterator
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_relocatable<B, B, B>::type
+   shift_erase_backward_alloc(Allocator &a, B b, B f, B l)
+{
+   typedef typename boost::container::iter_value<B>::type value_type;
+   B const new_b = ::boost::container::move_backward(b, f, l);
+   if(!has_trivial_destructor_after_move<value_type>::value){
+      ::boost::container::destroy_alloc(a, b, new_b);
+   }
+   else if(f < new_b){
+      //Erased elements that were not overwritten still own their resources
+      ::boost::container::destroy_alloc(a, f, new_b);
+   }
+   return new_b;
+}
+
+template
+   <typename Allocator,
+    typename B> // B models RandomAccessIterator
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_relocatable<B, B, B>::type
+   shift_erase_backward_alloc(Allocator &a, B b, B f, B l) BOOST_NOEXCEPT_OR_NOTHROW
+{
+   typedef typename boost::container::iterator_traits<B>::difference_type difference_type;
+   ::boost::container::destroy_alloc(a, f, l);
+   B const new_b = l - difference_type(f - b);
+   dtl::memmove(b, f, new_b);
+   return new_b;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 //
 //                         deep_swap_alloc_n
@@ -1176,7 +1359,7 @@ template
    ,typename F // F models ForwardIterator
    ,typename G // G models ForwardIterator
    >
-inline typename dtl::disable_if_memtransfer_copy_assignable<F, G, void>::type
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_copy_assignable<F, G, void>::type
    deep_swap_alloc_n( Allocator &a, F short_range_f, std::size_t  n_i, G large_range_f, std::size_t n_j)
 {
    std::size_t n = 0;
@@ -1195,7 +1378,7 @@ template
    ,typename F // F models ForwardIterator
    ,typename G // G models ForwardIterator
    >
-inline typename dtl::enable_if_c
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_c
    < dtl::is_memtransfer_copy_assignable<F, G>::value && (MaxTmpBytes <= DeepSwapAllocNMaxStorage) && false
    , void>::type
    deep_swap_alloc_n( Allocator &a, F short_range_f, std::size_t n_i, G large_range_f, std::size_t n_j)
@@ -1224,12 +1407,24 @@ template
    ,typename F // F models ForwardIterator
    ,typename G // G models ForwardIterator
    >
-inline typename dtl::enable_if_c
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_c
    < dtl::is_memtransfer_copy_assignable<F, G>::value && true//(MaxTmpBytes > DeepSwapAllocNMaxStorage)
    , void>::type
    deep_swap_alloc_n( Allocator &a, F short_range_f, std::size_t n_i, G large_range_f, std::size_t n_j)
 {
    typedef typename allocator_traits<Allocator>::value_type value_type;
+   #if defined(BOOST_CONTAINER_HAS_CXX20_CONSTEXPR)
+   if(BOOST_CONTAINER_IS_CONSTANT_EVALUATED()){
+      for (std::size_t n = 0; n != n_i ; ++short_range_f, ++large_range_f, ++n){
+         value_type tmp(*short_range_f);
+         *short_range_f = *large_range_f;
+         *large_range_f = tmp;
+      }
+      boost::container::uninitialized_move_alloc_n(a, large_range_f, std::size_t(n_j - n_i), short_range_f);
+      boost::container::destroy_alloc_n(a, large_range_f, std::size_t(n_j - n_i));
+      return;
+   }
+   #endif
    typedef typename dtl::aligned_storage
       <DeepSwapAllocNMaxStorage, dtl::alignment_of<value_type>::value>::type storage_type;
    storage_type storage;
@@ -1300,7 +1495,7 @@ template
    ,typename I // F models InputIterator
    ,typename O // G models OutputIterator
    >
-void copy_assign_range_alloc_n( Allocator &a, I inp_start, std::size_t n_i, O out_start, std::size_t n_o )
+BOOST_CONTAINER_CONSTEXPR20 void copy_assign_range_alloc_n( Allocator &a, I inp_start, std::size_t n_i, O out_start, std::size_t n_o )
 {
    if (n_o < n_i){
       inp_start = boost::container::copy_n_source_dest(inp_start, n_o, out_start);     // may throw
@@ -1323,7 +1518,7 @@ template
    ,typename I // F models InputIterator
    ,typename O // G models OutputIterator
    >
-void move_assign_range_alloc_n( Allocator &a, I inp_start, std::size_t n_i, O out_start, std::size_t n_o )
+BOOST_CONTAINER_CONSTEXPR20 void move_assign_range_alloc_n( Allocator &a, I inp_start, std::size_t n_i, O out_start, std::size_t n_o )
 {
    if (n_o < n_i){
       inp_start = boost::container::move_n_source_dest(inp_start, n_o, out_start);  // may throw
@@ -1363,7 +1558,7 @@ template
    ,typename O // G models OutputIterator
    ,typename InsertionProxy
    >
-void uninitialized_move_and_insert_alloc
+BOOST_CONTAINER_CONSTEXPR20 void uninitialized_move_and_insert_alloc
    ( Allocator &a
    , F first
    , F pos
@@ -1392,6 +1587,60 @@ void uninitialized_move_and_insert_alloc
    new_values_destroyer.release();
 }
 
+//Relocates [first, last) to the uninitialized range starting at d_first and inserts
+//n new elements in the position of pos. After the call [first, last) is raw storage
+//and the caller must not destroy it. If an exception is thrown [first, last) is left
+//initialized and the destination is left uninitialized.
+template
+   <typename Allocator
+   ,typename F // F models ForwardIterator
+   ,typename O // G models OutputIterator
+   ,typename InsertionProxy
+   >
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_memtransfer_relocatable<F, O, void>::type
+   uninitialized_relocate_and_insert_alloc
+   ( Allocator &a
+   , F first
+   , F pos
+   , F last
+   , O d_first
+   , std::size_t n
+   , InsertionProxy insertion_proxy)
+{
+   typedef typename boost::container::iter_value<F>::type value_type;
+   ::boost::container::uninitialized_move_and_insert_alloc(a, first, pos, last, d_first, n, insertion_proxy);
+   BOOST_IF_CONSTEXPR(!has_trivial_destructor_after_move<value_type>::value)
+      ::boost::container::destroy_alloc(a, first, last);
+}
+
+template
+   <typename Allocator
+   ,typename F // F models ForwardIterator
+   ,typename O // G models OutputIterator
+   ,typename InsertionProxy
+   >
+inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_memtransfer_relocatable<F, O, void>::type
+   uninitialized_relocate_and_insert_alloc
+   ( Allocator &a
+   , F first
+   , F pos
+   , F last
+   , O d_first
+   , std::size_t n
+   , InsertionProxy insertion_proxy)
+{
+   typedef typename boost::container::iterator_traits<O>::difference_type difference_type;
+   //Construct new elements first, so that old elements are
+   //untouched if an exception is thrown
+   O const d_pos = d_first + difference_type(pos - first);
+   O d_last = d_pos;
+   insertion_proxy.uninitialized_copy_n_and_update(a, d_last, n);
+   d_last += difference_type(n);
+   //Relocation can't throw
+   (void)dtl::memmove(first, pos, d_first);
+   (void)dtl::memmove(pos, last, d_last);
+}
+
 
 
 
@@ -1400,8 +1649,8 @@ template
    ,typename F // F models ForwardIterator
    ,typename InsertionProxy
    >
-typename dtl::enable_if_c<dtl::is_single_value_proxy<InsertionProxy>::value, void>::type
-   expand_backward_and_insert_nonempty_middle_alloc
+BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_c<dtl::is_single_value_proxy<InsertionProxy>::value, void>::type
+   expand_backward_and_insert_nonempty_middle_alloc_move
    ( Allocator &a
    , F const first
    , F const pos
@@ -1427,8 +1676,8 @@ template
    ,typename F // F models ForwardIterator
    ,typename InsertionProxy
    >
-typename dtl::disable_if_c<dtl::is_single_value_proxy<InsertionProxy>::value, void>::type
-   expand_backward_and_insert_nonempty_middle_alloc
+BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_c<dtl::is_single_value_proxy<InsertionProxy>::value, void>::type
+   expand_backward_and_insert_nonempty_middle_alloc_move
    ( Allocator &a
    , F first
    , F pos
@@ -1470,8 +1719,8 @@ template
    ,typename F // F models ForwardIterator
    ,typename InsertionProxy
    >
-typename dtl::enable_if_c<dtl::is_single_value_proxy<InsertionProxy>::value, void>::type
-   expand_forward_and_insert_nonempty_middle_alloc
+BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_c<dtl::is_single_value_proxy<InsertionProxy>::value, void>::type
+   expand_forward_and_insert_nonempty_middle_alloc_move
    ( Allocator &a
    , F pos
    , F last
@@ -1496,8 +1745,8 @@ template
    ,typename F // F models ForwardIterator
    ,typename InsertionProxy
    >
-typename dtl::disable_if_c<dtl::is_single_value_proxy<InsertionProxy>::value, void>::type
-   expand_forward_and_insert_nonempty_middle_alloc
+BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_c<dtl::is_single_value_proxy<InsertionProxy>::value, void>::type
+   expand_forward_and_insert_nonempty_middle_alloc_move
    ( Allocator &a
    , F pos
    , F last
@@ -1534,12 +1783,132 @@ typename dtl::disable_if_c<dtl::is_single_value_proxy<InsertionProxy>::value, vo
    }
 }
 
+template
+   <typename Allocator
+   ,typename F // F models ForwardIterator
+   ,typename InsertionProxy
+   >
+BOOST_CONTAINER_CONSTEXPR20 void expand_backward_and_insert_nonempty_middle_alloc_relocate
+   ( Allocator &a
+   , F const first
+   , F const pos
+   , std::size_t const n
+   , InsertionProxy insertion_proxy)
+{
+   BOOST_ASSERT(first != pos);
+   typedef typename boost::container::iterator_traits<F>::difference_type difference_type;
+   //Open a raw gap just before pos relocating [first, pos) n positions backwards
+   F const new_first = first - difference_type(n);
+   F const gap = dtl::memmove(first, pos, new_first);
+   BOOST_CONTAINER_TRY{
+      insertion_proxy.uninitialized_copy_n_and_update(a, gap, n);
+   }
+   BOOST_CONTAINER_CATCH(...){
+      //Close the gap, leaving the sequence untouched
+      (void)dtl::memmove(new_first, gap, first);
+      BOOST_CONTAINER_RETHROW
+   }
+   BOOST_CONTAINER_CATCH_END
+}
+
+template
+   <typename Allocator
+   ,typename F // F models ForwardIterator
+   ,typename InsertionProxy
+   >
+BOOST_CONTAINER_CONSTEXPR20 void expand_forward_and_insert_nonempty_middle_alloc_relocate
+   ( Allocator &a
+   , F const pos
+   , F const last
+   , std::size_t const n
+   , InsertionProxy insertion_proxy)
+{
+   BOOST_ASSERT(last != pos);
+   typedef typename boost::container::iterator_traits<F>::difference_type difference_type;
+   //Open a raw gap in pos relocating [pos, last) n positions forward
+   F const new_pos = pos + difference_type(n);
+   (void)dtl::memmove(pos, last, new_pos);
+   BOOST_CONTAINER_TRY{
+      insertion_proxy.uninitialized_copy_n_and_update(a, pos, n);
+   }
+   BOOST_CONTAINER_CATCH(...){
+      //Close the gap, leaving the sequence untouched
+      (void)dtl::memmove(new_pos, new_pos + (last - pos), pos);
+      BOOST_CONTAINER_RETHROW
+   }
+   BOOST_CONTAINER_CATCH_END
+}
+
+template
+   <typename Allocator
+   ,typename F // F models ForwardIterator
+   ,typename InsertionProxy
+   >
+inline BOOST_CONTAINER_CONSTEXPR20 void expand_backward_and_insert_nonempty_middle_alloc
+   (Allocator &a, F const first, F const pos, std::size_t const n, InsertionProxy insertion_proxy, dtl::true_type)
+{  (expand_backward_and_insert_nonempty_middle_alloc_relocate)(a, first, pos, n, insertion_proxy);  }
+
+template
+   <typename Allocator
+   ,typename F // F models ForwardIterator
+   ,typename InsertionProxy
+   >
+inline BOOST_CONTAINER_CONSTEXPR20 void expand_backward_and_insert_nonempty_middle_alloc
+   (Allocator &a, F const first, F const pos, std::size_t const n, InsertionProxy insertion_proxy, dtl::false_type)
+{  (expand_backward_and_insert_nonempty_middle_alloc_move)(a, first, pos, n, insertion_proxy);  }
+
+//Inserts n elements before pos opening a gap moving [first, pos) n positions backwards.
+//Trivially relocatable elements are memmoved instead of being move constructed/assigned.
+template
+   <typename Allocator
+   ,typename F // F models ForwardIterator
+   ,typename InsertionProxy
+   >
+inline BOOST_CONTAINER_CONSTEXPR20 void expand_backward_and_insert_nonempty_middle_alloc
+   (Allocator &a, F const first, F const pos, std::size_t const n, InsertionProxy insertion_proxy)
+{
+   (expand_backward_and_insert_nonempty_middle_alloc)
+      (a, first, pos, n, insertion_proxy, dtl::bool_<dtl::is_memtransfer_relocatable<F, F>::value>());
+}
+
+template
+   <typename Allocator
+   ,typename F // F models ForwardIterator
+   ,typename InsertionProxy
+   >
+inline BOOST_CONTAINER_CONSTEXPR20 void expand_forward_and_insert_nonempty_middle_alloc
+   (Allocator &a, F const pos, F const last, std::size_t const n, InsertionProxy insertion_proxy, dtl::true_type)
+{  (expand_forward_and_insert_nonempty_middle_alloc_relocate)(a, pos, last, n, insertion_proxy);  }
+
+template
+   <typename Allocator
+   ,typename F // F models ForwardIterator
+   ,typename InsertionProxy
+   >
+inline BOOST_CONTAINER_CONSTEXPR20 void expand_forward_and_insert_nonempty_middle_alloc
+   (Allocator &a, F const pos, F const last, std::size_t const n, InsertionProxy insertion_proxy, dtl::false_type)
+{  (expand_forward_and_insert_nonempty_middle_alloc_move)(a, pos, last, n, insertion_proxy);  }
+
+//Inserts n elements in pos opening a gap moving [pos, last) n positions forward.
+//Trivially relocatable elements are memmoved instead of being move constructed/assigned.
+template
+   <typename Allocator
+   ,typename F // F models ForwardIterator
+   ,typename InsertionProxy
+   >
+inline BOOST_CONTAINER_CONSTEXPR20 void expand_forward_and_insert_nonempty_middle_alloc
+   (Allocator &a, F const pos, F const last, std::size_t const n, InsertionProxy insertion_proxy)
+{
+   (expand_forward_and_insert_nonempty_middle_alloc)
+      (a, pos, last, n, insertion_proxy, dtl::bool_<dtl::is_memtransfer_relocatable<F, F>::value>());
+}
+
 template
 <typename Allocator
    , typename F // F models ForwardIterator
    , typename InsertionProxy
 >
-inline void expand_forward_and_insert_alloc
+inline BOOST_CONTAINER_CONSTEXPR20 void expand_forward_and_insert_alloc
    ( Allocator& a
    , F pos
    , F last
@@ -1561,7 +1930,7 @@ inline void expand_forward_and_insert_alloc
 }
 
 template <class B, class InsertionProxy, class Allocator>
-void expand_backward_forward_and_insert_alloc_move_backward
+BOOST_CONTAINER_CONSTEXPR20 void expand_backward_forward_and_insert_alloc_move_backward
 ( B const old_start
 , std::size_t const old_size
 , B const new_start
@@ -1572,8 +1941,8 @@ void expand_backward_forward_and_insert_alloc_move_backward
 {
    typedef std::size_t size_type;
    typedef typename allocator_traits<Allocator>::value_type value_type;
-   BOOST_STATIC_CONSTEXPR bool trivial_dctr_after_move = has_trivial_destructor_after_move<value_type>::value;
-   BOOST_STATIC_CONSTEXPR bool trivial_dctr = dtl::is_trivially_destructible<value_type>::value;
+   const bool trivial_dctr_after_move = has_trivial_destructor_after_move<value_type>::value;
+   const bool trivial_dctr = dtl::is_trivially_destructible<value_type>::value;
 
    typedef typename dtl::if_c
       <trivial_dctr
@@ -1861,7 +2230,7 @@ template
    , typename B // B models BidirIterator
    , typename InsertionProxy
 >
-inline void expand_backward_forward_and_insert_alloc_move_forward
+inline BOOST_CONTAINER_CONSTEXPR20 void expand_backward_forward_and_insert_alloc_move_forward
    ( B const old_start
    , std::size_t const old_size
    , B const new_start
@@ -1872,8 +2241,8 @@ inline void expand_backward_forward_and_insert_alloc_move_forward
 {
    typedef std::size_t size_type;
    typedef typename allocator_traits<Allocator>::value_type value_type;
-   BOOST_STATIC_CONSTEXPR bool trivial_dctr_after_move = has_trivial_destructor_after_move<value_type>::value;
-   BOOST_STATIC_CONSTEXPR bool trivial_dctr = dtl::is_trivially_destructible<value_type>::value;
+   const bool trivial_dctr_after_move = has_trivial_destructor_after_move<value_type>::value;
+   const bool trivial_dctr = dtl::is_trivially_destructible<value_type>::value;
 
    typedef typename dtl::if_c
       <trivial_dctr
@@ -2034,7 +2403,7 @@ inline void expand_backward_forward_and_insert_alloc_move_forward
 }
 
 template <class R, class InsertionProxy, class Allocator>
-void expand_backward_forward_and_insert_alloc
+BOOST_CONTAINER_CONSTEXPR20 void expand_backward_forward_and_insert_alloc
    ( R const old_start
    , std::size_t const old_size
    , R const new_start
@@ -29,6 +29,8 @@
 // container/detail
 #include <boost/container/detail/advanced_insert_int.hpp>
 #include <boost/container/detail/alloc_helpers.hpp>
+#include <boost/container/detail/allocation_type.hpp>
+#include <boost/container/detail/version_type.hpp>
 #include <boost/container/detail/algorithm.hpp> //algo_equal(), algo_lexicographical_compare
 #include <boost/container/detail/copy_move_algo.hpp>
 #include <boost/container/detail/iterator.hpp>
@@ -635,6 +637,82 @@ class deque_base
       return palloc.deallocate(p, n);
    }
 
+   //Notifies the allocator that the map was moved to a new buffer. n is always the number of
+   //active nodes (those holding elements), even if spare node pointers were also moved
+   inline void prot_notify_map_relocation(size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      ptr_alloc_t palloc(this->alloc());
+      allocator_traits<ptr_alloc_t>::on_relocation(palloc, n);
+   }
+
+   //Tries to expand the map in place (version 2 allocators) so that it can hold at least
+   //min_size node pointers. On success, returns the new start of the map (old node pointers
+   //are not moved, so they are placed after the returned address if the map was expanded
+   //backwards) and new_map_size is updated with the received size, never bigger than the
+   //requested one. Returns null if the map could not be expanded.
+   inline ptr_alloc_ptr prot_expand_map(allocation_type command, size_type min_size, size_type &new_map_size)
+   {
+      typedef typename dtl::version<ptr_alloc_t>::type ptr_alloc_version;
+      return this->priv_expand_map(ptr_alloc_version(), command, min_size, new_map_size);
+   }
+
+   //Templates, so that they are not instantiated by explicit instantiations with version 1 allocators
+   template<class AllocVersion>
+   inline typename dtl::enable_if_c<AllocVersion::value != 2, ptr_alloc_ptr>::type
+      priv_expand_map(AllocVersion, allocation_type, size_type, size_type &)
+   {  return ptr_alloc_ptr();  }
+
+   template<class AllocVersion>
+   typename dtl::enable_if_c<AllocVersion::value == 2, ptr_alloc_ptr>::type
+      priv_expand_map(AllocVersion, allocation_type command, size_type min_size, size_type &new_map_size)
+   {
+      ptr_alloc_t palloc(this->alloc());
+      ptr_alloc_ptr reuse = this->members_.m_map;
+      size_type received = new_map_size;
+      const ptr_alloc_ptr ret = palloc.allocation_command(command | nothrow_allocation, min_size, received, reuse);
+      if (ret) {
+         BOOST_ASSERT(reuse && ret <= this->members_.m_map);
+         new_map_size = received < new_map_size ? received : new_map_size;
+      }
+      return ret;
+   }
+
+   //Allocates the nodes of the trailing slots of a map already expanded in place to
+   //expanded_map_size, whose size is recorded first. If a node allocation throws, the
+   //map is shrunk back in place and the old size restored, so that all slots of a
+   //reservable map keep holding nodes.
+   void prot_allocate_expanded_map_nodes(size_type old_map_size, size_type expanded_map_size)
+   {
+      this->members_.m_map_size = static_cast<stored_size_type>(expanded_map_size);
+      BOOST_CONTAINER_TRY {
+         this->prot_allocate_nodes
+            (this->members_.m_map + difference_type(old_map_size), size_type(expanded_map_size - old_map_size));
+      }
+      BOOST_CONTAINER_CATCH(...) {
+         typedef typename dtl::version<ptr_alloc_t>::type ptr_alloc_version;
+         this->priv_shrink_map(ptr_alloc_version(), old_map_size);
+         this->members_.m_map_size = static_cast<stored_size_type>(old_map_size);
+         BOOST_CONTAINER_RETHROW
+      }
+      BOOST_CONTAINER_CATCH_END
+   }
+
+   //Templates, so that they are not instantiated by explicit instantiations with version 1 allocators
+   template<class AllocVersion>
+   inline typename dtl::enable_if_c<AllocVersion::value != 2, void>::type
+      priv_shrink_map(AllocVersion, size_type)
+   {}
+
+   template<class AllocVersion>
+   typename dtl::enable_if_c<AllocVersion::value == 2, void>::type
+      priv_shrink_map(AllocVersion, size_type map_size)
+   {
+      ptr_alloc_t palloc(this->alloc());
+      ptr_alloc_ptr reuse = this->members_.m_map;
+      size_type received = map_size;
+      (void)palloc.allocation_command(shrink_in_place | nothrow_allocation, map_size, received, reuse);
+   }
+
    inline deque_base(size_type num_elements, const allocator_type& a)
       :  members_(a)
    { this->prot_initialize_map_and_nodes(num_elements); }
@@ -748,6 +826,8 @@ class deque_base
       BOOST_ASSERT(!add_at_front);  //logic_error: single-ended never grows at front
       const size_type old_map_size = this->members_.m_map_size;
       const ptr_alloc_ptr old_map  = this->members_.m_map;
+      //start node is m_map[0]
+      const size_type old_active_nodes = size_type(size_type(this->prot_finish_node() - old_map) + 1u);
       const size_type additional_nodes = size_type((new_elems - 1u)/get_block_size() + 1u);
       const size_type new_active_nodes = size_type(old_map_size + additional_nodes);
 
@@ -759,23 +839,30 @@ class deque_base
       //The end position must be representable in stored_size_type
       this->test_size_against_n_nodes(new_map_size);
 
-      const ptr_alloc_ptr new_map = this->prot_allocate_map(new_map_size);
-      const size_type new_nodes = size_type(new_map_size - old_map_size);
+      //Node indices must be preserved so only forward expansion is useful
+      size_type final_map_size = new_map_size;
+      const bool expanded = !!this->prot_expand_map(expand_fwd, size_type(new_active_nodes + 2u), final_map_size);
+      if (expanded) {
+         this->prot_allocate_expanded_map_nodes(old_map_size, final_map_size);
+         return;
+      }
 
+      const ptr_alloc_ptr new_map = this->prot_allocate_map(final_map_size);
       BOOST_CONTAINER_TRY {
-         this->prot_allocate_nodes(new_map + difference_type(old_map_size), new_nodes);
+         this->prot_allocate_nodes(new_map + difference_type(old_map_size), size_type(final_map_size - old_map_size));
       }
       BOOST_CONTAINER_CATCH(...) {
-         this->prot_deallocate_map(new_map, new_map_size);
+         this->prot_deallocate_map(new_map, final_map_size);
          BOOST_CONTAINER_RETHROW
       }
       BOOST_CONTAINER_CATCH_END
 
       boost::container::move_n(old_map, old_map_size, new_map);
+      this->prot_notify_map_relocation(old_active_nodes);
       this->prot_deallocate_map(old_map, old_map_size);
 
       this->members_.m_map = new_map;
-      this->members_.m_map_size = static_cast<stored_size_type>(new_map_size);
+      this->members_.m_map_size = static_cast<stored_size_type>(final_map_size);
    }
 
    //Single-ended map growth (non-reservable). Only the active nodes are allocated;
@@ -805,13 +892,17 @@ class deque_base
          //The end position must be representable in stored_size_type
          this->test_size_against_n_nodes(new_map_size);
 
-         const ptr_alloc_ptr new_map = this->prot_allocate_map(new_map_size);
-         //Active nodes keep their indices (start stays at 0), so offsets are unchanged
-         boost::container::move_n(old_map, old_active_nodes, new_map);
-         this->prot_deallocate_map(old_map, old_map_size);
-
-         this->members_.m_map = new_map;
-         this->members_.m_map_size = static_cast<stored_size_type>(new_map_size);
+         //Node indices must be preserved so only forward expansion is useful
+         size_type final_map_size = new_map_size;
+         if (!this->prot_expand_map(expand_fwd, size_type(new_active_nodes + 2u), final_map_size)) {
+            const ptr_alloc_ptr new_map = this->prot_allocate_map(final_map_size);
+            //Active nodes keep their indices (start stays at 0), so offsets are unchanged
+            boost::container::move_n(old_map, old_active_nodes, new_map);
+            this->prot_notify_map_relocation(old_active_nodes);
+            this->prot_deallocate_map(old_map, old_map_size);
+            this->members_.m_map = new_map;
+         }
+         this->members_.m_map_size = static_cast<stored_size_type>(final_map_size);
       }
 
       this->prot_allocate_nodes(this->prot_finish_node() + 1, additional_nodes);
@@ -853,6 +944,22 @@ class deque_base
          //The end position must be representable in stored_size_type
          this->test_size_against_n_nodes(new_map_size);
 
+         //Forward expansion keeps all nodes in place: allocate the nodes of the new
+         //trailing slots and rotate active nodes to their new position.
+         size_type expanded_map_size = new_map_size;
+         if (this->prot_expand_map(expand_fwd, size_type(new_active_nodes + 1u + size_type(is_single_ended)), expanded_map_size)) {
+            this->prot_allocate_expanded_map_nodes(old_map_size, expanded_map_size);
+            new_nstart = old_map + priv_new_offset(is_single_ended_t(), add_at_front, expanded_map_size, new_active_nodes, additional_nodes + unused_slots);
+            const ptr_alloc_ptr end_node = start_node + difference_type(old_active_nodes);
+            if (new_nstart < start_node)
+               boost::movelib::rotate_gcd(new_nstart, start_node, end_node);
+            else
+               boost::movelib::rotate_gcd(start_node, end_node, new_nstart + old_active_nodes);
+            this->prot_start_update_node(new_nstart);
+            this->prot_finish_update_node(new_nstart + difference_type(old_active_nodes - 1u));
+            return;
+         }
+
          const ptr_alloc_ptr new_map = this->prot_allocate_map(new_map_size);
          new_nstart = new_map + priv_new_offset(is_single_ended_t(), add_at_front, new_map_size, new_active_nodes, additional_nodes + unused_slots);
 
@@ -880,6 +987,7 @@ class deque_base
          else
             boost::movelib::rotate_gcd(active_start, active_end, new_nstart + difference_type(old_active_nodes));
 
+         this->prot_notify_map_relocation(old_active_nodes);
          this->prot_deallocate_map(old_map, old_map_size);
 
          this->members_.m_map = new_map;
@@ -919,19 +1027,34 @@ class deque_base
          }
          else {
             //Doubling size, but at least one spare slot on each end
-            const size_type new_map_size = dtl::max_value(size_type(old_map_size*2), size_type(new_active_nodes + 1u + size_type(is_single_ended)));
+            size_type new_map_size = dtl::max_value(size_type(old_map_size*2), size_type(new_active_nodes + 1u + size_type(is_single_ended)));
 
             //The end position must be representable in stored_size_type
             this->test_size_against_n_nodes(new_map_size);
 
-            const ptr_alloc_ptr new_map = this->prot_allocate_map(new_map_size);
+            //If the map is expanded (even backwards) node pointers stay at their address,
+            //so they are moved to their new position as when the old map is reused.
+            const ptr_alloc_ptr expanded_map = this->prot_expand_map
+               (expand_fwd | expand_bwd, size_type(new_active_nodes + 1u + size_type(is_single_ended)), new_map_size);
+            if (expanded_map) {
+               new_nstart = expanded_map + priv_new_offset(is_single_ended_t(), add_at_front, new_map_size, new_active_nodes, additional_nodes);
+               if (new_nstart < start_node)
+                  boost::container::move_n(start_node, old_active_nodes, new_nstart);
+               else
+                  boost::container::move_backward_n(next_finish_node, old_active_nodes, new_nstart + difference_type(old_active_nodes));
+               this->members_.m_map = expanded_map;
+            }
+            else {
+               const ptr_alloc_ptr new_map = this->prot_allocate_map(new_map_size);
 
-            new_nstart = new_map + priv_new_offset(is_single_ended_t(), add_at_front, new_map_size, new_active_nodes, additional_nodes);
-            boost::container::move_n(start_node, old_active_nodes, new_nstart);
+               new_nstart = new_map + priv_new_offset(is_single_ended_t(), add_at_front, new_map_size, new_active_nodes, additional_nodes);
+               boost::container::move_n(start_node, old_active_nodes, new_nstart);
 
-            this->prot_deallocate_map(old_map, old_map_size);
+               this->prot_notify_map_relocation(old_active_nodes);
+               this->prot_deallocate_map(old_map, old_map_size);
 
-            this->members_.m_map = new_map;
+               this->members_.m_map = new_map;
+            }
             this->members_.m_map_size = static_cast<stored_size_type>(new_map_size);
          }
 
@@ -48,125 +48,125 @@ class constant_iterator
    typedef  constant_iterator<T> this_type;
 
    public:
-   inline explicit constant_iterator(const T &ref, std::size_t range_size)
+   inline BOOST_CONTAINER_CONSTEXPR20 explicit constant_iterator(const T &ref, std::size_t range_size)
       :  m_ptr(&ref), m_num(range_size){}
 
    //Constructors
-   inline constant_iterator()
+   inline BOOST_CONTAINER_CONSTEXPR20 constant_iterator()
       :  m_ptr(0), m_num(0){}
 
-   inline constant_iterator& operator++()
+   inline BOOST_CONTAINER_CONSTEXPR20 constant_iterator& operator++()
    { increment();   return *this;   }
 
-   inline constant_iterator operator++(int)
+   inline BOOST_CONTAINER_CONSTEXPR20 constant_iterator operator++(int)
    {
       constant_iterator result (*this);
       increment();
       return result;
    }
 
-   inline constant_iterator& operator--()
+   inline BOOST_CONTAINER_CONSTEXPR20 constant_iterator& operator--()
    { decrement();   return *this;   }
 
-   inline constant_iterator operator--(int)
+   inline BOOST_CONTAINER_CONSTEXPR20 constant_iterator operator--(int)
    {
       constant_iterator result (*this);
       decrement();
       return result;
    }
 
-   inline friend bool operator== (const constant_iterator& i, const constant_iterator& i2)
+   inline BOOST_CONTAINER_CONSTEXPR20 friend bool operator== (const constant_iterator& i, const constant_iterator& i2)
    { return i.equal(i2); }
 
-   inline friend bool operator!= (const constant_iterator& i, const constant_iterator& i2)
+   inline BOOST_CONTAINER_CONSTEXPR20 friend bool operator!= (const constant_iterator& i, const constant_iterator& i2)
    { return !(i == i2); }
 
-   inline friend bool operator< (const constant_iterator& i, const constant_iterator& i2)
+   inline BOOST_CONTAINER_CONSTEXPR20 friend bool operator< (const constant_iterator& i, const constant_iterator& i2)
    { return i.less(i2); }
 
-   inline friend bool operator> (const constant_iterator& i, const constant_iterator& i2)
+   inline BOOST_CONTAINER_CONSTEXPR20 friend bool operator> (const constant_iterator& i, const constant_iterator& i2)
    { return i2 < i; }
 
-   inline friend bool operator<= (const constant_iterator& i, const constant_iterator& i2)
+   inline BOOST_CONTAINER_CONSTEXPR20 friend bool operator<= (const constant_iterator& i, const constant_iterator& i2)
    { return !(i > i2); }
 
-   inline friend bool operator>= (const constant_iterator& i, const constant_iterator& i2)
+   inline BOOST_CONTAINER_CONSTEXPR20 friend bool operator>= (const constant_iterator& i, const constant_iterator& i2)
    { return !(i < i2); }
 
-   inline friend std::ptrdiff_t operator- (const constant_iterator& i, const constant_iterator& i2)
+   inline BOOST_CONTAINER_CONSTEXPR20 friend std::ptrdiff_t operator- (const constant_iterator& i, const constant_iterator& i2)
    { return i2.distance_to(i); }
 
    //Arithmetic signed
-   inline constant_iterator& operator+=(std::ptrdiff_t off)
+   inline BOOST_CONTAINER_CONSTEXPR20 constant_iterator& operator+=(std::ptrdiff_t off)
    {  this->advance(off); return *this;   }
 
-   inline constant_iterator operator+(std::ptrdiff_t off) const
+   inline BOOST_CONTAINER_CONSTEXPR20 constant_iterator operator+(std::ptrdiff_t off) const
    {
       constant_iterator other(*this);
       other.advance(off);
       return other;
    }
 
-   inline friend constant_iterator operator+(std::ptrdiff_t off, const constant_iterator& right)
+   inline BOOST_CONTAINER_CONSTEXPR20 friend constant_iterator operator+(std::ptrdiff_t off, const constant_iterator& right)
    {  return right + off; }
 
-   inline constant_iterator& operator-=(std::ptrdiff_t off)
+   inline BOOST_CONTAINER_CONSTEXPR20 constant_iterator& operator-=(std::ptrdiff_t off)
    {  this->advance(-off); return *this;   }
 
-   inline constant_iterator operator-(std::ptrdiff_t off) const
+   inline BOOST_CONTAINER_CONSTEXPR20 constant_iterator operator-(std::ptrdiff_t off) const
    {  return *this + (-off);  }
 
-   inline const T& operator[] (std::ptrdiff_t ) const
+   inline BOOST_CONTAINER_CONSTEXPR20 const T& operator[] (std::ptrdiff_t ) const
    { return dereference(); }
 
-   inline const T& operator*() const
+   inline BOOST_CONTAINER_CONSTEXPR20 const T& operator*() const
    { return dereference(); }
 
-   inline const T* operator->() const
+   inline BOOST_CONTAINER_CONSTEXPR20 const T* operator->() const
    { return &(dereference()); }
 
    //Arithmetic unsigned
-   inline constant_iterator& operator+=(std::size_t off)
+   inline BOOST_CONTAINER_CONSTEXPR20 constant_iterator& operator+=(std::size_t off)
    {  return *this += std::ptrdiff_t(off);  }
 
-   inline constant_iterator operator+(std::size_t off) const
+   inline BOOST_CONTAINER_CONSTEXPR20 constant_iterator operator+(std::size_t off) const
    {  return *this + std::ptrdiff_t(off);  }
 
-   inline friend constant_iterator operator+(std::size_t off, const constant_iterator& right)
+   inline BOOST_CONTAINER_CONSTEXPR20 friend constant_iterator operator+(std::size_t off, const constant_iterator& right)
    {  return std::ptrdiff_t(off) + right;  }
 
-   inline constant_iterator& operator-=(std::size_t off)
+   inline BOOST_CONTAINER_CONSTEXPR20 constant_iterator& operator-=(std::size_t off)
    {  return *this -= std::ptrdiff_t(off);  }
 
-   inline constant_iterator operator-(std::size_t off) const
+   inline BOOST_CONTAINER_CONSTEXPR20 constant_iterator operator-(std::size_t off) const
    {  return *this - std::ptrdiff_t(off);  }
 
-   inline const T& operator[] (std::size_t off) const
+   inline BOOST_CONTAINER_CONSTEXPR20 const T& operator[] (std::size_t off) const
    { return (*this)[std::ptrdiff_t(off)]; }
 
    private:
    const T *   m_ptr;
    std::size_t m_num;
 
-   inline void increment()
+   inline BOOST_CONTAINER_CONSTEXPR20 void increment()
    { --m_num; }
 
-   inline void decrement()
+   inline BOOST_CONTAINER_CONSTEXPR20 void decrement()
    { ++m_num; }
 
-   inline bool equal(const this_type &other) const
+   inline BOOST_CONTAINER_CONSTEXPR20 bool equal(const this_type &other) const
    {  return m_num == other.m_num;   }
 
-   inline bool less(const this_type &other) const
+   inline BOOST_CONTAINER_CONSTEXPR20 bool less(const this_type &other) const
    {  return other.m_num < m_num;   }
 
-   inline const T & dereference() const
+   inline BOOST_CONTAINER_CONSTEXPR20 const T & dereference() const
    { return *m_ptr; }
 
-   inline void advance(std::ptrdiff_t n)
+   inline BOOST_CONTAINER_CONSTEXPR20 void advance(std::ptrdiff_t n)
    {  m_num = std::size_t(std::ptrdiff_t(m_num) - n); }
 
-   inline std::ptrdiff_t distance_to(const this_type &other)const
+   inline BOOST_CONTAINER_CONSTEXPR20 std::ptrdiff_t distance_to(const this_type &other)const
    {  return std::ptrdiff_t(m_num - other.m_num);   }
 };
 
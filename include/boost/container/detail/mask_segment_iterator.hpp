@@ -0,0 +1,214 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#ifndef BOOST_CONTAINER_DETAIL_MASK_SEGMENT_ITERATOR_HPP
+#define BOOST_CONTAINER_DETAIL_MASK_SEGMENT_ITERATOR_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/detail/bit_utilities.hpp>
+#include <boost/container/detail/iterator.hpp>
+#include <boost/container/detail/type_traits.hpp>
+#include <boost/intrusive/pointer_traits.hpp>
+#include <boost/cstdint.hpp>
+
+//Segmented iterator support shared by containers that store their elements in
+//a circular list of 64-slot blocks whose occupied slots are tracked by a 64-bit
+//mask (hub, nest). A segment is a block and the local iterator visits only the
+//occupied slots of the block.
+//
+//The list header is itself a block_base with mask == 1 and no element storage:
+//the container's end() iterator points to its slot 0. Local iterators therefore
+//never obtain the element array of a block until they are dereferenced, so that
+//the (always empty) local range of the header can be formed safely.
+
+namespace boost {
+namespace container {
+namespace dtl {
+
+//! Bidirectional iterator over the occupied slots of a block.
+//! Stores the block and the mask of the occupied slots at or after the current one:
+//! the current slot is the lowest set bit and the past-the-end position is mask == 0.
+template<class BlockBasePointer, class Block, class ValuePointer>
+class mask_local_iterator
+{
+   typedef typename boost::intrusive::pointer_traits<ValuePointer>::element_type element_type;
+
+   public:
+   typedef boost::uint64_t                                                             mask_type;
+   typedef typename dtl::remove_const<element_type>::type                             value_type;
+   typedef typename boost::intrusive::pointer_traits<ValuePointer>::difference_type   difference_type;
+   typedef ValuePointer                                                                pointer;
+   typedef element_type&                                                               reference;
+   typedef std::bidirectional_iterator_tag                                             iterator_category;
+
+   BOOST_CONTAINER_FORCEINLINE mask_local_iterator() BOOST_NOEXCEPT_OR_NOTHROW
+      : m_pbb(), m_mask(0u)
+   {}
+
+   BOOST_CONTAINER_FORCEINLINE mask_local_iterator(BlockBasePointer pbb, mask_type mask) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_pbb(pbb), m_mask(mask)
+   {}
+
+   BOOST_CONTAINER_FORCEINLINE pointer operator->() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return static_cast<Block&>(*m_pbb).data() + dtl::unchecked_countr_zero(m_mask);  }
+
+   BOOST_CONTAINER_FORCEINLINE reference operator*() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return static_cast<Block&>(*m_pbb).data()[dtl::unchecked_countr_zero(m_mask)];  }
+
+   BOOST_CONTAINER_FORCEINLINE mask_local_iterator& operator++() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      m_mask &= m_mask - 1u;
+      return *this;
+   }
+
+   BOOST_CONTAINER_FORCEINLINE mask_local_iterator operator++(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      mask_local_iterator tmp(*this);
+      ++*this;
+      return tmp;
+   }
+
+   BOOST_CONTAINER_FORCEINLINE mask_local_iterator& operator--() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      //Occupied slots below the current one: the highest of them becomes current
+      const mask_type below = m_pbb->mask & ~m_mask;
+      m_mask |= mask_type(1u) << (63 - dtl::unchecked_countl_zero(below));
+      return *this;
+   }
+
+   BOOST_CONTAINER_FORCEINLINE mask_local_iterator operator--(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      mask_local_iterator tmp(*this);
+      --*this;
+      return tmp;
+   }
+
+   BOOST_CONTAINER_FORCEINLINE friend bool operator==(const mask_local_iterator& x, const mask_local_iterator& y) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return x.m_mask == y.m_mask && x.m_pbb == y.m_pbb;  }
+
+   BOOST_CONTAINER_FORCEINLINE friend bool operator!=(const mask_local_iterator& x, const mask_local_iterator& y) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !(x == y);  }
+
+   BOOST_CONTAINER_FORCEINLINE BlockBasePointer get_block() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_pbb;  }
+
+   BOOST_CONTAINER_FORCEINLINE mask_type get_mask() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_mask;  }
+
+   private:
+   BlockBasePointer m_pbb;
+   mask_type        m_mask;
+};
+
+//! Bidirectional iterator over the blocks of the circular block list.
+template<class BlockBasePointer>
+class mask_segment_iterator
+{
+   public:
+   BOOST_CONTAINER_FORCEINLINE mask_segment_iterator() BOOST_NOEXCEPT_OR_NOTHROW
+      : m_pbb()
+   {}
+
+   BOOST_CONTAINER_FORCEINLINE explicit mask_segment_iterator(BlockBasePointer pbb) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_pbb(pbb)
+   {}
+
+   BOOST_CONTAINER_FORCEINLINE mask_segment_iterator& operator++() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      m_pbb = m_pbb->next;
+      return *this;
+   }
+
+   BOOST_CONTAINER_FORCEINLINE mask_segment_iterator operator++(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      mask_segment_iterator tmp(*this);
+      ++*this;
+      return tmp;
+   }
+
+   BOOST_CONTAINER_FORCEINLINE mask_segment_iterator& operator--() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      m_pbb = m_pbb->prev;
+      return *this;
+   }
+
+   BOOST_CONTAINER_FORCEINLINE mask_segment_iterator operator--(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      mask_segment_iterator tmp(*this);
+      --*this;
+      return tmp;
+   }
+
+   BOOST_CONTAINER_FORCEINLINE friend bool operator==(const mask_segment_iterator& x, const mask_segment_iterator& y) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return x.m_pbb == y.m_pbb;  }
+
+   BOOST_CONTAINER_FORCEINLINE friend bool operator!=(const mask_segment_iterator& x, const mask_segment_iterator& y) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return x.m_pbb != y.m_pbb;  }
+
+   BOOST_CONTAINER_FORCEINLINE BlockBasePointer get_block() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_pbb;  }
+
+   private:
+   BlockBasePointer m_pbb;
+};
+
+//! Implements the static interface of segmented_iterator_traits for an iterator
+//! of a masked block list. Iterator must befriend this class and store the block
+//! (a BlockBasePointer) in "pbb" and the slot in "n", and be constructible from both.
+template<class Iterator, class BlockBasePointer, class Block>
+struct mask_segmented_iterator_traits
+{
+   typedef Iterator                                                                    iterator;
+   typedef mask_segment_iterator<BlockBasePointer>                                     segment_iterator;
+   typedef mask_local_iterator<BlockBasePointer, Block, typename Iterator::pointer>    local_iterator;
+   typedef typename local_iterator::mask_type                                          mask_type;
+
+   BOOST_CONTAINER_FORCEINLINE static segment_iterator segment(const iterator &it) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return segment_iterator(it.pbb);  }
+
+   BOOST_CONTAINER_FORCEINLINE static local_iterator local(const iterator &it) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      return local_iterator(it.pbb, it.pbb->mask & (~mask_type(0u) << it.n));
+   }
+
+   BOOST_CONTAINER_FORCEINLINE static iterator compose(const segment_iterator &s, const local_iterator &l) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BlockBasePointer pbb = s.get_block();
+      mask_type m = l.get_mask();
+      //The end of a block is the first element of the next block
+      if(BOOST_UNLIKELY(!m)){
+         pbb = pbb->next;
+         m = pbb->mask;
+      }
+      return iterator(pbb, dtl::unchecked_countr_zero(m));
+   }
+
+   BOOST_CONTAINER_FORCEINLINE static local_iterator begin(const segment_iterator &s) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return local_iterator(s.get_block(), s.get_block()->mask);  }
+
+   BOOST_CONTAINER_FORCEINLINE static local_iterator end(const segment_iterator &s) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return local_iterator(s.get_block(), 0u);  }
+};
+
+}  //namespace dtl {
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_CONTAINER_DETAIL_MASK_SEGMENT_ITERATOR_HPP
@@ -25,6 +25,17 @@
 #include <boost/container/throw_exception.hpp>
 // container/detail
 #include <boost/container/detail/min_max.hpp>
+// std
+#include <cstddef>
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC)
+#include <atomic>
+#endif
+
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC)
+#define BOOST_CONTAINER_ADAPTIVE_GROWTH_INIT (0u)
+#else
+#define BOOST_CONTAINER_ADAPTIVE_GROWTH_INIT = 0u
+#endif
 
 namespace boost {
 namespace container {
@@ -77,6 +88,163 @@ struct growth_factor_100
    : dtl::grow_factor_ratio<0, 2, 1>
 {};
 
+namespace dtl {
+
+//Rounds a capacity of n objects of ValueSize bytes up to the next allocation
+//size class used by common malloc implementations and pool resources:
+//16 byte granules up to 128 bytes and four classes per power of two above.
+template<std::size_t ValueSize, class SizeType>
+SizeType round_to_size_class(const SizeType n, const SizeType max_cap)
+{
+   const SizeType max_n = SizeType(SizeType(-1)/ValueSize/2u);
+   if(n > max_n)
+      return n;
+   const SizeType bytes = SizeType(n*ValueSize);
+   SizeType granule = 16u;
+   if(bytes > 128u){
+      SizeType pow2 = 128u;
+      while(SizeType(pow2 << 1u) < bytes)
+         pow2 = SizeType(pow2 << 1u);
+      granule = SizeType(pow2 >> 2u);
+   }
+   const SizeType rounded = SizeType(SizeType(bytes + granule - 1u) & SizeType(~SizeType(granule - 1u)));
+   return min_value<SizeType>(max_cap, max_value<SizeType>(n, SizeType(rounded/ValueSize)));
+}
+
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC)
+typedef std::atomic<unsigned> adaptive_growth_counter;
+
+inline unsigned adaptive_growth_load(const adaptive_growth_counter &c)
+{  return c.load(std::memory_order_relaxed);  }
+
+inline void adaptive_growth_store(adaptive_growth_counter &c, unsigned v)
+{  c.store(v, std::memory_order_relaxed);  }
+
+inline unsigned adaptive_growth_increment(adaptive_growth_counter &c)
+{  return c.fetch_add(1u, std::memory_order_relaxed) + 1u;  }
+#else
+typedef unsigned adaptive_growth_counter;
+
+inline unsigned adaptive_growth_load(const adaptive_growth_counter &c)
+{  return c;  }
+
+inline void adaptive_growth_store(adaptive_growth_counter &c, unsigned v)
+{  c = v;  }
+
+inline unsigned adaptive_growth_increment(adaptive_growth_counter &c)
+{  return ++c;  }
+#endif
+
+}  //namespace dtl {
+
+template<class Tag = void>
+struct adaptive_growth_factor
+{
+   typedef void size_class_rounding;
+
+   static const unsigned max_backoff_level = 3u;
+   static const unsigned growths_to_recover = 64u;
+
+   template<class SizeType>
+   SizeType operator()(const SizeType cur_cap, const SizeType add_min_cap, const SizeType max_cap) const
+   {
+      const unsigned level = dtl::adaptive_growth_load(s_level);
+      SizeType new_cap;
+      switch(level){
+         case 0u:  new_cap = dtl::grow_factor_ratio<0, 2, 1>()(cur_cap, add_min_cap, max_cap); break;
+         case 1u:  new_cap = dtl::grow_factor_ratio<0, 8, 5>()(cur_cap, add_min_cap, max_cap); break;
+         case 2u:  new_cap = dtl::grow_factor_ratio<0, 3, 2>()(cur_cap, add_min_cap, max_cap); break;
+         default:  new_cap = dtl::grow_factor_ratio<0, 5, 4>()(cur_cap, add_min_cap, max_cap); break;
+      }
+      //Become more aggressive again after many growths without slack
+      if(level && !(dtl::adaptive_growth_increment(s_growths) % growths_to_recover)){
+         dtl::adaptive_growth_store(s_level, level - 1u);
+      }
+      return new_cap;
+   }
+
+   template<std::size_t ValueSize, class SizeType>
+   SizeType next_capacity(const SizeType cur_cap, const SizeType add_min_cap, const SizeType max_cap) const
+   {
+      return dtl::round_to_size_class<ValueSize>((*this)(cur_cap, add_min_cap, max_cap), max_cap);
+   }
+
+   static void on_shrink_to_fit(std::size_t capacity, std::size_t size)
+   {
+      if((capacity - size) > capacity/4u){
+         const unsigned level = dtl::adaptive_growth_load(s_level);
+         if(level < max_backoff_level)
+            dtl::adaptive_growth_store(s_level, level + 1u);
+         dtl::adaptive_growth_store(s_growths, 0u);
+      }
+   }
+
+   static unsigned backoff_level()
+   {  return dtl::adaptive_growth_load(s_level);  }
+
+   static void reset()
+   {
+      dtl::adaptive_growth_store(s_level, 0u);
+      dtl::adaptive_growth_store(s_growths, 0u);
+   }
+
+   private:
+   static dtl::adaptive_growth_counter s_level;
+   static dtl::adaptive_growth_counter s_growths;
+};
+
+template<class Tag>
+dtl::adaptive_growth_counter adaptive_growth_factor<Tag>::s_level BOOST_CONTAINER_ADAPTIVE_GROWTH_INIT;
+
+template<class Tag>
+dtl::adaptive_growth_counter adaptive_growth_factor<Tag>::s_growths BOOST_CONTAINER_ADAPTIVE_GROWTH_INIT;
+
+#undef BOOST_CONTAINER_ADAPTIVE_GROWTH_INIT
+
+namespace dtl {
+
+template<class GrowthFactor>
+struct has_size_class_rounding
+{
+   template<class U> static char test(typename U::size_class_rounding*);
+   template<class U> static int  test(...);
+   static const bool value = sizeof(test<GrowthFactor>(0)) == sizeof(char);
+};
+
+template<class GrowthFactor, std::size_t ValueSize, bool = has_size_class_rounding<GrowthFactor>::value>
+struct growth_factor_dispatch
+{
+   template<class SizeType>
+   static SizeType next_capacity(const SizeType cur_cap, const SizeType add_min_cap, const SizeType max_cap)
+   {  return GrowthFactor()(cur_cap, add_min_cap, max_cap);  }
+
+   static void on_shrink_to_fit(std::size_t, std::size_t)
+   {}
+};
+
+template<class GrowthFactor, std::size_t ValueSize>
+struct growth_factor_dispatch<GrowthFactor, ValueSize, true>
+{
+   template<class SizeType>
+   static SizeType next_capacity(const SizeType cur_cap, const SizeType add_min_cap, const SizeType max_cap)
+   {  return GrowthFactor().template next_capacity<ValueSize>(cur_cap, add_min_cap, max_cap);  }
+
+   static void on_shrink_to_fit(std::size_t capacity, std::size_t size)
+   {  GrowthFactor::on_shrink_to_fit(capacity, size);  }
+};
+
+//Calls the growth factor, passing the size of the elements if it rounds capacities to size classes
+template<class GrowthFactor, std::size_t ValueSize, class SizeType>
+inline SizeType growth_factor_next_capacity(const SizeType cur_cap, const SizeType add_min_cap, const SizeType max_cap)
+{  return growth_factor_dispatch<GrowthFactor, ValueSize>::next_capacity(cur_cap, add_min_cap, max_cap);  }
+
+//Notifies a shrink_to_fit request to growth factors that adapt to observed usage
+template<class GrowthFactor>
+inline void growth_factor_on_shrink_to_fit(std::size_t capacity, std::size_t size)
+{  growth_factor_dispatch<GrowthFactor, 1u>::on_shrink_to_fit(capacity, size);  }
+
+}  //namespace dtl {
+
 template<class SizeType>
 inline void clamp_by_stored_size_type(SizeType &, SizeType)
 {}
@@ -0,0 +1,501 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#ifndef BOOST_CONTAINER_DETAIL_PARALLEL_ALGO_HPP
+#define BOOST_CONTAINER_DETAIL_PARALLEL_ALGO_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container/detail
+#include <boost/container/detail/copy_move_algo.hpp>
+#include <boost/container/detail/iterator.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/type_traits.hpp>
+#include <boost/move/detail/iterator_to_raw_pointer.hpp>
+// std
+#include <cstddef>
+#include <cstring>
+
+//! Parallel initialization needs std::thread and std::exception_ptr to propagate
+//! exceptions thrown by worker threads. Otherwise, initialization is sequential.
+#if !defined(BOOST_NO_CXX11_HDR_THREAD) && !defined(BOOST_NO_CXX11_HDR_EXCEPTION) && !defined(BOOST_NO_EXCEPTIONS)
+#  define BOOST_CONTAINER_HAS_PARALLEL_INIT
+#  include <exception>
+#  include <thread>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#  define BOOST_CONTAINER_HAS_NONTEMPORAL_STORES
+#  include <emmintrin.h>
+#endif
+
+//! Minimum number of bytes a worker thread must initialize. Ranges smaller than twice
+//! this value are initialized by the calling thread.
+#ifndef BOOST_CONTAINER_PARALLEL_INIT_MIN_BYTES
+#  define BOOST_CONTAINER_PARALLEL_INIT_MIN_BYTES (std::size_t(1u) << 20u)
+#endif
+
+//! Maximum number of threads (including the calling thread) used to initialize a range.
+#ifndef BOOST_CONTAINER_PARALLEL_INIT_MAX_THREADS
+#  define BOOST_CONTAINER_PARALLEL_INIT_MAX_THREADS 64u
+#endif
+
+//! If defined, the number of threads used to initialize a range instead of
+//! std::thread::hardware_concurrency().
+//! #define BOOST_CONTAINER_PARALLEL_INIT_THREADS
+
+//! Ranges of trivial types bigger than this value (an approximation of the last
+//! level cache size) are written with non-temporal stores, so that the initialization
+//! does not evict the working set from the cache.
+#ifndef BOOST_CONTAINER_NONTEMPORAL_MIN_BYTES
+#  define BOOST_CONTAINER_NONTEMPORAL_MIN_BYTES (std::size_t(32u) << 20u)
+#endif
+
+namespace boost {
+namespace container {
+namespace dtl {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//                         non-temporal copy/fill
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Copies n bytes bypassing the cache when the platform supports streaming stores
+inline void nontemporal_memcpy(void *dst, const void *src, std::size_t n) BOOST_NOEXCEPT_OR_NOTHROW
+{
+   #if defined(BOOST_CONTAINER_HAS_NONTEMPORAL_STORES)
+   unsigned char *d = static_cast<unsigned char*>(dst);
+   const unsigned char *s = static_cast<const unsigned char*>(src);
+   const std::size_t head = (16u - (reinterpret_cast<std::size_t>(d) & 15u)) & 15u;
+   if(n >= head + 16u){
+      std::memcpy(d, s, head);
+      d += head; s += head; n -= head;
+      for(; n >= 16u; n -= 16u, d += 16u, s += 16u){
+         _mm_stream_si128(reinterpret_cast<__m128i*>(d), _mm_loadu_si128(reinterpret_cast<const __m128i*>(s)));
+      }
+      _mm_sfence();
+   }
+   std::memcpy(d, s, n);
+   #else
+   std::memcpy(dst, src, n);
+   #endif
+}
+
+//Fills n bytes with copies of an object of elem_size bytes, bypassing the cache
+//when the platform supports streaming stores. Requires 16 % elem_size == 0
+//and n % elem_size == 0.
+inline void nontemporal_fill(void *dst, const void *elem, std::size_t elem_size, std::size_t n) BOOST_NOEXCEPT_OR_NOTHROW
+{
+   BOOST_ASSERT(elem_size && 16u % elem_size == 0u && n % elem_size == 0u);
+   //Two 16 byte blocks of repeated objects, so that any rotation of the pattern is available
+   unsigned char rep[32];
+   for(std::size_t i = 0; i != sizeof(rep); i += elem_size){
+      std::memcpy(rep + i, elem, elem_size);
+   }
+   unsigned char *d = static_cast<unsigned char*>(dst);
+   #if defined(BOOST_CONTAINER_HAS_NONTEMPORAL_STORES)
+   const std::size_t head = (16u - (reinterpret_cast<std::size_t>(d) & 15u)) & 15u;
+   if(n >= head + 16u){
+      std::memcpy(d, rep, head);
+      d += head; n -= head;
+      //Aligned blocks start head bytes after an object boundary
+      const unsigned char *const pattern = rep + head % elem_size;
+      const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern));
+      for(; n >= 16u; n -= 16u, d += 16u){
+         _mm_stream_si128(reinterpret_cast<__m128i*>(d), block);
+      }
+      _mm_sfence();
+      std::memcpy(d, pattern, n);
+      return;
+   }
+   #endif
+   for(; n >= 16u; n -= 16u, d += 16u){
+      std::memcpy(d, rep, 16u);
+   }
+   std::memcpy(d, rep, n);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//                         chunked parallel execution
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Returns the number of threads that should initialize n objects of elem_size bytes
+inline std::size_t parallel_init_thread_count(std::size_t n, std::size_t elem_size) BOOST_NOEXCEPT_OR_NOTHROW
+{
+   #if defined(BOOST_CONTAINER_HAS_PARALLEL_INIT)
+   const std::size_t min_bytes = BOOST_CONTAINER_PARALLEL_INIT_MIN_BYTES ? BOOST_CONTAINER_PARALLEL_INIT_MIN_BYTES : 1u;
+   const std::size_t max_bytes = std::size_t(-1)/elem_size;
+   const std::size_t bytes = n < max_bytes ? n*elem_size : std::size_t(-1);
+   std::size_t count = bytes/min_bytes;
+   if(count < 2u)
+      return 1u;
+   #if defined(BOOST_CONTAINER_PARALLEL_INIT_THREADS)
+   std::size_t hw = BOOST_CONTAINER_PARALLEL_INIT_THREADS;
+   #else
+   std::size_t hw = std::thread::hardware_concurrency();
+   #endif
+   hw = hw ? hw : 1u;
+   count = count < hw ? count : hw;
+   count = count < std::size_t(BOOST_CONTAINER_PARALLEL_INIT_MAX_THREADS) ? count : std::size_t(BOOST_CONTAINER_PARALLEL_INIT_MAX_THREADS);
+   return count < n ? count : n;
+   #else
+   (void)n; (void)elem_size;
+   return 1u;
+   #endif
+}
+
+#if defined(BOOST_CONTAINER_HAS_PARALLEL_INIT)
+
+//std::ref requires <functional>, this minimal wrapper avoids including it
+template<class Fn>
+struct ref_wrapper_call
+{
+   explicit ref_wrapper_call(Fn &fn) : m_fn(&fn) {}
+   void operator()() const { (*m_fn)(); }
+   Fn *m_fn;
+};
+
+template<class Task>
+struct parallel_init_worker
+{
+   parallel_init_worker()
+      : task(), first(), last(), error()
+   {}
+
+   void operator()()
+   {
+      BOOST_CONTAINER_TRY{
+         task->construct(first, last);
+      }
+      BOOST_CONTAINER_CATCH(...){
+         error = std::current_exception();
+      }
+      BOOST_CONTAINER_CATCH_END
+   }
+
+   Task *task;
+   std::size_t first;
+   std::size_t last;
+   std::exception_ptr error;
+};
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_PARALLEL_INIT)
+
+//Splits [0, n) in contiguous chunks and calls task.construct(first, last) for each
+//chunk from a different thread. task.construct must leave its chunk unconstructed
+//if it throws. If any chunk throws, successfully constructed chunks are destroyed
+//with task.destroy(first, last) and the first exception is rethrown.
+template<class Task>
+void parallel_init_run(Task &task, std::size_t n, std::size_t elem_size)
+{
+   const std::size_t nthreads = dtl::parallel_init_thread_count(n, elem_size);
+   if(nthreads < 2u){
+      task.construct(0u, n);
+      return;
+   }
+   #if defined(BOOST_CONTAINER_HAS_PARALLEL_INIT)
+   parallel_init_worker<Task> workers[BOOST_CONTAINER_PARALLEL_INIT_MAX_THREADS];
+   std::thread threads[BOOST_CONTAINER_PARALLEL_INIT_MAX_THREADS];
+   const std::size_t chunk = n/nthreads;
+   const std::size_t rem   = n%nthreads;
+   for(std::size_t i = 0, first = 0; i != nthreads; ++i){
+      workers[i].task  = &task;
+      workers[i].first = first;
+      first += chunk + std::size_t(i < rem);
+      workers[i].last  = first;
+   }
+
+   //Chunk 0 and chunks whose thread could not be created are constructed by this thread
+   std::size_t spawned = 1u;
+   BOOST_CONTAINER_TRY{
+      for(; spawned != nthreads; ++spawned){
+         threads[spawned] = std::thread(ref_wrapper_call<parallel_init_worker<Task> >(workers[spawned]));
+      }
+   }
+   BOOST_CONTAINER_CATCH(...){
+   }
+   BOOST_CONTAINER_CATCH_END
+   for(std::size_t i = spawned; i != nthreads; ++i){
+      workers[i]();
+   }
+   workers[0]();
+   for(std::size_t i = 1u; i != spawned; ++i){
+      threads[i].join();
+   }
+
+   std::exception_ptr error;
+   for(std::size_t i = 0; i != nthreads; ++i){
+      if(workers[i].error && !error){
+         error = workers[i].error;
+      }
+   }
+   if(error){
+      for(std::size_t i = 0; i != nthreads; ++i){
+         if(!workers[i].error){
+            task.destroy(workers[i].first, workers[i].last);
+         }
+      }
+      std::rethrow_exception(error);
+   }
+   #endif   //#if defined(BOOST_CONTAINER_HAS_PARALLEL_INIT)
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//                         parallel tasks
+//
+//////////////////////////////////////////////////////////////////////////////
+
+template<class Allocator, class F>
+struct parallel_init_task_base
+{
+   parallel_init_task_base(Allocator &a, F r)
+      : m_a(a), m_r(r)
+   {}
+
+   void destroy(std::size_t first, std::size_t last)
+   {  boost::container::destroy_alloc_n(m_a, m_r + difference_type(first), last - first);  }
+
+   typedef typename boost::container::iterator_traits<F>::difference_type difference_type;
+   Allocator &m_a;
+   F m_r;
+};
+
+template<class Allocator, class I, class F>
+struct parallel_copy_task
+   : parallel_init_task_base<Allocator, F>
+{
+   typedef parallel_init_task_base<Allocator, F> base_t;
+   typedef typename boost::container::iterator_traits<I>::difference_type i_difference_type;
+   typedef typename boost::container::iterator_traits<F>::value_type value_type;
+
+   parallel_copy_task(Allocator &a, I f, F r, bool nontemporal)
+      : base_t(a, r), m_f(f), m_nontemporal(nontemporal)
+   {}
+
+   void construct(std::size_t first, std::size_t last)
+   {  this->priv_construct(first, last, dtl::bool_<dtl::is_memtransfer_copy_constructible<I, F>::value>());  }
+
+   private:
+   void priv_construct(std::size_t first, std::size_t last, dtl::true_)
+   {
+      if(m_nontemporal){
+         dtl::nontemporal_memcpy
+            ( boost::movelib::iterator_to_raw_pointer(this->m_r) + first
+            , boost::movelib::iterator_to_raw_pointer(m_f) + first
+            , (last - first)*sizeof(value_type));
+      }
+      else{
+         this->priv_construct(first, last, dtl::false_());
+      }
+   }
+
+   void priv_construct(std::size_t first, std::size_t last, dtl::false_)
+   {
+      boost::container::uninitialized_copy_alloc_n
+         (this->m_a, m_f + i_difference_type(first), last - first, this->m_r + typename base_t::difference_type(first));
+   }
+
+   I m_f;
+   bool m_nontemporal;
+};
+
+template<class F, class T>
+struct is_nontemporal_fillable
+{
+   typedef typename boost::container::iterator_traits<F>::value_type value_type;
+   BOOST_STATIC_CONSTEXPR bool value = dtl::are_elements_contiguous<F>::value
+                                    && dtl::is_same<value_type, T>::value
+                                    && dtl::is_trivially_copy_constructible<T>::value
+                                    && (16u % sizeof(T)) == 0u;
+};
+
+template<class Allocator, class T, class F>
+struct parallel_fill_task
+   : parallel_init_task_base<Allocator, F>
+{
+   typedef parallel_init_task_base<Allocator, F> base_t;
+
+   parallel_fill_task(Allocator &a, const T &v, F r, bool nontemporal)
+      : base_t(a, r), m_v(v), m_nontemporal(nontemporal)
+   {}
+
+   void construct(std::size_t first, std::size_t last)
+   {  this->priv_construct(first, last, dtl::bool_<is_nontemporal_fillable<F, T>::value>());  }
+
+   private:
+   void priv_construct(std::size_t first, std::size_t last, dtl::true_)
+   {
+      if(m_nontemporal){
+         dtl::nontemporal_fill
+            (boost::movelib::iterator_to_raw_pointer(this->m_r) + first, &m_v, sizeof(T), (last - first)*sizeof(T));
+      }
+      else{
+         this->priv_construct(first, last, dtl::false_());
+      }
+   }
+
+   void priv_construct(std::size_t first, std::size_t last, dtl::false_)
+   {
+      boost::container::uninitialized_fill_alloc_n
+         (this->m_a, m_v, last - first, this->m_r + typename base_t::difference_type(first));
+   }
+
+   const T &m_v;
+   bool m_nontemporal;
+};
+
+template<class Allocator, class F>
+struct parallel_value_init_task
+   : parallel_init_task_base<Allocator, F>
+{
+   typedef parallel_init_task_base<Allocator, F> base_t;
+   typedef typename boost::container::iterator_traits<F>::value_type value_type;
+
+   parallel_value_init_task(Allocator &a, F r, bool nontemporal)
+      : base_t(a, r), m_nontemporal(nontemporal)
+   {}
+
+   void construct(std::size_t first, std::size_t last)
+   {  this->priv_construct(first, last, dtl::bool_<dtl::is_memzero_initializable<F>::value>());  }
+
+   private:
+   void priv_construct(std::size_t first, std::size_t last, dtl::true_)
+   {
+      if(m_nontemporal){
+         const unsigned char zero = 0u;
+         dtl::nontemporal_fill
+            (boost::movelib::iterator_to_raw_pointer(this->m_r) + first, &zero, 1u, (last - first)*sizeof(value_type));
+      }
+      else{
+         this->priv_construct(first, last, dtl::false_());
+      }
+   }
+
+   void priv_construct(std::size_t first, std::size_t last, dtl::false_)
+   {
+      boost::container::uninitialized_value_init_alloc_n
+         (this->m_a, last - first, this->m_r + typename base_t::difference_type(first));
+   }
+
+   bool m_nontemporal;
+};
+
+inline bool use_nontemporal_stores(std::size_t n, std::size_t elem_size) BOOST_NOEXCEPT_OR_NOTHROW
+{
+   #if defined(BOOST_CONTAINER_HAS_NONTEMPORAL_STORES)
+   return n >= BOOST_CONTAINER_NONTEMPORAL_MIN_BYTES/elem_size;
+   #else
+   (void)n; (void)elem_size;
+   return false;
+   #endif
+}
+
+}  //namespace dtl {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//                         parallel_uninitialized_copy_alloc_n
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! <b>Effects</b>: Same as uninitialized_copy_alloc_n(a, f, n, r), but the range is split in
+//!   chunks that are constructed concurrently. If a construction throws, all constructed
+//!   elements are destroyed and the exception is rethrown. Allocator's construct and destroy
+//!   must be callable concurrently from several threads.
+//!
+//! <b>Requires</b>: I and F model RandomAccessIterator.
+//!
+//! <b>Returns</b>: r + n
+template
+   <typename Allocator,
+    typename I, // I models RandomAccessIterator
+    typename F> // F models RandomAccessIterator
+F parallel_uninitialized_copy_alloc_n(Allocator &a, I f, std::size_t n, F r)
+{
+   typedef typename boost::container::iterator_traits<F>::value_type value_type;
+   typedef typename boost::container::iterator_traits<F>::difference_type difference_type;
+   dtl::parallel_copy_task<Allocator, I, F> task
+      (a, f, r, dtl::is_memtransfer_copy_constructible<I, F>::value && dtl::use_nontemporal_stores(n, sizeof(value_type)));
+   dtl::parallel_init_run(task, n, sizeof(value_type));
+   return r + difference_type(n);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//                         parallel_uninitialized_fill_alloc_n
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! <b>Effects</b>: Same as uninitialized_fill_alloc_n(a, v, n, r), but the range is split in
+//!   chunks that are constructed concurrently. If a construction throws, all constructed
+//!   elements are destroyed and the exception is rethrown. Allocator's construct and destroy
+//!   must be callable concurrently from several threads.
+//!
+//! <b>Requires</b>: F models RandomAccessIterator.
+//!
+//! <b>Returns</b>: r + n
+template
+   <typename Allocator,
+    typename T,
+    typename F> // F models RandomAccessIterator
+F parallel_uninitialized_fill_alloc_n(Allocator &a, const T &v, std::size_t n, F r)
+{
+   typedef typename boost::container::iterator_traits<F>::difference_type difference_type;
+   dtl::parallel_fill_task<Allocator, T, F> task
+      (a, v, r, dtl::is_nontemporal_fillable<F, T>::value && dtl::use_nontemporal_stores(n, sizeof(T)));
+   dtl::parallel_init_run(task, n, sizeof(T));
+   return r + difference_type(n);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//                         parallel_uninitialized_value_init_alloc_n
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! <b>Effects</b>: Same as uninitialized_value_init_alloc_n(a, n, r), but the range is split in
+//!   chunks that are constructed concurrently. If a construction throws, all constructed
+//!   elements are destroyed and the exception is rethrown. Allocator's construct and destroy
+//!   must be callable concurrently from several threads.
+//!
+//! <b>Requires</b>: F models RandomAccessIterator.
+//!
+//! <b>Returns</b>: r + n
+template
+   <typename Allocator,
+    typename F> // F models RandomAccessIterator
+F parallel_uninitialized_value_init_alloc_n(Allocator &a, std::size_t n, F r)
+{
+   typedef typename boost::container::iterator_traits<F>::value_type value_type;
+   typedef typename boost::container::iterator_traits<F>::difference_type difference_type;
+   dtl::parallel_value_init_task<Allocator, F> task
+      (a, r, dtl::is_memzero_initializable<F>::value && dtl::use_nontemporal_stores(n, sizeof(value_type)));
+   dtl::parallel_init_run(task, n, sizeof(value_type));
+   return r + difference_type(n);
+}
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_CONTAINER_DETAIL_PARALLEL_ALGO_HPP
@@ -140,6 +140,10 @@ class pool_resource
    //! <b>Throws</b>: Nothing.
    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment);
 
+   //! <b>Returns</b>: The block size of the pool that serves `bytes` or `bytes`
+   //!   if no pool will be used to serve this.
+   std::size_t do_allocation_size(std::size_t bytes, std::size_t alignment) const BOOST_NOEXCEPT;
+
    //Non-standard observers
    public:
    //! <b>Returns</b>: The number of pools that will be used in the pool resource.
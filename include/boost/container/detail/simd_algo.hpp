@@ -0,0 +1,591 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#ifndef BOOST_CONTAINER_DETAIL_SIMD_ALGO_HPP
+#define BOOST_CONTAINER_DETAIL_SIMD_ALGO_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/detail/bit_utilities.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/type_traits.hpp>
+#include <boost/cstdint.hpp>
+#include <cstddef>
+#include <cstring>
+
+//Equality kernels used by the segmented algorithms for contiguous ranges of
+//integral and floating point types. SSE2 is used on x86, AVX2 and AVX-512BW double and
+//quadruple the width of the vectors if the compiler targets them.
+//
+//If the compiler does not target AVX-512 but supports the target attribute (GCC and Clang
+//on x86), the wider kernels are compiled for their instruction set and selected at runtime
+//after checking the features of the CPU, otherwise the instruction set is selected at
+//compile time.
+#if !defined(BOOST_CONTAINER_SIMD_ALGO_DISABLE_SIMD)
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#     define BOOST_CONTAINER_SIMD_ALGO_SSE2
+#     include <emmintrin.h>
+#  endif
+#  if defined(BOOST_CONTAINER_SIMD_ALGO_SSE2) && defined(__AVX2__)
+#     define BOOST_CONTAINER_SIMD_ALGO_AVX2
+#     include <immintrin.h>
+#  endif
+#  if defined(BOOST_CONTAINER_SIMD_ALGO_AVX2) && defined(__AVX512F__) && defined(__AVX512BW__)
+#     define BOOST_CONTAINER_SIMD_ALGO_AVX512
+#  endif
+#  if defined(BOOST_CONTAINER_SIMD_ALGO_SSE2) && !defined(BOOST_CONTAINER_SIMD_ALGO_AVX512) && \
+      !defined(BOOST_CONTAINER_SIMD_ALGO_DISABLE_DISPATCH) && (defined(__x86_64__) || defined(__i386__)) && \
+      (defined(__clang__) || (defined(BOOST_GCC) && (BOOST_GCC >= 40900)))
+#     define BOOST_CONTAINER_SIMD_ALGO_DISPATCH
+#     include <immintrin.h>
+#  endif
+#endif
+
+//With runtime dispatch the wider operations are not forced inline in the kernels, as the
+//kernels are not compiled for their instruction set: they are only inlined (flattened)
+//in the entry points compiled with the target attribute.
+#if defined(BOOST_CONTAINER_SIMD_ALGO_DISPATCH)
+#  define BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC    inline __attribute__((__target__("avx2")))
+#  define BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC  inline __attribute__((__target__("avx2,avx512f,avx512bw")))
+#  define BOOST_CONTAINER_SIMD_ALGO_AVX2_ENTRY   __attribute__((__target__("avx2"), __flatten__))
+#  define BOOST_CONTAINER_SIMD_ALGO_AVX512_ENTRY __attribute__((__target__("avx2,avx512f,avx512bw"), __flatten__))
+#else
+#  define BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC    BOOST_CONTAINER_FORCEINLINE
+#  define BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC  BOOST_CONTAINER_FORCEINLINE
+#endif
+
+namespace boost {
+namespace container {
+namespace dtl {
+
+//Types whose equality can be computed by SIMD comparisons: integral types of 1, 2, 4
+//or 8 bytes (bitwise equality), float and double (IEEE equality, as operator==).
+template<class T>
+struct is_simd_algo_type
+{
+   typedef typename remove_const<T>::type type;
+   BOOST_STATIC_CONSTEXPR bool value =
+         (is_integral<type>::value && (sizeof(type) == 1u || sizeof(type) == 2u || sizeof(type) == 4u || sizeof(type) == 8u))
+      || (is_same<type, float>::value && sizeof(type) == 4u)
+      || (is_same<type, double>::value && sizeof(type) == 8u);
+};
+
+//Both ranges (or the range and the value) have the same SIMD comparable type
+template<class T, class U>
+struct is_simd_algo_pair
+{
+   BOOST_STATIC_CONSTEXPR bool value = is_simd_algo_type<T>::value
+      && is_same<typename remove_const<T>::type, typename remove_const<U>::type>::value;
+};
+
+#if defined(BOOST_CONTAINER_SIMD_ALGO_SSE2)
+
+template<std::size_t Size> struct simd_uint;
+template<> struct simd_uint<1u> { typedef boost::uint8_t  type; };
+template<> struct simd_uint<2u> { typedef boost::uint16_t type; };
+template<> struct simd_uint<4u> { typedef boost::uint32_t type; };
+template<> struct simd_uint<8u> { typedef boost::uint64_t type; };
+
+//Vector operations over lanes of Size bytes. eq returns a mask with lane_bits
+//consecutive bits set for each pair of equal lanes. Vectors are not part of the
+//interface so that kernels not compiled for the instruction set can call them.
+template<std::size_t Size, bool Float>
+struct simd_sse2
+{
+   typedef __m128i vec_type;
+   typedef typename simd_uint<Size>::type uint_type;
+   typedef void narrower;
+   BOOST_STATIC_CONSTEXPR std::size_t bytes = 16u;
+   BOOST_STATIC_CONSTEXPR std::size_t lane_bits = Size;
+
+   //Compares the vector at p with a vector of v values
+   BOOST_CONTAINER_FORCEINLINE static boost::uint64_t eq(const void *p, uint_type v)
+   {  return simd_sse2::eq(simd_sse2::load(p), simd_sse2::set1(v));  }
+
+   //Compares the vectors at p and q
+   BOOST_CONTAINER_FORCEINLINE static boost::uint64_t eq(const void *p, const void *q)
+   {  return simd_sse2::eq(simd_sse2::load(p), simd_sse2::load(q));  }
+
+   BOOST_CONTAINER_FORCEINLINE static void fill(void *p, uint_type v)
+   {  _mm_storeu_si128(static_cast<__m128i*>(p), simd_sse2::set1(v));  }
+
+   private:
+   BOOST_CONTAINER_FORCEINLINE static vec_type load(const void *p)
+   {  return _mm_loadu_si128(static_cast<const __m128i*>(p));  }
+
+   BOOST_CONTAINER_FORCEINLINE static vec_type set1(boost::uint8_t v)  {  return _mm_set1_epi8(char(v));  }
+   BOOST_CONTAINER_FORCEINLINE static vec_type set1(boost::uint16_t v) {  return _mm_set1_epi16(short(v));  }
+   BOOST_CONTAINER_FORCEINLINE static vec_type set1(boost::uint32_t v) {  return _mm_set1_epi32(int(v));  }
+   BOOST_CONTAINER_FORCEINLINE static vec_type set1(boost::uint64_t v)
+   {  return _mm_set_epi32(int(boost::uint32_t(v >> 32u)), int(boost::uint32_t(v)), int(boost::uint32_t(v >> 32u)), int(boost::uint32_t(v)));  }
+
+   BOOST_CONTAINER_FORCEINLINE static boost::uint64_t eq(vec_type a, vec_type b)
+   {  return boost::uint64_t(unsigned(_mm_movemask_epi8(simd_sse2::cmpeq(a, b, dtl::bool_<Float>(), dtl::integral_constant<std::size_t, Size>()))));  }
+
+   BOOST_CONTAINER_FORCEINLINE static vec_type cmpeq(vec_type a, vec_type b, dtl::false_, dtl::integral_constant<std::size_t, 1u>)
+   {  return _mm_cmpeq_epi8(a, b);  }
+
+   BOOST_CONTAINER_FORCEINLINE static vec_type cmpeq(vec_type a, vec_type b, dtl::false_, dtl::integral_constant<std::size_t, 2u>)
+   {  return _mm_cmpeq_epi16(a, b);  }
+
+   BOOST_CONTAINER_FORCEINLINE static vec_type cmpeq(vec_type a, vec_type b, dtl::false_, dtl::integral_constant<std::size_t, 4u>)
+   {  return _mm_cmpeq_epi32(a, b);  }
+
+   //No 64 bit comparison in SSE2: both 32 bit halves must be equal
+   BOOST_CONTAINER_FORCEINLINE static vec_type cmpeq(vec_type a, vec_type b, dtl::false_, dtl::integral_constant<std::size_t, 8u>)
+   {
+      const vec_type e = _mm_cmpeq_epi32(a, b);
+      return _mm_and_si128(e, _mm_shuffle_epi32(e, _MM_SHUFFLE(2, 3, 0, 1)));
+   }
+
+   BOOST_CONTAINER_FORCEINLINE static vec_type cmpeq(vec_type a, vec_type b, dtl::true_, dtl::integral_constant<std::size_t, 4u>)
+   {  return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));  }
+
+   BOOST_CONTAINER_FORCEINLINE static vec_type cmpeq(vec_type a, vec_type b, dtl::true_, dtl::integral_constant<std::size_t, 8u>)
+   {  return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));  }
+};
+
+#endif   //#if defined(BOOST_CONTAINER_SIMD_ALGO_SSE2)
+
+#if defined(BOOST_CONTAINER_SIMD_ALGO_AVX2) || defined(BOOST_CONTAINER_SIMD_ALGO_DISPATCH)
+
+template<std::size_t Size, bool Float>
+struct simd_avx2
+{
+   typedef __m256i vec_type;
+   typedef typename simd_uint<Size>::type uint_type;
+   typedef simd_sse2<Size, Float> narrower;
+   BOOST_STATIC_CONSTEXPR std::size_t bytes = 32u;
+   BOOST_STATIC_CONSTEXPR std::size_t lane_bits = Size;
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC static boost::uint64_t eq(const void *p, uint_type v)
+   {  return simd_avx2::eq(simd_avx2::load(p), simd_avx2::set1(v));  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC static boost::uint64_t eq(const void *p, const void *q)
+   {  return simd_avx2::eq(simd_avx2::load(p), simd_avx2::load(q));  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC static void fill(void *p, uint_type v)
+   {  _mm256_storeu_si256(static_cast<__m256i*>(p), simd_avx2::set1(v));  }
+
+   private:
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC static vec_type load(const void *p)
+   {  return _mm256_loadu_si256(static_cast<const __m256i*>(p));  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC static vec_type set1(boost::uint8_t v)  {  return _mm256_set1_epi8(char(v));  }
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC static vec_type set1(boost::uint16_t v) {  return _mm256_set1_epi16(short(v));  }
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC static vec_type set1(boost::uint32_t v) {  return _mm256_set1_epi32(int(v));  }
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC static vec_type set1(boost::uint64_t v) {  return _mm256_set1_epi64x((long long)(v));  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC static boost::uint64_t eq(vec_type a, vec_type b)
+   {  return boost::uint64_t(unsigned(_mm256_movemask_epi8(simd_avx2::cmpeq(a, b, dtl::bool_<Float>(), dtl::integral_constant<std::size_t, Size>()))));  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC static vec_type cmpeq(vec_type a, vec_type b, dtl::false_, dtl::integral_constant<std::size_t, 1u>)
+   {  return _mm256_cmpeq_epi8(a, b);  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC static vec_type cmpeq(vec_type a, vec_type b, dtl::false_, dtl::integral_constant<std::size_t, 2u>)
+   {  return _mm256_cmpeq_epi16(a, b);  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC static vec_type cmpeq(vec_type a, vec_type b, dtl::false_, dtl::integral_constant<std::size_t, 4u>)
+   {  return _mm256_cmpeq_epi32(a, b);  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC static vec_type cmpeq(vec_type a, vec_type b, dtl::false_, dtl::integral_constant<std::size_t, 8u>)
+   {  return _mm256_cmpeq_epi64(a, b);  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC static vec_type cmpeq(vec_type a, vec_type b, dtl::true_, dtl::integral_constant<std::size_t, 4u>)
+   {  return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC static vec_type cmpeq(vec_type a, vec_type b, dtl::true_, dtl::integral_constant<std::size_t, 8u>)
+   {  return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));  }
+};
+
+#endif   //#if defined(BOOST_CONTAINER_SIMD_ALGO_AVX2) || defined(BOOST_CONTAINER_SIMD_ALGO_DISPATCH)
+
+#if defined(BOOST_CONTAINER_SIMD_ALGO_AVX512) || defined(BOOST_CONTAINER_SIMD_ALGO_DISPATCH)
+
+//AVX-512 comparisons return a mask register with a bit per lane
+template<std::size_t Size, bool Float>
+struct simd_avx512
+{
+   typedef __m512i vec_type;
+   typedef typename simd_uint<Size>::type uint_type;
+   typedef simd_avx2<Size, Float> narrower;
+   BOOST_STATIC_CONSTEXPR std::size_t bytes = 64u;
+   BOOST_STATIC_CONSTEXPR std::size_t lane_bits = 1u;
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC static boost::uint64_t eq(const void *p, uint_type v)
+   {  return simd_avx512::eq(simd_avx512::load(p), simd_avx512::set1(v));  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC static boost::uint64_t eq(const void *p, const void *q)
+   {  return simd_avx512::eq(simd_avx512::load(p), simd_avx512::load(q));  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC static void fill(void *p, uint_type v)
+   {  _mm512_storeu_si512(p, simd_avx512::set1(v));  }
+
+   private:
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC static vec_type load(const void *p)
+   {  return _mm512_loadu_si512(p);  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC static vec_type set1(boost::uint8_t v)  {  return _mm512_set1_epi8(char(v));  }
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC static vec_type set1(boost::uint16_t v) {  return _mm512_set1_epi16(short(v));  }
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC static vec_type set1(boost::uint32_t v) {  return _mm512_set1_epi32(int(v));  }
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC static vec_type set1(boost::uint64_t v) {  return _mm512_set1_epi64((long long)(v));  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC static boost::uint64_t eq(vec_type a, vec_type b)
+   {  return simd_avx512::cmpeq(a, b, dtl::bool_<Float>(), dtl::integral_constant<std::size_t, Size>());  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC static boost::uint64_t cmpeq(vec_type a, vec_type b, dtl::false_, dtl::integral_constant<std::size_t, 1u>)
+   {  return boost::uint64_t(_mm512_cmpeq_epi8_mask(a, b));  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC static boost::uint64_t cmpeq(vec_type a, vec_type b, dtl::false_, dtl::integral_constant<std::size_t, 2u>)
+   {  return boost::uint64_t(_mm512_cmpeq_epi16_mask(a, b));  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC static boost::uint64_t cmpeq(vec_type a, vec_type b, dtl::false_, dtl::integral_constant<std::size_t, 4u>)
+   {  return boost::uint64_t(_mm512_cmpeq_epi32_mask(a, b));  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC static boost::uint64_t cmpeq(vec_type a, vec_type b, dtl::false_, dtl::integral_constant<std::size_t, 8u>)
+   {  return boost::uint64_t(_mm512_cmpeq_epi64_mask(a, b));  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC static boost::uint64_t cmpeq(vec_type a, vec_type b, dtl::true_, dtl::integral_constant<std::size_t, 4u>)
+   {  return boost::uint64_t(_mm512_cmp_ps_mask(_mm512_castsi512_ps(a), _mm512_castsi512_ps(b), _CMP_EQ_OQ));  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC static boost::uint64_t cmpeq(vec_type a, vec_type b, dtl::true_, dtl::integral_constant<std::size_t, 8u>)
+   {  return boost::uint64_t(_mm512_cmp_pd_mask(_mm512_castsi512_pd(a), _mm512_castsi512_pd(b), _CMP_EQ_OQ));  }
+};
+
+#endif   //#if defined(BOOST_CONTAINER_SIMD_ALGO_AVX512) || defined(BOOST_CONTAINER_SIMD_ALGO_DISPATCH)
+
+#if defined(BOOST_CONTAINER_SIMD_ALGO_SSE2)
+
+template<class T>
+struct simd_algo_widest
+{
+   typedef typename remove_const<T>::type type;
+   #if defined(BOOST_CONTAINER_SIMD_ALGO_AVX512)
+   typedef simd_avx512<sizeof(type), is_floating_point<type>::value> ops;
+   #elif defined(BOOST_CONTAINER_SIMD_ALGO_AVX2)
+   typedef simd_avx2<sizeof(type), is_floating_point<type>::value> ops;
+   #else
+   typedef simd_sse2<sizeof(type), is_floating_point<type>::value> ops;
+   #endif
+};
+
+//Kernels over [p, p + n). Ranges of at least a vector are processed with full vectors:
+//the last vector overlaps the previous one instead of processing the tail element by
+//element. Shorter ranges are processed with narrower vectors or with scalar code.
+template<class T, class Ops>
+struct simd_algo_impl
+{
+   typedef typename simd_uint<sizeof(T)>::type uint_t;
+   BOOST_STATIC_CONSTEXPR std::size_t lanes = Ops::bytes/sizeof(T);
+   BOOST_STATIC_CONSTEXPR std::size_t lane_bits = Ops::lane_bits;
+   BOOST_STATIC_CONSTEXPR boost::uint64_t full_mask = ~boost::uint64_t(0u) >> (64u - lanes*lane_bits);
+
+   BOOST_CONTAINER_FORCEINLINE static uint_t bits_of(const T &value)
+   {
+      uint_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      return bits;
+   }
+
+   BOOST_CONTAINER_FORCEINLINE static std::size_t first_lane(boost::uint64_t mask)
+   {  return std::size_t(dtl::unchecked_countr_zero(mask))/lane_bits;  }
+
+   //Position of the first element equal to value or n
+   static std::size_t find(const T *p, std::size_t n, const T &value)
+   {
+      if(n < lanes)
+         return simd_algo_impl<T, typename Ops::narrower>::find(p, n, value);
+      const uint_t v = bits_of(value);
+      std::size_t i = 0;
+      for(; i + lanes <= n; i += lanes){
+         const boost::uint64_t m = Ops::eq(p + i, v);
+         if(m)
+            return i + first_lane(m);
+      }
+      if(i != n){
+         const boost::uint64_t m = Ops::eq(p + (n - lanes), v);
+         if(m)
+            return n - lanes + first_lane(m);
+      }
+      return n;
+   }
+
+   //Number of elements equal to value
+   static std::size_t count(const T *p, std::size_t n, const T &value)
+   {
+      if(n < lanes)
+         return simd_algo_impl<T, typename Ops::narrower>::count(p, n, value);
+      const uint_t v = bits_of(value);
+      std::size_t bits = 0u;
+      std::size_t i = 0;
+      for(; i + lanes <= n; i += lanes){
+         bits += std::size_t(dtl::popcount(Ops::eq(p + i, v)));
+      }
+      if(i != n){
+         //Lanes already counted are shifted out
+         const std::size_t counted = i - (n - lanes);
+         bits += std::size_t(dtl::popcount(Ops::eq(p + (n - lanes), v) >> (counted*lane_bits)));
+      }
+      return bits/lane_bits;
+   }
+
+   //Position of the first element of [p, p + n) not equal to the element of q in the same position or n
+   static std::size_t mismatch(const T *p, const T *q, std::size_t n)
+   {
+      if(n < lanes)
+         return simd_algo_impl<T, typename Ops::narrower>::mismatch(p, q, n);
+      std::size_t i = 0;
+      for(; i + lanes <= n; i += lanes){
+         const boost::uint64_t m = ~Ops::eq(p + i, q + i) & full_mask;
+         if(m)
+            return i + first_lane(m);
+      }
+      if(i != n){
+         const boost::uint64_t m = ~Ops::eq(p + (n - lanes), q + (n - lanes)) & full_mask;
+         if(m)
+            return n - lanes + first_lane(m);
+      }
+      return n;
+   }
+
+   static void fill(T *p, std::size_t n, const T &value)
+   {
+      if(n < lanes)
+         return simd_algo_impl<T, typename Ops::narrower>::fill(p, n, value);
+      const uint_t v = bits_of(value);
+      std::size_t i = 0;
+      for(; i + lanes <= n; i += lanes){
+         Ops::fill(p + i, v);
+      }
+      if(i != n){
+         Ops::fill(p + (n - lanes), v);
+      }
+   }
+};
+
+template<class T>
+struct simd_algo_impl<T, void>
+{
+   static std::size_t find(const T *p, std::size_t n, const T &value)
+   {
+      std::size_t i = 0;
+      while(i != n && !(p[i] == value))
+         ++i;
+      return i;
+   }
+
+   static std::size_t count(const T *p, std::size_t n, const T &value)
+   {
+      std::size_t c = 0;
+      for(std::size_t i = 0; i != n; ++i)
+         c += std::size_t(p[i] == value);
+      return c;
+   }
+
+   static std::size_t mismatch(const T *p, const T *q, std::size_t n)
+   {
+      std::size_t i = 0;
+      while(i != n && p[i] == q[i])
+         ++i;
+      return i;
+   }
+
+   static void fill(T *p, std::size_t n, const T &value)
+   {
+      for(std::size_t i = 0; i != n; ++i)
+         p[i] = value;
+   }
+};
+
+#if defined(BOOST_CONTAINER_SIMD_ALGO_DISPATCH)
+
+//Entry points of the kernels compiled for each instruction set
+template<class T>
+struct simd_algo_avx2_kernels
+{
+   typedef simd_algo_impl<T, simd_avx2<sizeof(T), is_floating_point<T>::value> > impl;
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_ENTRY static std::size_t find(const T *p, std::size_t n, const T &value)
+   {  return impl::find(p, n, value);  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_ENTRY static std::size_t count(const T *p, std::size_t n, const T &value)
+   {  return impl::count(p, n, value);  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_ENTRY static std::size_t mismatch(const T *p, const T *q, std::size_t n)
+   {  return impl::mismatch(p, q, n);  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX2_ENTRY static void fill(T *p, std::size_t n, const T &value)
+   {  impl::fill(p, n, value);  }
+};
+
+template<class T>
+struct simd_algo_avx512_kernels
+{
+   typedef simd_algo_impl<T, simd_avx512<sizeof(T), is_floating_point<T>::value> > impl;
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_ENTRY static std::size_t find(const T *p, std::size_t n, const T &value)
+   {  return impl::find(p, n, value);  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_ENTRY static std::size_t count(const T *p, std::size_t n, const T &value)
+   {  return impl::count(p, n, value);  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_ENTRY static std::size_t mismatch(const T *p, const T *q, std::size_t n)
+   {  return impl::mismatch(p, q, n);  }
+
+   BOOST_CONTAINER_SIMD_ALGO_AVX512_ENTRY static void fill(T *p, std::size_t n, const T &value)
+   {  impl::fill(p, n, value);  }
+};
+
+template<class T>
+struct simd_algo_widest_kernels
+{
+   typedef simd_algo_impl<T, typename simd_algo_widest<T>::ops> impl;
+
+   static std::size_t find(const T *p, std::size_t n, const T &value)
+   {  return impl::find(p, n, value);  }
+
+   static std::size_t count(const T *p, std::size_t n, const T &value)
+   {  return impl::count(p, n, value);  }
+
+   static std::size_t mismatch(const T *p, const T *q, std::size_t n)
+   {  return impl::mismatch(p, q, n);  }
+
+   static void fill(T *p, std::size_t n, const T &value)
+   {  impl::fill(p, n, value);  }
+};
+
+//Widest instruction set supported by the CPU and the OS:
+//0 (compile time selection), 1 (AVX2) or 2 (AVX-512BW)
+inline int simd_algo_cpu_level()
+{
+   __builtin_cpu_init();
+   if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+      return 2;
+   if(__builtin_cpu_supports("avx2"))
+      return 1;
+   return 0;
+}
+
+//Kernels selected on the first call for each type
+template<class T>
+struct simd_algo_dispatch
+{
+   typedef std::size_t (*find_t)(const T *, std::size_t, const T &);
+   typedef std::size_t (*mismatch_t)(const T *, const T *, std::size_t);
+   typedef void (*fill_t)(T *, std::size_t, const T &);
+
+   find_t      find;
+   find_t      count;
+   mismatch_t  mismatch;
+   fill_t      fill;
+
+   static const simd_algo_dispatch &get()
+   {
+      static const simd_algo_dispatch d = simd_algo_dispatch::select();
+      return d;
+   }
+
+   private:
+   template<class Kernels>
+   static simd_algo_dispatch make()
+   {
+      const simd_algo_dispatch d = { &Kernels::find, &Kernels::count, &Kernels::mismatch, &Kernels::fill };
+      return d;
+   }
+
+   static simd_algo_dispatch select()
+   {
+      switch(simd_algo_cpu_level()){
+         case 2:
+            return make< simd_algo_avx512_kernels<T> >();
+         case 1:
+            return make< simd_algo_avx2_kernels<T> >();
+         default:
+            return make< simd_algo_widest_kernels<T> >();
+      }
+   }
+};
+
+//Ranges that do not fill two vectors of the widest instruction set selected at compile time
+//can't be processed faster by wider vectors and avoid the indirect call
+template<class T>
+inline std::size_t simd_find(const T *p, std::size_t n, const T &value)
+{
+   typedef simd_algo_impl<T, typename simd_algo_widest<T>::ops> impl;
+   return n < impl::lanes*2u ? impl::find(p, n, value) : simd_algo_dispatch<T>::get().find(p, n, value);
+}
+
+template<class T>
+inline std::size_t simd_count(const T *p, std::size_t n, const T &value)
+{
+   typedef simd_algo_impl<T, typename simd_algo_widest<T>::ops> impl;
+   return n < impl::lanes*2u ? impl::count(p, n, value) : simd_algo_dispatch<T>::get().count(p, n, value);
+}
+
+template<class T>
+inline std::size_t simd_mismatch(const T *p, const T *q, std::size_t n)
+{
+   typedef simd_algo_impl<T, typename simd_algo_widest<T>::ops> impl;
+   return n < impl::lanes*2u ? impl::mismatch(p, q, n) : simd_algo_dispatch<T>::get().mismatch(p, q, n);
+}
+
+template<class T>
+inline void simd_fill(T *p, std::size_t n, const T &value)
+{
+   typedef simd_algo_impl<T, typename simd_algo_widest<T>::ops> impl;
+   if(n < impl::lanes*2u)
+      impl::fill(p, n, value);
+   else
+      simd_algo_dispatch<T>::get().fill(p, n, value);
+}
+
+#else    //#if defined(BOOST_CONTAINER_SIMD_ALGO_DISPATCH)
+
+template<class T>
+BOOST_CONTAINER_FORCEINLINE std::size_t simd_find(const T *p, std::size_t n, const T &value)
+{  return simd_algo_impl<T, typename simd_algo_widest<T>::ops>::find(p, n, value);  }
+
+template<class T>
+BOOST_CONTAINER_FORCEINLINE std::size_t simd_count(const T *p, std::size_t n, const T &value)
+{  return simd_algo_impl<T, typename simd_algo_widest<T>::ops>::count(p, n, value);  }
+
+template<class T>
+BOOST_CONTAINER_FORCEINLINE std::size_t simd_mismatch(const T *p, const T *q, std::size_t n)
+{  return simd_algo_impl<T, typename simd_algo_widest<T>::ops>::mismatch(p, q, n);  }
+
+template<class T>
+BOOST_CONTAINER_FORCEINLINE void simd_fill(T *p, std::size_t n, const T &value)
+{  simd_algo_impl<T, typename simd_algo_widest<T>::ops>::fill(p, n, value);  }
+
+#endif   //#if defined(BOOST_CONTAINER_SIMD_ALGO_DISPATCH)
+
+#endif   //#if defined(BOOST_CONTAINER_SIMD_ALGO_SSE2)
+
+}  //namespace dtl {
+}  //namespace container {
+}  //namespace boost {
+
+#undef BOOST_CONTAINER_SIMD_ALGO_AVX2_FUNC
+#undef BOOST_CONTAINER_SIMD_ALGO_AVX512_FUNC
+#if defined(BOOST_CONTAINER_SIMD_ALGO_DISPATCH)
+#  undef BOOST_CONTAINER_SIMD_ALGO_AVX2_ENTRY
+#  undef BOOST_CONTAINER_SIMD_ALGO_AVX512_ENTRY
+#endif
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_CONTAINER_DETAIL_SIMD_ALGO_HPP
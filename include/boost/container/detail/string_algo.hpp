@@ -0,0 +1,454 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#ifndef BOOST_CONTAINER_DETAIL_STRING_ALGO_HPP
+#define BOOST_CONTAINER_DETAIL_STRING_ALGO_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/detail/bit_utilities.hpp>
+#include <boost/container/detail/minimal_char_traits_header.hpp>  // for char_traits
+#include <boost/cstdint.hpp>
+#include <cstddef>
+#include <cstring>
+
+//Search kernels used by basic_string<char>. SSE2 is used for character and substring
+//searches (AVX2 doubles the width of the substring search), SSSE3 (nibble lookup)
+//for character class searches (find_first_of and family).
+#if !defined(BOOST_CONTAINER_STRING_ALGO_DISABLE_SIMD)
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#     define BOOST_CONTAINER_STRING_ALGO_SSE2
+#     include <emmintrin.h>
+#  endif
+#  if defined(BOOST_CONTAINER_STRING_ALGO_SSE2) && (defined(__SSSE3__) || defined(__AVX__))
+#     define BOOST_CONTAINER_STRING_ALGO_SSSE3
+#     include <tmmintrin.h>
+#  endif
+#  if defined(BOOST_CONTAINER_STRING_ALGO_SSE2) && defined(__AVX2__)
+#     define BOOST_CONTAINER_STRING_ALGO_AVX2
+#     include <immintrin.h>
+#  endif
+#endif
+
+namespace boost {
+namespace container {
+namespace dtl {
+
+//Searches in [p, p + n) for any char_traits. Positions are relative to p,
+//npos (std::size_t(-1)) is returned if there is no match.
+template<class Traits>
+struct string_algo_generic
+{
+   typedef typename Traits::char_type char_type;
+
+   BOOST_STATIC_CONSTEXPR std::size_t npos = std::size_t(-1);
+
+   //First position equal to c (or not equal if !equal)
+   static std::size_t find_char(const char_type *p, std::size_t n, char_type c, bool equal)
+   {
+      if(equal){
+         const char_type *const r = Traits::find(p, n, c);
+         return r ? std::size_t(r - p) : npos;
+      }
+      for(std::size_t i = 0; i != n; ++i){
+         if(!Traits::eq(p[i], c))
+            return i;
+      }
+      return npos;
+   }
+
+   //Last position equal to c (or not equal if !equal)
+   static std::size_t rfind_char(const char_type *p, std::size_t n, char_type c, bool equal)
+   {
+      while(n){
+         --n;
+         if(Traits::eq(p[n], c) == equal)
+            return n;
+      }
+      return npos;
+   }
+
+   //First position of [s, s + sn). Precondition: sn != 0
+   static std::size_t search(const char_type *p, std::size_t n, const char_type *s, std::size_t sn)
+   {
+      if(sn > n)
+         return npos;
+      const std::size_t last = n - sn;
+      for(std::size_t i = 0; i <= last; ++i){
+         const char_type *const r = Traits::find(p + i, last - i + 1u, s[0]);
+         if(!r)
+            break;
+         i = std::size_t(r - p);
+         if(!Traits::compare(p + i + 1u, s + 1, sn - 1u))
+            return i;
+      }
+      return npos;
+   }
+
+   //Last position of [s, s + sn). Precondition: sn != 0
+   static std::size_t rsearch(const char_type *p, std::size_t n, const char_type *s, std::size_t sn)
+   {
+      if(sn > n)
+         return npos;
+      for(std::size_t i = n - sn + 1u; i; ){
+         --i;
+         if(Traits::eq(p[i], s[0]) && !Traits::compare(p + i + 1u, s + 1, sn - 1u))
+            return i;
+      }
+      return npos;
+   }
+
+   //First position whose character is in [s, s + sn) (or not in it if !within)
+   static std::size_t find_of(const char_type *p, std::size_t n, const char_type *s, std::size_t sn, bool within)
+   {
+      for(std::size_t i = 0; i != n; ++i){
+         if((Traits::find(s, sn, p[i]) != 0) == within)
+            return i;
+      }
+      return npos;
+   }
+
+   //Last position whose character is in [s, s + sn) (or not in it if !within)
+   static std::size_t rfind_of(const char_type *p, std::size_t n, const char_type *s, std::size_t sn, bool within)
+   {
+      while(n){
+         --n;
+         if((Traits::find(s, sn, p[n]) != 0) == within)
+            return n;
+      }
+      return npos;
+   }
+};
+
+template<class Traits>
+struct string_algo
+   : string_algo_generic<Traits>
+{};
+
+//Set of chars, built from the argument of find_first_of and family. Sets are built
+//in registers, as read-modify-write sequences on a table are serialized by the
+//store to load forwarding latency when the set has many chars.
+class string_char_class
+{
+   public:
+   #if defined(BOOST_CONTAINER_STRING_ALGO_SSSE3)
+
+   //Row lo of m_low (high nibbles 0-7) or m_high (high nibbles 8-15)
+   //holds a bit per high nibble whose char "high:lo" is in the set
+   string_char_class(const char *s, std::size_t sn)
+   {
+      const __m128i iota = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+      __m128i low = _mm_setzero_si128(), high = _mm_setzero_si128();
+      for(std::size_t i = 0; i != sn; ++i){
+         const unsigned c = static_cast<unsigned char>(s[i]);
+         const __m128i row = _mm_cmpeq_epi8(iota, _mm_set1_epi8(char(c & 0x0Fu)));
+         const __m128i bit = _mm_set1_epi8(char(1u << ((c >> 4u) & 7u)));
+         const __m128i sel = (c & 0x80u) ? _mm_setzero_si128() : _mm_set1_epi8(-1);
+         low  = _mm_or_si128(low,  _mm_and_si128(row, _mm_and_si128(bit, sel)));
+         high = _mm_or_si128(high, _mm_and_si128(row, _mm_andnot_si128(sel, bit)));
+      }
+      m_low = low;
+      m_high = high;
+   }
+
+   //Returns a mask with a bit set for each char of [p, p + 16) in the set
+   unsigned mask16(const char *p) const
+   {
+      const __m128i v   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      const __m128i bit = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+      const __m128i lo  = _mm_and_si128(v, _mm_set1_epi8(0x0f));
+      const __m128i hi  = _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f));
+      //pshufb returns zero for indexes with the high bit set, so each table only
+      //answers for its half of the high nibbles
+      const __m128i sign = _mm_and_si128(v, _mm_set1_epi8(-128));
+      const __m128i rows = _mm_or_si128
+         ( _mm_shuffle_epi8(m_low,  _mm_or_si128(lo, sign))
+         , _mm_shuffle_epi8(m_high, _mm_or_si128(lo, _mm_xor_si128(sign, _mm_set1_epi8(-128)))));
+      const __m128i hit = _mm_and_si128(rows, _mm_shuffle_epi8(bit, hi));
+      return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(hit, _mm_setzero_si128()))) ^ 0xFFFFu;
+   }
+
+   //Returns a mask with a bit set for each char of [p, p + n) in the set. Precondition: n < 16
+   unsigned mask(const char *p, std::size_t n) const
+   {
+      char buf[16] = {};
+      std::memcpy(buf, p, n);
+      return this->mask16(buf) & ((1u << n) - 1u);
+   }
+
+   private:
+   __m128i m_low;
+   __m128i m_high;
+
+   #else    //#if defined(BOOST_CONTAINER_STRING_ALGO_SSSE3)
+
+   string_char_class(const char *s, std::size_t sn)
+   {
+      boost::uint64_t w0 = 0u, w1 = 0u, w2 = 0u, w3 = 0u;
+      for(std::size_t i = 0; i != sn; ++i){
+         const unsigned c = static_cast<unsigned char>(s[i]);
+         const boost::uint64_t bit = boost::uint64_t(1u) << (c & 63u);
+         const unsigned w = c >> 6u;
+         w0 |= w == 0u ? bit : 0u;
+         w1 |= w == 1u ? bit : 0u;
+         w2 |= w == 2u ? bit : 0u;
+         w3 |= w == 3u ? bit : 0u;
+      }
+      m_bits[0] = w0;
+      m_bits[1] = w1;
+      m_bits[2] = w2;
+      m_bits[3] = w3;
+   }
+
+   bool contains(char c) const
+   {
+      const unsigned uc = static_cast<unsigned char>(c);
+      return (m_bits[uc >> 6u] >> (uc & 63u)) & 1u;
+   }
+
+   private:
+   boost::uint64_t m_bits[4];
+
+   #endif   //#if defined(BOOST_CONTAINER_STRING_ALGO_SSSE3)
+};
+
+#if defined(BOOST_CONTAINER_STRING_ALGO_SSE2)
+
+//Returns a mask with a bit set for each char of [p, p + 16) equal to c
+BOOST_CONTAINER_FORCEINLINE unsigned string_char_mask16(const char *p, __m128i c)
+{  return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), c)));  }
+
+BOOST_CONTAINER_FORCEINLINE std::size_t string_first_bit(unsigned mask)
+{  return std::size_t(dtl::unchecked_countr_zero(boost::uint64_t(mask)));  }
+
+BOOST_CONTAINER_FORCEINLINE std::size_t string_last_bit(unsigned mask)
+{  return std::size_t(63 - dtl::unchecked_countl_zero(boost::uint64_t(mask)));  }
+
+#endif   //#if defined(BOOST_CONTAINER_STRING_ALGO_SSE2)
+
+//Vectorized searches for char and the standard traits, whose comparisons are
+//equivalent to memchr/memcmp and SIMD byte comparisons.
+template<>
+struct string_algo< std::char_traits<char> >
+   : string_algo_generic< std::char_traits<char> >
+{
+   typedef string_algo_generic< std::char_traits<char> > base_t;
+
+   static std::size_t find_char(const char *p, std::size_t n, char c, bool equal)
+   {
+      if(equal){
+         //memchr is already vectorized by the C library
+         const void *const r = n ? std::memchr(p, c, n) : 0;
+         return r ? std::size_t(static_cast<const char*>(r) - p) : npos;
+      }
+      std::size_t i = 0;
+      #if defined(BOOST_CONTAINER_STRING_ALGO_SSE2)
+      const __m128i v = _mm_set1_epi8(c);
+      for(; i + 16u <= n; i += 16u){
+         const unsigned m = string_char_mask16(p + i, v) ^ 0xFFFFu;
+         if(m)
+            return i + string_first_bit(m);
+      }
+      #endif
+      return offset(i, base_t::find_char(p + i, n - i, c, false));
+   }
+
+   static std::size_t rfind_char(const char *p, std::size_t n, char c, bool equal)
+   {
+      #if defined(BOOST_CONTAINER_STRING_ALGO_SSE2)
+      const __m128i v = _mm_set1_epi8(c);
+      const unsigned flip = equal ? 0u : 0xFFFFu;
+      for(; n >= 16u; n -= 16u){
+         const unsigned m = string_char_mask16(p + n - 16u, v) ^ flip;
+         if(m)
+            return n - 16u + string_last_bit(m);
+      }
+      #endif
+      return base_t::rfind_char(p, n, c, equal);
+   }
+
+   static std::size_t search(const char *p, std::size_t n, const char *s, std::size_t sn)
+   {
+      if(sn == 1u)
+         return find_char(p, n, s[0], true);
+      else if(sn > n)
+         return npos;
+      //Two byte filter: only positions whose first and last chars match the
+      //first and last chars of s are compared. Loads never go beyond p + n.
+      const std::size_t end = n - sn + 1u;
+      std::size_t i = 0;
+      #if defined(BOOST_CONTAINER_STRING_ALGO_AVX2)
+      {
+         const __m256i first = _mm256_set1_epi8(s[0]);
+         const __m256i last  = _mm256_set1_epi8(s[sn - 1u]);
+         for(; i + 32u <= end; i += 32u){
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + sn - 1u));
+            unsigned m = unsigned(_mm256_movemask_epi8
+               (_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last))));
+            for(; m; m &= m - 1u){
+               const std::size_t j = i + string_first_bit(m);
+               if(!std::memcmp(p + j + 1u, s + 1, sn - 2u))
+                  return j;
+            }
+         }
+      }
+      #endif
+      #if defined(BOOST_CONTAINER_STRING_ALGO_SSE2)
+      {
+         const __m128i first = _mm_set1_epi8(s[0]);
+         const __m128i last  = _mm_set1_epi8(s[sn - 1u]);
+         for(; i + 16u <= end; i += 16u){
+            unsigned m = string_char_mask16(p + i, first) & string_char_mask16(p + i + sn - 1u, last);
+            for(; m; m &= m - 1u){
+               const std::size_t j = i + string_first_bit(m);
+               if(!std::memcmp(p + j + 1u, s + 1, sn - 2u))
+                  return j;
+            }
+         }
+      }
+      #endif
+      return offset(i, base_t::search(p + i, n - i, s, sn));
+   }
+
+   static std::size_t rsearch(const char *p, std::size_t n, const char *s, std::size_t sn)
+   {
+      if(sn == 1u)
+         return rfind_char(p, n, s[0], true);
+      else if(sn > n)
+         return npos;
+      std::size_t end = n - sn + 1u;
+      #if defined(BOOST_CONTAINER_STRING_ALGO_SSE2)
+      const __m128i first = _mm_set1_epi8(s[0]);
+      const __m128i last  = _mm_set1_epi8(s[sn - 1u]);
+      for(; end >= 16u; end -= 16u){
+         const std::size_t i = end - 16u;
+         unsigned m = string_char_mask16(p + i, first) & string_char_mask16(p + i + sn - 1u, last);
+         while(m){
+            const std::size_t j = string_last_bit(m);
+            if(!std::memcmp(p + i + j + 1u, s + 1, sn - 2u))
+               return i + j;
+            m &= ~(1u << j);
+         }
+      }
+      #endif
+      return base_t::rsearch(p, end + sn - 1u, s, sn);
+   }
+
+   static std::size_t find_of(const char *p, std::size_t n, const char *s, std::size_t sn, bool within)
+   {
+      if(sn == 1u)
+         return find_char(p, n, s[0], within);
+      else if(n < 16u)
+         return base_t::find_of(p, n, s, sn, within);
+      std::size_t i = 0;
+      #if defined(BOOST_CONTAINER_STRING_ALGO_SSSE3)
+      const string_char_class set(s, sn);
+      const unsigned flip = within ? 0u : 0xFFFFu;
+      for(; i + 16u <= n; i += 16u){
+         const unsigned m = set.mask16(p + i) ^ flip;
+         if(m)
+            return i + string_first_bit(m);
+      }
+      const unsigned m = i != n ? (set.mask(p + i, n - i) ^ flip) & ((1u << (n - i)) - 1u) : 0u;
+      return m ? i + string_first_bit(m) : npos;
+      #else
+      #if defined(BOOST_CONTAINER_STRING_ALGO_SSE2)
+      if(sn <= SmallCharClass){
+         const unsigned flip = within ? 0u : 0xFFFFu;
+         for(; i + 16u <= n; i += 16u){
+            const unsigned m = small_class_mask16(p + i, s, sn) ^ flip;
+            if(m)
+               return i + string_first_bit(m);
+         }
+         return offset(i, base_t::find_of(p + i, n - i, s, sn, within));
+      }
+      #endif
+      const string_char_class set(s, sn);
+      for(; i != n; ++i){
+         if(set.contains(p[i]) == within)
+            return i;
+      }
+      return npos;
+      #endif
+   }
+
+   static std::size_t rfind_of(const char *p, std::size_t n, const char *s, std::size_t sn, bool within)
+   {
+      if(sn == 1u)
+         return rfind_char(p, n, s[0], within);
+      else if(n < 16u)
+         return base_t::rfind_of(p, n, s, sn, within);
+      #if defined(BOOST_CONTAINER_STRING_ALGO_SSSE3)
+      const string_char_class set(s, sn);
+      const unsigned flip = within ? 0u : 0xFFFFu;
+      for(; n >= 16u; n -= 16u){
+         const unsigned m = set.mask16(p + n - 16u) ^ flip;
+         if(m)
+            return n - 16u + string_last_bit(m);
+      }
+      const unsigned m = n ? (set.mask(p, n) ^ flip) & ((1u << n) - 1u) : 0u;
+      return m ? string_last_bit(m) : npos;
+      #else
+      #if defined(BOOST_CONTAINER_STRING_ALGO_SSE2)
+      if(sn <= SmallCharClass){
+         const unsigned flip = within ? 0u : 0xFFFFu;
+         for(; n >= 16u; n -= 16u){
+            const unsigned m = small_class_mask16(p + n - 16u, s, sn) ^ flip;
+            if(m)
+               return n - 16u + string_last_bit(m);
+         }
+         return base_t::rfind_of(p, n, s, sn, within);
+      }
+      #endif
+      const string_char_class set(s, sn);
+      while(n){
+         --n;
+         if(set.contains(p[n]) == within)
+            return n;
+      }
+      return npos;
+      #endif
+   }
+
+   private:
+   static std::size_t offset(std::size_t i, std::size_t r)
+   {  return r == npos ? npos : i + r;  }
+
+   #if defined(BOOST_CONTAINER_STRING_ALGO_SSE2) && !defined(BOOST_CONTAINER_STRING_ALGO_SSSE3)
+   //Without SSSE3, sets up to this size are searched comparing each char of the set
+   BOOST_STATIC_CONSTEXPR std::size_t SmallCharClass = 8u;
+
+   static unsigned small_class_mask16(const char *p, const char *s, std::size_t sn)
+   {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      __m128i r = _mm_setzero_si128();
+      for(std::size_t i = 0; i != sn; ++i){
+         r = _mm_or_si128(r, _mm_cmpeq_epi8(v, _mm_set1_epi8(s[i])));
+      }
+      return unsigned(_mm_movemask_epi8(r));
+   }
+   #endif
+};
+
+}  //namespace dtl {
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_DETAIL_STRING_ALGO_HPP
@@ -43,18 +43,18 @@ class tuple<Head, Tail...>
    typedef tuple<Tail...> inherited;
 
    public:
-   tuple()
+   BOOST_CONTAINER_CONSTEXPR20 tuple()
       : inherited(), m_head()
    {}
 
    template<class U, class ...Args>
-   tuple(U &&u, Args && ...args)
+   BOOST_CONTAINER_CONSTEXPR20 tuple(U &&u, Args && ...args)
       : inherited(::boost::forward<Args>(args)...), m_head(::boost::forward<U>(u))
    {}
 
    // Construct tuple from another tuple.
    template<typename... VValues>
-   tuple(const tuple<VValues...>& other)
+   BOOST_CONTAINER_CONSTEXPR20 tuple(const tuple<VValues...>& other)
       : inherited(other.tail()), m_head(other.head())
    {}
 
@@ -66,11 +66,11 @@ class tuple<Head, Tail...>
       return this;
    }
 
-   typename add_reference<Head>::type head()             {  return m_head; }
-   typename add_reference<const Head>::type head() const {  return m_head; }
+   BOOST_CONTAINER_CONSTEXPR20 typename add_reference<Head>::type head()             {  return m_head; }
+   BOOST_CONTAINER_CONSTEXPR20 typename add_reference<const Head>::type head() const {  return m_head; }
 
-   inherited& tail()             { return *this; }
-   const inherited& tail() const { return *this; }
+   BOOST_CONTAINER_CONSTEXPR20 inherited& tail()             { return *this; }
+   BOOST_CONTAINER_CONSTEXPR20 const inherited& tail() const { return *this; }
 
    protected:
    Head m_head;
@@ -108,8 +108,8 @@ class get_impl<I, tuple<Head, Values...> >
    public:
    typedef typename add_reference<Element>::type                  type;
    typedef typename add_const_reference<Element>::type            const_type;
-   static type get(tuple<Head, Values...>& t)              { return Next::get(t.tail()); }
-   static const_type get(const tuple<Head, Values...>& t)  { return Next::get(t.tail()); }
+   BOOST_CONTAINER_CONSTEXPR20 static type get(tuple<Head, Values...>& t)              { return Next::get(t.tail()); }
+   BOOST_CONTAINER_CONSTEXPR20 static const_type get(const tuple<Head, Values...>& t)  { return Next::get(t.tail()); }
 };
 
 template<typename Head, typename... Values>
@@ -118,16 +118,16 @@ class get_impl<0, tuple<Head, Values...> >
    public:
    typedef typename add_reference<Head>::type         type;
    typedef typename add_const_reference<Head>::type   const_type;
-   static type       get(tuple<Head, Values...>& t)      { return t.head(); }
-   static const_type get(const tuple<Head, Values...>& t){ return t.head(); }
+   BOOST_CONTAINER_CONSTEXPR20 static type       get(tuple<Head, Values...>& t)      { return t.head(); }
+   BOOST_CONTAINER_CONSTEXPR20 static const_type get(const tuple<Head, Values...>& t){ return t.head(); }
 };
 
 template<int I, typename... Values>
-typename get_impl<I, tuple<Values...> >::type get(tuple<Values...>& t)
+BOOST_CONTAINER_CONSTEXPR20 typename get_impl<I, tuple<Values...> >::type get(tuple<Values...>& t)
 {  return get_impl<I, tuple<Values...> >::get(t);  }
 
 template<int I, typename... Values>
-typename get_impl<I, tuple<Values...> >::const_type get(const tuple<Values...>& t)
+BOOST_CONTAINER_CONSTEXPR20 typename get_impl<I, tuple<Values...> >::const_type get(const tuple<Values...>& t)
 {  return get_impl<I, tuple<Values...> >::get(t);  }
 
 ////////////////////////////////////////////////////
@@ -338,4 +338,22 @@ namespace boost {
 #  define BOOST_CONTAINER_PREFETCH(p) ((void)(p))
 #endif
 
+//C++20 constant evaluation support (constexpr destructors, std::construct_at and
+//std::is_constant_evaluated) used by static_vector for trivial types.
+#if (BOOST_CXX_VERSION >= 202002L) && defined(__cpp_constexpr_dynamic_alloc) && (__cpp_constexpr_dynamic_alloc >= 201907L)
+#  include <memory>        //std::construct_at
+#  include <type_traits>   //std::is_constant_evaluated
+#  if defined(__cpp_lib_constexpr_dynamic_alloc) && defined(__cpp_lib_is_constant_evaluated)
+#     define BOOST_CONTAINER_HAS_CXX20_CONSTEXPR
+#  endif
+#endif
+
+#if defined(BOOST_CONTAINER_HAS_CXX20_CONSTEXPR)
+#  define BOOST_CONTAINER_CONSTEXPR20 constexpr
+#  define BOOST_CONTAINER_IS_CONSTANT_EVALUATED() (::std::is_constant_evaluated())
+#else
+#  define BOOST_CONTAINER_CONSTEXPR20
+#  define BOOST_CONTAINER_IS_CONSTANT_EVALUATED() false
+#endif
+
 #endif   //#ifndef BOOST_CONTAINER_DETAIL_WORKAROUND_HPP
@@ -28,12 +28,15 @@
 #include <boost/assert.hpp>
 
 #include <boost/container/detail/copy_move_algo.hpp>
+#include <boost/container/detail/parallel_algo.hpp>
 #include <boost/container/new_allocator.hpp> //new_allocator
 #include <boost/container/allocator_traits.hpp> //allocator_traits
 #include <boost/container/detail/algorithm.hpp> //equal()
 #include <boost/container/throw_exception.hpp>
 #include <boost/container/options.hpp>
+#include <boost/container/trivially_relocatable.hpp>
 
+#include <boost/container/detail/addressof.hpp>
 #include <boost/container/detail/guards_dended.hpp>
 #include <boost/container/detail/iterator.hpp>
 #include <boost/container/detail/iterators.hpp>
@@ -42,6 +45,8 @@
 #include <boost/container/detail/next_capacity.hpp>
 #include <boost/container/detail/alloc_helpers.hpp>
 #include <boost/container/detail/advanced_insert_int.hpp>
+#include <boost/container/detail/allocation_type.hpp>
+#include <boost/container/detail/version_type.hpp>
 
 // move
 #if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
@@ -157,6 +162,8 @@ class devector
    typedef typename options_type::stored_size_type                               stored_size_type;
    BOOST_STATIC_CONSTEXPR std::size_t devector_min_free_fraction =
       options_type::free_fraction;
+   typedef typename dtl::version
+      <typename real_allocator<T, A>::type>::type                                alloc_version;
 
    #endif // ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 
@@ -307,6 +314,29 @@ class devector
       BOOST_ASSERT(invariants_ok());
    }
 
+   /**
+   * **Effects**: Constructs a devector with `n` value_initialized elements using the specified allocator.
+   * Elements are constructed concurrently by several threads.
+   *
+   * **Requires**: `T` shall be [DefaultInsertable] into `*this`. The allocator's `construct` and
+   * `destroy` shall be callable concurrently.
+   *
+   * **Postcondition**: `size() == n`.
+   *
+   * **Exceptions**: Strong exception guarantee.
+   *
+   * **Complexity**: Linear in `n`.
+   */
+   devector(size_type n, parallel_init_t, const allocator_type& allocator = allocator_type())
+      : m_(reserve_uninitialized_t(), allocator, n)
+   {
+      allocator_type &al = this->get_allocator_ref();
+      allocation_guard buffer_guard(m_.buffer, m_.capacity, al);
+      boost::container::parallel_uninitialized_value_init_alloc_n(al, n, this->priv_raw_begin());
+      buffer_guard.release();
+      BOOST_ASSERT(invariants_ok());
+   }
+
    /**
    * [CopyInsertable]: http://en.cppreference.com/w/cpp/concept/CopyInsertable
    *
@@ -327,6 +357,29 @@ class devector
       BOOST_ASSERT(invariants_ok());
    }
 
+   /**
+   * **Effects**: Constructs a devector with `n` copies of `value`, using the specified allocator.
+   * Elements are constructed concurrently by several threads.
+   *
+   * **Requires**: `T` shall be [CopyInsertable] into `*this`. The allocator's `construct` and
+   * `destroy` shall be callable concurrently.
+   *
+   * **Postcondition**: `size() == n`.
+   *
+   * **Exceptions**: Strong exception guarantee.
+   *
+   * **Complexity**: Linear in `n`.
+   */
+   devector(size_type n, const T& value, parallel_init_t, const allocator_type& allocator = allocator_type())
+      : m_(reserve_uninitialized_t(), allocator, n)
+   {
+      allocator_type &al = this->get_allocator_ref();
+      allocation_guard buffer_guard(m_.buffer, m_.capacity, al);
+      boost::container::parallel_uninitialized_fill_alloc_n(al, value, n, this->priv_raw_begin());
+      buffer_guard.release();
+      BOOST_ASSERT(invariants_ok());
+   }
+
    /**
    * **Effects**: Constructs a devector equal to the range `[first,last)`, using the specified allocator.
    *
@@ -412,6 +465,29 @@ class devector
       BOOST_ASSERT(invariants_ok());
    }
 
+   /**
+   * **Effects**: Copy constructs a devector. Elements are constructed concurrently by several threads.
+   *
+   * **Requires**: `T` shall be [CopyInsertable] into `*this`. The allocator's `construct` and
+   * `destroy` shall be callable concurrently.
+   *
+   * **Postcondition**: `this->size() == x.size()`.
+   *
+   * **Exceptions**: Strong exception guarantee.
+   *
+   * **Complexity**: Linear in the size of `x`.
+   */
+   devector(const devector& x, parallel_init_t)
+      : m_(reserve_uninitialized_t(), allocator_traits_type::select_on_container_copy_construction(x.get_allocator_ref()), x.size())
+   {
+      allocator_type &al = this->get_allocator_ref();
+      allocation_guard buffer_guard(m_.buffer, m_.capacity, al);
+      boost::container::parallel_uninitialized_copy_alloc_n
+         (al, boost::movelib::to_raw_pointer(x.m_.buffer) + x.m_.front_idx, x.size(), this->priv_raw_begin());
+      buffer_guard.release();
+      BOOST_ASSERT(invariants_ok());
+   }
+
    /**
    * [CopyInsertable]: http://en.cppreference.com/w/cpp/concept/CopyInsertable
    *
@@ -1018,6 +1094,28 @@ class devector
       this->resize_back(sz, c);
    }
 
+   /**
+    * **Effects**: Same as resize(sz) but new elements are value-initialized
+    * concurrently by several threads. The allocator's `construct` and `destroy`
+    * shall be callable concurrently.
+    */
+   inline void resize(size_type sz, parallel_init_t)
+   {
+      this->resize_back_parallel(sz, value_init);
+      BOOST_ASSERT(invariants_ok());
+   }
+
+   /**
+    * **Effects**: Same as resize(sz, c) but new elements are copy constructed
+    * concurrently by several threads. The allocator's `construct` and `destroy`
+    * shall be callable concurrently.
+    */
+   inline void resize(size_type sz, const T& c, parallel_init_t)
+   {
+      this->resize_back_parallel(sz, c);
+      BOOST_ASSERT(invariants_ok());
+   }
+
    /**
     * **Effects**: If `sz` is greater than the size of `*this`,
     * additional value-initialized elements are inserted
@@ -1181,7 +1279,9 @@ class devector
          size_type const nc = ((new_capacity + rounder)/divisor)*devector_min_free_fraction;
          BOOST_ASSERT(new_capacity <= (nc - nc / devector_min_free_fraction));
          size_type const sz = this->size();
-         reallocate_at(nc, (nc-sz)/2u);
+         if (!this->expand_in_place(expand_fwd | expand_bwd, nc, nc) || this->capacity() < new_capacity) {
+            reallocate_at(nc, (nc-sz)/2u);
+         }
       }
       BOOST_ASSERT(invariants_ok());
    }
@@ -1206,6 +1306,10 @@ class devector
    {
       if (front_capacity() >= new_capacity) { return; }
 
+      //Backwards expansion makes room at the front without moving elements
+      if (this->expand_in_place(expand_bwd, new_capacity + back_free_capacity(), new_capacity + back_free_capacity())
+          && front_capacity() >= new_capacity) { return; }
+
       reallocate_at(new_capacity + back_free_capacity(), new_capacity - size());
 
       BOOST_ASSERT(invariants_ok());
@@ -1231,6 +1335,9 @@ class devector
    {
       if (back_capacity() >= new_capacity) { return; }
 
+      if (this->expand_in_place(expand_fwd, new_capacity + front_free_capacity(), new_capacity + front_free_capacity())
+          && back_capacity() >= new_capacity) { return; }
+
       reallocate_at(new_capacity + front_free_capacity(), m_.front_idx);
 
       BOOST_ASSERT(invariants_ok());
@@ -1259,10 +1366,57 @@ class devector
     */
    inline void shrink_to_fit()
    {
+      dtl::growth_factor_on_shrink_to_fit<growth_factor_type>(m_.capacity, this->size());
       if(this->front_capacity() || this->back_capacity())
             this->reallocate_at(size(), 0);
    }
 
+   /**
+    * **Effects**: Makes sure that `n` elements can be pushed to the back without
+    * reallocation, growing the storage geometrically, and returns a pointer to the
+    * uninitialized storage that follows the last element. `size()` is unchanged.
+    * Invalidates iterators if reallocation is needed.
+    *
+    * **Returns**: A pointer `p` to storage for `n` elements. Elements constructed in
+    * `[p, p + k)` can be added to the devector calling `commit(k)`.
+    *
+    * **Requires**: `T` shall be [MoveInsertable] into `*this`.
+    *
+    * **Complexity**: Linear in the size of `*this` if reallocation is needed, constant otherwise.
+    *
+    * **Note**: Non-standard extension. It lets producers like `read()` write trivially copyable
+    * elements directly in the devector without initializing them first. The pointer is
+    * invalidated by any operation that modifies the devector except `commit`.
+    *
+    * [MoveInsertable]: http://en.cppreference.com/w/cpp/concept/MoveInsertable
+    */
+   T* append_uninitialized(size_type n)
+   {
+      if (this->back_free_capacity() < n) {
+         const size_type front_free = this->front_free_capacity();
+         this->reserve_back(size_type(this->calculate_new_capacity(size_type(m_.back_idx + n)) - front_free));
+      }
+      return boost::movelib::to_raw_pointer(m_.buffer) + m_.back_idx;
+   }
+
+   /**
+    * **Effects**: Adds to the back the first `k` elements of the storage returned
+    * by the last call to `append_uninitialized`.
+    *
+    * **Requires**: `k` is not greater than the argument of that call and the `k` elements
+    * were constructed (or, for trivially copyable types, written).
+    *
+    * **Complexity**: Constant.
+    *
+    * **Note**: Non-standard extension.
+    */
+   void commit(size_type k) BOOST_NOEXCEPT
+   {
+      BOOST_ASSERT(k <= this->back_free_capacity());
+      m_.set_back_idx(size_type(m_.back_idx + k));
+      BOOST_ASSERT(invariants_ok());
+   }
+
    // element access:
 
    /**
@@ -2081,12 +2235,8 @@ class devector
       size_type n = boost::container::iterator_udistance(first, last);
 
       if (front_distance < back_distance) {
-            // move n to the right
-            boost::container::move_backward(begin(), first, last);
-
-            for (iterator i = begin(); i != begin() + n; ++i) {
-               allocator_traits_type::destroy(get_allocator_ref(), boost::movelib::to_raw_pointer(i));
-            }
+            // move (or relocate) n to the right
+            boost::container::shift_erase_backward_alloc(get_allocator_ref(), begin(), first, last);
             //n is always less than max stored_size_type
             m_.set_front_idx(m_.front_idx + n);
 
@@ -2094,13 +2244,8 @@ class devector
             return last;
       }
       else {
-            // move n to the left
-            boost::container::move(last, end(), first);
-
-            for (iterator i = end() - n; i != end(); ++i)
-            {
-               allocator_traits_type::destroy(get_allocator_ref(), boost::movelib::to_raw_pointer(i));
-            }
+            // move (or relocate) n to the left
+            boost::container::shift_erase_forward_alloc(get_allocator_ref(), first, last, end());
             //n is always less than max stored_size_type
             m_.set_back_idx(m_.back_idx - n);
 
@@ -2322,6 +2467,53 @@ class devector
       return p;
    }
 
+   //Allocates at least cap elements and updates cap with the number
+   //of elements the new buffer can hold.
+   pointer allocate_at_least(size_type &cap)
+   {
+      pointer const p = impl::do_allocate_at_least(get_allocator_ref(), cap);
+      #ifdef BOOST_CONTAINER_DEVECTOR_ALLOC_STATS
+      ++m_.capacity_alloc_count;
+      #endif // BOOST_CONTAINER_DEVECTOR_ALLOC_STATS
+      return p;
+   }
+
+   //Tries to expand the buffer in place (version 2 allocators) to hold at least
+   //min_capacity elements. Elements are not moved: if the buffer is expanded
+   //backwards, indexes are updated so that they point to the same elements.
+   inline bool expand_in_place(allocation_type command, size_type min_capacity, size_type preferred_capacity)
+   {  return this->priv_expand_in_place(alloc_version(), command, min_capacity, preferred_capacity);  }
+
+   //Templates, so that they are not instantiated by explicit instantiations with version 1 allocators
+   template<class AllocVersion>
+   inline typename dtl::enable_if_c<AllocVersion::value != 2, bool>::type
+      priv_expand_in_place(AllocVersion, allocation_type, size_type, size_type)
+   {  return false;  }
+
+   template<class AllocVersion>
+   typename dtl::enable_if_c<AllocVersion::value == 2, bool>::type
+      priv_expand_in_place(AllocVersion, allocation_type command, size_type min_capacity, size_type preferred_capacity)
+   {
+      const size_type max_stored = size_type(stored_size_type(-1));
+      if (!m_.buffer || min_capacity > max_stored) {
+         return false;
+      }
+      size_type real_cap = preferred_capacity < max_stored ? preferred_capacity : max_stored;
+      pointer reuse = m_.buffer;
+      pointer const ret = this->get_allocator_ref().allocation_command
+         (command | nothrow_allocation, min_capacity, real_cap, reuse);
+      if (!ret) {
+         return false;
+      }
+      BOOST_ASSERT(reuse == m_.buffer && ret <= m_.buffer);
+      const size_type offset = size_type(m_.buffer - ret);
+      m_.buffer = ret;
+      m_.set_capacity(real_cap < max_stored ? real_cap : max_stored);
+      m_.set_front_idx(size_type(m_.front_idx + offset));
+      m_.set_back_idx(size_type(m_.back_idx + offset));
+      return true;
+   }
+
    void destroy_elements(pointer b, pointer e)
    {
       for (; b != e; ++b) {
@@ -2336,6 +2528,15 @@ class devector
       }
    }
 
+   //Deallocates the old buffer after its elements were relocated to a new one
+   void deallocate_relocated_buffer()
+   {
+      if (m_.buffer) {
+         allocator_traits_type::on_relocation(get_allocator_ref(), this->size());
+         allocator_traits_type::deallocate(get_allocator_ref(), m_.buffer, m_.capacity);
+      }
+   }
+
    #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
    template <typename... Args>
    inline void alloc_construct(pointer dst, Args&&... args)
@@ -2405,7 +2606,8 @@ class devector
       if ( remaining_additional_cap < min_additional_cap )
             boost::container::throw_length_error("devector: get_next_capacity, max size exceeded");
 
-      return growth_factor_type()( size_type(m_.capacity), min_additional_cap, max);
+      return dtl::growth_factor_next_capacity<growth_factor_type, sizeof(T)>
+         ( size_type(m_.capacity), min_additional_cap, max);
    }
 
    #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
@@ -2474,9 +2676,18 @@ class devector
    template <typename... Args>
    void resize_front_slow_path(size_type sz, size_type n, Args&&... args)
    {
-      const size_type back_free_cap = back_free_capacity();
-      const size_type new_capacity = calculate_new_capacity(sz + back_free_cap);
-      pointer new_buffer = allocate(new_capacity);
+      size_type back_free_cap = back_free_capacity();
+      size_type new_capacity = calculate_new_capacity(sz + back_free_cap);
+      if (this->expand_in_place(expand_bwd, sz + back_free_cap, new_capacity)) {
+         if (sz <= this->front_capacity()) {
+            construct_n(m_.buffer + m_.front_idx - n, n, boost::forward<Args>(args)...);
+            m_.set_front_idx(m_.front_idx - n);
+            return;
+         }
+         back_free_cap = back_free_capacity();
+         new_capacity = calculate_new_capacity(sz + back_free_cap);
+      }
+      pointer new_buffer = allocate_at_least(new_capacity);
 
       allocator_type &al = this->get_allocator_ref();
       allocation_guard new_buffer_guard(new_buffer, new_capacity, al);
@@ -2487,12 +2698,11 @@ class devector
       detail::construction_guard<allocator_type> guard(new_buffer + new_elem_index, al);
       guarded_construct_n(new_buffer + new_elem_index, n, guard, boost::forward<Args>(args)...);
 
-      //This might throw
-      boost::container::uninitialized_move_alloc(al, begin(), end(), new_buffer + new_old_elem_index);
+      //This might throw, old elements are relocated (destroyed) if successful
+      boost::container::uninitialized_relocate_alloc(al, begin(), end(), new_buffer + new_old_elem_index);
 
       //This can't throw
-      this->destroy_elements(data(), data() + size());
-      this->deallocate_buffer();
+      this->deallocate_relocated_buffer();
 
       guard.release();
       new_buffer_guard.release();
@@ -2503,6 +2713,58 @@ class devector
       m_.set_back_idx(new_elem_index + sz);
    }
 
+   inline void parallel_construct_at_back(size_type n, value_init_t)
+   {
+      boost::container::parallel_uninitialized_value_init_alloc_n
+         (this->get_allocator_ref(), n, this->priv_raw_end());
+   }
+
+   inline void parallel_construct_at_back(size_type n, const T &c)
+   {
+      boost::container::parallel_uninitialized_fill_alloc_n
+         (this->get_allocator_ref(), c, n, this->priv_raw_end());
+   }
+
+   inline size_type index_of_alias(value_init_t)
+   {  return size_type(-1);  }
+
+   inline size_type index_of_alias(const T &c)
+   {
+      const T *const p = boost::container::dtl::addressof(c);
+      return (this->priv_raw_begin() <= p && p < this->priv_raw_end())
+         ? size_type(p - this->priv_raw_begin()) : size_type(-1);
+   }
+
+   template <class U>
+   void resize_back_parallel(size_type sz, const U &u)
+   {
+      const size_type old_sz = this->size();
+      if (sz > old_sz)
+      {
+         const size_type n = sz - old_sz;
+         if (sz > this->back_capacity())
+         {
+            //u might be an element of the devector, relocated by reserve_back
+            const size_type pos = this->index_of_alias(u);
+            this->reserve_back(sz);
+            if (pos != size_type(-1))
+            {
+               this->parallel_construct_at_back(n, this->priv_raw_begin()[pos]);
+               m_.set_back_idx(m_.back_idx + n);
+               return;
+            }
+         }
+         this->parallel_construct_at_back(n, u);
+         m_.set_back_idx(m_.back_idx + n);
+      }
+      else
+      {
+         const size_type new_bidx = m_.back_idx - (old_sz - sz);
+         destroy_elements(m_.buffer + new_bidx, m_.buffer + m_.back_idx);
+         m_.set_back_idx(new_bidx);
+      }
+   }
+
    template <typename... Args>
    void resize_back_impl(size_type sz, Args&&... args)
    {
@@ -2533,8 +2795,13 @@ class devector
    template <typename... Args>
    void resize_back_slow_path(size_type sz, size_type n, Args&&... args)
    {
-      const size_type new_capacity = calculate_new_capacity(sz + front_free_capacity());
-      pointer new_buffer = allocate(new_capacity);
+      size_type new_capacity = calculate_new_capacity(sz + front_free_capacity());
+      if (this->expand_in_place(expand_fwd, sz + front_free_capacity(), new_capacity)) {
+         construct_n(m_.buffer + m_.back_idx, n, boost::forward<Args>(args)...);
+         m_.set_back_idx(m_.back_idx + n);
+         return;
+      }
+      pointer new_buffer = allocate_at_least(new_capacity);
 
       allocator_type &al = this->get_allocator_ref();
       allocation_guard new_buffer_guard(new_buffer, new_capacity, al);
@@ -2542,12 +2809,11 @@ class devector
       detail::construction_guard<allocator_type> guard(new_buffer + m_.back_idx, al);
       guarded_construct_n(new_buffer + m_.back_idx, n, guard, boost::forward<Args>(args)...);
 
-      //This might throw
-      boost::container::uninitialized_move_alloc(al, begin(), end(), new_buffer + m_.front_idx);
+      //This might throw, old elements are relocated (destroyed) if successful
+      boost::container::uninitialized_relocate_alloc(al, begin(), end(), new_buffer + m_.front_idx);
 
       //This can't throw
-      this->destroy_elements(data(), data() + size());
-      this->deallocate_buffer();
+      this->deallocate_relocated_buffer();
 
       guard.release();
       new_buffer_guard.release();
@@ -2586,9 +2852,18 @@ class devector
    BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
    void resize_front_slow_path(size_type sz, size_type n BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
    {\
-      const size_type back_free_cap = back_free_capacity();\
-      const size_type new_capacity = calculate_new_capacity(sz + back_free_cap);\
-      pointer new_buffer = allocate(new_capacity);\
+      size_type back_free_cap = back_free_capacity();\
+      size_type new_capacity = calculate_new_capacity(sz + back_free_cap);\
+      if (this->expand_in_place(expand_bwd, sz + back_free_cap, new_capacity)) {\
+         if (sz <= this->front_capacity()) {\
+            construct_n(m_.buffer + m_.front_idx - n, n BOOST_MOVE_I##N BOOST_MOVE_FWD##N);\
+            m_.set_front_idx(m_.front_idx - n);\
+            return;\
+         }\
+         back_free_cap = back_free_capacity();\
+         new_capacity = calculate_new_capacity(sz + back_free_cap);\
+      }\
+      pointer new_buffer = allocate_at_least(new_capacity);\
       allocator_type &al = this->get_allocator_ref();\
       allocation_guard new_buffer_guard(new_buffer, new_capacity, al);\
       \
@@ -2598,13 +2873,12 @@ class devector
       detail::construction_guard<allocator_type> guard(new_buffer + new_elem_index, al);\
       guarded_construct_n(new_buffer + new_elem_index, n, guard BOOST_MOVE_I##N BOOST_MOVE_FWD##N);\
       \
-      boost::container::uninitialized_move_alloc(al, begin(), end(), new_buffer + new_old_elem_index);\
+      boost::container::uninitialized_relocate_alloc(al, begin(), end(), new_buffer + new_old_elem_index);\
       \
       guard.release();\
       new_buffer_guard.release();\
       \
-      this->destroy_elements(data(), data() + size());\
-      this->deallocate_buffer();\
+      this->deallocate_relocated_buffer();\
       \
       m_.buffer = new_buffer;\
       m_.set_capacity(new_capacity);\
@@ -2641,18 +2915,22 @@ class devector
    BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
    void resize_back_slow_path(size_type sz, size_type n BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
    {\
-      const size_type new_capacity = calculate_new_capacity(sz + front_free_capacity());\
-      pointer new_buffer = allocate(new_capacity);\
+      size_type new_capacity = calculate_new_capacity(sz + front_free_capacity());\
+      if (this->expand_in_place(expand_fwd, sz + front_free_capacity(), new_capacity)) {\
+         construct_n(m_.buffer + m_.back_idx, n BOOST_MOVE_I##N BOOST_MOVE_FWD##N);\
+         m_.set_back_idx(m_.back_idx + n);\
+         return;\
+      }\
+      pointer new_buffer = allocate_at_least(new_capacity);\
       allocator_type &al = this->get_allocator_ref();\
       allocation_guard new_buffer_guard(new_buffer, new_capacity, al);\
    \
       detail::construction_guard<allocator_type> guard(new_buffer + m_.back_idx, al);\
       guarded_construct_n(new_buffer + m_.back_idx, n, guard BOOST_MOVE_I##N BOOST_MOVE_FWD##N);\
    \
-      boost::container::uninitialized_move_alloc(al, begin(), end(), new_buffer + m_.front_idx);\
+      boost::container::uninitialized_relocate_alloc(al, begin(), end(), new_buffer + m_.front_idx);\
    \
-      this->destroy_elements(data(), data() + size());\
-      this->deallocate_buffer();\
+      this->deallocate_relocated_buffer();\
    \
       guard.release();\
       new_buffer_guard.release();\
@@ -2670,15 +2948,19 @@ class devector
 
    void reallocate_at(size_type new_capacity, size_type buffer_offset)
    {
-      pointer new_buffer = allocate(new_capacity);
+      pointer new_buffer = allocate_at_least(new_capacity);
       {
          allocator_type &al = this->get_allocator_ref();
          allocation_guard new_buffer_guard(new_buffer, new_capacity, al);
-         boost::container::uninitialized_move_alloc(al, this->begin(), this->end(), new_buffer + buffer_offset);
+         //Old elements are relocated (destroyed) if successful
+         boost::container::uninitialized_relocate_alloc(al, this->begin(), this->end(), new_buffer + buffer_offset);
          new_buffer_guard.release();
       }
-      this->destroy_elements(m_.buffer + m_.front_idx, m_.buffer + m_.back_idx);
-      this->deallocate_buffer();
+      //shrink_to_fit also reallocates, but that is not a relocation due to growth
+      if (new_capacity > m_.capacity)
+         this->deallocate_relocated_buffer();
+      else
+         this->deallocate_buffer();
 
       m_.buffer = new_buffer;
       //Safe cast, allocate() will handle stored_size_type overflow
@@ -2760,11 +3042,32 @@ class devector
       size_type const free_cap = front_free_cap + back_free_cap;
       size_type const index = size_type(p - cbegin());
 
-      size_type const cap = m_.capacity;
+      size_type cap = m_.capacity;
       allocator_type &al = this->get_allocator_ref();
+      bool expanded = false;
 
       //Test if enough free memory would be left
-      if (free_cap >= n && (free_cap - n) >= cap/devector_min_free_fraction) {
+      if (!(free_cap >= n && (free_cap - n) >= cap/devector_min_free_fraction)) {
+         //Try to expand the buffer in place (version 2 allocators). Backwards expansion
+         //leaves room at the front and forward expansion at the back, elements are not moved.
+         expanded = this->expand_in_place(expand_fwd | expand_bwd, size_type(cap + n), calculate_new_capacity(cap + n));
+         if (expanded) {
+            cap = m_.capacity;
+            InsertionProxy prx(proxy);
+            if (index == this->size() && back_free_capacity() >= n) {
+               prx.uninitialized_copy_n_and_update(al, this->priv_raw_end(), n);
+               m_.set_back_idx(m_.back_idx + n);
+               return begin() + index;
+            }
+            else if (index == 0u && front_free_capacity() >= n) {
+               prx.uninitialized_copy_n_and_update(al, this->priv_raw_begin() - n, n);
+               m_.set_front_idx(m_.front_idx - n);
+               return begin();
+            }
+         }
+      }
+
+      if (expanded || (free_cap >= n && (free_cap - n) >= cap/devector_min_free_fraction)) {
          size_type const old_size = this->size();
          T* const raw_pos = const_cast<T*>(boost::movelib::to_raw_pointer(p));
          size_type const new_size = old_size + n;
@@ -2781,8 +3084,8 @@ class devector
       }
       else {
          // reallocate
-         const size_type new_capacity = calculate_new_capacity(m_.capacity + n);
-         pointer new_buffer = allocate(new_capacity);
+         size_type new_capacity = calculate_new_capacity(m_.capacity + n);
+         pointer new_buffer = allocate_at_least(new_capacity);
 
          // guard allocation
          allocation_guard new_buffer_guard(new_buffer, new_capacity, al);
@@ -2793,13 +3096,13 @@ class devector
          T* const raw_pos = const_cast<T*>(boost::movelib::to_raw_pointer(p));
          T* const raw_new_start = const_cast<T*>(boost::movelib::to_raw_pointer(new_buffer)) + new_front_index;
 
-         boost::container::uninitialized_move_and_insert_alloc
+         //Old elements are relocated (destroyed) if successful
+         boost::container::uninitialized_relocate_and_insert_alloc
             (al, this->priv_raw_begin(), raw_pos, this->priv_raw_end(), raw_new_start, n, proxy);
          new_buffer_guard.release();
 
          // cleanup
-         destroy_elements(begin(), end());
-         deallocate_buffer();
+         deallocate_relocated_buffer();
 
          // rebind members
          m_.set_capacity(new_capacity);
@@ -2929,6 +3232,21 @@ class devector
          }
       }
 
+      static pointer do_allocate_at_least(allocator_type &a, size_type &cap)
+      {
+         if (cap) {
+            //First detect overflow on smaller stored_size_types
+            if (cap > stored_size_type(-1)){
+                  boost::container::throw_length_error("get_next_capacity, allocator's max size reached");
+            }
+            //Received size must be representable by stored_size_type
+            return dtl::allocate_at_least_up_to(a, cap, size_type(stored_size_type(-1)));
+         }
+         else {
+            return pointer();
+         }
+      }
+
       impl()
          : allocator_type(), buffer(), front_idx(), back_idx(), capacity()
          #ifdef BOOST_CONTAINER_DEVECTOR_ALLOC_STATS
@@ -3086,6 +3404,19 @@ struct has_trivial_destructor_after_move<boost::container::devector<T, Allocator
       ::boost::has_trivial_destructor_after_move<pointer>::value;
 };
 
+namespace container {
+
+//!is_trivially_relocatable<> == true_type
+//!specialization for optimizations
+template <class T, class Allocator, class Options>
+struct is_trivially_relocatable<boost::container::devector<T, Allocator, Options> >
+   : dtl::is_trivially_relocatable_holder
+      < typename boost::container::devector<T, Allocator, Options>::allocator_type
+      , typename boost::container::devector<T, Allocator, Options>::pointer>
+{};
+
+}  //namespace container {
+
 }
 
 #endif    //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
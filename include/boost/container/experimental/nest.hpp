@@ -36,6 +36,7 @@
 #include <boost/container/detail/compare_functors.hpp>
 #include <boost/container/detail/iterator.hpp>
 #include <boost/container/detail/iterators.hpp>
+#include <boost/container/detail/mask_segment_iterator.hpp>
 #include <boost/container/detail/mpl.hpp>
 #include <boost/container/detail/type_traits.hpp>
 // move
@@ -197,6 +198,11 @@ std::pair< nest_iterator<ValuePointer, StoreDataInBlock, Prefetch>, F >
       , nest_iterator<ValuePointer, StoreDataInBlock, Prefetch>
       , F);
 
+template<class Iterator>
+struct segmented_iterator_traits;
+
+struct segmented_iterator_tag;
+
 namespace nest_detail {
 
 //////////////////////////////////////////////
@@ -731,6 +737,8 @@ private:
          ( nest_iterator<VP, SDIB, Pf>
          , nest_iterator<VP, SDIB, Pf>
          , FF);
+   template<class, class, class> friend struct dtl::mask_segmented_iterator_traits;
+   template<class> friend struct boost::container::segmented_iterator_traits;
 
    typedef typename nest_detail::pointer_rebind<ValuePointer, void>::type  void_pointer;
    typedef nest_detail::block_base<void_pointer>                           block_base_type;
@@ -761,6 +769,24 @@ private:
    int                n;
 };
 
+//////////////////////////////////////////////
+//
+//      segmented_iterator_traits
+//
+//////////////////////////////////////////////
+
+//Segments are the blocks of the nest and local iterators visit the occupied slots
+//of a block, so segmented algorithms avoid the block-change test of operator++.
+template<class ValuePointer, bool StoreDataInBlock, bool Prefetch>
+struct segmented_iterator_traits< nest_iterator<ValuePointer, StoreDataInBlock, Prefetch> >
+   : dtl::mask_segmented_iterator_traits
+      < nest_iterator<ValuePointer, StoreDataInBlock, Prefetch>
+      , typename nest_iterator<ValuePointer, StoreDataInBlock, Prefetch>::block_base_pointer
+      , typename nest_iterator<ValuePointer, StoreDataInBlock, Prefetch>::block_type>
+{
+   typedef segmented_iterator_tag is_segmented_iterator;
+};
+
 namespace nest_detail {
 
 //////////////////////////////////////////////
@@ -22,6 +22,7 @@
 #include <boost/container/detail/workaround.hpp>
 #include <boost/container/experimental/segmented_iterator_traits.hpp>
 #include <boost/container/detail/iterator.hpp>
+#include <boost/container/detail/simd_algo.hpp>
 
 namespace boost {
 namespace container {
@@ -121,6 +122,20 @@ segmented_count_dispatch
    return n;
 }
 
+#if defined(BOOST_CONTAINER_SIMD_ALGO_SSE2)
+
+//Segments of integral or floating point types compared with
+//a value of the same type are counted with SIMD comparisons.
+template <class E, class T>
+BOOST_CONTAINER_FORCEINLINE
+typename algo_enable_if_c<dtl::is_simd_algo_pair<E, T>::value, std::ptrdiff_t>::type
+segmented_count_dispatch(E* first, E* last, const T& value, const non_segmented_iterator_tag &, const std::random_access_iterator_tag &)
+{
+   return std::ptrdiff_t(dtl::simd_count(first, std::size_t(last - first), value));
+}
+
+#endif   //BOOST_CONTAINER_SIMD_ALGO_SSE2
+
 template <class SegIter, class T, class Cat>
 typename boost::container::iterator_traits<SegIter>::difference_type
    segmented_count_dispatch(SegIter first, SegIter last, const T& BOOST_RESTRICT value, segmented_iterator_tag, Cat)
@@ -22,6 +22,7 @@
 #include <boost/container/detail/workaround.hpp>
 #include <boost/container/experimental/segmented_iterator_traits.hpp>
 #include <boost/container/detail/iterator.hpp>
+#include <boost/container/detail/simd_algo.hpp>
 #include <boost/container/experimental/segmented_fill_n.hpp>
 
 namespace boost {
@@ -77,6 +78,20 @@ segmented_fill_range(FwdIt first, Sent last, const T& value, Tag, Cat)
       *first = value;
 }
 
+#if defined(BOOST_CONTAINER_SIMD_ALGO_SSE2)
+
+//Segments of integral or floating point types are
+//filled with SIMD stores of a value of the same type.
+template <class E, class T>
+BOOST_CONTAINER_FORCEINLINE
+typename algo_enable_if_c<dtl::is_simd_algo_pair<E, T>::value>::type
+segmented_fill_range(E* first, E* last, const T& value, const non_segmented_iterator_tag &, const std::random_access_iterator_tag &)
+{
+   dtl::simd_fill(first, std::size_t(last - first), value);
+}
+
+#endif   //BOOST_CONTAINER_SIMD_ALGO_SSE2
+
 template <class SegIter, class T, class Cat>
 void segmented_fill_range
    (SegIter first, SegIter last, const T& value, segmented_iterator_tag, Cat)
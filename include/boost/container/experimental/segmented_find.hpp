@@ -22,6 +22,7 @@
 #include <boost/container/detail/workaround.hpp>
 #include <boost/container/experimental/segmented_iterator_traits.hpp>
 #include <boost/container/detail/iterators.hpp>
+#include <boost/container/detail/simd_algo.hpp>
 
 namespace boost {
 namespace container {
@@ -95,6 +96,20 @@ segmented_find_dispatch(InpIter first, Sent last, const T& BOOST_RESTRICT value,
    return first;
 }
 
+#if defined(BOOST_CONTAINER_SIMD_ALGO_SSE2)
+
+//Segments of integral or floating point types compared with
+//a value of the same type are searched with SIMD comparisons.
+template <class E, class T>
+BOOST_CONTAINER_FORCEINLINE
+typename algo_enable_if_c<dtl::is_simd_algo_pair<E, T>::value, E*>::type
+segmented_find_dispatch(E* first, E* last, const T& value, const non_segmented_iterator_tag &, const std::random_access_iterator_tag &)
+{
+   return first + dtl::simd_find(first, std::size_t(last - first), value);
+}
+
+#endif   //BOOST_CONTAINER_SIMD_ALGO_SSE2
+
 template <class SegIter, class T, class Cat>
 SegIter segmented_find_dispatch
    (SegIter first, SegIter last, const T& BOOST_RESTRICT value, segmented_iterator_tag, Cat)
@@ -22,6 +22,7 @@
 #include <boost/container/detail/workaround.hpp>
 #include <boost/container/experimental/segmented_iterator_traits.hpp>
 #include <boost/container/detail/iterators.hpp>
+#include <boost/container/detail/simd_algo.hpp>
 #include <utility>
 
 namespace boost {
@@ -149,6 +150,36 @@ segmented_mismatch_iter2_bounded
 
 #endif   //BOOST_CONTAINER_SEGMENTED_ENABLE_DUAL_RA_OPTIMIZATION
 
+#if defined(BOOST_CONTAINER_SIMD_ALGO_SSE2)
+
+//Segments of integral or floating point types compared with operator==
+//against contiguous elements of the same type use SIMD comparisons.
+template <class E1, class E2>
+BOOST_CONTAINER_FORCEINLINE
+typename algo_enable_if_c<dtl::is_simd_algo_pair<E1, E2>::value, segduo<E1*, E2*> >::type
+segmented_mismatch_iter2_bounded
+   (E1* first1, E1* last1, E2* first2, E2* iter2_last, mismatch_equal,
+    const non_segmented_iterator_tag &, const std::random_access_iterator_tag &)
+{
+   const std::size_t n1 = std::size_t(last1 - first1);
+   const std::size_t n2 = std::size_t(iter2_last - first2);
+   const std::size_t n = dtl::simd_mismatch(first1, first2, n1 < n2 ? n1 : n2);
+   return segduo<E1*, E2*>(first1 + n, first2 + n);
+}
+
+template <class E1, class E2>
+BOOST_CONTAINER_FORCEINLINE
+typename algo_enable_if_c<dtl::is_simd_algo_pair<E1, E2>::value, segduo<E1*, E2*> >::type
+segmented_mismatch_iter2_bounded
+   (E1* first1, E1* last1, E2* first2, unreachable_sentinel_t, mismatch_equal,
+    const non_segmented_iterator_tag &, const std::random_access_iterator_tag &)
+{
+   const std::size_t n = dtl::simd_mismatch(first1, first2, std::size_t(last1 - first1));
+   return segduo<E1*, E2*>(first1 + n, first2 + n);
+}
+
+#endif   //BOOST_CONTAINER_SIMD_ALGO_SSE2
+
 template <class SrcIter, class Sent, class SegIter2, class BinaryPred, class SrcCat>
 segduo<SrcIter, SegIter2> segmented_mismatch_iter2_bounded
    (SrcIter first1, Sent last1, SegIter2 iter2_first, SegIter2 iter2_last, BinaryPred pred,
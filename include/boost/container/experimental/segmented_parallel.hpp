@@ -0,0 +1,839 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#ifndef BOOST_CONTAINER_EXPERIMENTAL_SEGMENTED_PARALLEL_HPP
+#define BOOST_CONTAINER_EXPERIMENTAL_SEGMENTED_PARALLEL_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/experimental/segmented_iterator_traits.hpp>
+#include <boost/container/experimental/segmented_copy.hpp>
+#include <boost/container/experimental/segmented_count.hpp>
+#include <boost/container/experimental/segmented_count_if.hpp>
+#include <boost/container/experimental/segmented_fill.hpp>
+#include <boost/container/experimental/segmented_find.hpp>
+#include <boost/container/experimental/segmented_find_if.hpp>
+#include <boost/container/experimental/segmented_find_if_not.hpp>
+#include <boost/container/experimental/segmented_for_each.hpp>
+#include <boost/container/experimental/segmented_replace.hpp>
+#include <boost/container/experimental/segmented_replace_if.hpp>
+#include <boost/container/experimental/segmented_transform.hpp>
+#include <boost/container/detail/bit_utilities.hpp>
+#include <boost/container/detail/iterator.hpp>
+#include <boost/container/detail/mask_segment_iterator.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/parallel_algo.hpp>
+#include <cstddef>
+
+//! Parallel segmented algorithms run tasks in std::threads and need std::atomic to
+//! publish the progress of searches. Otherwise, tasks run sequentially in the calling
+//! thread (user-defined executors are still honored).
+#if defined(BOOST_CONTAINER_HAS_PARALLEL_INIT) && !defined(BOOST_NO_CXX11_HDR_ATOMIC)
+#  define BOOST_CONTAINER_HAS_SEGMENTED_PARALLEL
+#  include <atomic>
+#endif
+
+//! Maximum number of tasks a range is split into.
+#ifndef BOOST_CONTAINER_SEGMENTED_PARALLEL_MAX_TASKS
+#  define BOOST_CONTAINER_SEGMENTED_PARALLEL_MAX_TASKS 256u
+#endif
+
+//! Maximum number of threads (including the calling thread) used by segmented_thread_executor.
+#ifndef BOOST_CONTAINER_SEGMENTED_PARALLEL_MAX_THREADS
+#  define BOOST_CONTAINER_SEGMENTED_PARALLEL_MAX_THREADS 64u
+#endif
+
+//! Default minimum number of elements of a task. Ranges smaller than twice
+//! this value are processed by the calling thread.
+#ifndef BOOST_CONTAINER_SEGMENTED_PARALLEL_MIN_TASK_SIZE
+#  define BOOST_CONTAINER_SEGMENTED_PARALLEL_MIN_TASK_SIZE (std::size_t(1u) << 15u)
+#endif
+
+//! Number of tasks per thread of the executor. More tasks than threads balance
+//! the load when some segments are more expensive to process than others.
+#ifndef BOOST_CONTAINER_SEGMENTED_PARALLEL_TASKS_PER_THREAD
+#  define BOOST_CONTAINER_SEGMENTED_PARALLEL_TASKS_PER_THREAD 4u
+#endif
+
+namespace boost {
+namespace container {
+namespace detail_algo {
+
+#if defined(BOOST_CONTAINER_HAS_SEGMENTED_PARALLEL)
+
+//Runs tasks in increasing index order until all of them have been taken
+template<class Fn>
+struct segmented_task_puller
+{
+   segmented_task_puller(Fn &fn, std::atomic<std::size_t> &next, std::size_t ntasks)
+      : m_fn(&fn), m_next(&next), m_ntasks(ntasks)
+   {}
+
+   void operator()() const
+   {
+      for(std::size_t i; (i = m_next->fetch_add(1u, std::memory_order_relaxed)) < m_ntasks; ){
+         (*m_fn)(i);
+      }
+   }
+
+   Fn *m_fn;
+   std::atomic<std::size_t> *m_next;
+   std::size_t m_ntasks;
+};
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_SEGMENTED_PARALLEL)
+
+}  //namespace detail_algo {
+
+//! Executor that runs the tasks of a parallel segmented algorithm in std::threads.
+//! The calling thread also runs tasks. Threads are created per algorithm call: the
+//! default minimum task size makes the creation cost negligible.
+//!
+//! An executor is any copyable class with the following members:
+//!
+//!   std::size_t concurrency() const; //Number of tasks that can run concurrently
+//!   template<class Fn> void run(std::size_t ntasks, Fn &fn) const; //Calls fn(i) for i in [0, ntasks) and waits
+//!
+//! fn does not throw: exceptions thrown by the element operations are captured and
+//! rethrown by the algorithm in the calling thread.
+class segmented_thread_executor
+{
+   public:
+   //! <b>Effects</b>: Constructs an executor that uses up to "threads" threads, including the calling one.
+   //!   If threads is zero std::thread::hardware_concurrency() threads are used.
+   explicit segmented_thread_executor(std::size_t threads = 0u) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_threads(threads)
+   {}
+
+   //! <b>Returns</b>: The number of threads used to run tasks.
+   std::size_t concurrency() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      #if defined(BOOST_CONTAINER_HAS_SEGMENTED_PARALLEL)
+      std::size_t n = m_threads ? m_threads : std::size_t(std::thread::hardware_concurrency());
+      n = n ? n : 1u;
+      return n < std::size_t(BOOST_CONTAINER_SEGMENTED_PARALLEL_MAX_THREADS) ? n : std::size_t(BOOST_CONTAINER_SEGMENTED_PARALLEL_MAX_THREADS);
+      #else
+      return 1u;
+      #endif
+   }
+
+   //! <b>Effects</b>: Calls fn(i) for every i in [0, ntasks). Tasks are started in increasing
+   //!   index order. If a thread can't be created, tasks run in the remaining threads.
+   template<class Fn>
+   void run(std::size_t ntasks, Fn &fn) const
+   {
+      #if defined(BOOST_CONTAINER_HAS_SEGMENTED_PARALLEL)
+      std::size_t nthreads = this->concurrency();
+      nthreads = nthreads < ntasks ? nthreads : ntasks;
+      if(nthreads > 1u){
+         typedef detail_algo::segmented_task_puller<Fn> puller_t;
+         std::atomic<std::size_t> next(0u);
+         puller_t puller(fn, next, ntasks);
+         std::thread threads[BOOST_CONTAINER_SEGMENTED_PARALLEL_MAX_THREADS];
+         std::size_t spawned = 1u;
+         BOOST_CONTAINER_TRY{
+            for(; spawned != nthreads; ++spawned){
+               threads[spawned] = std::thread(dtl::ref_wrapper_call<puller_t>(puller));
+            }
+         }
+         BOOST_CONTAINER_CATCH(...){
+         }
+         BOOST_CONTAINER_CATCH_END
+         puller();
+         for(std::size_t i = 1u; i != spawned; ++i){
+            threads[i].join();
+         }
+         return;
+      }
+      #endif
+      for(std::size_t i = 0; i != ntasks; ++i){
+         fn(i);
+      }
+   }
+
+   private:
+   std::size_t m_threads;
+};
+
+//! Execution policy of parallel segmented algorithms. The range is split in tasks at
+//! segment boundaries (whole segments are never shared between tasks unless a segment
+//! is bigger than a task) and tasks are run by the executor.
+template<class Executor = segmented_thread_executor>
+class segmented_parallel_policy
+{
+   public:
+   typedef Executor executor_type;
+
+   //! <b>Effects</b>: Constructs a policy that runs tasks of at least min_task_size elements in ex.
+   explicit segmented_parallel_policy
+      (const executor_type &ex = executor_type(), std::size_t min_task_size = BOOST_CONTAINER_SEGMENTED_PARALLEL_MIN_TASK_SIZE)
+      : m_executor(ex), m_min_task_size(min_task_size ? min_task_size : 1u)
+   {}
+
+   //! <b>Returns</b>: The executor that runs the tasks.
+   const executor_type &executor() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_executor;  }
+
+   //! <b>Returns</b>: The minimum number of elements of a task.
+   std::size_t min_task_size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_min_task_size;  }
+
+   private:
+   executor_type m_executor;
+   std::size_t   m_min_task_size;
+};
+
+//! Default parallel policy: tasks run in hardware_concurrency() threads.
+static const segmented_parallel_policy<> segmented_par = segmented_parallel_policy<>();
+
+//! <b>Returns</b>: A policy that runs tasks of at least min_task_size elements in ex.
+template<class Executor>
+inline segmented_parallel_policy<Executor> segmented_par_on
+   (const Executor &ex, std::size_t min_task_size = BOOST_CONTAINER_SEGMENTED_PARALLEL_MIN_TASK_SIZE)
+{  return segmented_parallel_policy<Executor>(ex, min_task_size);  }
+
+namespace detail_algo {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//                         range partition
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Task i processes [bounds[i], bounds[i+1]) whose first element is at
+//position offsets[i] of the range
+template<class It>
+struct segmented_partition
+{
+   std::size_t ntasks;
+   It          bounds[BOOST_CONTAINER_SEGMENTED_PARALLEL_MAX_TASKS + 1u];
+   std::size_t offsets[BOOST_CONTAINER_SEGMENTED_PARALLEL_MAX_TASKS + 1u];
+};
+
+inline std::size_t segmented_parallel_task_count(std::size_t n, std::size_t min_task_size, std::size_t max_tasks)
+{
+   const std::size_t ntasks = n/min_task_size;
+   return ntasks < 2u ? 1u : ntasks < max_tasks ? ntasks : max_tasks;
+}
+
+//Element position where task i of ntasks starts
+inline std::size_t segmented_parallel_task_start(std::size_t n, std::size_t ntasks, std::size_t i)
+{  return (n/ntasks)*i + ((n%ntasks)*i)/ntasks;  }
+
+//Number of elements of a local range
+template<class LocalIt>
+inline std::size_t segmented_local_size(const LocalIt &first, const LocalIt &last)
+{  return std::size_t(boost::container::iterator_distance(first, last));  }
+
+template<class BlockBasePointer, class Block, class ValuePointer>
+inline std::size_t segmented_local_size
+   ( const dtl::mask_local_iterator<BlockBasePointer, Block, ValuePointer> &first
+   , const dtl::mask_local_iterator<BlockBasePointer, Block, ValuePointer> &last)
+{  return std::size_t(dtl::popcount(first.get_mask() & ~last.get_mask()));  }
+
+template<class It>
+inline It segmented_snap_to_segment(const It &it, const It &prev, non_segmented_iterator_tag)
+{  (void)prev; return it;  }
+
+//Moves a task boundary to the start of its segment, unless that would make the previous task empty
+template<class It>
+inline It segmented_snap_to_segment(const It &it, const It &prev, segmented_iterator_tag)
+{
+   typedef segmented_iterator_traits<It> traits;
+   const typename traits::segment_iterator s = traits::segment(it);
+   const It sb = traits::compose(s, traits::begin(s));
+   return prev < sb ? sb : it;
+}
+
+//Random-access ranges are split by position
+template<class It, class SegTag>
+void segmented_parallel_split_ra
+   (It first, It last, std::size_t min_task_size, std::size_t max_tasks, segmented_partition<It> &p, SegTag)
+{
+   typedef typename iterator_traits<It>::difference_type difference_type;
+   const std::size_t n = std::size_t(last - first);
+   const std::size_t ntasks = (segmented_parallel_task_count)(n, min_task_size, max_tasks);
+   std::size_t k = 0u;
+   p.bounds[0]  = first;
+   p.offsets[0] = 0u;
+   for(std::size_t i = 1u; i != ntasks; ++i){
+      const It b = (segmented_snap_to_segment)
+         (first + difference_type((segmented_parallel_task_start)(n, ntasks, i)), p.bounds[k], SegTag());
+      if(b != p.bounds[k]){
+         ++k;
+         p.bounds[k]  = b;
+         p.offsets[k] = std::size_t(b - first);
+      }
+   }
+   ++k;
+   p.bounds[k]  = last;
+   p.offsets[k] = n;
+   p.ntasks = k;
+}
+
+template<class It>
+inline void segmented_parallel_split
+   (It first, It last, std::size_t min_task_size, std::size_t max_tasks, segmented_partition<It> &p, segmented_iterator_tag, std::random_access_iterator_tag)
+{  (segmented_parallel_split_ra)(first, last, min_task_size, max_tasks, p, segmented_iterator_tag());  }
+
+template<class It>
+inline void segmented_parallel_split
+   (It first, It last, std::size_t min_task_size, std::size_t max_tasks, segmented_partition<It> &p, non_segmented_iterator_tag, std::random_access_iterator_tag)
+{  (segmented_parallel_split_ra)(first, last, min_task_size, max_tasks, p, non_segmented_iterator_tag());  }
+
+//Other segmented ranges are split at segment boundaries after counting
+//the elements of each segment
+template<class It, class Cat>
+void segmented_parallel_split
+   (It first, It last, std::size_t min_task_size, std::size_t max_tasks, segmented_partition<It> &p, segmented_iterator_tag, Cat)
+{
+   typedef segmented_iterator_traits<It>      traits;
+   typedef typename traits::segment_iterator  segment_iterator;
+
+   const segment_iterator sfirst = traits::segment(first);
+   const segment_iterator slast  = traits::segment(last);
+   std::size_t k = 0u;
+   p.bounds[0]  = first;
+   p.offsets[0] = 0u;
+   std::size_t n;
+   if(sfirst == slast){
+      n = (segmented_local_size)(traits::local(first), traits::local(last));
+   }
+   else{
+      const std::size_t first_size = (segmented_local_size)(traits::local(first), traits::end(sfirst));
+      n = first_size;
+      segment_iterator s = sfirst;
+      for(++s; s != slast; ++s){
+         n += (segmented_local_size)(traits::begin(s), traits::end(s));
+      }
+      n += (segmented_local_size)(traits::begin(slast), traits::local(last));
+
+      const std::size_t ntasks = (segmented_parallel_task_count)(n, min_task_size, max_tasks);
+      std::size_t acc = first_size;
+      s = sfirst;
+      for(++s; s != slast && k + 1u != ntasks; ++s){
+         if(acc >= (segmented_parallel_task_start)(n, ntasks, k + 1u)){
+            ++k;
+            p.bounds[k]  = traits::compose(s, traits::begin(s));
+            p.offsets[k] = acc;
+         }
+         acc += (segmented_local_size)(traits::begin(s), traits::end(s));
+      }
+   }
+   ++k;
+   p.bounds[k]  = last;
+   p.offsets[k] = n;
+   p.ntasks = k;
+}
+
+//Non-segmented ranges without random access are processed by a single task
+template<class It, class Cat>
+void segmented_parallel_split
+   (It first, It last, std::size_t, std::size_t, segmented_partition<It> &p, non_segmented_iterator_tag, Cat)
+{
+   p.bounds[0]  = first;
+   p.bounds[1]  = last;
+   p.offsets[0] = 0u;
+   p.offsets[1] = 0u;
+   p.ntasks = 1u;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//                         task execution
+//
+//////////////////////////////////////////////////////////////////////////////
+
+template<class It, class Op>
+struct segmented_parallel_job
+{
+   segmented_parallel_job(const segmented_partition<It> &p, Op &op)
+      : m_p(&p), m_op(&op)
+   {}
+
+   void operator()(std::size_t i)
+   {
+      #if defined(BOOST_CONTAINER_HAS_SEGMENTED_PARALLEL)
+      BOOST_CONTAINER_TRY{
+         m_op->run(i, m_p->bounds[i], m_p->bounds[i + 1u], m_p->offsets[i]);
+      }
+      BOOST_CONTAINER_CATCH(...){
+         m_errors[i] = std::current_exception();
+      }
+      BOOST_CONTAINER_CATCH_END
+      #else
+      m_op->run(i, m_p->bounds[i], m_p->bounds[i + 1u], m_p->offsets[i]);
+      #endif
+   }
+
+   const segmented_partition<It> *m_p;
+   Op *m_op;
+   #if defined(BOOST_CONTAINER_HAS_SEGMENTED_PARALLEL)
+   std::exception_ptr m_errors[BOOST_CONTAINER_SEGMENTED_PARALLEL_MAX_TASKS];
+   #endif
+};
+
+//Splits [first, last) and calls op.run(task, task_first, task_last, task_offset) for each task.
+//If any task throws, the exception of the task that comes first in the range is rethrown.
+template<class Executor, class It, class Op>
+void segmented_parallel_run
+   (const segmented_parallel_policy<Executor> &policy, It first, It last, Op &op, segmented_partition<It> &p)
+{
+   typedef typename iterator_traits<It>::iterator_category           cat_t;
+   typedef typename segmented_iterator_traits<It>::is_segmented_iterator seg_t;
+
+   const std::size_t conc = policy.executor().concurrency();
+   const std::size_t max_tasks = conc*std::size_t(BOOST_CONTAINER_SEGMENTED_PARALLEL_TASKS_PER_THREAD);
+   if(conc < 2u){
+      //Splitting might need a pass over all segments
+      (segmented_parallel_split)(first, last, 0u, 1u, p, non_segmented_iterator_tag(), std::forward_iterator_tag());
+   }
+   else{
+      (segmented_parallel_split)
+         ( first, last, policy.min_task_size()
+         , max_tasks < std::size_t(BOOST_CONTAINER_SEGMENTED_PARALLEL_MAX_TASKS) ? max_tasks : std::size_t(BOOST_CONTAINER_SEGMENTED_PARALLEL_MAX_TASKS)
+         , p, seg_t(), cat_t());
+   }
+   if(p.ntasks == 1u){
+      op.run(0u, p.bounds[0], p.bounds[1], 0u);
+      return;
+   }
+   segmented_parallel_job<It, Op> job(p, op);
+   policy.executor().run(p.ntasks, job);
+   #if defined(BOOST_CONTAINER_HAS_SEGMENTED_PARALLEL)
+   for(std::size_t i = 0; i != p.ntasks; ++i){
+      if(job.m_errors[i]){
+         std::rethrow_exception(job.m_errors[i]);
+      }
+   }
+   #endif
+}
+
+//Lowest index of the tasks that found an element
+class segmented_min_index
+{
+   public:
+   segmented_min_index()
+      : m_index(std::size_t(-1))
+   {}
+
+   std::size_t load() const
+   {
+      #if defined(BOOST_CONTAINER_HAS_SEGMENTED_PARALLEL)
+      return m_index.load(std::memory_order_relaxed);
+      #else
+      return m_index;
+      #endif
+   }
+
+   void update(std::size_t i)
+   {
+      #if defined(BOOST_CONTAINER_HAS_SEGMENTED_PARALLEL)
+      std::size_t cur = m_index.load(std::memory_order_relaxed);
+      while(i < cur && !m_index.compare_exchange_weak(cur, i, std::memory_order_relaxed)){}
+      #else
+      if(i < m_index)
+         m_index = i;
+      #endif
+   }
+
+   private:
+   #if defined(BOOST_CONTAINER_HAS_SEGMENTED_PARALLEL)
+   std::atomic<std::size_t> m_index;
+   #else
+   std::size_t m_index;
+   #endif
+};
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//                         task operations
+//
+//////////////////////////////////////////////////////////////////////////////
+
+template<class F>
+struct par_for_each_op
+{
+   explicit par_for_each_op(const F &f) : m_f(f) {}
+
+   template<class It>
+   void run(std::size_t, It first, It last, std::size_t)
+   {  (segmented_for_each)(first, last, F(m_f));  }
+
+   const F &m_f;
+};
+
+template<class It>
+struct par_count_base
+{
+   typedef typename iterator_traits<It>::difference_type difference_type;
+
+   difference_type sum(std::size_t ntasks) const
+   {
+      difference_type n = 0;
+      for(std::size_t i = 0; i != ntasks; ++i){
+         n += m_counts[i];
+      }
+      return n;
+   }
+
+   difference_type m_counts[BOOST_CONTAINER_SEGMENTED_PARALLEL_MAX_TASKS];
+};
+
+template<class It, class Pred>
+struct par_count_if_op
+   : par_count_base<It>
+{
+   explicit par_count_if_op(const Pred &pred) : m_pred(pred) {}
+
+   void run(std::size_t i, It first, It last, std::size_t)
+   {  this->m_counts[i] = (segmented_count_if)(first, last, Pred(m_pred));  }
+
+   const Pred &m_pred;
+};
+
+template<class It, class T>
+struct par_count_op
+   : par_count_base<It>
+{
+   explicit par_count_op(const T &value) : m_value(value) {}
+
+   void run(std::size_t i, It first, It last, std::size_t)
+   {  this->m_counts[i] = (segmented_count)(first, last, m_value);  }
+
+   const T &m_value;
+};
+
+template<class T>
+struct par_find_searcher
+{
+   explicit par_find_searcher(const T &value) : m_value(value) {}
+
+   template<class It>
+   It operator()(It first, It last) const
+   {  return (segmented_find)(first, last, m_value);  }
+
+   const T &m_value;
+};
+
+template<class Pred>
+struct par_find_if_searcher
+{
+   explicit par_find_if_searcher(const Pred &pred) : m_pred(pred) {}
+
+   template<class It>
+   It operator()(It first, It last) const
+   {  return (segmented_find_if)(first, last, Pred(m_pred));  }
+
+   const Pred &m_pred;
+};
+
+template<class Pred>
+struct par_find_if_not_searcher
+{
+   explicit par_find_if_not_searcher(const Pred &pred) : m_pred(pred) {}
+
+   template<class It>
+   It operator()(It first, It last) const
+   {  return (segmented_find_if_not)(first, last, Pred(m_pred));  }
+
+   const Pred &m_pred;
+};
+
+//Tasks after the first one that found an element are skipped
+template<class It, class Searcher>
+struct par_find_op
+{
+   explicit par_find_op(const Searcher &s) : m_searcher(s), m_found() {}
+
+   void run(std::size_t i, It first, It last, std::size_t)
+   {
+      if(i < m_found.load()){
+         const It r = m_searcher(first, last);
+         if(r != last){
+            m_results[i] = r;
+            m_found.update(i);
+         }
+      }
+   }
+
+   It result(It last) const
+   {
+      const std::size_t i = m_found.load();
+      return i == std::size_t(-1) ? last : m_results[i];
+   }
+
+   Searcher m_searcher;
+   segmented_min_index m_found;
+   It m_results[BOOST_CONTAINER_SEGMENTED_PARALLEL_MAX_TASKS];
+};
+
+template<class T>
+struct par_fill_op
+{
+   explicit par_fill_op(const T &value) : m_value(value) {}
+
+   template<class It>
+   void run(std::size_t, It first, It last, std::size_t)
+   {  (segmented_fill)(first, last, m_value);  }
+
+   const T &m_value;
+};
+
+template<class T>
+struct par_replace_op
+{
+   par_replace_op(const T &old_value, const T &new_value) : m_old_value(old_value), m_new_value(new_value) {}
+
+   template<class It>
+   void run(std::size_t, It first, It last, std::size_t)
+   {  (segmented_replace)(first, last, m_old_value, m_new_value);  }
+
+   const T &m_old_value;
+   const T &m_new_value;
+};
+
+template<class Pred, class T>
+struct par_replace_if_op
+{
+   par_replace_if_op(const Pred &pred, const T &new_value) : m_pred(pred), m_new_value(new_value) {}
+
+   template<class It>
+   void run(std::size_t, It first, It last, std::size_t)
+   {  (segmented_replace_if)(first, last, Pred(m_pred), m_new_value);  }
+
+   const Pred &m_pred;
+   const T &m_new_value;
+};
+
+//Each task writes to the output position of its first element
+template<class OutIter, class UnaryOp>
+struct par_transform_op
+{
+   par_transform_op(OutIter result, const UnaryOp &op) : m_result(result), m_op(op) {}
+
+   template<class It>
+   void run(std::size_t i, It first, It last, std::size_t offset)
+   {
+      typedef typename iterator_traits<OutIter>::difference_type difference_type;
+      m_results[i] = (segmented_transform)(first, last, m_result + difference_type(offset), UnaryOp(m_op));
+   }
+
+   OutIter m_result;
+   const UnaryOp &m_op;
+   OutIter m_results[BOOST_CONTAINER_SEGMENTED_PARALLEL_MAX_TASKS];
+};
+
+template<class OutIter>
+struct par_copy_op
+{
+   explicit par_copy_op(OutIter result) : m_result(result) {}
+
+   template<class It>
+   void run(std::size_t i, It first, It last, std::size_t offset)
+   {
+      typedef typename iterator_traits<OutIter>::difference_type difference_type;
+      m_results[i] = (segmented_copy)(first, last, m_result + difference_type(offset));
+   }
+
+   OutIter m_result;
+   OutIter m_results[BOOST_CONTAINER_SEGMENTED_PARALLEL_MAX_TASKS];
+};
+
+template<class Executor, class FwdIt, class OutIter, class UnaryOp>
+OutIter segmented_par_transform_dispatch
+   (const segmented_parallel_policy<Executor> &policy, FwdIt first, FwdIt last, OutIter result, UnaryOp op, std::random_access_iterator_tag)
+{
+   par_transform_op<OutIter, UnaryOp> t(result, op);
+   segmented_partition<FwdIt> p;
+   (segmented_parallel_run)(policy, first, last, t, p);
+   return t.m_results[p.ntasks - 1u];
+}
+
+//Output positions of tasks can't be computed in constant time
+template<class Executor, class FwdIt, class OutIter, class UnaryOp, class Cat>
+OutIter segmented_par_transform_dispatch
+   (const segmented_parallel_policy<Executor> &, FwdIt first, FwdIt last, OutIter result, UnaryOp op, Cat)
+{  return (segmented_transform)(first, last, result, op);  }
+
+template<class Executor, class FwdIt, class OutIter>
+OutIter segmented_par_copy_dispatch
+   (const segmented_parallel_policy<Executor> &policy, FwdIt first, FwdIt last, OutIter result, std::random_access_iterator_tag)
+{
+   par_copy_op<OutIter> t(result);
+   segmented_partition<FwdIt> p;
+   (segmented_parallel_run)(policy, first, last, t, p);
+   return t.m_results[p.ntasks - 1u];
+}
+
+template<class Executor, class FwdIt, class OutIter, class Cat>
+OutIter segmented_par_copy_dispatch
+   (const segmented_parallel_policy<Executor> &, FwdIt first, FwdIt last, OutIter result, Cat)
+{  return (segmented_copy)(first, last, result);  }
+
+}  //namespace detail_algo {
+
+//////////////////////////////////////////////////////////////////////////////
+//
+//                         parallel algorithms
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//! <b>Effects</b>: Applies a copy of f to every element of [first, last). Elements of different
+//!   tasks are visited concurrently, elements of a task are visited in order.
+//!
+//! <b>Throws</b>: The exception thrown by f for the first element (in range order) of the tasks
+//!   that threw. Tasks that did not throw are completed.
+template <class Executor, class FwdIt, class F>
+void segmented_for_each(const segmented_parallel_policy<Executor> &policy, FwdIt first, FwdIt last, F f)
+{
+   detail_algo::par_for_each_op<F> t(f);
+   detail_algo::segmented_partition<FwdIt> p;
+   (detail_algo::segmented_parallel_run)(policy, first, last, t, p);
+}
+
+//! <b>Returns</b>: The number of elements of [first, last) that satisfy pred.
+template <class Executor, class FwdIt, class Pred>
+typename iterator_traits<FwdIt>::difference_type
+   segmented_count_if(const segmented_parallel_policy<Executor> &policy, FwdIt first, FwdIt last, Pred pred)
+{
+   detail_algo::par_count_if_op<FwdIt, Pred> t(pred);
+   detail_algo::segmented_partition<FwdIt> p;
+   (detail_algo::segmented_parallel_run)(policy, first, last, t, p);
+   return t.sum(p.ntasks);
+}
+
+//! <b>Returns</b>: The number of elements of [first, last) equal to value.
+template <class Executor, class FwdIt, class T>
+typename iterator_traits<FwdIt>::difference_type
+   segmented_count(const segmented_parallel_policy<Executor> &policy, FwdIt first, FwdIt last, const T &value)
+{
+   detail_algo::par_count_op<FwdIt, T> t(value);
+   detail_algo::segmented_partition<FwdIt> p;
+   (detail_algo::segmented_parallel_run)(policy, first, last, t, p);
+   return t.sum(p.ntasks);
+}
+
+//! <b>Returns</b>: The first iterator i of [first, last) that satisfies pred(*i) or last.
+//!   As in the sequential algorithm, the first matching element is returned even if
+//!   tasks placed later in the range found a match before.
+template <class Executor, class FwdIt, class Pred>
+FwdIt segmented_find_if(const segmented_parallel_policy<Executor> &policy, FwdIt first, FwdIt last, Pred pred)
+{
+   typedef detail_algo::par_find_if_searcher<Pred> searcher_t;
+   detail_algo::par_find_op<FwdIt, searcher_t> t((searcher_t(pred)));
+   detail_algo::segmented_partition<FwdIt> p;
+   (detail_algo::segmented_parallel_run)(policy, first, last, t, p);
+   return t.result(last);
+}
+
+//! <b>Returns</b>: The first iterator i of [first, last) that doesn't satisfy pred(*i) or last.
+template <class Executor, class FwdIt, class Pred>
+FwdIt segmented_find_if_not(const segmented_parallel_policy<Executor> &policy, FwdIt first, FwdIt last, Pred pred)
+{
+   typedef detail_algo::par_find_if_not_searcher<Pred> searcher_t;
+   detail_algo::par_find_op<FwdIt, searcher_t> t((searcher_t(pred)));
+   detail_algo::segmented_partition<FwdIt> p;
+   (detail_algo::segmented_parallel_run)(policy, first, last, t, p);
+   return t.result(last);
+}
+
+//! <b>Returns</b>: The first iterator i of [first, last) such that *i == value or last.
+template <class Executor, class FwdIt, class T>
+FwdIt segmented_find(const segmented_parallel_policy<Executor> &policy, FwdIt first, FwdIt last, const T &value)
+{
+   typedef detail_algo::par_find_searcher<T> searcher_t;
+   detail_algo::par_find_op<FwdIt, searcher_t> t((searcher_t(value)));
+   detail_algo::segmented_partition<FwdIt> p;
+   (detail_algo::segmented_parallel_run)(policy, first, last, t, p);
+   return t.result(last);
+}
+
+//! <b>Returns</b>: true if pred returns true for all elements of [first, last) or the range is empty.
+template <class Executor, class FwdIt, class Pred>
+bool segmented_all_of(const segmented_parallel_policy<Executor> &policy, FwdIt first, FwdIt last, Pred pred)
+{  return (segmented_find_if_not)(policy, first, last, pred) == last;  }
+
+//! <b>Returns</b>: true if pred returns true for any element of [first, last).
+template <class Executor, class FwdIt, class Pred>
+bool segmented_any_of(const segmented_parallel_policy<Executor> &policy, FwdIt first, FwdIt last, Pred pred)
+{  return (segmented_find_if)(policy, first, last, pred) != last;  }
+
+//! <b>Returns</b>: true if pred returns false for all elements of [first, last) or the range is empty.
+template <class Executor, class FwdIt, class Pred>
+bool segmented_none_of(const segmented_parallel_policy<Executor> &policy, FwdIt first, FwdIt last, Pred pred)
+{  return (segmented_find_if)(policy, first, last, pred) == last;  }
+
+//! <b>Effects</b>: Assigns value to every element of [first, last).
+template <class Executor, class FwdIt, class T>
+void segmented_fill(const segmented_parallel_policy<Executor> &policy, FwdIt first, FwdIt last, const T &value)
+{
+   detail_algo::par_fill_op<T> t(value);
+   detail_algo::segmented_partition<FwdIt> p;
+   (detail_algo::segmented_parallel_run)(policy, first, last, t, p);
+}
+
+//! <b>Effects</b>: Replaces elements of [first, last) equal to old_value with new_value.
+template <class Executor, class FwdIt, class T>
+void segmented_replace
+   (const segmented_parallel_policy<Executor> &policy, FwdIt first, FwdIt last, const T &old_value, const T &new_value)
+{
+   detail_algo::par_replace_op<T> t(old_value, new_value);
+   detail_algo::segmented_partition<FwdIt> p;
+   (detail_algo::segmented_parallel_run)(policy, first, last, t, p);
+}
+
+//! <b>Effects</b>: Replaces elements of [first, last) that satisfy pred with new_value.
+template <class Executor, class FwdIt, class Pred, class T>
+void segmented_replace_if
+   (const segmented_parallel_policy<Executor> &policy, FwdIt first, FwdIt last, Pred pred, const T &new_value)
+{
+   detail_algo::par_replace_if_op<Pred, T> t(pred, new_value);
+   detail_algo::segmented_partition<FwdIt> p;
+   (detail_algo::segmented_parallel_run)(policy, first, last, t, p);
+}
+
+//! <b>Effects</b>: Assigns op(*i) to the element of the output range at the position of i.
+//!   The output range is written in parallel if OutIter is random-access, otherwise
+//!   the sequential algorithm is used.
+//!
+//! <b>Returns</b>: The end of the output range.
+template <class Executor, class FwdIt, class OutIter, class UnaryOp>
+OutIter segmented_transform
+   (const segmented_parallel_policy<Executor> &policy, FwdIt first, FwdIt last, OutIter result, UnaryOp op)
+{
+   typedef typename iterator_traits<OutIter>::iterator_category out_cat_t;
+   return (detail_algo::segmented_par_transform_dispatch)(policy, first, last, result, op, out_cat_t());
+}
+
+//! <b>Effects</b>: Copies [first, last) to the output range. The output range is written
+//!   in parallel if OutIter is random-access, otherwise the sequential algorithm is used.
+//!
+//! <b>Returns</b>: The end of the output range.
+template <class Executor, class FwdIt, class OutIter>
+OutIter segmented_copy(const segmented_parallel_policy<Executor> &policy, FwdIt first, FwdIt last, OutIter result)
+{
+   typedef typename iterator_traits<OutIter>::iterator_category out_cat_t;
+   return (detail_algo::segmented_par_copy_dispatch)(policy, first, last, result, out_cat_t());
+}
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_CONTAINER_EXPERIMENTAL_SEGMENTED_PARALLEL_HPP
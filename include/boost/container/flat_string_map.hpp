@@ -0,0 +1,1117 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_FLAT_STRING_MAP_HPP
+#define BOOST_CONTAINER_FLAT_STRING_MAP_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+#error "boost/container/flat_string_map.hpp requires C++11 variadic templates and rvalue references"
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+#include <boost/assert.hpp>
+
+// container
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/new_allocator.hpp>
+#include <boost/container/options.hpp>
+#include <boost/container/string.hpp>
+#include <boost/container/throw_exception.hpp>
+#include <boost/container/vector.hpp>
+// container/detail
+#include <boost/container/detail/min_max.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// move
+#include <boost/move/adl_move_swap.hpp>
+#include <boost/move/utility_core.hpp>
+#include <boost/move/algo/adaptive_merge.hpp>
+#include <boost/move/algo/adaptive_sort.hpp>
+#include <boost/move/detail/to_raw_pointer.hpp>
+// std
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <ostream>
+#include <utility>
+
+namespace boost {
+namespace container {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace dtl {
+
+template<class T>
+struct is_container_basic_string
+{
+   static const bool value = false;
+};
+
+template<class CharT, class Traits, class Allocator, class Options>
+struct is_container_basic_string< basic_string<CharT, Traits, Allocator, Options> >
+{
+   static const bool value = true;
+};
+
+}  //namespace dtl {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A read-only view of a key stored in a flat_string_map, or of a key used to
+//! search a flat_string_map.
+//!
+//! Keys can be implicitly constructed from null-terminated strings, from
+//! strings (std::string, boost::container::string...) and from string views
+//! (std::string_view, boost::string_view...). Keys obtained from a flat_string_map
+//! are null-terminated and they are valid until the map is modified.
+//!
+//! Keys are compared like std::string: lexicographically, comparing characters
+//! as unsigned char.
+class flat_string_key
+{
+   public:
+   typedef char               value_type;
+   typedef std::char_traits<char> traits_type;
+   typedef std::size_t        size_type;
+   typedef std::ptrdiff_t     difference_type;
+   typedef const char *       pointer;
+   typedef const char *       const_pointer;
+   typedef const char &       reference;
+   typedef const char &       const_reference;
+   typedef const char *       iterator;
+   typedef const char *       const_iterator;
+
+   //! <b>Effects</b>: Constructs an empty key.
+   inline flat_string_key() BOOST_NOEXCEPT_OR_NOTHROW
+      : m_data(""), m_size(0u)
+   {}
+
+   //! <b>Effects</b>: Constructs a key that refers to the null-terminated string s.
+   inline flat_string_key(const char *s) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_data(s), m_size(std::strlen(s))
+   {}
+
+   //! <b>Effects</b>: Constructs a key that refers to the characters [s, s + n).
+   inline flat_string_key(const char *s, size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_data(s), m_size(n)
+   {}
+
+   //! <b>Effects</b>: Constructs a key that refers to the characters of the string s.
+   template<template <class, class, class> class BasicString, class Traits, class Allocator>
+   inline flat_string_key(const BasicString<char, Traits, Allocator> &s
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename dtl::disable_if_c<dtl::is_container_basic_string<BasicString<char BOOST_MOVE_I Traits BOOST_MOVE_I Allocator> >::value>::type* = 0)
+      ) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_data(s.data()), m_size(s.size())
+   {}
+
+   //! <b>Effects</b>: Constructs a key that refers to the characters of the string s.
+   template<class Traits, class Allocator, class Options>
+   inline flat_string_key(const basic_string<char, Traits, Allocator, Options> &s) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_data(s.data()), m_size(s.size())
+   {}
+
+   //! <b>Effects</b>: Constructs a key that refers to the characters of the string view sv.
+   template<template <class, class> class BasicStringView, class Traits>
+   inline flat_string_key(BasicStringView<char, Traits> sv
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename dtl::disable_if_c<dtl::is_container_basic_string<BasicStringView<char BOOST_MOVE_I Traits> >::value>::type* = 0)
+      ) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_data(sv.data()), m_size(sv.size())
+   {}
+
+   //! <b>Returns</b>: A pointer to the characters of the key.
+   inline const char *data() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_data;  }
+
+   //! <b>Returns</b>: A pointer to the characters of the key.
+   //!
+   //! <b>Requires</b>: The key was obtained from a flat_string_map or constructed
+   //!   from a null-terminated string.
+   inline const char *c_str() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_data;  }
+
+   //! <b>Returns</b>: The number of characters of the key.
+   inline size_type size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_size;  }
+
+   //! <b>Returns</b>: The number of characters of the key.
+   inline size_type length() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_size;  }
+
+   //! <b>Returns</b>: size() == 0.
+   inline bool empty() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !m_size;  }
+
+   inline const_iterator begin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_data;  }
+
+   inline const_iterator end() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_data + m_size;  }
+
+   //! <b>Requires</b>: i < size().
+   inline const char &operator[](size_type i) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  BOOST_ASSERT(i < m_size);  return m_data[i];  }
+
+   //! <b>Returns</b>: A string view (e.g. std::string_view) of the key.
+   template<template <class, class> class BasicStringView, class Traits>
+   inline operator BasicStringView<char, Traits>() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return BasicStringView<char, Traits>(m_data, m_size);  }
+
+   //! <b>Returns</b>: A copy of the key.
+   inline string str() const
+   {  return string(m_data, m_size);  }
+
+   //! <b>Returns</b>: A negative value, zero or a positive value if *this is less than,
+   //!   equal to or greater than k.
+   inline int compare(const flat_string_key &k) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const size_type n = m_size < k.m_size ? m_size : k.m_size;
+      const int r = n ? std::memcmp(m_data, k.m_data, n) : 0;
+      return r ? r : (m_size < k.m_size ? -1 : int(m_size != k.m_size));
+   }
+
+   friend inline bool operator==(const flat_string_key &a, const flat_string_key &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return a.m_size == b.m_size && (!a.m_size || !std::memcmp(a.m_data, b.m_data, a.m_size));  }
+
+   friend inline bool operator!=(const flat_string_key &a, const flat_string_key &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !(a == b);  }
+
+   friend inline bool operator<(const flat_string_key &a, const flat_string_key &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return a.compare(b) < 0;  }
+
+   friend inline bool operator>(const flat_string_key &a, const flat_string_key &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return b < a;  }
+
+   friend inline bool operator<=(const flat_string_key &a, const flat_string_key &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !(b < a);  }
+
+   friend inline bool operator>=(const flat_string_key &a, const flat_string_key &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !(a < b);  }
+
+   template<class Traits>
+   friend inline std::basic_ostream<char, Traits> &operator<<(std::basic_ostream<char, Traits> &os, const flat_string_key &k)
+   {  return os.write(k.m_data, std::streamsize(k.m_size));  }
+
+   private:
+   const char *m_data;
+   size_type   m_size;
+};
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+template<class Options>
+struct get_flat_string_map_opt
+{
+   typedef flat_string_map_opt<typename Options::stored_size_type> type;
+};
+
+template<>
+struct get_flat_string_map_opt<void>
+{
+   typedef flat_string_map_null_opt type;
+};
+
+namespace dtl {
+
+//The first 8 characters of a key, as an integer whose order is the lexicographical
+//order of the characters. Shorter keys are padded with zeros.
+typedef ::boost::ulong_long_type flat_string_prefix_t;
+
+inline flat_string_prefix_t flat_string_prefix(const char *s, std::size_t n) BOOST_NOEXCEPT_OR_NOTHROW
+{
+   unsigned char b[8] = {};
+   std::memcpy(b, s, n < 8u ? n : 8u);
+   return (flat_string_prefix_t(b[0]) << 56u) | (flat_string_prefix_t(b[1]) << 48u) |
+          (flat_string_prefix_t(b[2]) << 40u) | (flat_string_prefix_t(b[3]) << 32u) |
+          (flat_string_prefix_t(b[4]) << 24u) | (flat_string_prefix_t(b[5]) << 16u) |
+          (flat_string_prefix_t(b[6]) <<  8u) |  flat_string_prefix_t(b[7]);
+}
+
+//Element of the sorted array of flat_string_map: the location of the key
+//in the character arena, its first characters and the mapped value.
+template<class SizeType, class T>
+struct flat_string_entry
+{
+   template<class ...Args>
+   flat_string_entry(flat_string_prefix_t p, SizeType off, SizeType len, Args&&... args)
+      : prefix(p), offset(off), length(len), value(boost::forward<Args>(args)...)
+   {}
+
+   flat_string_prefix_t prefix;
+   SizeType             offset;
+   SizeType             length;
+   T                    value;
+};
+
+//A key to be searched: the characters and the precomputed prefix
+struct flat_string_probe
+{
+   explicit flat_string_probe(const flat_string_key &k) BOOST_NOEXCEPT_OR_NOTHROW
+      : data(k.data()), size(k.size()), prefix(flat_string_prefix(k.data(), k.size()))
+   {}
+
+   const char          *data;
+   std::size_t          size;
+   flat_string_prefix_t prefix;
+};
+
+//Three-way comparison of a stored key and a probe. The prefix decides most comparisons
+//without touching the arena. If prefixes are equal, the first min(8, sizes) characters are equal.
+template<class Entry>
+inline int flat_string_compare(const Entry &e, const char *arena, const flat_string_probe &k) BOOST_NOEXCEPT_OR_NOTHROW
+{
+   if(e.prefix != k.prefix)
+      return e.prefix < k.prefix ? -1 : 1;
+   const std::size_t elen = std::size_t(e.length);
+   const std::size_t n = elen < k.size ? elen : k.size;
+   if(n > 8u){
+      const int r = std::memcmp(arena + std::size_t(e.offset) + 8u, k.data + 8u, n - 8u);
+      if(r)
+         return r;
+   }
+   return elen < k.size ? -1 : int(elen != k.size);
+}
+
+template<class Entry>
+struct flat_string_entry_less
+{
+   explicit flat_string_entry_less(const char *arena)
+      : m_arena(arena)
+   {}
+
+   bool operator()(const Entry &a, const Entry &b) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(a.prefix != b.prefix)
+         return a.prefix < b.prefix;
+      const flat_string_probe pb(flat_string_key(m_arena + std::size_t(b.offset), std::size_t(b.length)));
+      return flat_string_compare(a, m_arena, pb) < 0;
+   }
+
+   const char *m_arena;
+};
+
+//Result of operator-> of flat_string_map iterators
+template<class Reference>
+class flat_string_map_arrow
+{
+   public:
+   explicit flat_string_map_arrow(const Reference &r)
+      : m_ref(r)
+   {}
+
+   const Reference *operator->() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return &m_ref;  }
+
+   private:
+   Reference m_ref;
+};
+
+template<class Map, bool IsConst>
+class flat_string_map_iterator
+{
+   typedef typename Map::entry_t    entry_t;
+   typedef typename if_c<IsConst, const entry_t, entry_t>::type qualified_entry_t;
+   typedef typename if_c<IsConst, const typename Map::mapped_type, typename Map::mapped_type>::type qualified_mapped_t;
+
+   public:
+   typedef std::random_access_iterator_tag               iterator_category;
+   typedef typename Map::value_type                      value_type;
+   typedef typename Map::difference_type                 difference_type;
+   typedef std::pair<flat_string_key, qualified_mapped_t&>  reference;
+   typedef flat_string_map_arrow<reference>              pointer;
+
+   inline flat_string_map_iterator() BOOST_NOEXCEPT_OR_NOTHROW
+      : m_map(), m_entry()
+   {}
+
+   inline flat_string_map_iterator(const Map *m, qualified_entry_t *e) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_map(m), m_entry(e)
+   {}
+
+   template<bool C>
+   inline flat_string_map_iterator(const flat_string_map_iterator<Map, C> &other
+      , typename enable_if_c<IsConst && !C>::type* = 0) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_map(other.m_map), m_entry(other.m_entry)
+   {}
+
+   //! <b>Returns</b>: The key of the element.
+   inline flat_string_key key() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_map->priv_key(*m_entry);  }
+
+   //! <b>Returns</b>: The mapped value of the element.
+   inline qualified_mapped_t &value() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_entry->value;  }
+
+   inline reference operator*() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return reference(this->key(), m_entry->value);  }
+
+   inline pointer operator->() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return pointer(**this);  }
+
+   inline reference operator[](difference_type n) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return *(*this + n);  }
+
+   inline flat_string_map_iterator& operator++() BOOST_NOEXCEPT_OR_NOTHROW
+   {  ++m_entry;  return *this;  }
+
+   inline flat_string_map_iterator operator++(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {  flat_string_map_iterator tmp(*this);  ++m_entry;  return tmp;  }
+
+   inline flat_string_map_iterator& operator--() BOOST_NOEXCEPT_OR_NOTHROW
+   {  --m_entry;  return *this;  }
+
+   inline flat_string_map_iterator operator--(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {  flat_string_map_iterator tmp(*this);  --m_entry;  return tmp;  }
+
+   inline flat_string_map_iterator& operator+=(difference_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {  m_entry += n;  return *this;  }
+
+   inline flat_string_map_iterator& operator-=(difference_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {  m_entry -= n;  return *this;  }
+
+   friend inline flat_string_map_iterator operator+(flat_string_map_iterator it, difference_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return it += n;  }
+
+   friend inline flat_string_map_iterator operator+(difference_type n, flat_string_map_iterator it) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return it += n;  }
+
+   friend inline flat_string_map_iterator operator-(flat_string_map_iterator it, difference_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return it -= n;  }
+
+   friend inline difference_type operator-(const flat_string_map_iterator &a, const flat_string_map_iterator &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return a.m_entry - b.m_entry;  }
+
+   friend inline bool operator==(const flat_string_map_iterator &a, const flat_string_map_iterator &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return a.m_entry == b.m_entry;  }
+
+   friend inline bool operator!=(const flat_string_map_iterator &a, const flat_string_map_iterator &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return a.m_entry != b.m_entry;  }
+
+   friend inline bool operator<(const flat_string_map_iterator &a, const flat_string_map_iterator &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return a.m_entry < b.m_entry;  }
+
+   friend inline bool operator>(const flat_string_map_iterator &a, const flat_string_map_iterator &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return b < a;  }
+
+   friend inline bool operator<=(const flat_string_map_iterator &a, const flat_string_map_iterator &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !(b < a);  }
+
+   friend inline bool operator>=(const flat_string_map_iterator &a, const flat_string_map_iterator &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !(a < b);  }
+
+   private:
+   template<class, bool> friend class flat_string_map_iterator;
+   friend Map;
+
+   const Map *m_map;
+   qualified_entry_t *m_entry;
+};
+
+}  //namespace dtl {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A sorted associative container with unique string keys, like flat_map<string, T>,
+//! optimized to hold many short and medium keys.
+//!
+//! The characters of all keys are stored contiguously, null-terminated, in a single
+//! character arena. The sorted array of elements only stores, for each element, the offset
+//! and length of the key in the arena, its first 8 characters packed in an integer and the
+//! mapped value. Keys don't need their own allocation and most comparisons of a lookup
+//! are decided by the packed prefix without accessing the arena.
+//!
+//! Like flat_map, insertions and erasures are linear and invalidate iterators and keys.
+//! Erased keys leave unused characters in the arena that are reclaimed when they
+//! exceed the characters of the live keys, or when shrink_to_fit is called.
+//!
+//! Dereferencing an iterator returns a pair of a flat_string_key and a reference to the
+//! mapped value by value, so the usual <code>it->first</code> / <code>it->second</code>
+//! syntax is supported, but references to the elements can't be stored.
+//!
+//! \tparam T The type of the mapped value. It must be MoveConstructible and MoveAssignable.
+//! \tparam Allocator An allocator of characters, rebound for the array of elements. If it's void, new_allocator is used.
+//! \tparam Options A type produced from \c boost::container::flat_string_map_options.
+template <class T, class Allocator BOOST_CONTAINER_DOCONLY(= void), class Options BOOST_CONTAINER_DOCONLY(= void)>
+class flat_string_map
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   typedef boost::container::allocator_traits
+      <typename real_allocator<char, Allocator>::type>                           allocator_traits_type;
+   typedef typename get_flat_string_map_opt<Options>::type                       options_type;
+   typedef typename options_type::template
+      get_stored_size_type<allocator_traits_type>::type                          stored_size_type;
+   typedef dtl::flat_string_entry<stored_size_type, T>                           entry_t;
+   typedef typename allocator_traits_type::template
+      portable_rebind_alloc<entry_t>::type                                       entry_allocator_type;
+   typedef vector<entry_t, entry_allocator_type>                                 entry_vector_t;
+   typedef vector<char, typename real_allocator<char, Allocator>::type>          arena_t;
+   typedef dtl::flat_string_entry_less<entry_t>                                  entry_less_t;
+
+   template<class, bool> friend class dtl::flat_string_map_iterator;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+   typedef flat_string_key                                                       key_type;
+   typedef T                                                                     mapped_type;
+   typedef std::pair<flat_string_key, T>                                         value_type;
+   typedef BOOST_CONTAINER_IMPDEF
+      (typename real_allocator<char BOOST_MOVE_I Allocator>::type)               allocator_type;
+   typedef typename allocator_traits<allocator_type>::size_type                  size_type;
+   typedef typename allocator_traits<allocator_type>::difference_type            difference_type;
+   typedef std::pair<flat_string_key, T&>                                        reference;
+   typedef std::pair<flat_string_key, const T&>                                  const_reference;
+   typedef BOOST_CONTAINER_IMPDEF
+      (dtl::flat_string_map_iterator<flat_string_map BOOST_MOVE_I false>)       iterator;
+   typedef BOOST_CONTAINER_IMPDEF
+      (dtl::flat_string_map_iterator<flat_string_map BOOST_MOVE_I true>)        const_iterator;
+   typedef BOOST_CONTAINER_IMPDEF
+      (boost::container::reverse_iterator<iterator>)                            reverse_iterator;
+   typedef BOOST_CONTAINER_IMPDEF
+      (boost::container::reverse_iterator<const_iterator>)                      const_reverse_iterator;
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   BOOST_COPYABLE_AND_MOVABLE(flat_string_map)
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //          construct/copy/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Constructs an empty map.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline flat_string_map()
+      : m_entries(), m_arena(), m_garbage(0u)
+   {}
+
+   //! <b>Effects</b>: Constructs an empty map that uses a copy of a to allocate memory.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline explicit flat_string_map(const allocator_type &a)
+      : m_entries(entry_allocator_type(a)), m_arena(a), m_garbage(0u)
+   {}
+
+   //! <b>Effects</b>: Constructs an empty map and inserts the elements of [first, last)
+   //!   (see insert(first, last)).
+   template<class InputIterator>
+   inline flat_string_map(InputIterator first, InputIterator last, const allocator_type &a = allocator_type())
+      : m_entries(entry_allocator_type(a)), m_arena(a), m_garbage(0u)
+   {  this->insert(first, last);  }
+
+   //! <b>Effects</b>: Copy constructs a map. Unused characters of the arena are not copied.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements and characters.
+   inline flat_string_map(const flat_string_map &x)
+      : m_entries(x.m_entries), m_arena(x.m_arena.get_stored_allocator()), m_garbage(0u)
+   {  this->priv_copy_keys(x);  }
+
+   //! <b>Effects</b>: Move constructs a map. x is left empty.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline flat_string_map(BOOST_RV_REF(flat_string_map) x) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_entries(boost::move(x.m_entries)), m_arena(boost::move(x.m_arena)), m_garbage(x.m_garbage)
+   {  x.m_garbage = 0u;  }
+
+   //! <b>Effects</b>: Copy assigns x to *this.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements and characters.
+   inline flat_string_map& operator=(BOOST_COPY_ASSIGN_REF(flat_string_map) x)
+   {
+      if(this != &x){
+         m_arena.clear();
+         m_garbage = 0u;
+         BOOST_CONTAINER_TRY{
+            m_entries = x.m_entries;
+            this->priv_copy_keys(x);
+         }
+         BOOST_CONTAINER_CATCH(...){
+            this->clear();
+            BOOST_CONTAINER_RETHROW;
+         }
+         BOOST_CONTAINER_CATCH_END
+      }
+      return *this;
+   }
+
+   //! <b>Effects</b>: Move assigns x to *this.
+   //!
+   //! <b>Complexity</b>: Constant if allocators are equal or propagate, linear otherwise.
+   inline flat_string_map& operator=(BOOST_RV_REF(flat_string_map) x)
+   {
+      if(this != &x){
+         m_entries = boost::move(x.m_entries);
+         m_arena   = boost::move(x.m_arena);
+         m_garbage = x.m_garbage;
+         x.m_entries.clear();
+         x.m_arena.clear();
+         x.m_garbage = 0u;
+      }
+      return *this;
+   }
+
+   //! <b>Returns</b>: A copy of the allocator of the character arena.
+   inline allocator_type get_allocator() const
+   {  return m_arena.get_allocator();  }
+
+   //////////////////////////////////////////////
+   //
+   //                iterators
+   //
+   //////////////////////////////////////////////
+
+   inline iterator begin() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return iterator(this, this->priv_entries());  }
+
+   inline const_iterator begin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_iterator(this, this->priv_entries());  }
+
+   inline const_iterator cbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->begin();  }
+
+   inline iterator end() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return iterator(this, this->priv_entries() + m_entries.size());  }
+
+   inline const_iterator end() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_iterator(this, this->priv_entries() + m_entries.size());  }
+
+   inline const_iterator cend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->end();  }
+
+   inline reverse_iterator rbegin() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return reverse_iterator(this->end());  }
+
+   inline const_reverse_iterator rbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_reverse_iterator(this->end());  }
+
+   inline const_reverse_iterator crbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->rbegin();  }
+
+   inline reverse_iterator rend() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return reverse_iterator(this->begin());  }
+
+   inline const_reverse_iterator rend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_reverse_iterator(this->begin());  }
+
+   inline const_reverse_iterator crend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->rend();  }
+
+   //////////////////////////////////////////////
+   //
+   //                capacity
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Returns</b>: true if the map contains no elements.
+   inline bool empty() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_entries.empty();  }
+
+   //! <b>Returns</b>: The number of elements.
+   inline size_type size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_entries.size();  }
+
+   //! <b>Returns</b>: The maximum number of elements.
+   inline size_type max_size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_entries.max_size();  }
+
+   //! <b>Returns</b>: The number of elements that can be inserted without reallocating the array of elements.
+   inline size_type capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_entries.capacity();  }
+
+   //! <b>Returns</b>: The number of characters stored in the arena, including the terminating null
+   //!   of each key and the characters of erased keys that were not reclaimed yet.
+   inline size_type key_storage_size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_arena.size();  }
+
+   //! <b>Effects</b>: Makes sure that n elements whose keys have key_chars characters in total
+   //!   can be inserted without reallocating.
+   //!
+   //! <b>Throws</b>: If memory allocation throws.
+   void reserve(size_type n, size_type key_chars = 0u)
+   {
+      m_entries.reserve(n);
+      const size_type live = size_type(m_arena.size() - m_garbage);
+      m_arena.reserve(size_type(live + key_chars + (n > m_entries.size() ? n - m_entries.size() : 0u)));
+   }
+
+   //! <b>Effects</b>: Reclaims the characters of erased keys and releases unused capacity.
+   //!
+   //! <b>Throws</b>: If memory allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements and characters.
+   void shrink_to_fit()
+   {
+      if(m_garbage)
+         this->priv_compact();
+      m_arena.shrink_to_fit();
+      m_entries.shrink_to_fit();
+   }
+
+   //////////////////////////////////////////////
+   //
+   //               element access
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: If there is no element with key k, inserts one with a value-initialized mapped value.
+   //!
+   //! <b>Returns</b>: A reference to the mapped value of the element with key k.
+   //!
+   //! <b>Complexity</b>: Logarithmic search plus linear insertion.
+   inline T &operator[](const key_type &k)
+   {  return this->try_emplace(k).first.value();  }
+
+   //! <b>Returns</b>: A reference to the mapped value of the element with key k.
+   //!
+   //! <b>Throws</b>: std::out_of_range if there is no such element.
+   T &at(const key_type &k)
+   {
+      const iterator it = this->find(k);
+      if(it == this->end())
+         throw_out_of_range("flat_string_map::at key not found");
+      return it.value();
+   }
+
+   //! <b>Returns</b>: A reference to the mapped value of the element with key k.
+   //!
+   //! <b>Throws</b>: std::out_of_range if there is no such element.
+   const T &at(const key_type &k) const
+   {
+      const const_iterator it = this->find(k);
+      if(it == this->end())
+         throw_out_of_range("flat_string_map::at key not found");
+      return it.value();
+   }
+
+   //! <b>Requires</b>: i < size().
+   //!
+   //! <b>Returns</b>: An iterator to the i-th element in key order.
+   inline iterator nth(size_type i) BOOST_NOEXCEPT_OR_NOTHROW
+   {  BOOST_ASSERT(i <= this->size());  return this->begin() + difference_type(i);  }
+
+   //! <b>Requires</b>: i < size().
+   //!
+   //! <b>Returns</b>: An iterator to the i-th element in key order.
+   inline const_iterator nth(size_type i) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  BOOST_ASSERT(i <= this->size());  return this->begin() + difference_type(i);  }
+
+   //! <b>Returns</b>: The position of the element pointed by it.
+   inline size_type index_of(const_iterator it) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return size_type(it - this->begin());  }
+
+   //////////////////////////////////////////////
+   //
+   //                modifiers
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: If there is no element with key k, inserts one whose mapped value is constructed
+   //!   from args. The characters of k are copied to the arena. k can refer to a key of *this.
+   //!
+   //! <b>Returns</b>: An iterator to the element with key k and true if it was inserted.
+   //!
+   //! <b>Throws</b>: If memory allocation or the constructor of T throw, or length_error if the
+   //!   characters of the keys can't be represented with the stored size type.
+   //!
+   //! <b>Complexity</b>: Logarithmic search plus linear insertion.
+   template<class ...Args>
+   std::pair<iterator, bool> try_emplace(const key_type &k, Args&&... args)
+   {
+      const dtl::flat_string_probe probe(k);
+      entry_t *const pos = this->priv_lower_bound(probe);
+      if(pos != this->priv_entries_end() && !dtl::flat_string_compare(*pos, this->priv_arena(), probe))
+         return std::pair<iterator, bool>(iterator(this, pos), false);
+      const size_type index = size_type(pos - this->priv_entries());
+      const size_type old_arena_size = m_arena.size();
+      const stored_size_type off = this->priv_store_key(k.data(), k.size());
+      BOOST_CONTAINER_TRY{
+         m_entries.emplace( m_entries.begin() + difference_type(index), probe.prefix, off
+                          , stored_size_type(k.size()), boost::forward<Args>(args)...);
+      }
+      BOOST_CONTAINER_CATCH(...){
+         m_arena.resize(old_arena_size);
+         BOOST_CONTAINER_RETHROW;
+      }
+      BOOST_CONTAINER_CATCH_END
+      return std::pair<iterator, bool>(iterator(this, this->priv_entries() + index), true);
+   }
+
+   //! <b>Effects</b>: Same as try_emplace(k, args...).
+   template<class ...Args>
+   inline std::pair<iterator, bool> emplace(const key_type &k, Args&&... args)
+   {  return this->try_emplace(k, boost::forward<Args>(args)...);  }
+
+   //! <b>Effects</b>: Same as try_emplace(x.first, x.second).
+   inline std::pair<iterator, bool> insert(const value_type &x)
+   {  return this->try_emplace(x.first, x.second);  }
+
+   //! <b>Effects</b>: Same as try_emplace(x.first, boost::move(x.second)).
+   inline std::pair<iterator, bool> insert(BOOST_RV_REF(value_type) x)
+   {  return this->try_emplace(x.first, boost::move(x.second));  }
+
+   //! <b>Effects</b>: If there is no element with key k, inserts one whose mapped value is constructed from
+   //!   obj. Otherwise, assigns obj to the mapped value.
+   //!
+   //! <b>Returns</b>: An iterator to the element with key k and true if it was inserted.
+   template<class M>
+   std::pair<iterator, bool> insert_or_assign(const key_type &k, BOOST_FWD_REF(M) obj)
+   {
+      std::pair<iterator, bool> r = this->try_emplace(k, boost::forward<M>(obj));
+      if(!r.second)
+         r.first.value() = boost::forward<M>(obj);
+      return r;
+   }
+
+   //! <b>Requires</b>: The value type of InputIterator is a pair whose first member is convertible
+   //!   to key_type and whose second member is convertible to T.
+   //!
+   //! <b>Effects</b>: Inserts the elements of [first, last) whose key is not already in the map.
+   //!   If several elements have the same key, only the first one is inserted.
+   //!
+   //! <b>Complexity</b>: The new elements are appended, sorted and merged with the existing ones:
+   //!   N*log(N) + size(), where N is the number of new elements.
+   template<class InputIterator>
+   void insert(InputIterator first, InputIterator last)
+   {
+      const size_type old_size = m_entries.size();
+      const size_type old_arena_size = m_arena.size();
+      BOOST_CONTAINER_TRY{
+         for(; first != last; ++first){
+            const key_type k((*first).first);
+            const stored_size_type off = this->priv_store_key(k.data(), k.size());
+            m_entries.emplace_back( dtl::flat_string_prefix(k.data(), k.size()), off
+                                  , stored_size_type(k.size()), (*first).second);
+         }
+      }
+      BOOST_CONTAINER_CATCH(...){
+         m_entries.erase(m_entries.begin() + difference_type(old_size), m_entries.end());
+         m_arena.resize(old_arena_size);
+         BOOST_CONTAINER_RETHROW;
+      }
+      BOOST_CONTAINER_CATCH_END
+      this->priv_merge_tail(old_size);
+   }
+
+   //! <b>Effects</b>: Erases the element pointed by pos.
+   //!
+   //! <b>Returns</b>: An iterator to the element that followed the erased one.
+   //!
+   //! <b>Complexity</b>: Linear to the elements after pos, plus linear to the number of
+   //!   characters if the arena is compacted.
+   iterator erase(const_iterator pos)
+   {
+      const size_type index = this->index_of(pos);
+      m_garbage = size_type(m_garbage + size_type(pos.m_entry->length) + 1u);
+      m_entries.erase(m_entries.begin() + difference_type(index));
+      this->priv_compact_if_needed();
+      return this->nth(index);
+   }
+
+   //! <b>Effects</b>: Erases the elements in [first, last).
+   //!
+   //! <b>Returns</b>: An iterator to the element that followed the erased ones.
+   iterator erase(const_iterator first, const_iterator last)
+   {
+      const size_type index = this->index_of(first);
+      for(const entry_t *e = first.m_entry; e != last.m_entry; ++e){
+         m_garbage = size_type(m_garbage + size_type(e->length) + 1u);
+      }
+      m_entries.erase( m_entries.begin() + difference_type(index)
+                     , m_entries.begin() + difference_type(this->index_of(last)));
+      this->priv_compact_if_needed();
+      return this->nth(index);
+   }
+
+   //! <b>Effects</b>: Erases the element with key k, if any.
+   //!
+   //! <b>Returns</b>: The number of erased elements.
+   size_type erase(const key_type &k)
+   {
+      const const_iterator it = this->find(k);
+      if(it == this->cend())
+         return 0u;
+      this->erase(it);
+      return 1u;
+   }
+
+   //! <b>Effects</b>: Swaps the contents of *this and x.
+   //!
+   //! <b>Complexity</b>: Constant.
+   void swap(flat_string_map &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      m_entries.swap(x.m_entries);
+      m_arena.swap(x.m_arena);
+      boost::adl_move_swap(m_garbage, x.m_garbage);
+   }
+
+   //! <b>Effects</b>: Erases all elements. The capacity is kept.
+   void clear() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      m_entries.clear();
+      m_arena.clear();
+      m_garbage = 0u;
+   }
+
+   //////////////////////////////////////////////
+   //
+   //                observers
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Returns</b>: An iterator to the element with key k, or end() if there is no such element.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   iterator find(const key_type &k)
+   {
+      const dtl::flat_string_probe probe(k);
+      entry_t *const pos = this->priv_lower_bound(probe);
+      entry_t *const end = this->priv_entries_end();
+      return iterator(this, (pos != end && !dtl::flat_string_compare(*pos, this->priv_arena(), probe)) ? pos : end);
+   }
+
+   //! <b>Returns</b>: An iterator to the element with key k, or end() if there is no such element.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   inline const_iterator find(const key_type &k) const
+   {  return const_cast<flat_string_map*>(this)->find(k);  }
+
+   //! <b>Returns</b>: true if there is an element with key k.
+   inline bool contains(const key_type &k) const
+   {  return this->find(k) != this->end();  }
+
+   //! <b>Returns</b>: The number of elements with key k (0 or 1).
+   inline size_type count(const key_type &k) const
+   {  return size_type(this->contains(k));  }
+
+   //! <b>Returns</b>: An iterator to the first element whose key is not less than k.
+   inline iterator lower_bound(const key_type &k)
+   {  return iterator(this, this->priv_lower_bound(dtl::flat_string_probe(k)));  }
+
+   //! <b>Returns</b>: An iterator to the first element whose key is not less than k.
+   inline const_iterator lower_bound(const key_type &k) const
+   {  return const_cast<flat_string_map*>(this)->lower_bound(k);  }
+
+   //! <b>Returns</b>: An iterator to the first element whose key is greater than k.
+   iterator upper_bound(const key_type &k)
+   {
+      const dtl::flat_string_probe probe(k);
+      entry_t *pos = this->priv_lower_bound(probe);
+      if(pos != this->priv_entries_end() && !dtl::flat_string_compare(*pos, this->priv_arena(), probe))
+         ++pos;
+      return iterator(this, pos);
+   }
+
+   //! <b>Returns</b>: An iterator to the first element whose key is greater than k.
+   inline const_iterator upper_bound(const key_type &k) const
+   {  return const_cast<flat_string_map*>(this)->upper_bound(k);  }
+
+   //! <b>Returns</b>: std::pair(lower_bound(k), upper_bound(k)).
+   inline std::pair<iterator, iterator> equal_range(const key_type &k)
+   {  return std::pair<iterator, iterator>(this->lower_bound(k), this->upper_bound(k));  }
+
+   //! <b>Returns</b>: std::pair(lower_bound(k), upper_bound(k)).
+   inline std::pair<const_iterator, const_iterator> equal_range(const key_type &k) const
+   {  return std::pair<const_iterator, const_iterator>(this->lower_bound(k), this->upper_bound(k));  }
+
+   //! <b>Returns</b>: true if x and y contain the same keys with equal mapped values.
+   friend bool operator==(const flat_string_map &x, const flat_string_map &y)
+   {
+      if(x.size() != y.size())
+         return false;
+      for(const_iterator ix = x.begin(), iy = y.begin(), ex = x.end(); ix != ex; ++ix, ++iy){
+         if(ix.key() != iy.key() || !(ix.value() == iy.value()))
+            return false;
+      }
+      return true;
+   }
+
+   //! <b>Returns</b>: !(x == y).
+   friend inline bool operator!=(const flat_string_map &x, const flat_string_map &y)
+   {  return !(x == y);  }
+
+   //! <b>Effects</b>: x.swap(y).
+   friend inline void swap(flat_string_map &x, flat_string_map &y) BOOST_NOEXCEPT_OR_NOTHROW
+   {  x.swap(y);  }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+
+   inline entry_t *priv_entries() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_cast<entry_t*>(boost::movelib::to_raw_pointer(m_entries.data()));  }
+
+   inline entry_t *priv_entries_end() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->priv_entries() + m_entries.size();  }
+
+   inline const char *priv_arena() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return boost::movelib::to_raw_pointer(m_arena.data());  }
+
+   inline flat_string_key priv_key(const entry_t &e) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return flat_string_key(this->priv_arena() + size_type(e.offset), size_type(e.length));  }
+
+   inline entry_t *priv_lower_bound(const dtl::flat_string_probe &probe) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->priv_lower_bound_in(this->priv_entries(), this->priv_entries_end(), probe);  }
+
+   //Appends a null-terminated copy of [k, k + n) to the arena. k can point to the arena.
+   stored_size_type priv_store_key(const char *k, size_type n)
+   {
+      const size_type off = m_arena.size();
+      if(size_type(stored_size_type(-1)) - 1u - off < n)
+         throw_length_error("flat_string_map: the characters of the keys exceed the stored size type");
+      const char *const arena = this->priv_arena();
+      const std::less<const char*> less;
+      const bool inside = off && !less(k, arena) && less(k, arena + off);
+      const size_type src_off = inside ? size_type(k - arena) : 0u;
+      char *const p = m_arena.append_uninitialized(size_type(n + 1u));
+      if(inside)
+         k = this->priv_arena() + src_off;
+      if(n)
+         std::memcpy(p, k, n);
+      p[n] = '\0';
+      m_arena.commit(size_type(n + 1u));
+      return stored_size_type(off);
+   }
+
+   void priv_copy_keys(const flat_string_map &x)
+   {
+      //Copies only the live keys of x, in key order
+      size_type chars = 0u;
+      for(const entry_t *e = this->priv_entries(), *end = this->priv_entries_end(); e != end; ++e){
+         chars = size_type(chars + size_type(e->length) + 1u);
+      }
+      m_arena.reserve(chars);
+      const char *const src = x.priv_arena();
+      for(entry_t *e = this->priv_entries(), *end = this->priv_entries_end(); e != end; ++e){
+         e->offset = this->priv_store_key(src + size_type(e->offset), size_type(e->length));
+      }
+   }
+
+   void priv_compact_if_needed()
+   {
+      //Amortized: the arena is rebuilt when at least half of it is unused
+      if(m_garbage > m_arena.size()/2u && m_garbage >= 256u){
+         BOOST_CONTAINER_TRY{
+            this->priv_compact();
+         }
+         BOOST_CONTAINER_CATCH(...){
+            //Compaction is an optimization, the map is still valid
+         }
+         BOOST_CONTAINER_CATCH_END
+      }
+      else if(m_entries.empty()){
+         m_arena.clear();
+         m_garbage = 0u;
+      }
+   }
+
+   void priv_compact()
+   {
+      arena_t new_arena(m_arena.get_stored_allocator());
+      new_arena.reserve(size_type(m_arena.size() - m_garbage));
+      const char *const src = this->priv_arena();
+      for(entry_t *e = this->priv_entries(), *end = this->priv_entries_end(); e != end; ++e){
+         const size_type n = size_type(size_type(e->length) + 1u);
+         const size_type off = new_arena.size();
+         std::memcpy(new_arena.append_uninitialized(n), src + size_type(e->offset), n);
+         new_arena.commit(n);
+         e->offset = stored_size_type(off);
+      }
+      m_arena.swap(new_arena);
+      m_garbage = 0u;
+   }
+
+   //Sorts the elements appended after "old_size", removes the ones whose key is
+   //repeated and merges them with the previous elements.
+   void priv_merge_tail(size_type old_size)
+   {
+      entry_t *const base = this->priv_entries();
+      entry_t *const mid  = base + old_size;
+      entry_t *const last = this->priv_entries_end();
+      if(mid == last)
+         return;
+      const char *const arena = this->priv_arena();
+      const entry_less_t less(arena);
+      size_type unused_size = size_type(m_entries.capacity() - m_entries.size());
+      //Stable, so that the first of several equal keys is kept
+      boost::movelib::adaptive_sort(mid, last, less, last, unused_size);
+      //Remove new keys that are repeated or already present
+      entry_t *out = mid;
+      for(entry_t *e = mid; e != last; ++e){
+         const dtl::flat_string_probe probe(this->priv_key(*e));
+         const bool repeated = (out != mid && !dtl::flat_string_compare(*(out - 1), arena, probe));
+         bool present = false;
+         if(!repeated && old_size){
+            entry_t *const pos = this->priv_lower_bound_in(base, mid, probe);
+            present = pos != mid && !dtl::flat_string_compare(*pos, arena, probe);
+         }
+         if(repeated || present){
+            m_garbage = size_type(m_garbage + size_type(e->length) + 1u);
+         }
+         else{
+            if(out != e)
+               *out = boost::move(*e);
+            ++out;
+         }
+      }
+      m_entries.erase(m_entries.begin() + difference_type(out - base), m_entries.end());
+      unused_size = size_type(m_entries.capacity() - m_entries.size());
+      boost::movelib::adaptive_merge(base, mid, out, less, out, unused_size);
+      this->priv_compact_if_needed();
+   }
+
+   entry_t *priv_lower_bound_in(entry_t *first, entry_t *last, const dtl::flat_string_probe &probe) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const char *const arena = this->priv_arena();
+      size_type len = size_type(last - first);
+      while(len){
+         const size_type half = len/2u;
+         entry_t *const middle = first + half;
+         if(dtl::flat_string_compare(*middle, arena, probe) < 0){
+            first = middle + 1;
+            len = size_type(len - half - 1u);
+         }
+         else{
+            len = half;
+         }
+      }
+      return first;
+   }
+
+   entry_vector_t m_entries;
+   arena_t        m_arena;
+   size_type      m_garbage;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_FLAT_STRING_MAP_HPP
@@ -0,0 +1,711 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#ifndef BOOST_CONTAINER_GROUPED_MULTIMAP_HPP
+#define BOOST_CONTAINER_GROUPED_MULTIMAP_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/map.hpp>
+#include <boost/container/vector.hpp>
+// container/detail
+#include <boost/container/detail/algorithm.hpp>
+#include <boost/container/detail/iterator.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// move
+#include <boost/move/traits.hpp>
+#include <boost/move/utility_core.hpp>
+// move/detail
+#if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+#include <boost/move/detail/fwd_macros.hpp>
+#endif
+// intrusive/detail
+#include <boost/intrusive/detail/minimal_pair_header.hpp>      //pair
+#include <boost/intrusive/detail/minimal_less_equal_header.hpp>//less, equal
+// std
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+#include <initializer_list>
+#endif
+
+namespace boost {
+namespace container {
+
+//! A grouped_multimap is an associative container that supports equivalent keys
+//! like multimap, but stores each distinct key only once: every tree node holds
+//! a key and a contiguous sequence (a boost::container::vector) with all the mapped
+//! values associated with that key, in insertion order.
+//!
+//! When keys are heavily duplicated, this reduces the number of tree nodes and key
+//! copies by the duplication factor, and <code>count</code>, <code>equal_range</code>
+//! and <code>erase(key)</code> operate in O(log(key_count()) + count(k)) time on
+//! contiguous memory.
+//!
+//! Iteration is performed by groups: the <code>value_type</code> of iterators is
+//! <code>std::pair<const Key, group_type></code>. Mapped values of a group can be
+//! modified in place, but the size of a group must only be changed through
+//! the grouped_multimap interface, so that <code>size()</code> stays accurate and no
+//! empty groups are stored.
+//!
+//! \tparam Key is the key_type of the map
+//! \tparam T is the <code>mapped_type</code>
+//! \tparam Compare is the ordering function for Keys (e.g. <i>std::less<Key></i>).
+//! \tparam Allocator is the allocator to allocate the <code>value_type</code>s
+//!   (e.g. <i>allocator< std::pair<const Key, T> > </i>). It's rebound to allocate
+//!   tree nodes and mapped value sequences.
+//! \tparam Options is an packed option type generated using using boost::container::tree_assoc_options.
+//!   Options are applied to the underlying tree of groups.
+template <class Key, class T, class Compare BOOST_CONTAINER_DOCONLY(= std::less<Key>)
+         , class Allocator BOOST_CONTAINER_DOCONLY(= void), class Options BOOST_CONTAINER_DOCONLY(= void) >
+class grouped_multimap
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   BOOST_COPYABLE_AND_MOVABLE(grouped_multimap)
+
+   typedef typename real_allocator<std::pair<const Key, T>, Allocator>::type  real_allocator_t;
+   typedef allocator_traits<real_allocator_t>                                 real_allocator_traits_t;
+   typedef typename real_allocator_traits_t::template
+      portable_rebind_alloc<T>::type                                          mapped_allocator_impl;
+   typedef vector<T, mapped_allocator_impl>                                   group_type_impl;
+   typedef typename real_allocator_traits_t::template
+      portable_rebind_alloc<std::pair<const Key, group_type_impl> >::type     group_allocator_impl;
+   typedef map<Key, group_type_impl, Compare, group_allocator_impl, Options>  tree_t;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+
+   typedef Key                                                                key_type;
+   typedef T                                                                  mapped_type;
+   typedef std::pair<const Key, T>                                            value_type;
+   typedef real_allocator_t                                                   allocator_type;
+   typedef Compare                                                            key_compare;
+   typedef typename real_allocator_traits_t::size_type                        size_type;
+   typedef typename real_allocator_traits_t::difference_type                  difference_type;
+   typedef BOOST_CONTAINER_IMPDEF(mapped_allocator_impl)                      mapped_allocator_type;
+   typedef BOOST_CONTAINER_IMPDEF(group_type_impl)                            group_type;
+   typedef typename tree_t::value_type                                        group_value_type;
+   typedef typename BOOST_CONTAINER_IMPDEF(tree_t::iterator)                  iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(tree_t::const_iterator)            const_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(tree_t::reverse_iterator)          reverse_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(tree_t::const_reverse_iterator)    const_reverse_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(group_type_impl::iterator)         mapped_iterator;
+   typedef typename BOOST_CONTAINER_IMPDEF(group_type_impl::const_iterator)   const_mapped_iterator;
+
+   //////////////////////////////////////////////
+   //
+   //          construct/copy/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Default constructs an empty grouped_multimap.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline grouped_multimap()
+      BOOST_NOEXCEPT_IF(dtl::is_nothrow_default_constructible<allocator_type>::value &&
+                        dtl::is_nothrow_default_constructible<Compare>::value)
+      : m_tree(), m_size()
+   {}
+
+   //! <b>Effects</b>: Constructs an empty grouped_multimap using the specified allocator instance.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline explicit grouped_multimap(const allocator_type& a)
+      : m_tree(group_allocator_impl(a)), m_size()
+   {}
+
+   //! <b>Effects</b>: Constructs an empty grouped_multimap using the specified comparison
+   //!   object and allocator.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline explicit grouped_multimap(const Compare& comp, const allocator_type& a = allocator_type())
+      : m_tree(comp, group_allocator_impl(a)), m_size()
+   {}
+
+   //! <b>Effects</b>: Constructs an empty grouped_multimap using the specified comparison object
+   //!   and allocator, and inserts elements from the range [first ,last ).
+   //!
+   //! <b>Complexity</b>: N log(N) in general, where N is last - first.
+   template <class InputIterator>
+   grouped_multimap(InputIterator first, InputIterator last
+                   , const Compare& comp = Compare(), const allocator_type& a = allocator_type())
+      : m_tree(comp, group_allocator_impl(a)), m_size()
+   {  this->insert(first, last);  }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Same as grouped_multimap(il.begin(), il.end(), comp, a).
+   grouped_multimap(std::initializer_list<value_type> il
+                   , const Compare& comp = Compare(), const allocator_type& a = allocator_type())
+      : m_tree(comp, group_allocator_impl(a)), m_size()
+   {  this->insert(il.begin(), il.end());  }
+#endif
+
+   //! <b>Effects</b>: Copy constructs a grouped_multimap.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   inline grouped_multimap(const grouped_multimap& x)
+      : m_tree(x.m_tree), m_size(x.m_size)
+   {}
+
+   //! <b>Effects</b>: Move constructs a grouped_multimap. Constructs *this using x's resources.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Postcondition</b>: x is emptied.
+   inline grouped_multimap(BOOST_RV_REF(grouped_multimap) x)
+      BOOST_NOEXCEPT_IF(boost::container::dtl::is_nothrow_move_constructible<Compare>::value)
+      : m_tree(boost::move(x.m_tree)), m_size(x.m_size)
+   {  x.m_size = 0u;  }
+
+   //! <b>Effects</b>: Copy constructs a grouped_multimap using the specified allocator.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   inline grouped_multimap(const grouped_multimap& x, const allocator_type &a)
+      : m_tree(x.m_tree, group_allocator_impl(a)), m_size(x.m_size)
+   {}
+
+   //! <b>Effects</b>: Move constructs a grouped_multimap using the specified allocator.
+   //!   Constructs *this using x's resources.
+   //!
+   //! <b>Complexity</b>: Constant if a == x.get_allocator(), linear otherwise.
+   //!
+   //! <b>Postcondition</b>: x is emptied.
+   inline grouped_multimap(BOOST_RV_REF(grouped_multimap) x, const allocator_type &a)
+      : m_tree(boost::move(x.m_tree), group_allocator_impl(a)), m_size(x.m_size)
+   {  x.m_tree.clear();  x.m_size = 0u;  }
+
+   //! <b>Effects</b>: Makes *this a copy of x.
+   //!
+   //! <b>Complexity</b>: Linear in x.size().
+   inline grouped_multimap& operator=(BOOST_COPY_ASSIGN_REF(grouped_multimap) x)
+   {
+      m_tree = x.m_tree;
+      m_size = x.m_size;
+      return *this;
+   }
+
+   //! <b>Effects</b>: this->swap(x.get()).
+   //!
+   //! <b>Complexity</b>: Constant if allocators are equal or propagate, linear otherwise.
+   inline grouped_multimap& operator=(BOOST_RV_REF(grouped_multimap) x)
+      BOOST_NOEXCEPT_IF( (allocator_traits<group_allocator_impl>::propagate_on_container_move_assignment::value ||
+                          allocator_traits<group_allocator_impl>::is_always_equal::value) &&
+                          boost::container::dtl::is_nothrow_move_assignable<Compare>::value)
+   {
+      m_tree = boost::move(x.m_tree);
+      m_size = x.m_size;
+      x.m_tree.clear();
+      x.m_size = 0u;
+      return *this;
+   }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Assign content of il to *this.
+   grouped_multimap& operator=(std::initializer_list<value_type> il)
+   {
+      this->clear();
+      this->insert(il.begin(), il.end());
+      return *this;
+   }
+#endif
+
+   //! <b>Effects</b>: Returns a copy of the allocator that
+   //!   was passed to the object's constructor.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline
+      allocator_type get_allocator() const
+   {  return allocator_type(m_tree.get_allocator());  }
+
+   //! <b>Effects</b>: Returns the comparison object out
+   //!   of which a was constructed.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline
+      key_compare key_comp() const
+   {  return m_tree.key_comp();  }
+
+   //////////////////////////////////////////////
+   //
+   //                group iterators
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns an iterator to the first group.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline iterator begin() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_tree.begin();  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first group.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline const_iterator begin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_tree.begin();  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first group.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline const_iterator cbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_tree.cbegin();  }
+
+   //! <b>Effects</b>: Returns an iterator to the end of the sequence of groups.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline iterator end() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_tree.end();  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the sequence of groups.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline const_iterator end() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_tree.end();  }
+
+   //! <b>Effects</b>: Returns a const_iterator to the end of the sequence of groups.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline const_iterator cend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_tree.cend();  }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the last group.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline reverse_iterator rbegin() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_tree.rbegin();  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the last group.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline const_reverse_iterator rbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_tree.rbegin();  }
+
+   //! <b>Effects</b>: Returns a reverse_iterator pointing to the end of the reversed sequence of groups.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline reverse_iterator rend() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_tree.rend();  }
+
+   //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end of the reversed sequence of groups.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline const_reverse_iterator rend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_tree.rend();  }
+
+   //////////////////////////////////////////////
+   //
+   //                capacity
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns true if the container contains no elements.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline bool empty() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !m_size;  }
+
+   //! <b>Effects</b>: Returns the number of mapped values (key/value associations) in the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline size_type size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_size;  }
+
+   //! <b>Effects</b>: Returns the number of distinct keys (groups) in the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline size_type key_count() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_tree.size();  }
+
+   //! <b>Effects</b>: Returns the largest possible size of the container.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline size_type max_size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return allocator_traits<mapped_allocator_type>::max_size(mapped_allocator_type(m_tree.get_allocator()));  }
+
+   //! <b>Effects</b>: Tries to deallocate the excess of memory created
+   //!   by the mapped value sequences of all groups.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or T's copy/move constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to size().
+   void shrink_to_fit()
+   {
+      for(iterator it = m_tree.begin(), itend = m_tree.end(); it != itend; ++it){
+         it->second.shrink_to_fit();
+      }
+   }
+
+   //////////////////////////////////////////////
+   //
+   //                modifiers
+   //
+   //////////////////////////////////////////////
+
+   #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! <b>Effects</b>: Appends a mapped value constructed with std::forward<Args>(args)...
+   //!   to the group of key k, creating the group if k was not present.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the newly inserted mapped value.
+   //!
+   //! <b>Complexity</b>: Logarithmic in key_count() plus amortized constant.
+   //!
+   //! <b>Note</b>: Iterators and references to mapped values of the group of k might be invalidated.
+   template <class... Args>
+   mapped_iterator emplace(const key_type& k, BOOST_FWD_REF(Args)... args)
+   {
+      iterator g(this->priv_group(k));
+      BOOST_CONTAINER_TRY{
+         g->second.emplace_back(boost::forward<Args>(args)...);
+      }
+      BOOST_CONTAINER_CATCH(...){
+         this->priv_erase_if_empty(g);
+         BOOST_CONTAINER_RETHROW
+      }
+      BOOST_CONTAINER_CATCH_END
+      return this->priv_inserted(g);
+   }
+
+   #else // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   #define BOOST_CONTAINER_GROUPED_MULTIMAP_EMPLACE_CODE(N) \
+   BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
+   mapped_iterator emplace(const key_type& k BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+   {\
+      iterator g(this->priv_group(k));\
+      BOOST_CONTAINER_TRY{\
+         g->second.emplace_back(BOOST_MOVE_FWD##N);\
+      }\
+      BOOST_CONTAINER_CATCH(...){\
+         this->priv_erase_if_empty(g);\
+         BOOST_CONTAINER_RETHROW\
+      }\
+      BOOST_CONTAINER_CATCH_END\
+      return this->priv_inserted(g);\
+   }\
+   //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_CONTAINER_GROUPED_MULTIMAP_EMPLACE_CODE)
+   #undef BOOST_CONTAINER_GROUPED_MULTIMAP_EMPLACE_CODE
+
+   #endif   // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   //! <b>Effects</b>: Appends a copy of x.second to the group of key x.first.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the newly inserted mapped value.
+   //!
+   //! <b>Complexity</b>: Logarithmic in key_count() plus amortized constant.
+   inline mapped_iterator insert(const value_type& x)
+   {  return this->emplace(x.first, x.second);  }
+
+   //! <b>Effects</b>: Appends a copy of m to the group of key k.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the newly inserted mapped value.
+   //!
+   //! <b>Complexity</b>: Logarithmic in key_count() plus amortized constant.
+   inline mapped_iterator insert(const key_type& k, const mapped_type& m)
+   {  return this->emplace(k, m);  }
+
+   //! <b>Effects</b>: Appends m, move constructed, to the group of key k.
+   //!
+   //! <b>Returns</b>: An iterator pointing to the newly inserted mapped value.
+   //!
+   //! <b>Complexity</b>: Logarithmic in key_count() plus amortized constant.
+   inline mapped_iterator insert(const key_type& k, BOOST_RV_REF(mapped_type) m)
+   {  return this->emplace(k, boost::move(m));  }
+
+   //! <b>Requires</b>: first, last are not iterators into *this.
+   //!
+   //! <b>Effects</b>: inserts each element from the range [first,last) .
+   //!
+   //! <b>Complexity</b>: At most N log(key_count()+N) (N is the distance from first to last)
+   template <class InputIterator>
+   void insert(InputIterator first, InputIterator last)
+   {
+      for( ; first != last; ++first){
+         this->emplace(first->first, first->second);
+      }
+   }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: inserts each element from the range [il.begin(), il.end()).
+   //!
+   //! <b>Complexity</b>: At most N log(key_count()+N) (N is the distance from il.begin() to il.end())
+   inline void insert(std::initializer_list<value_type> il)
+   {  this->insert(il.begin(), il.end());  }
+#endif
+
+   //! <b>Effects</b>: Erases all mapped values associated with key k.
+   //!
+   //! <b>Returns</b>: Returns the number of erased mapped values.
+   //!
+   //! <b>Complexity</b>: log(key_count()) + count(k)
+   size_type erase(const key_type& k)
+   {
+      iterator g(m_tree.find(k));
+      if(g == m_tree.end())
+         return 0u;
+      const size_type n = g->second.size();
+      m_tree.erase(g);
+      m_size -= n;
+      return n;
+   }
+
+   //! <b>Effects</b>: Erases the group pointed to by p, including all its mapped values.
+   //!
+   //! <b>Returns</b>: Returns an iterator pointing to the group immediately
+   //!   following p prior to the group being erased. If no such group exists,
+   //!   returns end().
+   //!
+   //! <b>Complexity</b>: Amortized constant time plus count(p->first).
+   iterator erase(const_iterator p)
+   {
+      m_size -= p->second.size();
+      return m_tree.erase(p);
+   }
+
+   //! <b>Requires</b>: mp is a valid dereferenceable iterator into the mapped value sequence
+   //!   of the group pointed by p.
+   //!
+   //! <b>Effects</b>: Erases the mapped value pointed by mp, preserving the relative order
+   //!   of the remaining values of the group. If the group becomes empty, it is also erased.
+   //!
+   //! <b>Returns</b>: Returns an iterator pointing to the group p if it was not erased,
+   //!   or to the group immediately following p otherwise.
+   //!
+   //! <b>Complexity</b>: Linear to the number of mapped values of the group following mp.
+   iterator erase(const_iterator p, const_mapped_iterator mp)
+   {
+      const iterator g(m_tree.erase(p, p));   //const_iterator -> iterator conversion
+      g->second.erase(mp);
+      --m_size;
+      return g->second.empty() ? m_tree.erase(g) : g;
+   }
+
+   //! <b>Effects</b>: Swaps the contents of *this and x.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   void swap(grouped_multimap& x)
+      BOOST_NOEXCEPT_IF(  allocator_traits<group_allocator_impl>::is_always_equal::value
+                                 && boost::container::dtl::is_nothrow_swappable<Compare>::value )
+   {
+      m_tree.swap(x.m_tree);
+      const size_type tmp = m_size;
+      m_size = x.m_size;
+      x.m_size = tmp;
+   }
+
+   //! <b>Effects</b>: erase(begin(),end()).
+   //!
+   //! <b>Postcondition</b>: size() == 0.
+   //!
+   //! <b>Complexity</b>: linear in key_count().
+   inline void clear() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      m_tree.clear();
+      m_size = 0u;
+   }
+
+   //////////////////////////////////////////////
+   //
+   //                lookup
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Returns</b>: An iterator pointing to the group with key equivalent to x, or end() if
+   //!   such a group is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic in key_count().
+   BOOST_CONTAINER_NODISCARD inline iterator find(const key_type& x)
+   {  return m_tree.find(x);  }
+
+   //! <b>Returns</b>: A const_iterator pointing to the group with key equivalent to x, or end() if
+   //!   such a group is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic in key_count().
+   BOOST_CONTAINER_NODISCARD inline const_iterator find(const key_type& x) const
+   {  return m_tree.find(x);  }
+
+   //! <b>Returns</b>: Returns true if there is a group with key equivalent to x.
+   //!
+   //! <b>Complexity</b>: Logarithmic in key_count().
+   BOOST_CONTAINER_NODISCARD inline bool contains(const key_type& x) const
+   {  return m_tree.find(x) != m_tree.end();  }
+
+   //! <b>Returns</b>: The number of mapped values associated with key x.
+   //!
+   //! <b>Complexity</b>: Logarithmic in key_count().
+   BOOST_CONTAINER_NODISCARD size_type count(const key_type& x) const
+   {
+      const const_iterator g(m_tree.find(x));
+      return g == m_tree.end() ? size_type(0u) : size_type(g->second.size());
+   }
+
+   //! <b>Effects</b>: Returns the contiguous range of mapped values associated with key x.
+   //!   The range is empty if x is not present.
+   //!
+   //! <b>Complexity</b>: Logarithmic in key_count().
+   BOOST_CONTAINER_NODISCARD std::pair<mapped_iterator, mapped_iterator> equal_range(const key_type& x)
+   {
+      const iterator g(m_tree.find(x));
+      return g == m_tree.end()
+         ? std::pair<mapped_iterator, mapped_iterator>()
+         : std::pair<mapped_iterator, mapped_iterator>(g->second.begin(), g->second.end());
+   }
+
+   //! <b>Effects</b>: Returns the contiguous range of mapped values associated with key x.
+   //!   The range is empty if x is not present.
+   //!
+   //! <b>Complexity</b>: Logarithmic in key_count().
+   BOOST_CONTAINER_NODISCARD std::pair<const_mapped_iterator, const_mapped_iterator> equal_range(const key_type& x) const
+   {
+      const const_iterator g(m_tree.find(x));
+      return g == m_tree.end()
+         ? std::pair<const_mapped_iterator, const_mapped_iterator>()
+         : std::pair<const_mapped_iterator, const_mapped_iterator>(g->second.begin(), g->second.end());
+   }
+
+   //! <b>Returns</b>: An iterator pointing to the first group with key not less than x, or end()
+   //!   if such a group is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic in key_count().
+   BOOST_CONTAINER_NODISCARD inline iterator lower_bound(const key_type& x)
+   {  return m_tree.lower_bound(x);  }
+
+   //! <b>Returns</b>: A const_iterator pointing to the first group with key not less than x, or end()
+   //!   if such a group is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic in key_count().
+   BOOST_CONTAINER_NODISCARD inline const_iterator lower_bound(const key_type& x) const
+   {  return m_tree.lower_bound(x);  }
+
+   //! <b>Returns</b>: An iterator pointing to the first group with key greater than x, or end()
+   //!   if such a group is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic in key_count().
+   BOOST_CONTAINER_NODISCARD inline iterator upper_bound(const key_type& x)
+   {  return m_tree.upper_bound(x);  }
+
+   //! <b>Returns</b>: A const_iterator pointing to the first group with key greater than x, or end()
+   //!   if such a group is not found.
+   //!
+   //! <b>Complexity</b>: Logarithmic in key_count().
+   BOOST_CONTAINER_NODISCARD inline const_iterator upper_bound(const key_type& x) const
+   {  return m_tree.upper_bound(x);  }
+
+   //! <b>Effects</b>: Returns true if x and y are equal
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   BOOST_CONTAINER_NODISCARD friend bool operator==(const grouped_multimap& x, const grouped_multimap& y)
+   {  return x.size() == y.size() && x.m_tree == y.m_tree;  }
+
+   //! <b>Effects</b>: Returns true if x and y are unequal
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   BOOST_CONTAINER_NODISCARD friend bool operator!=(const grouped_multimap& x, const grouped_multimap& y)
+   {  return !(x == y);  }
+
+   //! <b>Effects</b>: Returns true if x is less than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   BOOST_CONTAINER_NODISCARD friend bool operator<(const grouped_multimap& x, const grouped_multimap& y)
+   {  return x.m_tree < y.m_tree;  }
+
+   //! <b>Effects</b>: Returns true if x is greater than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   BOOST_CONTAINER_NODISCARD friend bool operator>(const grouped_multimap& x, const grouped_multimap& y)
+   {  return y < x;  }
+
+   //! <b>Effects</b>: Returns true if x is equal or less than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   BOOST_CONTAINER_NODISCARD friend bool operator<=(const grouped_multimap& x, const grouped_multimap& y)
+   {  return !(y < x);  }
+
+   //! <b>Effects</b>: Returns true if x is equal or greater than y
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the container.
+   BOOST_CONTAINER_NODISCARD friend bool operator>=(const grouped_multimap& x, const grouped_multimap& y)
+   {  return !(x < y);  }
+
+   //! <b>Effects</b>: x.swap(y)
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline friend void swap(grouped_multimap& x, grouped_multimap& y)
+      BOOST_NOEXCEPT_IF(BOOST_NOEXCEPT(x.swap(y)))
+   {  x.swap(y);  }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   iterator priv_group(const key_type& k)
+   {
+      //Mapped value sequences are constructed with a copy of the container's allocator
+      //so that stateful allocators (e.g. polymorphic_allocator) are honoured.
+      return m_tree.try_emplace(k, mapped_allocator_type(m_tree.get_allocator())).first;
+   }
+
+   void priv_erase_if_empty(iterator g)
+   {
+      if(g->second.empty()){
+         m_tree.erase(g);
+      }
+   }
+
+   mapped_iterator priv_inserted(iterator g)
+   {
+      ++m_size;
+      return g->second.end() - 1;
+   }
+
+   tree_t      m_tree;
+   size_type   m_size;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+}  //namespace container {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//!has_trivial_destructor_after_move<> == true_type
+//!specialization for optimizations
+template <class Key, class T, class Compare, class Allocator, class Options>
+struct has_trivial_destructor_after_move<boost::container::grouped_multimap<Key, T, Compare, Allocator, Options> >
+{
+   typedef typename boost::container::grouped_multimap<Key, T, Compare, Allocator, Options>::group_type group_type;
+   typedef typename ::boost::container::real_allocator<std::pair<const Key, T>, Allocator>::type real_allocator_t;
+   typedef typename ::boost::container::allocator_traits<real_allocator_t>::template
+      portable_rebind_alloc<std::pair<const Key, group_type> >::type group_allocator_t;
+   typedef ::boost::container::map<Key, group_type, Compare, group_allocator_t, Options> tree;
+   BOOST_STATIC_CONSTEXPR bool value = ::boost::has_trivial_destructor_after_move<tree>::value;
+};
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_GROUPED_MULTIMAP_HPP
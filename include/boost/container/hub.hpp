@@ -26,6 +26,7 @@
 //container
 #include <boost/container/container_fwd.hpp>
 #include <boost/container/detail/bit_utilities.hpp>
+#include <boost/container/detail/mask_segment_iterator.hpp>
 #include <boost/container/detail/range_utils.hpp>   //from_range_t / from_range
 
 #include <algorithm>
@@ -110,6 +111,11 @@ template<typename ValuePointer> class iterator;
 
 }
 
+template<class Iterator>
+struct segmented_iterator_traits;
+
+struct segmented_iterator_tag;
+
 template<typename T, typename Allocator, typename F>
 F for_each(hub<T, Allocator>&, F);
 
@@ -472,6 +478,10 @@ private:
    template<typename T, typename A, typename F>
    friend std::pair<typename hub<T, A>::iterator, F> container::for_each_while(
       hub<T, A>&, F);
+   template<typename, typename, typename>
+   friend struct dtl::mask_segmented_iterator_traits;
+   template<typename>
+   friend struct container::segmented_iterator_traits;
 
    template<typename T>
    using pointer_rebind_t = hub_detail::pointer_rebind_t<ValuePointer, T>;
@@ -503,6 +513,22 @@ private:
    int                n = 0;
 };
 
+} //namespace container::hub_detail
+
+//Segments are the blocks of the hub and local iterators visit the occupied slots
+//of a block, so segmented algorithms avoid the block-change test of operator++.
+template<typename ValuePointer>
+struct segmented_iterator_traits<hub_detail::iterator<ValuePointer>>:
+   dtl::mask_segmented_iterator_traits<
+      hub_detail::iterator<ValuePointer>,
+      typename hub_detail::iterator<ValuePointer>::block_base_pointer,
+      typename hub_detail::iterator<ValuePointer>::block>
+{
+   using is_segmented_iterator = segmented_iterator_tag;
+};
+
+namespace hub_detail {
+
 template<class F>
 struct inline_ref_caller
 {
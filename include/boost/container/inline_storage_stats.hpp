@@ -0,0 +1,271 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_INLINE_STORAGE_STATS_HPP
+#define BOOST_CONTAINER_INLINE_STORAGE_STATS_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#if defined(BOOST_NO_CXX11_HDR_ATOMIC) || defined(BOOST_NO_CXX11_CONSTEXPR)
+#error "boost/container/inline_storage_stats.hpp requires C++11 atomics and constexpr"
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/current_function.hpp>
+
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+//!\file
+//! Statistics about the usage of the internal buffer of small_vector and basic_string.
+//! They are only collected if BOOST_CONTAINER_INLINE_STORAGE_STATS is defined before including
+//! any Boost.Container header (the macro changes the layout of vector and basic_string, so it must be
+//! defined consistently in all translation units). If BOOST_CONTAINER_INLINE_STORAGE_STATS_AT_EXIT
+//! is also defined, statistics are printed to stderr when the program exits.
+
+namespace boost {
+namespace container {
+
+//! Statistics of a small_vector or basic_string instantiation. When a container is destroyed it records
+//! the maximum size it reached during its lifetime and whether it needed dynamic storage.
+//!
+//! Each instantiation has its own object, with static storage duration. Counters are updated with relaxed
+//! atomic operations, so containers can be destroyed concurrently from several threads.
+class inline_storage_stats
+{
+   public:
+   //! Sizes lower than linear_buckets have a bucket of their own in the histogram.
+   BOOST_STATIC_CONSTEXPR std::size_t linear_buckets = 32u;
+
+   //! Number of buckets of the histogram of maximum sizes: sizes lower than linear_buckets have
+   //! a bucket of their own, bigger sizes are grouped in power of two ranges.
+   BOOST_STATIC_CONSTEXPR std::size_t buckets = linear_buckets + sizeof(std::size_t)*CHAR_BIT - 5u;
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   BOOST_CONSTEXPR inline_storage_stats(const char *(*name_fn)(), std::size_t inline_cap) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_name(name_fn), m_inline_capacity(inline_cap)
+      , m_containers(0u), m_spills(0u), m_histogram()
+      , m_registered(false), m_next()
+   {}
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   //! <b>Returns</b>: A human readable name of the container type (compiler dependent).
+   const char *name() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_name();  }
+
+   //! <b>Returns</b>: The number of elements that fit in the internal buffer of the container.
+   std::size_t inline_capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_inline_capacity;  }
+
+   //! <b>Returns</b>: The number of destroyed containers.
+   std::size_t containers() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_containers.load(std::memory_order_relaxed);  }
+
+   //! <b>Returns</b>: The number of destroyed containers that used dynamic storage.
+   std::size_t spills() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_spills.load(std::memory_order_relaxed);  }
+
+   //! <b>Returns</b>: The number of destroyed containers whose maximum size is in bucket b.
+   //!
+   //! <b>Precondition</b>: b < buckets.
+   std::size_t bucket_count(std::size_t b) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_histogram[b].load(std::memory_order_relaxed);  }
+
+   //! <b>Returns</b>: The number of destroyed containers whose maximum size was lower or
+   //!   equal to n, that is, those that would not have needed dynamic storage with an
+   //!   internal capacity of n elements. If n is not the upper bound of a bucket,
+   //!   the bucket that contains n is not counted.
+   std::size_t containers_fitting(std::size_t n) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      std::size_t r = 0u;
+      for(std::size_t b = 0u; b != buckets && bucket_max(b) <= n; ++b){
+         r += this->bucket_count(b);
+      }
+      return r;
+   }
+
+   //! <b>Returns</b>: The bucket of the histogram that counts maximum size n.
+   static std::size_t bucket(std::size_t n) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(n < linear_buckets)
+         return n;
+      std::size_t log2 = 0u;
+      while(n >>= 1u)
+         ++log2;
+      return linear_buckets + log2 - 5u;
+   }
+
+   //! <b>Returns</b>: The minimum size counted by bucket b.
+   static std::size_t bucket_min(std::size_t b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return b < linear_buckets ? b : std::size_t(1u) << (b - linear_buckets + 5u);  }
+
+   //! <b>Returns</b>: The maximum size counted by bucket b.
+   static std::size_t bucket_max(std::size_t b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return b < linear_buckets ? b : std::size_t((bucket_min(b) << 1u) - 1u);  }
+
+   //! <b>Effects</b>: Sets all counters to zero.
+   void reset() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      m_containers.store(0u, std::memory_order_relaxed);
+      m_spills.store(0u, std::memory_order_relaxed);
+      for(std::size_t b = 0u; b != buckets; ++b){
+         m_histogram[b].store(0u, std::memory_order_relaxed);
+      }
+   }
+
+   //! <b>Effects</b>: Records a destroyed container that reached max_size elements.
+   //!   spilled must be true if the container used dynamic storage.
+   void record(std::size_t max_size, bool spilled) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(!m_registered.load(std::memory_order_relaxed) && !m_registered.exchange(true)){
+         this->priv_register();
+      }
+      m_containers.fetch_add(1u, std::memory_order_relaxed);
+      if(spilled){
+         m_spills.fetch_add(1u, std::memory_order_relaxed);
+      }
+      m_histogram[bucket(max_size)].fetch_add(1u, std::memory_order_relaxed);
+   }
+
+   //! <b>Returns</b>: The statistics of the next instantiation that has recorded containers, or null.
+   const inline_storage_stats *next() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_next;  }
+
+   //! <b>Returns</b>: The statistics of the last instantiation that recorded its first container, or null
+   //!   if no container has been recorded. Use next() to iterate through all instantiations.
+   static const inline_storage_stats *first() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return registry<void>::head.load(std::memory_order_acquire);  }
+
+   //! <b>Effects</b>: Prints the statistics of this instantiation: the number of containers and spills,
+   //!   and the histogram of maximum sizes with the cumulative percentage of containers.
+   void print(std::FILE *f) const
+   {
+      const std::size_t total = this->containers();
+      std::fprintf( f, "%s\n  inline capacity: %llu, containers: %llu, spills: %llu (%.2f%%)\n"
+                  , this->name(), (unsigned long long)m_inline_capacity
+                  , (unsigned long long)total, (unsigned long long)this->spills()
+                  , total ? 100.0*double(this->spills())/double(total) : 0.0);
+      std::fprintf(f, "  %-24s %14s %12s\n", "max size", "containers", "cumulative");
+      std::size_t acc = 0u;
+      for(std::size_t b = 0u; b != buckets; ++b){
+         const std::size_t cnt = this->bucket_count(b);
+         if(cnt){
+            acc += cnt;
+            char range[64];
+            if(b < linear_buckets)
+               std::snprintf(range, sizeof(range), "%llu", (unsigned long long)b);
+            else
+               std::snprintf(range, sizeof(range), "[%llu, %llu]", (unsigned long long)bucket_min(b), (unsigned long long)bucket_max(b));
+            std::fprintf( f, "  %-24s %14llu %11.2f%%\n", range, (unsigned long long)cnt
+                        , 100.0*double(acc)/double(total));
+         }
+      }
+   }
+
+   //! <b>Effects</b>: Prints the statistics of all instantiations that recorded containers.
+   static void print_all(std::FILE *f)
+   {
+      for(const inline_storage_stats *s = first(); s; s = s->next()){
+         s->print(f);
+      }
+   }
+
+   //! <b>Effects</b>: Registers (only once) a function that prints the statistics of all instantiations to
+   //!   stderr when the program exits (see std::atexit).
+   //!
+   //! <b>Note</b>: Containers destroyed after the function has run are not reported.
+   static void print_all_at_exit()
+   {
+      if(!registry<void>::at_exit.exchange(true)){
+         std::atexit(&priv_print_all_stderr);
+      }
+   }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   inline_storage_stats(const inline_storage_stats &);
+   inline_storage_stats &operator=(const inline_storage_stats &);
+
+   template<class Dummy>
+   struct registry
+   {
+      static std::atomic<inline_storage_stats*> head;
+      static std::atomic<bool> at_exit;
+   };
+
+   static void priv_print_all_stderr()
+   {  print_all(stderr);  }
+
+   //Pushes this object in the global list of instantiations
+   void priv_register() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      inline_storage_stats *head = registry<void>::head.load(std::memory_order_relaxed);
+      do{
+         m_next = head;
+      } while(!registry<void>::head.compare_exchange_weak(head, this, std::memory_order_release, std::memory_order_relaxed));
+      #ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS_AT_EXIT
+      print_all_at_exit();
+      #endif
+   }
+
+   const char *(*const        m_name)();
+   const std::size_t          m_inline_capacity;
+   std::atomic<std::size_t>   m_containers;
+   std::atomic<std::size_t>   m_spills;
+   std::atomic<std::size_t>   m_histogram[buckets];
+   std::atomic<bool>          m_registered;
+   inline_storage_stats *     m_next;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+template<class Dummy>
+std::atomic<inline_storage_stats*> inline_storage_stats::registry<Dummy>::head(0);
+
+template<class Dummy>
+std::atomic<bool> inline_storage_stats::registry<Dummy>::at_exit(false);
+
+namespace dtl {
+
+//Statistics object of a container instantiation with an internal buffer of InlineCapacity elements
+template<class Container, std::size_t InlineCapacity>
+struct inline_storage_stats_of
+{
+   static const char *name()
+   {  return BOOST_CURRENT_FUNCTION;  }
+
+   static inline_storage_stats instance;
+};
+
+template<class Container, std::size_t InlineCapacity>
+inline_storage_stats inline_storage_stats_of<Container, InlineCapacity>::instance
+   (&inline_storage_stats_of<Container, InlineCapacity>::name, InlineCapacity);
+
+}  //namespace dtl {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_INLINE_STORAGE_STATS_HPP
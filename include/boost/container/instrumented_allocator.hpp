@@ -0,0 +1,415 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_INSTRUMENTED_ALLOCATOR_HPP
+#define BOOST_CONTAINER_INSTRUMENTED_ALLOCATOR_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/new_allocator.hpp>
+#include <boost/container/trivially_relocatable.hpp>
+#include <boost/container/detail/type_traits.hpp>
+#include <boost/container/detail/version_type.hpp>
+#include <boost/container/detail/allocator_version_traits.hpp>
+#include <boost/move/utility_core.hpp>
+#if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+#include <boost/move/detail/fwd_macros.hpp>
+#endif
+
+#include <cstddef>
+
+//!\file
+
+namespace boost {
+namespace container {
+
+//! Allocation counters collected by statistics_observer. All sizes are in bytes.
+struct allocation_statistics
+{
+   //! Number of successful allocations
+   std::size_t allocations;
+   //! Number of deallocations
+   std::size_t deallocations;
+   //! Number of times a container moved its elements to a new buffer because the old one was too small
+   std::size_t reallocations;
+   //! Number of buffers expanded or shrunk in place (only with version 2 inner allocators)
+   std::size_t in_place_resizes;
+   //! Total bytes allocated
+   std::size_t bytes_allocated;
+   //! Total bytes of elements moved to new buffers by reallocations
+   std::size_t bytes_relocated;
+   //! Bytes currently allocated
+   std::size_t live_bytes;
+   //! Maximum value of live_bytes
+   std::size_t peak_live_bytes;
+};
+
+//! Callback interface notified by instrumented_allocator. Sizes are in bytes.
+//!
+//! Derived classes override the events they are interested in, for example to export
+//! them to a metrics system. Default implementations do nothing.
+class allocation_observer
+{
+   public:
+   virtual ~allocation_observer()
+   {}
+
+   //! Called after a successful allocation of `bytes` bytes.
+   virtual void on_allocate(std::size_t bytes)
+   {  (void)bytes;  }
+
+   //! Called before `bytes` bytes are deallocated.
+   virtual void on_deallocate(std::size_t bytes)
+   {  (void)bytes;  }
+
+   //! Called after a buffer of `old_bytes` bytes was expanded or shrunk in place to `new_bytes` bytes.
+   virtual void on_resize(std::size_t old_bytes, std::size_t new_bytes)
+   {  (void)old_bytes; (void)new_bytes;  }
+
+   //! Called when a container moves `bytes` bytes of elements to a new buffer because the
+   //! old buffer was too small (e.g. when a vector grows, or a deque grows its index map).
+   virtual void on_relocation(std::size_t bytes)
+   {  (void)bytes;  }
+};
+
+//! An allocation_observer that accumulates events in an allocation_statistics object.
+//!
+//! This class is not thread-safe, so it should observe containers used from a single thread.
+class statistics_observer
+   : public allocation_observer
+{
+   public:
+   //! <b>Effects</b>: Constructs an observer with all counters set to zero.
+   statistics_observer()
+   {  this->reset();  }
+
+   //! <b>Returns</b>: the counters accumulated since construction or the last call to reset().
+   const allocation_statistics &statistics() const
+   {  return m_stats;  }
+
+   //! <b>Effects</b>: Sets all counters to zero.
+   void reset()
+   {
+      m_stats.allocations = m_stats.deallocations = m_stats.reallocations = m_stats.in_place_resizes = 0u;
+      m_stats.bytes_allocated = m_stats.bytes_relocated = 0u;
+      m_stats.live_bytes = m_stats.peak_live_bytes = 0u;
+   }
+
+   virtual void on_allocate(std::size_t bytes)
+   {
+      ++m_stats.allocations;
+      m_stats.bytes_allocated += bytes;
+      m_stats.live_bytes += bytes;
+      if(m_stats.live_bytes > m_stats.peak_live_bytes)
+         m_stats.peak_live_bytes = m_stats.live_bytes;
+   }
+
+   virtual void on_deallocate(std::size_t bytes)
+   {
+      ++m_stats.deallocations;
+      m_stats.live_bytes -= bytes;
+   }
+
+   virtual void on_resize(std::size_t old_bytes, std::size_t new_bytes)
+   {
+      ++m_stats.in_place_resizes;
+      if(new_bytes > old_bytes){
+         m_stats.bytes_allocated += new_bytes - old_bytes;
+         m_stats.live_bytes += new_bytes - old_bytes;
+         if(m_stats.live_bytes > m_stats.peak_live_bytes)
+            m_stats.peak_live_bytes = m_stats.live_bytes;
+      }
+      else{
+         m_stats.live_bytes -= old_bytes - new_bytes;
+      }
+   }
+
+   virtual void on_relocation(std::size_t bytes)
+   {
+      ++m_stats.reallocations;
+      m_stats.bytes_relocated += bytes;
+   }
+
+   private:
+   allocation_statistics m_stats;
+};
+
+//! An allocator adaptor that forwards all requests to an inner allocator and notifies
+//! allocations, deallocations and container reallocations to an allocation_observer.
+//!
+//! As every Boost.Container container obtains its memory from its allocator, this adaptor
+//! instruments any of them (vector, deque, map, flat_map, basic_string, hub, small_vector...).
+//! Containers that move their elements to a new buffer when they grow notify it
+//! through allocator_traits::on_relocation.
+//!
+//! Rebound copies share the observer, so node and index allocations of a container are also
+//! reported. A default constructed instrumented_allocator has no observer and reports nothing.
+//!
+//! The adaptor has the version of the inner allocator: if it's a version 2 allocator (e.g.
+//! boost::container::allocator<T, 2>), containers can still expand their buffers in place.
+//!
+//! \tparam T The type of objects to allocate
+//! \tparam Allocator The inner allocator. If void, new_allocator<T> is used.
+template<class T, class Allocator = void>
+class instrumented_allocator
+{
+   public:
+   //! The inner allocator type
+   typedef typename real_allocator<T, Allocator>::type               inner_allocator_type;
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   typedef allocator_traits<inner_allocator_type>                    inner_traits;
+   typedef dtl::allocator_version_traits<inner_allocator_type>       inner_version_traits;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   typedef T                                                         value_type;
+   typedef typename inner_traits::pointer                            pointer;
+   typedef typename inner_traits::const_pointer                      const_pointer;
+   typedef typename inner_traits::void_pointer                       void_pointer;
+   typedef typename inner_traits::const_void_pointer                 const_void_pointer;
+   typedef typename inner_traits::size_type                          size_type;
+   typedef typename inner_traits::difference_type                    difference_type;
+   typedef typename inner_traits::propagate_on_container_copy_assignment propagate_on_container_copy_assignment;
+   typedef typename inner_traits::propagate_on_container_move_assignment propagate_on_container_move_assignment;
+   typedef typename inner_traits::propagate_on_container_swap        propagate_on_container_swap;
+   typedef dtl::false_type                                           is_always_equal;
+   //! Version of the inner allocator
+   typedef dtl::version_type
+      <instrumented_allocator, dtl::version<inner_allocator_type>::value> version;
+   //! Chain of nodes used by allocate_individual and deallocate_individual
+   typedef typename inner_version_traits::multiallocation_chain      multiallocation_chain;
+
+   //!Obtains an instrumented_allocator that allocates
+   //!objects of type T2 with the rebound inner allocator
+   template<class T2>
+   struct rebind
+   {
+      typedef instrumented_allocator
+         <T2, typename inner_traits::template portable_rebind_alloc<T2>::type> other;
+   };
+
+   //! <b>Effects</b>: Constructs an allocator without observer.
+   instrumented_allocator()
+      : m_inner(), m_observer()
+   {}
+
+   //! <b>Effects</b>: Constructs an allocator that notifies events to `observer`
+   //!   and obtains memory from `inner`. `observer` must outlive all copies of the allocator.
+   explicit instrumented_allocator(allocation_observer &observer, const inner_allocator_type &inner = inner_allocator_type())
+      : m_inner(inner), m_observer(&observer)
+   {}
+
+   //! <b>Effects</b>: Constructs an allocator sharing the observer of `other`
+   //!   and an inner allocator converted from `other`'s.
+   template<class T2, class A2>
+   instrumented_allocator(const instrumented_allocator<T2, A2> &other)
+      : m_inner(other.inner_allocator()), m_observer(other.observer())
+   {}
+
+   //! <b>Returns</b>: The inner allocator.
+   inner_allocator_type &inner_allocator() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_inner;  }
+
+   //! <b>Returns</b>: The inner allocator.
+   const inner_allocator_type &inner_allocator() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_inner;  }
+
+   //! <b>Returns</b>: A pointer to the observer, null if the allocator has no observer.
+   allocation_observer *observer() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_observer;  }
+
+   //! <b>Effects</b>: Allocates memory from the inner allocator and notifies it.
+   BOOST_CONTAINER_NODISCARD pointer allocate(size_type n)
+   {
+      const pointer p = inner_traits::allocate(m_inner, n);
+      if(m_observer)
+         m_observer->on_allocate(n*sizeof(T));
+      return p;
+   }
+
+   //! <b>Effects</b>: Allocates memory for at least n objects from the inner allocator
+   //!   and notifies the real size of the allocation.
+   BOOST_CONTAINER_NODISCARD allocation_result<pointer, size_type> allocate_at_least(size_type n)
+   {
+      const allocation_result<pointer, size_type> r = inner_traits::allocate_at_least(m_inner, n);
+      if(m_observer)
+         m_observer->on_allocate(r.count*sizeof(T));
+      return r;
+   }
+
+   //! <b>Effects</b>: Notifies the deallocation and returns the memory to the inner allocator.
+   void deallocate(pointer p, size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(m_observer)
+         m_observer->on_deallocate(n*sizeof(T));
+      inner_traits::deallocate(m_inner, p, n);
+   }
+
+   //! <b>Effects</b>: Forwards the request to the inner allocator. New buffers are notified
+   //!   as allocations of the received size and buffers expanded or shrunk in place through
+   //!   allocation_observer::on_resize. See boost::container::allocator::allocation_command.
+   BOOST_CONTAINER_NODISCARD pointer allocation_command
+      (allocation_type command, size_type limit_size, size_type &prefer_in_recvd_out_size, pointer &reuse)
+   {
+      const size_type old_size = (m_observer && reuse) ? this->priv_inner_size(reuse, dtl::version<inner_allocator_type>()) : 0u;
+      const pointer p = inner_version_traits::allocation_command
+         (m_inner, command, limit_size, prefer_in_recvd_out_size, reuse);
+      if(m_observer && p){
+         //Shrink commands don't return the buffer in reuse
+         if(reuse || (command & (shrink_in_place | try_shrink_in_place)))
+            m_observer->on_resize(old_size*sizeof(T), prefer_in_recvd_out_size*sizeof(T));
+         else
+            m_observer->on_allocate(prefer_in_recvd_out_size*sizeof(T));
+      }
+      return p;
+   }
+
+   //! <b>Effects</b>: Allocates one object from the inner allocator and notifies it.
+   BOOST_CONTAINER_NODISCARD pointer allocate_one()
+   {
+      const pointer p = inner_version_traits::allocate_one(m_inner);
+      if(m_observer)
+         m_observer->on_allocate(sizeof(T));
+      return p;
+   }
+
+   //! <b>Effects</b>: Notifies the deallocation and returns an object obtained with allocate_one.
+   void deallocate_one(pointer p) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(m_observer)
+         m_observer->on_deallocate(sizeof(T));
+      inner_version_traits::deallocate_one(m_inner, p);
+   }
+
+   //! <b>Effects</b>: Allocates n objects from the inner allocator, notifying each of them,
+   //!   and links them to chain.
+   void allocate_individual(std::size_t n, multiallocation_chain &chain)
+   {
+      inner_version_traits::allocate_individual(m_inner, size_type(n), chain);
+      if(m_observer){
+         for(std::size_t i = 0; i != n; ++i)
+            m_observer->on_allocate(sizeof(T));
+      }
+   }
+
+   //! <b>Effects</b>: Notifies the deallocation of each object of chain
+   //!   and returns them to the inner allocator.
+   void deallocate_individual(multiallocation_chain &chain) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(m_observer){
+         for(std::size_t i = 0, n = chain.size(); i != n; ++i)
+            m_observer->on_deallocate(sizeof(T));
+      }
+      inner_version_traits::deallocate_individual(m_inner, chain);
+   }
+
+   //! <b>Effects</b>: Notifies that a container moved n objects to a new buffer.
+   void on_relocation(size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(m_observer)
+         m_observer->on_relocation(n*sizeof(T));
+   }
+
+   //! <b>Returns</b>: The maximum number of objects the inner allocator can allocate.
+   BOOST_CONTAINER_NODISCARD size_type max_size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return inner_traits::max_size(m_inner);  }
+
+   #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+   //! <b>Effects</b>: Constructs an object using the inner allocator.
+   template<class U, class ...Args>
+   void construct(U *p, BOOST_FWD_REF(Args) ...args)
+   {  inner_traits::construct(m_inner, p, ::boost::forward<Args>(args)...);  }
+
+   #else // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   #define BOOST_CONTAINER_INSTRUMENTED_ALLOCATOR_CONSTRUCT_CODE(N) \
+   template<class U BOOST_MOVE_I##N BOOST_MOVE_CLASS##N>\
+   void construct(U *p BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+   {  inner_traits::construct(m_inner, p BOOST_MOVE_I##N BOOST_MOVE_FWD##N);  }\
+   //
+   BOOST_MOVE_ITERATE_0TO9(BOOST_CONTAINER_INSTRUMENTED_ALLOCATOR_CONSTRUCT_CODE)
+   #undef BOOST_CONTAINER_INSTRUMENTED_ALLOCATOR_CONSTRUCT_CODE
+
+   #endif   // !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   //! <b>Effects</b>: Destroys an object using the inner allocator.
+   template<class U>
+   void destroy(U *p) BOOST_NOEXCEPT_OR_NOTHROW
+   {  inner_traits::destroy(m_inner, p);  }
+
+   //! <b>Returns</b>: An allocator with the same observer and the inner allocator
+   //!   obtained from its select_on_container_copy_construction.
+   instrumented_allocator select_on_container_copy_construction() const
+   {
+      return instrumented_allocator
+         (inner_traits::select_on_container_copy_construction(m_inner), m_observer);
+   }
+
+   //! <b>Returns</b>: true if both allocators share the observer and inner allocators compare equal.
+   friend bool operator==(const instrumented_allocator &a, const instrumented_allocator &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return a.m_observer == b.m_observer && inner_traits::equal(a.m_inner, b.m_inner);  }
+
+   //! <b>Returns</b>: !(a == b)
+   friend bool operator!=(const instrumented_allocator &a, const instrumented_allocator &b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !(a == b);  }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   instrumented_allocator(const inner_allocator_type &inner, allocation_observer *observer)
+      : m_inner(inner), m_observer(observer)
+   {}
+
+   //Templates, so that they are not instantiated by explicit instantiations with version 1 allocators.
+   //Version 1 allocation commands never reuse a buffer.
+   template<class AllocVersion>
+   typename dtl::enable_if_c<AllocVersion::value != 2, size_type>::type
+      priv_inner_size(pointer, AllocVersion) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return 0u;  }
+
+   template<class AllocVersion>
+   typename dtl::enable_if_c<AllocVersion::value == 2, size_type>::type
+      priv_inner_size(pointer p, AllocVersion) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_inner.size(p);  }
+
+   inner_allocator_type m_inner;
+   allocation_observer *m_observer;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+template<class T, class Allocator>
+struct is_trivially_relocatable< instrumented_allocator<T, Allocator> >
+{
+   BOOST_STATIC_CONSTEXPR bool value = is_trivially_relocatable
+      <typename instrumented_allocator<T, Allocator>::inner_allocator_type>::value;
+};
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_INSTRUMENTED_ALLOCATOR_HPP
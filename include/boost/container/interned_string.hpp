@@ -0,0 +1,611 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_INTERNED_STRING_HPP
+#define BOOST_CONTAINER_INTERNED_STRING_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#if defined(BOOST_NO_CXX11_HDR_ATOMIC)
+#error "boost/container/interned_string.hpp requires C++11 atomics"
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+#include <boost/assert.hpp>
+
+// container
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/new_allocator.hpp>
+#include <boost/container/string.hpp>
+// container/detail
+#include <boost/container/detail/alloc_helpers.hpp>
+#include <boost/container/detail/min_max.hpp>
+#include <boost/container/detail/minimal_char_traits_header.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/mutex.hpp>
+#include <boost/container/detail/placement_new.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// intrusive
+#include <boost/intrusive/pointer_traits.hpp>
+// move
+#include <boost/move/detail/to_raw_pointer.hpp>
+// std
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+
+namespace boost {
+namespace container {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace dtl {
+
+//An interned string: the hash and the length, followed by
+//the null-terminated characters.
+struct intern_entry
+{
+   std::size_t hash;
+   std::size_t size;
+};
+
+//Header of an arena block. Blocks are allocated as arrays of intern_entry
+//units and the header uses the first unit.
+struct intern_block
+{
+   intern_block *next;
+   std::size_t   units;
+};
+
+//Header of an index: a power of two array of slots follows the header.
+//Indexes are only freed when the table is destroyed, as readers might be
+//probing an index that was replaced by a bigger one.
+struct intern_index
+{
+   intern_index *prev;
+   std::size_t   mask;
+
+   std::atomic<const intern_entry*> *slots()
+   {  return reinterpret_cast<std::atomic<const intern_entry*>*>(this + 1);  }
+};
+
+BOOST_CONTAINER_STATIC_ASSERT(sizeof(intern_block) <= sizeof(intern_entry));
+BOOST_CONTAINER_STATIC_ASSERT(sizeof(intern_index) <= sizeof(intern_entry));
+
+template<class CharT>
+inline const CharT *intern_chars(const intern_entry *e)
+{  return reinterpret_cast<const CharT*>(e + 1);  }
+
+//Word at a time multiplicative hash of the character bytes.
+inline std::size_t intern_hash(const void *p, std::size_t bytes)
+{
+   const unsigned char *s = static_cast<const unsigned char*>(p);
+   const std::size_t mul = sizeof(std::size_t) >= 8u
+      ? std::size_t(0x9E3779B97F4A7C15ull) : std::size_t(0x9E3779B1u);
+   const unsigned shift = unsigned(sizeof(std::size_t)*4u - 3u);
+   std::size_t h = bytes * mul;
+   for(; bytes >= sizeof(std::size_t); bytes -= sizeof(std::size_t), s += sizeof(std::size_t)){
+      std::size_t w;
+      std::memcpy(&w, s, sizeof(w));
+      h = (h ^ w) * mul;
+      h ^= h >> shift;
+   }
+   if(bytes){
+      std::size_t w = 0u;
+      std::memcpy(&w, s, bytes);
+      h = (h ^ w) * mul;
+   }
+   h ^= h >> shift;
+   return h * mul;
+}
+
+template<class CharT>
+inline std::size_t intern_hash(const CharT *s, std::size_t n)
+{  return dtl::intern_hash(static_cast<const void*>(s), n*sizeof(CharT));  }
+
+}  //namespace dtl {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A handle to an immutable string stored in a basic_intern_table. Handles are as cheap to copy as a
+//! pointer, equality is a pointer comparison and the hash was computed when the string was interned.
+//!
+//! A default constructed handle represents the empty string, which is never stored in the table.
+//! Handles obtained from different tables can't be compared for equality. A handle is valid while
+//! the table that produced it is alive.
+//!
+//! \tparam CharT The type of character it contains.
+//! \tparam Traits The Character Traits type, which encapsulates basic character operations
+template <class CharT, class Traits BOOST_CONTAINER_DOCONLY(= std::char_traits<CharT>)>
+class basic_interned_string
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   template<class C, class T, class A>
+   friend class basic_intern_table;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   typedef Traits                traits_type;
+   typedef CharT                 value_type;
+   typedef std::size_t           size_type;
+   typedef std::ptrdiff_t        difference_type;
+   typedef const CharT &         reference;
+   typedef const CharT &         const_reference;
+   typedef const CharT *         pointer;
+   typedef const CharT *         const_pointer;
+   typedef const CharT *         iterator;
+   typedef const CharT *         const_iterator;
+
+   //! <b>Effects</b>: Constructs a handle to the empty string.
+   //!
+   //! <b>Complexity</b>: Constant.
+   basic_interned_string() BOOST_NOEXCEPT_OR_NOTHROW
+      : m_e()
+   {}
+
+   //! <b>Returns</b>: The number of characters.
+   //!
+   //! <b>Complexity</b>: Constant.
+   size_type size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_e ? m_e->size : 0u;  }
+
+   //! <b>Returns</b>: size().
+   size_type length() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->size();  }
+
+   //! <b>Returns</b>: size() == 0.
+   bool empty() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !m_e;  }
+
+   //! <b>Returns</b>: A pointer to the null-terminated characters.
+   //!
+   //! <b>Complexity</b>: Constant.
+   const CharT *c_str() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      static const CharT empty_chars[1] = { CharT() };
+      return m_e ? dtl::intern_chars<CharT>(m_e) : empty_chars;
+   }
+
+   //! <b>Returns</b>: c_str().
+   const CharT *data() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->c_str();  }
+
+   //! <b>Returns</b>: data().
+   const_iterator begin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->c_str();  }
+
+   //! <b>Returns</b>: data() + size().
+   const_iterator end() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->c_str() + this->size();  }
+
+   //! <b>Requires</b>: n < size().
+   //!
+   //! <b>Returns</b>: data()[n].
+   const_reference operator[](size_type n) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(n < this->size());
+      return this->c_str()[n];
+   }
+
+   //! <b>Returns</b>: The hash of the characters, computed when the string was interned.
+   //!
+   //! <b>Complexity</b>: Constant.
+   std::size_t hash() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_e ? m_e->hash : dtl::intern_hash(this->c_str(), 0u);  }
+
+   //! <b>Returns</b>: A value that identifies the interned string in its table: equal handles return equal values.
+   //!   It can be used to order handles in constant time (e.g. as the key of a flat_map) when the order
+   //!   does not need to be lexicographical.
+   const void *id() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_e;  }
+
+   //! <b>Returns</b>: A basic_string with the same characters.
+   template<class Allocator>
+   basic_string<CharT, Traits, Allocator> str(const Allocator &a) const
+   {  return basic_string<CharT, Traits, Allocator>(this->data(), this->size(), a);  }
+
+   //! <b>Returns</b>: A basic_string with the same characters.
+   basic_string<CharT, Traits> str() const
+   {  return basic_string<CharT, Traits>(this->data(), this->size());  }
+
+   //! <b>Returns</b>: A string_view of the characters.
+   //!
+   //! <b>Complexity</b>: Constant.
+   template<template <class, class> class BasicStringView>
+   operator BasicStringView<CharT, Traits>() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return BasicStringView<CharT, Traits>(this->data(), this->size());  }
+
+   //! <b>Returns</b>: The lexicographical comparison of the characters, as basic_string::compare.
+   //!
+   //! <b>Complexity</b>: Constant if both handles are equal, linear otherwise.
+   int compare(const basic_interned_string &x) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      return m_e == x.m_e ? 0 : s_compare(this->data(), this->size(), x.data(), x.size());
+   }
+
+   //! <b>Returns</b>: The lexicographical comparison with the null-terminated array s.
+   int compare(const CharT *s) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return s_compare(this->data(), this->size(), s, Traits::length(s));  }
+
+   //! <b>Returns</b>: true if both handles refer to the same interned string.
+   //!
+   //! <b>Complexity</b>: Constant.
+   friend bool operator==(const basic_interned_string &x, const basic_interned_string &y) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return x.m_e == y.m_e;  }
+
+   //! <b>Returns</b>: !(x == y).
+   friend bool operator!=(const basic_interned_string &x, const basic_interned_string &y) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return x.m_e != y.m_e;  }
+
+   //! <b>Returns</b>: x.compare(y) < 0.
+   friend bool operator<(const basic_interned_string &x, const basic_interned_string &y) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return x.compare(y) < 0;  }
+
+   //! <b>Returns</b>: y < x.
+   friend bool operator>(const basic_interned_string &x, const basic_interned_string &y) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return y < x;  }
+
+   //! <b>Returns</b>: !(y < x).
+   friend bool operator<=(const basic_interned_string &x, const basic_interned_string &y) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !(y < x);  }
+
+   //! <b>Returns</b>: !(x < y).
+   friend bool operator>=(const basic_interned_string &x, const basic_interned_string &y) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !(x < y);  }
+
+   //! <b>Returns</b>: true if x has the characters of the null-terminated array s.
+   friend bool operator==(const basic_interned_string &x, const CharT *s) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return x.compare(s) == 0;  }
+
+   //! <b>Returns</b>: x == s.
+   friend bool operator==(const CharT *s, const basic_interned_string &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return x.compare(s) == 0;  }
+
+   //! <b>Returns</b>: !(x == s).
+   friend bool operator!=(const basic_interned_string &x, const CharT *s) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return x.compare(s) != 0;  }
+
+   //! <b>Returns</b>: !(x == s).
+   friend bool operator!=(const CharT *s, const basic_interned_string &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return x.compare(s) != 0;  }
+
+   //! <b>Returns</b>: x.hash(), so boost::hash uses the cached hash.
+   friend std::size_t hash_value(const basic_interned_string &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return x.hash();  }
+
+   //! <b>Effects</b>: Writes the characters of x to os.
+   friend std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os, const basic_interned_string &x)
+   {  return os.write(x.data(), std::streamsize(x.size()));  }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   explicit basic_interned_string(const dtl::intern_entry *e)
+      : m_e(e)
+   {}
+
+   static int s_compare(const CharT *s1, std::size_t n1, const CharT *s2, std::size_t n2)
+   {
+      const int cmp = Traits::compare(s1, s2, dtl::min_value(n1, n2));
+      return cmp != 0 ? cmp : (n1 < n2 ? -1 : (n1 > n2 ? 1 : 0));
+   }
+
+   const dtl::intern_entry *m_e;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+//! A table of interned strings. Each distinct string is stored once, with its hash, in blocks
+//! obtained from the allocator and is never modified or freed until the table is destroyed.
+//! intern() returns a basic_interned_string handle to the stored copy.
+//!
+//! All member functions can be called concurrently. Looking up strings that are already
+//! interned does not take locks: the index is an open addressing table of atomic pointers that
+//! is only appended to. Inserting a new string is serialized by a mutex.
+//!
+//! \tparam CharT The type of character it contains.
+//! \tparam Traits The Character Traits type, which encapsulates basic character operations
+//! \tparam Allocator The allocator used to obtain memory for the strings and the index.
+//!   Use void for the default allocator.
+template <class CharT, class Traits BOOST_CONTAINER_DOCONLY(= std::char_traits<CharT>), class Allocator BOOST_CONTAINER_DOCONLY(= void)>
+class basic_intern_table
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   typedef boost::container::allocator_traits
+      <typename real_allocator<CharT, Allocator>::type>                          allocator_traits_type;
+   typedef typename allocator_traits_type::template
+      portable_rebind_alloc<dtl::intern_entry>::type                             unit_allocator_type;
+   typedef boost::container::allocator_traits<unit_allocator_type>              unit_alloc_traits;
+   typedef typename unit_alloc_traits::pointer                                   unit_ptr;
+   typedef std::atomic<const dtl::intern_entry*>                                 slot_t;
+
+   BOOST_DELETED_FUNCTION(basic_intern_table(const basic_intern_table &))
+   BOOST_DELETED_FUNCTION(basic_intern_table &operator=(const basic_intern_table &))
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   typedef Traits                                                                traits_type;
+   typedef CharT                                                                 value_type;
+   typedef BOOST_CONTAINER_IMPDEF
+      (typename real_allocator<CharT BOOST_MOVE_I Allocator>::type)              allocator_type;
+   typedef std::size_t                                                           size_type;
+   typedef basic_interned_string<CharT, Traits>                                  interned_string_type;
+
+   //! Bytes of the blocks where strings are stored. Longer strings are stored in their own block.
+   BOOST_STATIC_CONSTEXPR std::size_t block_bytes = 4096u;
+
+   //! <b>Effects</b>: Constructs an empty table that will obtain memory from a.
+   //!
+   //! <b>Complexity</b>: Constant.
+   explicit basic_intern_table(const allocator_type &a = allocator_type()) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_(unit_allocator_type(a))
+   {}
+
+   //! <b>Effects</b>: Deallocates all strings and indexes.
+   //!   Handles obtained from this table are no longer valid.
+   //!
+   //! <b>Complexity</b>: Linear to the number of allocated blocks.
+   ~basic_intern_table()
+   {
+      dtl::intern_index *ix = m_.index.load(std::memory_order_relaxed);
+      while(ix){
+         dtl::intern_index *const prev = ix->prev;
+         for(std::size_t i = 0, n = ix->mask + 1u; i != n; ++i){
+            ix->slots()[i].~slot_t();
+         }
+         this->priv_deallocate(reinterpret_cast<dtl::intern_entry*>(ix), priv_index_units(ix->mask + 1u));
+         ix = prev;
+      }
+      dtl::intern_block *b = m_.blocks;
+      while(b){
+         dtl::intern_block *const next = b->next;
+         this->priv_deallocate(reinterpret_cast<dtl::intern_entry*>(b), b->units);
+         b = next;
+      }
+   }
+
+   //! <b>Returns</b>: A copy of the allocator.
+   allocator_type get_allocator() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return allocator_type(static_cast<const unit_allocator_type&>(m_));  }
+
+   //! <b>Returns</b>: The number of distinct non-empty strings stored in the table.
+   size_type size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_.size.load(std::memory_order_relaxed);  }
+
+   //! <b>Returns</b>: size() == 0.
+   bool empty() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !this->size();  }
+
+   //! <b>Effects</b>: Grows the index so that n distinct strings can be interned without rehashing.
+   //!
+   //! <b>Throws</b>: If the allocation throws.
+   void reserve(size_type n)
+   {
+      dtl::scoped_lock<dtl::default_mutex> guard(m_.mutex);
+      dtl::intern_index *const ix = m_.index.load(std::memory_order_relaxed);
+      if(!ix || priv_max_load(ix->mask + 1u) < n){
+         this->priv_rehash(n);
+      }
+   }
+
+   //! <b>Effects</b>: Stores a copy of [s, s + n) in the table if an equal string was not stored yet.
+   //!
+   //! <b>Returns</b>: A handle to the stored string. Interning equal strings returns equal handles.
+   //!
+   //! <b>Throws</b>: If the allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to n on average. It does not take locks if the string was already interned.
+   interned_string_type intern(const CharT *s, size_type n)
+   {
+      if(!n){
+         return interned_string_type();
+      }
+      const std::size_t h = dtl::intern_hash(s, n);
+      const dtl::intern_entry *e = this->priv_find(s, n, h);
+      return interned_string_type(e ? e : this->priv_insert(s, n, h));
+   }
+
+   //! <b>Effects</b>: Returns intern(s, traits_type::length(s)).
+   interned_string_type intern(const CharT *s)
+   {  return this->intern(s, Traits::length(s));  }
+
+   //! <b>Effects</b>: Returns intern(s.data(), s.size()).
+   template<class StrAllocator, class StrOptions>
+   interned_string_type intern(const basic_string<CharT, Traits, StrAllocator, StrOptions> &s)
+   {  return this->intern(s.data(), s.size());  }
+
+   //! <b>Effects</b>: Returns intern(sv.data(), sv.size()).
+   template<template <class, class> class BasicStringView>
+   BOOST_CONTAINER_DOC1ST(interned_string_type, typename dtl::disable_if<is_string< BasicStringView<CharT BOOST_MOVE_I Traits> > BOOST_MOVE_I interned_string_type >::type)
+      intern(BasicStringView<CharT, Traits> sv)
+   {  return this->intern(sv.data(), sv.size());  }
+
+   //! <b>Returns</b>: A handle to the interned string equal to [s, s + n) or an empty handle if
+   //!   the string was not interned.
+   //!
+   //! <b>Complexity</b>: Linear to n on average. It does not take locks.
+   interned_string_type find(const CharT *s, size_type n) const
+   {  return interned_string_type(n ? this->priv_find(s, n, dtl::intern_hash(s, n)) : 0);  }
+
+   //! <b>Effects</b>: Returns find(s, traits_type::length(s)).
+   interned_string_type find(const CharT *s) const
+   {  return this->find(s, Traits::length(s));  }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   static std::size_t priv_units(std::size_t n)
+   {  return 1u + ((n + 1u)*sizeof(CharT) + sizeof(dtl::intern_entry) - 1u)/sizeof(dtl::intern_entry);  }
+
+   static std::size_t priv_index_units(std::size_t slots)
+   {  return 1u + (slots*sizeof(slot_t) + sizeof(dtl::intern_entry) - 1u)/sizeof(dtl::intern_entry);  }
+
+   //Load factor of 1/2 for short probe sequences
+   static std::size_t priv_max_load(std::size_t slots)
+   {  return slots/2u;  }
+
+   dtl::intern_entry *priv_allocate(std::size_t units)
+   {
+      return boost::movelib::to_raw_pointer
+         (unit_alloc_traits::allocate(m_, typename unit_alloc_traits::size_type(units)));
+   }
+
+   void priv_deallocate(dtl::intern_entry *p, std::size_t units)
+   {
+      unit_alloc_traits::deallocate
+         (m_, boost::intrusive::pointer_traits<unit_ptr>::pointer_to(*p), typename unit_alloc_traits::size_type(units));
+   }
+
+   const dtl::intern_entry *priv_find(const CharT *s, std::size_t n, std::size_t h) const
+   {
+      dtl::intern_index *const ix = m_.index.load(std::memory_order_acquire);
+      if(ix){
+         slot_t *const slots = ix->slots();
+         for(std::size_t i = h & ix->mask; ; i = (i + 1u) & ix->mask){
+            const dtl::intern_entry *const e = slots[i].load(std::memory_order_acquire);
+            if(!e){
+               break;
+            }
+            else if(e->hash == h && e->size == n && !Traits::compare(dtl::intern_chars<CharT>(e), s, n)){
+               return e;
+            }
+         }
+      }
+      return 0;
+   }
+
+   static void priv_link(dtl::intern_index *ix, const dtl::intern_entry *e)
+   {
+      slot_t *const slots = ix->slots();
+      std::size_t i = e->hash & ix->mask;
+      while(slots[i].load(std::memory_order_relaxed)){
+         i = (i + 1u) & ix->mask;
+      }
+      slots[i].store(e, std::memory_order_release);
+   }
+
+   //Publishes a new index with room for n strings. Must be called with the mutex locked.
+   void priv_rehash(std::size_t n)
+   {
+      std::size_t slots = 64u;
+      while(priv_max_load(slots) < n){
+         slots *= 2u;
+      }
+      dtl::intern_index *const old = m_.index.load(std::memory_order_relaxed);
+      dtl::intern_index *const ix = reinterpret_cast<dtl::intern_index*>(this->priv_allocate(priv_index_units(slots)));
+      ix->prev = old;
+      ix->mask = slots - 1u;
+      for(std::size_t i = 0; i != slots; ++i){
+         ::new(&ix->slots()[i], boost_container_new_t()) slot_t(0);
+      }
+      if(old){
+         slot_t *const old_slots = old->slots();
+         for(std::size_t i = 0, e = old->mask + 1u; i != e; ++i){
+            if(const dtl::intern_entry *const p = old_slots[i].load(std::memory_order_relaxed)){
+               priv_link(ix, p);
+            }
+         }
+      }
+      m_.index.store(ix, std::memory_order_release);
+   }
+
+   const dtl::intern_entry *priv_insert(const CharT *s, std::size_t n, std::size_t h)
+   {
+      dtl::scoped_lock<dtl::default_mutex> guard(m_.mutex);
+      //Another thread might have inserted it
+      if(const dtl::intern_entry *const e = this->priv_find(s, n, h)){
+         return e;
+      }
+      const std::size_t sz = m_.size.load(std::memory_order_relaxed);
+      dtl::intern_index *ix = m_.index.load(std::memory_order_relaxed);
+      if(!ix || priv_max_load(ix->mask + 1u) <= sz){
+         this->priv_rehash(sz + 1u);
+         ix = m_.index.load(std::memory_order_relaxed);
+      }
+      //Store the characters in the current block or in a new one
+      const std::size_t units = priv_units(n);
+      const std::size_t block_units = block_bytes/sizeof(dtl::intern_entry);
+      dtl::intern_entry *e;
+      if(m_.free_units >= units){
+         e = m_.free;
+      }
+      else if(units > block_units/4u){
+         //Long strings get their own block, so the current one is not wasted
+         return this->priv_publish(ix, this->priv_new_block(units + 1u) + 1, s, n, h);
+      }
+      else{
+         e = this->priv_new_block(block_units) + 1;
+         m_.free_units = block_units - 1u;
+      }
+      m_.free = e + units;
+      m_.free_units -= units;
+      return this->priv_publish(ix, e, s, n, h);
+   }
+
+   dtl::intern_entry *priv_new_block(std::size_t units)
+   {
+      dtl::intern_entry *const p = this->priv_allocate(units);
+      dtl::intern_block *const b = ::new(p, boost_container_new_t()) dtl::intern_block;
+      b->next = m_.blocks;
+      b->units = units;
+      m_.blocks = b;
+      return p;
+   }
+
+   const dtl::intern_entry *priv_publish
+      (dtl::intern_index *ix, dtl::intern_entry *e, const CharT *s, std::size_t n, std::size_t h)
+   {
+      ::new(e, boost_container_new_t()) dtl::intern_entry;
+      e->hash = h;
+      e->size = n;
+      CharT *const chars = const_cast<CharT*>(dtl::intern_chars<CharT>(e));
+      Traits::copy(chars, s, n);
+      Traits::assign(chars[n], CharT());
+      priv_link(ix, e);
+      m_.size.store(m_.size.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+      return e;
+   }
+
+   struct impl : unit_allocator_type
+   {
+      explicit impl(const unit_allocator_type &a)
+         : unit_allocator_type(a), index(0), size(0u), blocks(), free(), free_units()
+      {}
+
+      std::atomic<dtl::intern_index*> index;
+      std::atomic<std::size_t>        size;
+      dtl::intern_block  *blocks;
+      dtl::intern_entry  *free;
+      std::size_t         free_units;
+      dtl::default_mutex  mutex;
+   } m_;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+template <class CharT, class Traits, class Allocator>
+const std::size_t basic_intern_table<CharT, Traits, Allocator>::block_bytes;
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_INTERNED_STRING_HPP
@@ -0,0 +1,394 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_MMAP_ALLOCATOR_HPP
+#define BOOST_CONTAINER_MMAP_ALLOCATOR_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#if !defined(BOOST_HAS_UNISTD_H)
+#  error "boost::container::mmap_allocator requires a POSIX system"
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/detail/allocation_type.hpp>
+#include <boost/container/detail/version_type.hpp>
+#include <boost/container/detail/multiallocation_chain.hpp>
+#include <boost/container/detail/type_traits.hpp>
+#include <boost/container/throw_exception.hpp>
+
+#include <cstddef>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+#  define BOOST_CONTAINER_MMAP_ALLOCATOR_HAS_MREMAP
+#endif
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#  define MAP_ANONYMOUS MAP_ANON
+#endif
+
+//!\file
+
+namespace boost {
+namespace container {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace dtl {
+
+//Each mapping starts with a header that stores the size of the mapping,
+//so that allocation_command can expand or shrink it in place.
+struct mmap_allocator_header
+{
+   std::size_t bytes;
+};
+
+template<int Dummy>
+struct mmap_allocator_page_size
+{
+   static std::size_t get()
+   {
+      static const std::size_t page = priv_page_size();
+      return page;
+   }
+
+   private:
+   static std::size_t priv_page_size()
+   {
+      const long ps = ::sysconf(_SC_PAGESIZE);
+      return ps > 0 ? std::size_t(ps) : std::size_t(4096u);
+   }
+};
+
+}  //namespace dtl {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! This class is an extended (version 2) allocator that obtains each buffer directly from the
+//! operating system with `mmap`. It is designed for huge arrays of trivially copyable elements
+//! stored in [classref boost::container::vector vector]:
+//!
+//! - Capacities are page-granular: the whole mapping is reported as usable capacity.
+//! - Forward expansion (`expand_fwd`) grows the mapping in place with `mremap` (Linux) so the kernel
+//!   just maps new pages after the buffer: no element is copied and the old and new buffers never
+//!   coexist. If the virtual address range after the buffer is not free and `allow_relocation` is
+//!   requested (vector does it for trivially relocatable elements), the kernel moves the pages
+//!   to a new address range, again without copying. Otherwise `allocation_command` falls back
+//!   to a new mapping.
+//! - Shrinking in place (`shrink_in_place`) returns unused pages to the system.
+//! - Mappings bigger than a huge page are advised with `MADV_HUGEPAGE` where available.
+//!
+//! Each allocation takes at least one page so this allocator should not be used for node-based containers.
+//! The allocator is stateless: memory allocated by an instance can be deallocated by any other.
+template<class T>
+class mmap_allocator
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   typedef mmap_allocator<T>        self_t;
+   typedef dtl::mmap_allocator_header header_t;
+
+   BOOST_STATIC_CONSTEXPR std::size_t huge_page_size = std::size_t(2u*1024u*1024u);
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   typedef T                                    value_type;
+   typedef T *                                  pointer;
+   typedef const T *                            const_pointer;
+   typedef T &                                  reference;
+   typedef const T &                            const_reference;
+   typedef std::size_t                          size_type;
+   typedef std::ptrdiff_t                       difference_type;
+
+   typedef boost::container::dtl::
+      version_type<self_t, 2>                   version;
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   typedef boost::container::dtl::
+         basic_multiallocation_chain<void*>     void_multiallocation_chain;
+
+   typedef boost::container::dtl::
+      transform_multiallocation_chain
+         <void_multiallocation_chain, T>        multiallocation_chain;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   //!Obtains an allocator that allocates
+   //!objects of type T2
+   template<class T2>
+   struct rebind
+   {
+      typedef mmap_allocator<T2> other;
+   };
+
+   //!Default constructor
+   //!Never throws
+   mmap_allocator() BOOST_NOEXCEPT_OR_NOTHROW
+   {}
+
+   //!Constructor from related allocator.
+   //!Never throws
+   template<class T2>
+   mmap_allocator(const mmap_allocator<T2> &) BOOST_NOEXCEPT_OR_NOTHROW
+   {}
+
+   //!Maps memory for an array of count elements.
+   //!Throws bad_alloc if there is no enough memory
+   BOOST_CONTAINER_NODISCARD pointer allocate(size_type count)
+   {
+      pointer const p = this->priv_map(count);
+      if(!p)
+         boost::container::throw_bad_alloc();
+      return p;
+   }
+
+   //!Maps memory for an array of at least count elements. The
+   //!returned count includes the tail of the last page.
+   //!Throws bad_alloc if there is no enough memory
+   BOOST_CONTAINER_NODISCARD allocation_result<pointer, size_type> allocate_at_least(size_type count)
+   {
+      allocation_result<pointer, size_type> ret = { this->allocate(count), 0u };
+      ret.count = this->size(ret.ptr);
+      return ret;
+   }
+
+   //!Unmaps memory previously allocated by this allocator.
+   //!Never throws
+   void deallocate(pointer ptr, size_type) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(ptr){
+         header_t *const h = priv_header(ptr);
+         ::munmap(static_cast<void*>(h), h->bytes);
+      }
+   }
+
+   //!Returns the maximum number of elements that could be allocated.
+   //!Never throws
+   BOOST_CONTAINER_NODISCARD size_type max_size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return size_type(size_type(-1)/2u - priv_data_offset() - priv_page_size())/sizeof(T);   }
+
+   //!Returns the number of objects the previously allocated memory
+   //!pointed by p can hold.
+   BOOST_CONTAINER_NODISCARD size_type size(pointer p) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return priv_capacity(priv_header(p)->bytes);  }
+
+   //!An advanced function that offers in-place forward expansion, shrink in place and
+   //!new allocation capabilities. `expand_bwd` requests are ignored.
+   //!
+   //!If `expand_fwd` is requested and `reuse` is not null, the mapping is grown in place to hold
+   //!`prefer_in_recvd_out_size` elements or, failing that, `limit_size` elements. If that's not
+   //!possible and `allow_relocation` is requested, the mapping is moved with its contents to a new
+   //!address, which is returned and also stored in `reuse`.
+   //!If `shrink_in_place` or `try_shrink_in_place` is requested, the mapping is reduced to the
+   //!pages needed to hold `prefer_in_recvd_out_size` elements. Otherwise, if `allocate_new` is
+   //!requested, a new mapping is created and `reuse` is set to null.
+   //!
+   //!On success, `prefer_in_recvd_out_size` holds the number of elements the buffer can hold.
+   //!If no command succeeds, returns null if `nothrow_allocation` was requested or throws bad_alloc.
+   BOOST_CONTAINER_NODISCARD pointer allocation_command(allocation_type command,
+                         size_type limit_size,
+                         size_type &prefer_in_recvd_out_size,
+                         pointer &reuse)
+   {
+      pointer ret = this->priv_allocation_command(command, limit_size, prefer_in_recvd_out_size, reuse);
+      if(!ret && !(command & nothrow_allocation))
+         boost::container::throw_bad_alloc();
+      return ret;
+   }
+
+   //!Swaps two allocators, does nothing
+   //!because this allocator is stateless
+   inline friend void swap(self_t &, self_t &) BOOST_NOEXCEPT_OR_NOTHROW
+   {}
+
+   //!An allocator always compares to true, as memory allocated with one
+   //!instance can be deallocated by another instance
+   BOOST_CONTAINER_NODISCARD
+      friend bool operator==(const mmap_allocator &, const mmap_allocator &) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return true;   }
+
+   //!An allocator always compares to false, as memory allocated with one
+   //!instance can be deallocated by another instance
+   BOOST_CONTAINER_NODISCARD
+      friend bool operator!=(const mmap_allocator &, const mmap_allocator &) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return false;   }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+
+   static std::size_t priv_page_size()
+   {  return dtl::mmap_allocator_page_size<0>::get();  }
+
+   //Data starts after the header, respecting T's and the fundamental alignment
+   static std::size_t priv_data_offset()
+   {
+      const std::size_t a = dtl::alignment_of<T>::value > dtl::alignment_of<dtl::max_align_t>::value
+         ? dtl::alignment_of<T>::value : dtl::alignment_of<dtl::max_align_t>::value;
+      return (sizeof(header_t) + (a - 1u)) & ~(a - 1u);
+   }
+
+   //Page-rounded mapping size needed to hold n elements, 0 on overflow
+   static std::size_t priv_mapping_bytes(size_type n)
+   {
+      const std::size_t max = size_type(-1)/2u - priv_data_offset() - priv_page_size();
+      if(n > max/sizeof(T))
+         return 0u;
+      const std::size_t page = priv_page_size();
+      return (priv_data_offset() + n*sizeof(T) + (page - 1u)) & ~(page - 1u);
+   }
+
+   static size_type priv_capacity(std::size_t bytes)
+   {  return size_type((bytes - priv_data_offset())/sizeof(T));  }
+
+   static header_t *priv_header(pointer p)
+   {  return reinterpret_cast<header_t*>(reinterpret_cast<char*>(p) - priv_data_offset());  }
+
+   static pointer priv_data(void *mapping)
+   {  return reinterpret_cast<pointer>(static_cast<char*>(mapping) + priv_data_offset());  }
+
+   static void priv_advise(void *addr, std::size_t bytes)
+   {
+      #if defined(MADV_HUGEPAGE)
+      if(bytes >= huge_page_size){
+         ::madvise(addr, bytes, MADV_HUGEPAGE);
+      }
+      #else
+      (void)addr; (void)bytes;
+      #endif
+   }
+
+   static pointer priv_map(size_type n)
+   {
+      const std::size_t bytes = priv_mapping_bytes(n);
+      if(!bytes)
+         return pointer();
+      void *const m = ::mmap(0, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if(m == MAP_FAILED)
+         return pointer();
+      priv_advise(m, bytes);
+      static_cast<header_t*>(m)->bytes = bytes;
+      return priv_data(m);
+   }
+
+   //Resizes the mapping that holds p without moving it
+   static bool priv_remap_in_place(pointer p, std::size_t new_bytes)
+   {
+      header_t *const h = priv_header(p);
+      const std::size_t old_bytes = h->bytes;
+      if(new_bytes < old_bytes){
+         //Shrinking is always possible, just unmap the tail
+         if(0 != ::munmap(reinterpret_cast<char*>(h) + new_bytes, old_bytes - new_bytes))
+            return false;
+      }
+      else if(new_bytes > old_bytes){
+         #if defined(BOOST_CONTAINER_MMAP_ALLOCATOR_HAS_MREMAP)
+         //Without MREMAP_MAYMOVE the kernel only succeeds if the mapping can grow in place
+         if(MAP_FAILED == ::mremap(static_cast<void*>(h), old_bytes, new_bytes, 0))
+            return false;
+         priv_advise(h, new_bytes);
+         #else
+         return false;
+         #endif
+      }
+      h->bytes = new_bytes;
+      return true;
+   }
+
+   #if defined(BOOST_CONTAINER_MMAP_ALLOCATOR_HAS_MREMAP)
+   static pointer priv_remap_relocate(pointer p, std::size_t new_bytes)
+   {
+      if(!new_bytes)
+         return pointer();
+      header_t *const h = priv_header(p);
+      void *const m = ::mremap(static_cast<void*>(h), h->bytes, new_bytes, MREMAP_MAYMOVE);
+      if(m == MAP_FAILED)
+         return pointer();
+      priv_advise(m, new_bytes);
+      static_cast<header_t*>(m)->bytes = new_bytes;
+      return priv_data(m);
+   }
+   #endif
+
+   pointer priv_allocation_command
+      (allocation_type command, size_type limit_size, size_type &prefer_in_recvd_out_size, pointer &reuse)
+   {
+      const size_type preferred_size = prefer_in_recvd_out_size;
+      if(reuse && (command & (shrink_in_place | try_shrink_in_place))){
+         const std::size_t old_bytes = priv_header(reuse)->bytes;
+         const std::size_t new_bytes = priv_mapping_bytes(preferred_size);
+         if(new_bytes && new_bytes < old_bytes && priv_remap_in_place(reuse, new_bytes)){
+            prefer_in_recvd_out_size = priv_capacity(new_bytes);
+            return reuse;
+         }
+         prefer_in_recvd_out_size = priv_capacity(old_bytes);
+         return (command & try_shrink_in_place) ? reuse : pointer();
+      }
+
+      if(reuse && (command & expand_fwd)){
+         const std::size_t old_bytes = priv_header(reuse)->bytes;
+         //Already enough?
+         if(priv_capacity(old_bytes) >= limit_size){
+            prefer_in_recvd_out_size = priv_capacity(old_bytes);
+            return reuse;
+         }
+         const std::size_t pref_bytes  = priv_mapping_bytes(preferred_size);
+         const std::size_t limit_bytes = priv_mapping_bytes(limit_size);
+         if(pref_bytes && priv_remap_in_place(reuse, pref_bytes)){
+            prefer_in_recvd_out_size = priv_capacity(pref_bytes);
+            return reuse;
+         }
+         #if defined(BOOST_CONTAINER_MMAP_ALLOCATOR_HAS_MREMAP)
+         //Let the kernel move the pages to a bigger address range, nothing is copied
+         if(command & allow_relocation){
+            pointer const p = priv_remap_relocate(reuse, pref_bytes);
+            if(p){
+               reuse = p;
+               prefer_in_recvd_out_size = priv_capacity(pref_bytes);
+               return p;
+            }
+         }
+         #endif
+         //Growing page by page would lead to a syscall per page, so try the
+         //minimum size only if a new allocation is not an option
+         if( !(command & allocate_new) &&
+             limit_bytes && limit_bytes != pref_bytes && priv_remap_in_place(reuse, limit_bytes) ){
+            prefer_in_recvd_out_size = priv_capacity(limit_bytes);
+            return reuse;
+         }
+      }
+
+      if(command & allocate_new){
+         pointer ret = priv_map(preferred_size);
+         if(!ret && limit_size < preferred_size)
+            ret = priv_map(limit_size);
+         if(ret){
+            prefer_in_recvd_out_size = priv_capacity(priv_header(ret)->bytes);
+            reuse = pointer();
+            return ret;
+         }
+      }
+      return pointer();
+   }
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_MMAP_ALLOCATOR_HPP
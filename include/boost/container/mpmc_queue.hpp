@@ -0,0 +1,411 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_MPMC_QUEUE_HPP
+#define BOOST_CONTAINER_MPMC_QUEUE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#if defined(BOOST_NO_CXX11_HDR_ATOMIC) || defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+#error "boost/container/mpmc_queue.hpp requires C++11 atomics and variadic templates"
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/allocator_traits.hpp>
+// container/detail
+#include <boost/container/detail/bounded_queue_storage.hpp>
+#include <boost/container/detail/iterator.hpp>
+#include <boost/container/detail/min_max.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/placement_new.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// move
+#include <boost/move/utility_core.hpp>
+// std
+#include <atomic>
+#include <cstddef>
+#include <utility>   //std::declval
+
+namespace boost {
+namespace container {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace dtl {
+
+//A slot of mpmc_queue: the sequence number says if the slot is free or holds
+//an element for the current turn of the ring.
+template<class T>
+struct mpmc_queue_slot
+{
+   std::atomic<std::size_t> seq;
+   typename dtl::aligned_storage<sizeof(T), dtl::alignment_of<T>::value>::type storage;
+
+   BOOST_CONTAINER_FORCEINLINE T *value() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return static_cast<T*>(static_cast<void*>(&storage));  }
+};
+
+}  //namespace dtl {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A bounded, lock-free, multi-producer/multi-consumer FIFO queue.
+//!
+//! Any number of threads can push and pop elements concurrently. Each slot stores a sequence
+//! number: a producer (consumer) claims the next slot incrementing the shared tail (head) index
+//! with a compare-and-swap only if the sequence number of the slot says it's free (full),
+//! constructs (destroys) the element and publishes the slot updating its sequence number.
+//! Head and tail indices are placed in different cache lines.
+//!
+//! push_n and pop_n claim several consecutive slots with a single compare-and-swap.
+//!
+//! T's move constructor and destructor must not throw: elements are constructed
+//! in a temporary before a slot is claimed when their construction might throw,
+//! as a claimed slot must always be published.
+//!
+//! \tparam T The type of the stored elements.
+//! \tparam Capacity If not zero, the number of elements that can be stored in the queue,
+//!   which must be a power of two. Slots are stored inline, like in static_vector.
+//!   If zero, the capacity is specified at construction time (and rounded up to a power of two),
+//!   and the slots are obtained from the allocator.
+//! \tparam Allocator The allocator used to obtain the slots when Capacity is zero, use void
+//!   for the default allocator. Elements are constructed with placement new.
+template <class T, std::size_t Capacity BOOST_CONTAINER_DOCONLY(= 0u), class Allocator BOOST_CONTAINER_DOCONLY(= void)>
+class mpmc_queue
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   BOOST_CONTAINER_STATIC_ASSERT_MSG(noexcept(T(std::declval<T&&>())), "mpmc_queue requires a nothrow move constructor");
+
+   typedef dtl::mpmc_queue_slot<T>                                   slot_t;
+   typedef dtl::bounded_queue_storage
+      <slot_t, Capacity, typename real_allocator<T, Allocator>::type>   storage_t;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   typedef T                                                      value_type;
+   typedef BOOST_CONTAINER_IMPDEF
+      (typename real_allocator<T BOOST_MOVE_I Allocator>::type)   allocator_type;
+   typedef std::size_t                                            size_type;
+
+   //! <b>Effects</b>: Constructs an empty queue that stores up to Capacity elements inline.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to Capacity.
+   //!
+   //! <b>Note</b>: Only available if Capacity is not zero.
+   mpmc_queue() BOOST_NOEXCEPT_OR_NOTHROW
+      : m_storage(), m_tail(), m_head()
+   {  this->priv_init_slots();  }
+
+   //! <b>Effects</b>: Constructs an empty queue that stores up to `capacity` elements
+   //!   (rounded up to a power of two), allocating the slots with a copy of a.
+   //!
+   //! <b>Throws</b>: length_error if capacity is zero or too big, or if the allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to capacity.
+   //!
+   //! <b>Note</b>: Only available if Capacity is zero.
+   explicit mpmc_queue(size_type capacity, const allocator_type &a = allocator_type())
+      : m_storage(capacity, a), m_tail(), m_head()
+   {  this->priv_init_slots();  }
+
+   //! <b>Effects</b>: Destroys the elements still in the queue and deallocates the slots.
+   //!
+   //! <b>Complexity</b>: Linear to capacity().
+   ~mpmc_queue()
+   {
+      const std::size_t tail = m_tail.index.load(std::memory_order_relaxed);
+      for(std::size_t head = m_head.index.load(std::memory_order_relaxed); head != tail; ++head){
+         this->priv_slot(head).value()->~T();
+      }
+      slot_t *const slots = m_storage.slots();
+      for(std::size_t i = 0u, cap = m_storage.capacity(); i != cap; ++i){
+         slots[i].seq.~atomic();
+      }
+   }
+
+   //! <b>Effects</b>: Returns a copy of the allocator used to obtain the slots.
+   allocator_type get_allocator() const
+   {  return m_storage.get_allocator();  }
+
+   //! <b>Returns</b>: The maximum number of elements the queue can hold.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD size_type capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_storage.capacity();  }
+
+   //! <b>Returns</b>: An approximation of the number of elements in the queue: slots claimed
+   //!   by producers or consumers that are still being filled or emptied are also counted.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD size_type size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const std::size_t head = m_head.index.load(std::memory_order_acquire);
+      const std::size_t tail = m_tail.index.load(std::memory_order_acquire);
+      return dtl::min_value(std::size_t(tail - head), m_storage.capacity());
+   }
+
+   //! <b>Returns</b>: size() == 0.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD bool empty() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !this->size();  }
+
+   //! <b>Effects</b>: Constructs a temporary object with std::forward<Args>(args)... and,
+   //!   if the queue is not full, moves it to the end of the queue.
+   //!
+   //! <b>Returns</b>: true if the element was inserted, false if the queue was full.
+   //!
+   //! <b>Throws</b>: If T's constructor throws. In that case the queue is not modified.
+   template<class ...Args>
+   bool try_emplace(BOOST_FWD_REF(Args)... args)
+   {
+      T tmp(::boost::forward<Args>(args)...);
+      return this->priv_push(::boost::move(tmp));
+   }
+
+   //! <b>Effects</b>: If the queue is not full, inserts a copy of x at the end of the queue.
+   //!   If T's copy constructor might throw, the copy is constructed before claiming a slot.
+   //!
+   //! <b>Returns</b>: true if the element was inserted, false if the queue was full.
+   //!
+   //! <b>Throws</b>: If T's copy constructor throws. In that case the queue is not modified.
+   bool try_push(const T &x)
+   {  return this->priv_push_copy(x, dtl::bool_<noexcept(T(std::declval<const T&>()))>());  }
+
+   //! <b>Effects</b>: If the queue is not full, inserts x at the end of the queue
+   //!   using T's move constructor. Otherwise x is not modified.
+   //!
+   //! <b>Returns</b>: true if the element was inserted, false if the queue was full.
+   //!
+   //! <b>Throws</b>: Nothing.
+   bool try_push(BOOST_RV_REF(T) x) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->priv_push(::boost::move(x));  }
+
+   //! <b>Requires</b>: Constructing T from *first does not throw (use
+   //!   boost::make_move_iterator to move elements).
+   //!
+   //! <b>Effects</b>: Claims up to n consecutive free slots with a single compare-and-swap and
+   //!   inserts at the end of the queue elements constructed from the first elements of
+   //!   the range starting at first.
+   //!
+   //! <b>Returns</b>: The number of inserted elements.
+   //!
+   //! <b>Throws</b>: Nothing.
+   template<class InpIt>
+   size_type push_n(InpIt first, size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_CONTAINER_STATIC_ASSERT_MSG(noexcept(T(std::declval<typename boost::container::iterator_traits<InpIt>::reference>())), "mpmc_queue::push_n requires a nothrow conversion");
+      if(!n){
+         return 0u;
+      }
+      std::size_t pos = m_tail.index.load(std::memory_order_relaxed);
+      std::size_t k;
+      for(;;){
+         //Count free slots for this turn of the ring
+         for(k = 0u; k != n && this->priv_slot(pos + k).seq.load(std::memory_order_acquire) == pos + k; ++k){}
+         if(k){
+            if(m_tail.index.compare_exchange_weak(pos, pos + k, std::memory_order_relaxed)){
+               break;
+            }
+         }
+         else if(std::ptrdiff_t(this->priv_slot(pos).seq.load(std::memory_order_acquire) - pos) < 0){
+            return 0u;  //Full
+         }
+         else{
+            pos = m_tail.index.load(std::memory_order_relaxed);
+         }
+      }
+      for(std::size_t i = 0u; i != k; ++i, ++first){
+         slot_t &s = this->priv_slot(pos + i);
+         ::new(s.value(), boost_container_new_t()) T(*first);
+         s.seq.store(pos + i + 1u, std::memory_order_release);
+      }
+      return k;
+   }
+
+   //! <b>Effects</b>: If the queue is not empty, move assigns the first element to out
+   //!   and removes it from the queue.
+   //!
+   //! <b>Returns</b>: true if an element was removed, false if the queue was empty.
+   //!
+   //! <b>Throws</b>: If T's move assignment throws. In that case the element is removed from the queue.
+   bool try_pop(T &out)
+   {
+      std::size_t pos = m_head.index.load(std::memory_order_relaxed);
+      for(;;){
+         slot_t &s = this->priv_slot(pos);
+         const std::ptrdiff_t dif = std::ptrdiff_t(s.seq.load(std::memory_order_acquire) - (pos + 1u));
+         if(!dif){
+            if(m_head.index.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed)){
+               this->priv_pop_slots(pos, 1u, &out);
+               return true;
+            }
+         }
+         else if(dif < 0){
+            return false;  //Empty
+         }
+         else{
+            pos = m_head.index.load(std::memory_order_relaxed);
+         }
+      }
+   }
+
+   //! <b>Effects</b>: Claims up to n consecutive elements with a single compare-and-swap,
+   //!   move assigns them to the range starting at out and removes them from the queue.
+   //!
+   //! <b>Returns</b>: The number of removed elements.
+   //!
+   //! <b>Throws</b>: If the assignment throws. In that case all the claimed elements are removed.
+   template<class OutIt>
+   size_type pop_n(OutIt out, size_type n)
+   {
+      if(!n){
+         return 0u;
+      }
+      std::size_t pos = m_head.index.load(std::memory_order_relaxed);
+      std::size_t k;
+      for(;;){
+         //Count published elements for this turn of the ring
+         for(k = 0u; k != n && this->priv_slot(pos + k).seq.load(std::memory_order_acquire) == pos + k + 1u; ++k){}
+         if(k){
+            if(m_head.index.compare_exchange_weak(pos, pos + k, std::memory_order_relaxed)){
+               break;
+            }
+         }
+         else if(std::ptrdiff_t(this->priv_slot(pos).seq.load(std::memory_order_acquire) - (pos + 1u)) < 0){
+            return 0u;  //Empty
+         }
+         else{
+            pos = m_head.index.load(std::memory_order_relaxed);
+         }
+      }
+      this->priv_pop_slots(pos, k, out);
+      return k;
+   }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   mpmc_queue(const mpmc_queue &);
+   mpmc_queue &operator=(const mpmc_queue &);
+
+   void priv_init_slots() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      slot_t *const slots = m_storage.slots();
+      for(std::size_t i = 0u, cap = m_storage.capacity(); i != cap; ++i){
+         ::new(&slots[i].seq, boost_container_new_t()) std::atomic<std::size_t>(i);
+      }
+   }
+
+   BOOST_CONTAINER_FORCEINLINE slot_t &priv_slot(std::size_t index) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_storage.slots()[index & (m_storage.capacity() - 1u)];  }
+
+   bool priv_push(BOOST_RV_REF(T) x) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      std::size_t pos = m_tail.index.load(std::memory_order_relaxed);
+      for(;;){
+         slot_t &s = this->priv_slot(pos);
+         const std::ptrdiff_t dif = std::ptrdiff_t(s.seq.load(std::memory_order_acquire) - pos);
+         if(!dif){
+            if(m_tail.index.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed)){
+               ::new(s.value(), boost_container_new_t()) T(::boost::move(x));
+               s.seq.store(pos + 1u, std::memory_order_release);
+               return true;
+            }
+         }
+         else if(dif < 0){
+            return false;  //Full
+         }
+         else{
+            pos = m_tail.index.load(std::memory_order_relaxed);
+         }
+      }
+   }
+
+   bool priv_push_copy(const T &x, dtl::true_) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      std::size_t pos = m_tail.index.load(std::memory_order_relaxed);
+      for(;;){
+         slot_t &s = this->priv_slot(pos);
+         const std::ptrdiff_t dif = std::ptrdiff_t(s.seq.load(std::memory_order_acquire) - pos);
+         if(!dif){
+            if(m_tail.index.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed)){
+               ::new(s.value(), boost_container_new_t()) T(x);
+               s.seq.store(pos + 1u, std::memory_order_release);
+               return true;
+            }
+         }
+         else if(dif < 0){
+            return false;  //Full
+         }
+         else{
+            pos = m_tail.index.load(std::memory_order_relaxed);
+         }
+      }
+   }
+
+   bool priv_push_copy(const T &x, dtl::false_)
+   {
+      T tmp(x);
+      return this->priv_push(::boost::move(tmp));
+   }
+
+   //Moves out the k claimed elements starting at pos and frees their slots for the next turn.
+   //Claimed slots must always be freed, even if an assignment throws.
+   template<class OutIt>
+   void priv_pop_slots(std::size_t pos, std::size_t k, OutIt out)
+   {
+      const std::size_t cap = m_storage.capacity();
+      std::size_t i = 0u;
+      BOOST_CONTAINER_TRY{
+         for(; i != k; ++i, ++out){
+            slot_t &s = this->priv_slot(pos + i);
+            T *const p = s.value();
+            *out = ::boost::move(*p);
+            p->~T();
+            s.seq.store(pos + i + cap, std::memory_order_release);
+         }
+      }
+      BOOST_CONTAINER_CATCH(...){
+         for(; i != k; ++i){
+            slot_t &s = this->priv_slot(pos + i);
+            s.value()->~T();
+            s.seq.store(pos + i + cap, std::memory_order_release);
+         }
+         BOOST_CONTAINER_RETHROW
+      }
+      BOOST_CONTAINER_CATCH_END
+   }
+
+   storage_t                        m_storage;
+   //Index of the next slot to be claimed by a producer
+   dtl::queue_index<void>           m_tail;
+   //Index of the next slot to be claimed by a consumer
+   dtl::queue_index<void>           m_head;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_MPMC_QUEUE_HPP
@@ -23,6 +23,7 @@
 #include <boost/container/detail/workaround.hpp>
 #include <boost/container/throw_exception.hpp>
 #include <boost/container/detail/operator_new_helpers.hpp>
+#include <boost/container/detail/allocation_type.hpp>
 #include <cstddef>
 
 //!\file
@@ -160,6 +161,17 @@ class new_allocator
       return dtl::operator_new_allocate<T>(count);
    }
 
+   //!Allocates memory for an array of at least count elements. As operator new offers
+   //!no way to obtain the usable size of the allocated storage, the returned count
+   //!is always equal to count (like C++23 `std::allocator::allocate_at_least`).
+   //!Throws bad_alloc if there is no enough memory
+   BOOST_CONTAINER_NODISCARD
+   allocation_result<pointer, size_type> allocate_at_least(size_type count)
+   {
+      allocation_result<pointer, size_type> ret = { this->allocate(count), count };
+      return ret;
+   }
+
    //!Deallocates previously allocated memory.
    //!Never throws
    void deallocate(pointer ptr, size_type n) BOOST_NOEXCEPT_OR_NOTHROW
@@ -204,7 +204,7 @@ class node_allocator
    size_type size(pointer p) const BOOST_NOEXCEPT_OR_NOTHROW
    {
       BOOST_CONTAINER_STATIC_ASSERT(( Version > 1 ));
-      return dlmalloc_size(p);
+      return dlmalloc_size(p)/sizeof(T);
    }
 
    //!Allocates just one object. Memory allocated with this function
@@ -265,6 +265,9 @@ struct growth_factor_60;
 
 struct growth_factor_100;
 
+template<class Tag>
+struct adaptive_growth_factor;
+
 #else
 
 //!This growth factor argument specifies that the container should increase its
@@ -279,6 +282,32 @@ struct growth_factor_60{};
 //!capacity a 100% (doubling its capacity) when existing capacity is exhausted.
 struct growth_factor_100{};
 
+//!This growth factor argument specifies that the container should adapt its growth
+//!to the observed usage of all containers using the same `Tag` (e.g. a type per call site):
+//!
+//!   * Growth starts aggressive (doubling the capacity).
+//!   * Each `shrink_to_fit` call that finds more than 25% of unused capacity backs off the growth
+//!     (60%, 50% and finally 25%) for all containers with the same `Tag`.
+//!   * After 64 growths without a new backoff, growth becomes more aggressive again.
+//!   * Capacities are rounded up to common allocation size classes (16 byte granules up to 128 bytes
+//!     and four classes per power of two above, as used by malloc implementations and pool resources),
+//!     so that the slack of the allocation is usable capacity.
+//!
+//!The shared state is updated with relaxed atomic operations (or plain integers in C++03).
+template<class Tag = void>
+struct adaptive_growth_factor
+{
+   //!Returns the current backoff level: 0 (100% growth) to 3 (25% growth).
+   static unsigned backoff_level();
+
+   //!Notifies that a container with `capacity` and `size` was shrunk to fit.
+   //!Containers call it automatically from `shrink_to_fit`.
+   static void on_shrink_to_fit(std::size_t capacity, std::size_t size);
+
+   //!Restores the initial, aggressive, growth.
+   static void reset();
+};
+
 #endif   // !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
 
 //!This option setter specifies the growth factor strategy of the
@@ -304,8 +333,9 @@ struct growth_factor_100{};
 //!
 //!Predefined growth factors that can be passed as arguments to this option are:
 //!\c boost::container::growth_factor_50,
-//!\c boost::container::growth_factor_60 and
-//!\c boost::container::growth_factor_100
+//!\c boost::container::growth_factor_60,
+//!\c boost::container::growth_factor_100 and
+//!\c boost::container::adaptive_growth_factor
 //!
 //!If this option is not specified, a default will be used by the container.
 BOOST_INTRUSIVE_OPTION_TYPE(growth_factor, GrowthFactor, GrowthFactor, growth_factor_type)
@@ -818,6 +848,125 @@ BOOST_INTRUSIVE_OPTION_CONSTANT(block_size, std::size_t, BlockSize, block_size)
 //!\tparam SegmentSize An unsigned integer value.
 BOOST_INTRUSIVE_OPTION_CONSTANT(segment_size, std::size_t, SegmentSize, block_size)
 
+////////////////////////////////////////////////////////////////
+//
+//
+//          OPTIONS FOR ROPE CONTAINER
+//
+//
+////////////////////////////////////////////////////////////////
+
+#if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+template<std::size_t BlockBytes, std::size_t BlockSize>
+struct rope_opt
+{
+   BOOST_STATIC_CONSTEXPR std::size_t block_bytes = BlockBytes;
+   BOOST_STATIC_CONSTEXPR std::size_t block_size  = BlockSize;
+   BOOST_CONTAINER_STATIC_ASSERT_MSG(!(block_bytes && block_size), "block_bytes and block_size can't be specified at the same time");
+};
+
+typedef rope_opt<0u, 0u> rope_null_opt;
+
+#endif
+
+//! Helper metafunction to combine options into a single type to be used
+//! by \c boost::container::basic_rope.
+//! Supported options are: \c boost::container::block_bytes / \c boost::container::segment_bytes and
+//! \c boost::container::block_size / \c boost::container::segment_size, that specify the maximum
+//! size of a chunk.
+#if defined(BOOST_CONTAINER_DOXYGEN_INVOKED) || defined(BOOST_CONTAINER_VARIADIC_TEMPLATES)
+template<class ...Options>
+#else
+template<class O1 = void, class O2 = void, class O3 = void, class O4 = void>
+#endif
+struct rope_options
+{
+   /// @cond
+   typedef typename ::boost::intrusive::pack_options
+      < rope_null_opt,
+      #if !defined(BOOST_CONTAINER_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4
+      #else
+      Options...
+      #endif
+      >::type packed_options;
+   typedef rope_opt< packed_options::block_bytes
+                   , packed_options::block_size
+                   > implementation_defined;
+   /// @endcond
+   typedef implementation_defined type;
+};
+
+#if !defined(BOOST_NO_CXX11_TEMPLATE_ALIASES)
+
+//! Helper alias metafunction to combine options into a single type to be used
+//! by \c boost::container::basic_rope.
+template<class ...Options>
+using rope_options_t = typename boost::container::rope_options<Options...>::type;
+
+#endif
+
+////////////////////////////////////////////////////////////////
+//
+//
+//          OPTIONS FOR FLAT_STRING_MAP CONTAINER
+//
+//
+////////////////////////////////////////////////////////////////
+
+#if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+template<class StoredSizeType>
+struct flat_string_map_opt
+{
+   typedef StoredSizeType  stored_size_type;
+
+   template<class AllocTraits>
+   struct get_stored_size_type
+      : get_stored_size_type_with_alloctraits<AllocTraits, StoredSizeType>
+   {};
+};
+
+typedef flat_string_map_opt<void> flat_string_map_null_opt;
+
+#endif
+
+//! Helper metafunction to combine options into a single type to be used
+//! by \c boost::container::flat_string_map.
+//! Supported options are: \c boost::container::stored_size, that specifies the type used
+//! to store the offset and the length of each key. A 32 bit type limits the total size
+//! of the keys to 4GB, but reduces the per-key overhead in 64 bit machines.
+#if defined(BOOST_CONTAINER_DOXYGEN_INVOKED) || defined(BOOST_CONTAINER_VARIADIC_TEMPLATES)
+template<class ...Options>
+#else
+template<class O1 = void, class O2 = void, class O3 = void, class O4 = void>
+#endif
+struct flat_string_map_options
+{
+   /// @cond
+   typedef typename ::boost::intrusive::pack_options
+      < flat_string_map_null_opt,
+      #if !defined(BOOST_CONTAINER_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4
+      #else
+      Options...
+      #endif
+      >::type packed_options;
+   typedef flat_string_map_opt<typename packed_options::stored_size_type> implementation_defined;
+   /// @endcond
+   typedef implementation_defined type;
+};
+
+#if !defined(BOOST_NO_CXX11_TEMPLATE_ALIASES)
+
+//! Helper alias metafunction to combine options into a single type to be used
+//! by \c boost::container::flat_string_map.
+template<class ...Options>
+using flat_string_map_options_t = typename boost::container::flat_string_map_options<Options...>::type;
+
+#endif
+
 #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 
 //!This option specifies if the container has reserve/capacity-like features
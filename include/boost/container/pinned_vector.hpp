@@ -0,0 +1,530 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_PINNED_VECTOR_HPP
+#define BOOST_CONTAINER_PINNED_VECTOR_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#if !defined(BOOST_HAS_UNISTD_H)
+#  error "boost::container::pinned_vector requires a POSIX system"
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/mmap_allocator.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/container/detail/allocation_type.hpp>
+#include <boost/container/detail/version_type.hpp>
+#include <boost/container/detail/multiallocation_chain.hpp>
+#include <boost/container/detail/type_traits.hpp>
+#include <boost/container/throw_exception.hpp>
+#include <boost/move/utility_core.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+#include <initializer_list>
+#endif
+
+#include <cstddef>
+#include <unistd.h>
+#include <sys/mman.h>
+
+//!\file
+
+namespace boost {
+namespace container {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace dtl {
+
+//Each reservation starts with a header that stores the size of the reserved address
+//range and the size of its prefix that is currently accessible.
+struct pinned_allocator_header
+{
+   std::size_t reserved;
+   std::size_t committed;
+};
+
+}  //namespace dtl {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! This class is an extended (version 2) allocator that reserves a fixed range of virtual
+//! addresses for each buffer and only commits (makes accessible) the pages that are needed.
+//! The size of the range is fixed at construction (see `max_capacity()`).
+//!
+//! - A new allocation reserves the whole range without backing memory and commits the pages
+//!   needed for the requested size.
+//! - Forward expansion (`expand_fwd`) commits more pages of the range, so it always succeeds
+//!   in place while the range is not exhausted. A buffer is never moved: `allow_relocation`
+//!   is ignored and, if `reuse` can't be expanded, no new buffer is allocated.
+//! - Shrinking in place (`shrink_in_place`) returns the tail pages to the system keeping the range.
+//!
+//! Memory allocated by an instance can be deallocated by any other instance, but the number
+//! of elements a buffer can hold is fixed when the buffer is allocated. For that reason the
+//! allocator is propagated on move assignment and swap, but not on copy assignment.
+//!
+//! This allocator is the building block of [classref boost::container::pinned_vector pinned_vector].
+template<class T>
+class pinned_allocator
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   typedef pinned_allocator<T>            self_t;
+   typedef dtl::pinned_allocator_header   header_t;
+
+   template<class T2>
+   friend class pinned_allocator;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   typedef T                                    value_type;
+   typedef T *                                  pointer;
+   typedef const T *                            const_pointer;
+   typedef T &                                  reference;
+   typedef const T &                            const_reference;
+   typedef std::size_t                          size_type;
+   typedef std::ptrdiff_t                       difference_type;
+
+   typedef boost::container::dtl::
+      version_type<self_t, 2>                   version;
+
+   typedef dtl::false_type                      propagate_on_container_copy_assignment;
+   typedef dtl::true_type                       propagate_on_container_move_assignment;
+   typedef dtl::true_type                       propagate_on_container_swap;
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   typedef boost::container::dtl::
+         basic_multiallocation_chain<void*>     void_multiallocation_chain;
+
+   typedef boost::container::dtl::
+      transform_multiallocation_chain
+         <void_multiallocation_chain, T>        multiallocation_chain;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   //!Obtains an allocator that allocates
+   //!objects of type T2
+   template<class T2>
+   struct rebind
+   {
+      typedef pinned_allocator<T2> other;
+   };
+
+   //!Constructs an allocator that can't allocate any element.
+   //!Never throws
+   pinned_allocator() BOOST_NOEXCEPT_OR_NOTHROW
+      : m_reserved(0u)
+   {}
+
+   //!Constructs an allocator whose buffers can hold up to max_capacity elements.
+   //!Throws length_error if the range can't be represented
+   explicit pinned_allocator(size_type max_capacity)
+      : m_reserved(priv_reservation_bytes(max_capacity))
+   {
+      if(max_capacity && !m_reserved)
+         boost::container::throw_length_error("pinned_allocator, reservation too big");
+   }
+
+   //!Constructor from related allocator: reserves the same number of bytes per buffer.
+   //!Never throws
+   template<class T2>
+   pinned_allocator(const pinned_allocator<T2> &other) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_reserved(other.m_reserved)
+   {}
+
+   //!Returns the number of elements a buffer allocated by this allocator can hold.
+   //!Never throws
+   BOOST_CONTAINER_NODISCARD size_type max_capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_reserved ? priv_capacity(m_reserved) : 0u;  }
+
+   //!Reserves a range for max_capacity() elements and commits memory for count elements.
+   //!Throws bad_alloc if there is no enough memory
+   BOOST_CONTAINER_NODISCARD pointer allocate(size_type count)
+   {
+      pointer const p = this->priv_map(count);
+      if(!p)
+         boost::container::throw_bad_alloc();
+      return p;
+   }
+
+   //!Reserves a range for max_capacity() elements and commits memory for at least count elements.
+   //!The returned count includes the tail of the last committed page.
+   //!Throws bad_alloc if there is no enough memory
+   BOOST_CONTAINER_NODISCARD allocation_result<pointer, size_type> allocate_at_least(size_type count)
+   {
+      allocation_result<pointer, size_type> ret = { this->allocate(count), 0u };
+      ret.count = this->size(ret.ptr);
+      return ret;
+   }
+
+   //!Releases the whole range reserved for ptr.
+   //!Never throws
+   void deallocate(pointer ptr, size_type) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(ptr){
+         header_t *const h = priv_header(ptr);
+         ::munmap(static_cast<void*>(h), h->reserved);
+      }
+   }
+
+   //!Returns max_capacity().
+   //!Never throws
+   BOOST_CONTAINER_NODISCARD size_type max_size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->max_capacity();   }
+
+   //!Returns the number of objects the committed memory of p can hold.
+   BOOST_CONTAINER_NODISCARD size_type size(pointer p) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return priv_capacity(priv_header(p)->committed);  }
+
+   //!An advanced function that offers in-place forward expansion, shrink in place and
+   //!new allocation capabilities. `expand_bwd` and `allow_relocation` requests are ignored.
+   //!
+   //!If `expand_fwd` is requested and `reuse` is not null, more pages of the reserved range are
+   //!committed to hold `prefer_in_recvd_out_size` elements or, failing that, `limit_size` elements.
+   //!If that's not possible null is returned (or bad_alloc is thrown) even if `allocate_new` was
+   //!requested, as the buffer must not change its address.
+   //!If `shrink_in_place` or `try_shrink_in_place` is requested, the pages not needed to hold
+   //!`prefer_in_recvd_out_size` elements are decommitted. Otherwise, if `allocate_new` is requested
+   //!and `reuse` is null, a new range is reserved.
+   //!
+   //!On success, `prefer_in_recvd_out_size` holds the number of elements the buffer can hold.
+   //!If no command succeeds, returns null if `nothrow_allocation` was requested or throws bad_alloc.
+   BOOST_CONTAINER_NODISCARD pointer allocation_command(allocation_type command,
+                         size_type limit_size,
+                         size_type &prefer_in_recvd_out_size,
+                         pointer &reuse)
+   {
+      pointer ret = this->priv_allocation_command(command, limit_size, prefer_in_recvd_out_size, reuse);
+      if(!ret && !(command & nothrow_allocation))
+         boost::container::throw_bad_alloc();
+      return ret;
+   }
+
+   //!Swaps two allocators
+   inline friend void swap(self_t &l, self_t &r) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const std::size_t tmp = l.m_reserved;
+      l.m_reserved = r.m_reserved;
+      r.m_reserved = tmp;
+   }
+
+   //!An allocator always compares to true, as memory allocated with one
+   //!instance can be deallocated by another instance
+   BOOST_CONTAINER_NODISCARD
+      friend bool operator==(const pinned_allocator &, const pinned_allocator &) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return true;   }
+
+   //!An allocator always compares to false, as memory allocated with one
+   //!instance can be deallocated by another instance
+   BOOST_CONTAINER_NODISCARD
+      friend bool operator!=(const pinned_allocator &, const pinned_allocator &) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return false;   }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   std::size_t m_reserved;
+
+   static std::size_t priv_page_size()
+   {  return dtl::mmap_allocator_page_size<0>::get();  }
+
+   //Data starts after the header, respecting T's and the fundamental alignment
+   static std::size_t priv_data_offset()
+   {
+      const std::size_t a = dtl::alignment_of<T>::value > dtl::alignment_of<dtl::max_align_t>::value
+         ? dtl::alignment_of<T>::value : dtl::alignment_of<dtl::max_align_t>::value;
+      return (sizeof(header_t) + (a - 1u)) & ~(a - 1u);
+   }
+
+   //Page-rounded size needed to hold n elements, 0 on overflow
+   static std::size_t priv_reservation_bytes(size_type n)
+   {
+      const std::size_t max = size_type(-1)/2u - priv_data_offset() - priv_page_size();
+      if(n > max/sizeof(T))
+         return 0u;
+      const std::size_t page = priv_page_size();
+      return (priv_data_offset() + n*sizeof(T) + (page - 1u)) & ~(page - 1u);
+   }
+
+   static size_type priv_capacity(std::size_t bytes)
+   {  return size_type((bytes - priv_data_offset())/sizeof(T));  }
+
+   static header_t *priv_header(pointer p)
+   {  return reinterpret_cast<header_t*>(reinterpret_cast<char*>(p) - priv_data_offset());  }
+
+   static pointer priv_data(void *mapping)
+   {  return reinterpret_cast<pointer>(static_cast<char*>(mapping) + priv_data_offset());  }
+
+   pointer priv_map(size_type n) const
+   {
+      const std::size_t bytes = priv_reservation_bytes(n);
+      if(!bytes || bytes > m_reserved)
+         return pointer();
+      #if defined(MAP_NORESERVE)
+      const int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+      #else
+      const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+      #endif
+      //Inaccessible pages don't consume memory nor count against the commit limit
+      void *const m = ::mmap(0, m_reserved, PROT_NONE, flags, -1, 0);
+      if(m == MAP_FAILED)
+         return pointer();
+      if(0 != ::mprotect(m, bytes, PROT_READ | PROT_WRITE)){
+         ::munmap(m, m_reserved);
+         return pointer();
+      }
+      header_t *const h = static_cast<header_t*>(m);
+      h->reserved  = m_reserved;
+      h->committed = bytes;
+      return priv_data(m);
+   }
+
+   //Commits or decommits the pages after the first new_bytes bytes of the range
+   static bool priv_commit(pointer p, std::size_t new_bytes)
+   {
+      header_t *const h = priv_header(p);
+      const std::size_t old_bytes = h->committed;
+      char *const base = reinterpret_cast<char*>(h);
+      if(!new_bytes || new_bytes > h->reserved){
+         return false;
+      }
+      else if(new_bytes > old_bytes){
+         if(0 != ::mprotect(base + old_bytes, new_bytes - old_bytes, PROT_READ | PROT_WRITE))
+            return false;
+      }
+      else if(new_bytes < old_bytes){
+         if(0 != ::mprotect(base + new_bytes, old_bytes - new_bytes, PROT_NONE))
+            return false;
+         ::madvise(base + new_bytes, old_bytes - new_bytes, MADV_DONTNEED);
+      }
+      h->committed = new_bytes;
+      return true;
+   }
+
+   pointer priv_allocation_command
+      (allocation_type command, size_type limit_size, size_type &prefer_in_recvd_out_size, pointer &reuse)
+   {
+      const size_type preferred_size = prefer_in_recvd_out_size;
+      if(reuse && (command & (shrink_in_place | try_shrink_in_place))){
+         const std::size_t old_bytes = priv_header(reuse)->committed;
+         const std::size_t new_bytes = priv_reservation_bytes(preferred_size);
+         if(new_bytes && new_bytes < old_bytes && priv_commit(reuse, new_bytes)){
+            prefer_in_recvd_out_size = priv_capacity(new_bytes);
+            return reuse;
+         }
+         prefer_in_recvd_out_size = priv_capacity(old_bytes);
+         return (command & try_shrink_in_place) ? reuse : pointer();
+      }
+
+      if(reuse){
+         if(command & expand_fwd){
+            const header_t &h = *priv_header(reuse);
+            //Already enough?
+            if(priv_capacity(h.committed) >= limit_size){
+               prefer_in_recvd_out_size = priv_capacity(h.committed);
+               return reuse;
+            }
+            //Commit the preferred size, clamped to the reserved range
+            std::size_t new_bytes = priv_reservation_bytes(preferred_size);
+            if(!new_bytes || new_bytes > h.reserved)
+               new_bytes = h.reserved;
+            if(priv_capacity(new_bytes) >= limit_size && priv_commit(reuse, new_bytes)){
+               prefer_in_recvd_out_size = priv_capacity(new_bytes);
+               return reuse;
+            }
+         }
+         //The buffer can't be moved so don't allocate a new one
+         return pointer();
+      }
+
+      if(command & allocate_new){
+         pointer ret = priv_map(preferred_size);
+         if(!ret && limit_size < preferred_size)
+            ret = priv_map(limit_size);
+         if(ret){
+            prefer_in_recvd_out_size = priv_capacity(priv_header(ret)->committed);
+            reuse = pointer();
+            return ret;
+         }
+      }
+      return pointer();
+   }
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+//! pinned_vector is a vector-like container whose elements never change their address.
+//!
+//! On construction, the container is given its maximum capacity. The first allocation reserves
+//! a range of virtual addresses big enough for that capacity, but physical memory is only committed
+//! as elements are inserted. As the buffer always grows in place, pointers, references and iterators
+//! to elements are not invalidated by insertions at the end (`push_back`, `emplace_back`, `resize`,
+//! `reserve`...), and elements are never copied or moved on growth.
+//!
+//! Growing beyond the maximum capacity throws `length_error`. Erasing all elements and calling
+//! `shrink_to_fit` releases the reservation.
+//!
+//! pinned_vector publicly derives from [classref boost::container::vector vector] using a
+//! [classref boost::container::pinned_allocator pinned_allocator], so all vector operations are available.
+//!
+//! \tparam T The type of object that is stored in the pinned_vector
+//! \tparam Options A type produced from \c boost::container::vector_options.
+template <class T, class Options BOOST_CONTAINER_DOCONLY(= void) >
+class pinned_vector
+   : public vector<T, pinned_allocator<T>, Options>
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   BOOST_COPYABLE_AND_MOVABLE(pinned_vector)
+
+   typedef vector<T, pinned_allocator<T>, Options> base_type;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   typedef typename base_type::allocator_type   allocator_type;
+   typedef typename base_type::size_type        size_type;
+   typedef typename base_type::value_type       value_type;
+
+   //! <b>Effects</b>: Constructs an empty pinned_vector with a zero maximum capacity.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline pinned_vector() BOOST_NOEXCEPT_OR_NOTHROW
+      : base_type()
+   {}
+
+   //! <b>Effects</b>: Constructs an empty pinned_vector that can hold up to max_capacity elements.
+   //!   No memory is reserved until the first insertion.
+   //!
+   //! <b>Throws</b>: length_error if max_capacity is too big.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline explicit pinned_vector(size_type max_capacity)
+      : base_type(allocator_type(max_capacity))
+   {}
+
+   //! <b>Effects</b>: Constructs a pinned_vector that can hold up to max_capacity elements
+   //!   and inserts n value-initialized elements.
+   //!
+   //! <b>Throws</b>: length_error if n > max_capacity, if allocation throws or T's value initialization throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   inline pinned_vector(size_type max_capacity, size_type n)
+      : base_type(n, allocator_type(max_capacity))
+   {}
+
+   //! <b>Effects</b>: Constructs a pinned_vector that can hold up to max_capacity elements
+   //!   and inserts n copies of v.
+   //!
+   //! <b>Throws</b>: length_error if n > max_capacity, if allocation throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   inline pinned_vector(size_type max_capacity, size_type n, const value_type &v)
+      : base_type(n, v, allocator_type(max_capacity))
+   {}
+
+   //! <b>Effects</b>: Constructs a pinned_vector that can hold up to max_capacity elements
+   //!   with a copy of the range [first, last).
+   //!
+   //! <b>Throws</b>: length_error if the range does not fit, if allocation throws or T's
+   //!   constructor from a dereferenced InIt throws.
+   //!
+   //! <b>Complexity</b>: Linear to the distance between first and last.
+   template <class InIt>
+   inline pinned_vector(size_type max_capacity, InIt first, InIt last
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename dtl::disable_if_c
+         < dtl::is_convertible<InIt BOOST_MOVE_I size_type>::value
+         BOOST_MOVE_I dtl::nat >::type * = 0)
+      )
+      : base_type(first, last, allocator_type(max_capacity))
+   {}
+
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   //! <b>Effects</b>: Constructs a pinned_vector that can hold up to max_capacity elements
+   //!   with a copy of the elements in il.
+   //!
+   //! <b>Throws</b>: length_error if il does not fit, if allocation throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to il.size().
+   inline pinned_vector(size_type max_capacity, std::initializer_list<value_type> il)
+      : base_type(il, allocator_type(max_capacity))
+   {}
+   #endif
+
+   //! <b>Effects</b>: Copy constructs a pinned_vector with the same maximum capacity as other.
+   //!
+   //! <b>Throws</b>: If allocation throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to other.size().
+   inline pinned_vector(const pinned_vector &other)
+      : base_type(static_cast<const base_type&>(other))
+   {}
+
+   //! <b>Effects</b>: Move constructs a pinned_vector, stealing other's buffer. Addresses of elements
+   //!   are preserved.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline pinned_vector(BOOST_RV_REF(pinned_vector) other) BOOST_NOEXCEPT_OR_NOTHROW
+      : base_type(BOOST_MOVE_BASE(base_type, other))
+   {}
+
+   //! <b>Effects</b>: Makes *this contain the same elements as other. The maximum capacity of *this is kept.
+   //!
+   //! <b>Throws</b>: length_error if other.size() > max_capacity(), if allocation throws or T's copy
+   //!   constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in other.
+   inline pinned_vector& operator=(BOOST_COPY_ASSIGN_REF(pinned_vector) other)
+   {  return static_cast<pinned_vector&>(this->base_type::operator=(static_cast<const base_type&>(other)));  }
+
+   //! <b>Effects</b>: Move assignment. Transfers other's buffer and maximum capacity to *this.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in *this (destroyed).
+   inline pinned_vector& operator=(BOOST_RV_REF(pinned_vector) other) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return static_cast<pinned_vector&>(this->base_type::operator=(BOOST_MOVE_BASE(base_type, other)));  }
+
+   //! <b>Effects</b>: Swaps the contents and maximum capacities of *this and other.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline void swap(pinned_vector &other) BOOST_NOEXCEPT_OR_NOTHROW
+   {  this->base_type::swap(other);  }
+
+   //! <b>Effects</b>: x.swap(y)
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline friend void swap(pinned_vector &x, pinned_vector &y) BOOST_NOEXCEPT_OR_NOTHROW
+   {  x.swap(y);  }
+
+   //! <b>Effects</b>: Returns the maximum number of elements the container can hold.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline size_type max_capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->get_stored_allocator().max_capacity();  }
+};
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_PINNED_VECTOR_HPP
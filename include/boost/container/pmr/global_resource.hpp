@@ -54,6 +54,16 @@ BOOST_CONTAINER_DECL memory_resource* set_default_resource(memory_resource* r) B
 //!   memory resource pointer.
 BOOST_CONTAINER_NODISCARD BOOST_CONTAINER_DECL memory_resource* get_default_resource() BOOST_NOEXCEPT;
 
+//! <b>Returns</b>: The number of bytes, equal or greater than `bytes`, that `r` reserves
+//!   to serve `r.allocate(bytes, alignment)`: `r.allocation_size(bytes, alignment)` if `r`
+//!   is a `synchronized_pool_resource` or an `unsynchronized_pool_resource`, `bytes` otherwise.
+//!
+//! <b>Note</b>: Non-standard extension used by `polymorphic_allocator::allocate_at_least`
+//!   (see `BOOST_CONTAINER_PMR_ALLOCATE_AT_LEAST`). The resource type is obtained with
+//!   `dynamic_cast`, so if the library is compiled without RTTI `bytes` is always returned.
+BOOST_CONTAINER_NODISCARD BOOST_CONTAINER_DECL std::size_t allocation_size
+   (const memory_resource &r, std::size_t bytes, std::size_t alignment) BOOST_NOEXCEPT;
+
 }  //namespace pmr {
 }  //namespace container {
 }  //namespace boost {
@@ -26,6 +26,10 @@
 
 #include <cstddef>
 
+#if defined(BOOST_CONTAINER_PMR_ALLOCATE_AT_LEAST) && defined(BOOST_NO_RTTI)
+#error "BOOST_CONTAINER_PMR_ALLOCATE_AT_LEAST requires RTTI to query pool resources"
+#endif
+
 namespace boost {
 namespace container {
 namespace pmr {
@@ -81,6 +85,27 @@ class polymorphic_allocator
    BOOST_CONTAINER_NODISCARD T* allocate(size_t n)
    {  return static_cast<T*>(m_resource->allocate(n*sizeof(T), ::boost::move_detail::alignment_of<T>::value));  }
 
+   #if defined(BOOST_CONTAINER_PMR_ALLOCATE_AT_LEAST) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //! <b>Returns</b>: Equivalent to
+   //!   `{allocate(c), c}` where `c` is the number of `T` objects that fit in
+   //!   `pmr::allocation_size(*m_resource, n * sizeof(T), alignof(T))` bytes.
+   //!
+   //! <b>Note</b>: Non-standard extension, only available if `BOOST_CONTAINER_PMR_ALLOCATE_AT_LEAST`
+   //!   is defined, as querying the resource costs a `dynamic_cast` per allocation.
+   //!   The storage must be deallocated passing the returned count.
+   BOOST_CONTAINER_NODISCARD allocation_result<T*, size_t> allocate_at_least(size_t n)
+   {
+      const size_t align = ::boost::move_detail::alignment_of<T>::value;
+      size_t c = n;
+      if(n <= size_t(-1)/sizeof(T)){
+         c = pmr::allocation_size(*m_resource, n*sizeof(T), align)/sizeof(T);
+         c = c < n ? n : c;
+      }
+      allocation_result<T*, size_t> ret = { this->allocate(c), c };
+      return ret;
+   }
+   #endif   //#if defined(BOOST_CONTAINER_PMR_ALLOCATE_AT_LEAST)
+
    //! <b>Requires</b>: p was allocated from a memory resource, x, equal to *m_resource,
    //! using `x.allocate(n * sizeof(T), alignof(T))`.
    //!
@@ -114,6 +114,9 @@ class BOOST_CONTAINER_DECL synchronized_pool_resource
    //Non-standard observers
    public:
    
+   //! @copydoc ::boost::container::pmr::unsynchronized_pool_resource::allocation_size(std::size_t,std::size_t)const
+   std::size_t allocation_size(std::size_t bytes, std::size_t alignment = max_align) const BOOST_NOEXCEPT;
+   
    //! @copydoc ::boost::container::pmr::unsynchronized_pool_resource::pool_count()
    std::size_t pool_count() const;
 
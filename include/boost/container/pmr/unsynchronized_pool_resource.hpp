@@ -149,6 +149,12 @@ class BOOST_CONTAINER_DECL unsynchronized_pool_resource
 
    //Non-standard observers
    public:
+   //! <b>Returns</b>: The size of the blocks of the pool selected to serve `bytes`
+   //!   or `bytes` if `bytes` is larger than that which the largest pool can handle.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   std::size_t allocation_size(std::size_t bytes, std::size_t alignment = max_align) const BOOST_NOEXCEPT;
+
    //! <b>Returns</b>: The number of pools that will be used in the pool resource.
    //!
    //! <b>Note</b>: Non-standard extension.
@@ -0,0 +1,1929 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_ROPE_HPP
+#define BOOST_CONTAINER_ROPE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#if defined(BOOST_NO_CXX11_HDR_ATOMIC)
+#error "boost/container/rope.hpp requires C++11 atomics"
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+#include <boost/assert.hpp>
+
+// container
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/new_allocator.hpp>
+#include <boost/container/options.hpp>
+#include <boost/container/string.hpp>
+#include <boost/container/throw_exception.hpp>
+// container/detail
+#include <boost/container/detail/alloc_helpers.hpp>
+#include <boost/container/detail/iterator.hpp>
+#include <boost/container/detail/min_max.hpp>
+#include <boost/container/detail/minimal_char_traits_header.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/placement_new.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// intrusive
+#include <boost/intrusive/pointer_traits.hpp>
+// move
+#include <boost/move/adl_move_swap.hpp>
+#include <boost/move/utility_core.hpp>
+#include <boost/move/detail/to_raw_pointer.hpp>
+// std
+#include <atomic>
+#include <cstddef>
+#include <ostream>
+
+namespace boost {
+namespace container {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+template<class Options>
+struct get_rope_opt
+{
+   typedef rope_opt<Options::block_bytes, Options::block_size> type;
+};
+
+template<>
+struct get_rope_opt<void>
+{
+   typedef rope_null_opt type;
+};
+
+namespace dtl {
+
+//Maximum number of characters of a chunk. 1KB by default.
+template<class CharT, class Options>
+struct rope_chunk_size
+{
+   BOOST_STATIC_CONSTEXPR std::size_t bytes = Options::block_bytes ? Options::block_bytes : 1024u;
+   BOOST_STATIC_CONSTEXPR std::size_t value = Options::block_size ? Options::block_size
+                                            : (bytes < sizeof(CharT) ? 1u : bytes/sizeof(CharT));
+};
+
+//Node of the concatenation tree of basic_rope. Leaves (height zero) store up to "capacity"
+//characters just after the node, inner nodes store the sum of the sizes of their children.
+//The tree is an AVL tree: the height of the children of a node differs at most in one.
+//Nodes are reference counted and can be shared between ropes: a shared node is never modified.
+template<class VoidPointer, class SizeType>
+struct rope_node
+{
+   typedef typename boost::intrusive::pointer_traits<VoidPointer>::template
+      rebind_pointer<rope_node>::type                                   node_ptr;
+
+   explicit rope_node(SizeType cap)
+      : refs(1u), size(0u), capacity(cap), height(0u), left(), right()
+   {}
+
+   rope_node(const node_ptr &l, const node_ptr &r)
+      : refs(1u), size(SizeType(l->size + r->size)), capacity(0u)
+      , height(1u + (l->height < r->height ? r->height : l->height)), left(l), right(r)
+   {}
+
+   std::atomic<std::size_t>   refs;
+   SizeType                   size;
+   SizeType                   capacity;
+   unsigned                   height;
+   node_ptr                   left;
+   node_ptr                   right;
+};
+
+//Iterator of basic_rope. It stores the position and caches the chunk that contains it,
+//so that dereferencing is constant time while the position stays in the same chunk.
+template<class Rope>
+class rope_iterator
+{
+   typedef typename Rope::size_type                size_type;
+
+   public:
+   typedef std::random_access_iterator_tag         iterator_category;
+   typedef typename Rope::value_type               value_type;
+   typedef typename Rope::difference_type          difference_type;
+   typedef const value_type *                      pointer;
+   typedef const value_type &                      reference;
+
+   inline rope_iterator() BOOST_NOEXCEPT_OR_NOTHROW
+      : m_rope(), m_pos(0u), m_chars(), m_first(0u), m_last(0u)
+   {}
+
+   inline rope_iterator(const Rope *r, size_type pos) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_rope(r), m_pos(pos), m_chars(), m_first(0u), m_last(0u)
+   {}
+
+   //! <b>Returns</b>: The position of the iterator in the rope.
+   inline size_type position() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_pos;  }
+
+   BOOST_CONTAINER_NODISCARD reference operator*() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      //Unsigned arithmetic: true if m_pos is not in [m_first, m_last)
+      if(size_type(m_pos - m_first) >= size_type(m_last - m_first)){
+         m_rope->priv_chunk_at(m_pos, m_chars, m_first, m_last);
+      }
+      return m_chars[m_pos - m_first];
+   }
+
+   BOOST_CONTAINER_NODISCARD inline pointer operator->() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return &**this;  }
+
+   BOOST_CONTAINER_NODISCARD inline reference operator[](difference_type off) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return *(*this + off);  }
+
+   inline rope_iterator& operator++() BOOST_NOEXCEPT_OR_NOTHROW
+   {  ++m_pos; return *this;  }
+
+   inline rope_iterator operator++(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {  rope_iterator tmp(*this); ++m_pos; return tmp;  }
+
+   inline rope_iterator& operator--() BOOST_NOEXCEPT_OR_NOTHROW
+   {  --m_pos; return *this;  }
+
+   inline rope_iterator operator--(int) BOOST_NOEXCEPT_OR_NOTHROW
+   {  rope_iterator tmp(*this); --m_pos; return tmp;  }
+
+   inline rope_iterator& operator+=(difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
+   {  m_pos = size_type(difference_type(m_pos) + off); return *this;  }
+
+   inline rope_iterator& operator-=(difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
+   {  m_pos = size_type(difference_type(m_pos) - off); return *this;  }
+
+   BOOST_CONTAINER_NODISCARD inline friend rope_iterator operator+(rope_iterator it, difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return it += off;  }
+
+   BOOST_CONTAINER_NODISCARD inline friend rope_iterator operator+(difference_type off, rope_iterator it) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return it += off;  }
+
+   BOOST_CONTAINER_NODISCARD inline friend rope_iterator operator-(rope_iterator it, difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return it -= off;  }
+
+   BOOST_CONTAINER_NODISCARD inline friend difference_type operator-(const rope_iterator &l, const rope_iterator &r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return difference_type(l.m_pos) - difference_type(r.m_pos);  }
+
+   BOOST_CONTAINER_NODISCARD inline friend bool operator==(const rope_iterator &l, const rope_iterator &r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos == r.m_pos;  }
+
+   BOOST_CONTAINER_NODISCARD inline friend bool operator!=(const rope_iterator &l, const rope_iterator &r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos != r.m_pos;  }
+
+   BOOST_CONTAINER_NODISCARD inline friend bool operator<(const rope_iterator &l, const rope_iterator &r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos < r.m_pos;  }
+
+   BOOST_CONTAINER_NODISCARD inline friend bool operator>(const rope_iterator &l, const rope_iterator &r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos > r.m_pos;  }
+
+   BOOST_CONTAINER_NODISCARD inline friend bool operator<=(const rope_iterator &l, const rope_iterator &r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos <= r.m_pos;  }
+
+   BOOST_CONTAINER_NODISCARD inline friend bool operator>=(const rope_iterator &l, const rope_iterator &r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return l.m_pos >= r.m_pos;  }
+
+   private:
+   const Rope *               m_rope;
+   size_type                  m_pos;
+   mutable const value_type * m_chars;
+   mutable size_type          m_first;
+   mutable size_type          m_last;
+};
+
+}  //namespace dtl {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! A basic_rope is a sequence of characters stored in reference counted chunks, designed
+//! for large strings that are built by concatenation or edited in the middle.
+//!
+//! Chunks are the leaves of a balanced (AVL) concatenation tree, and trees are shared between
+//! ropes: copying a rope, concatenating two ropes or obtaining a substring does not copy characters
+//! (only the chunks that are split at the ends of the range). Concatenation, substr, insert and erase are
+//! logarithmic. Characters appended with append or push_back are written in place in the last chunk
+//! (the tail), which is linked to the tree when it is full, so appending is amortized constant time plus
+//! the copy of the appended characters.
+//!
+//! Characters can't be modified through iterators or references: all iterators are constant.
+//! Element access is logarithmic, but iterators cache the chunk they point to, so
+//! traversals are linear. for_each_chunk passes each chunk as a pointer and a size to a function object,
+//! which can be used to write the contents of the rope without copying it to a contiguous buffer.
+//!
+//! Reference counts are atomic: two ropes that share chunks can be used concurrently from different
+//! threads. Chunks are only shared between ropes whose allocators compare equal, otherwise characters are copied.
+//!
+//! \tparam CharT The type of character it contains.
+//! \tparam Traits The Character Traits type, which encapsulates basic character operations
+//! \tparam Allocator The allocator, used to allocate the nodes of the tree. Use void for the default allocator.
+//! \tparam Options A type produced from \c boost::container::rope_options. The maximum size of a chunk can be
+//!   specified with \c block_bytes or \c block_size. The default is 1KB.
+template <class CharT, class Traits BOOST_CONTAINER_DOCONLY(= std::char_traits<CharT>), class Allocator BOOST_CONTAINER_DOCONLY(= void), class Options BOOST_CONTAINER_DOCONLY(= void)>
+class basic_rope
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   typedef boost::container::allocator_traits
+      <typename real_allocator<CharT, Allocator>::type>                          allocator_traits_type;
+   typedef typename allocator_traits_type::void_pointer                          void_pointer;
+   typedef typename allocator_traits_type::size_type                             alloc_size_type;
+   typedef dtl::rope_node<void_pointer, alloc_size_type>                         node_t;
+   typedef typename node_t::node_ptr                                             node_ptr;
+   typedef typename allocator_traits_type::template
+      portable_rebind_alloc<node_t>::type                                        node_allocator_type;
+   typedef boost::container::allocator_traits<node_allocator_type>              node_alloc_traits;
+   typedef typename get_rope_opt<Options>::type                                  options_type;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //                    types
+   //
+   //////////////////////////////////////////////
+   typedef Traits                                                                traits_type;
+   typedef CharT                                                                 value_type;
+   typedef BOOST_CONTAINER_IMPDEF
+      (typename real_allocator<CharT BOOST_MOVE_I Allocator>::type)              allocator_type;
+   typedef typename allocator_traits<allocator_type>::size_type                  size_type;
+   typedef typename allocator_traits<allocator_type>::difference_type            difference_type;
+   typedef const CharT &                                                         reference;
+   typedef const CharT &                                                         const_reference;
+   typedef const CharT *                                                         pointer;
+   typedef const CharT *                                                         const_pointer;
+   typedef BOOST_CONTAINER_IMPDEF(dtl::rope_iterator<basic_rope>)                const_iterator;
+   typedef const_iterator                                                        iterator;
+   typedef BOOST_CONTAINER_IMPDEF
+      (boost::container::reverse_iterator<const_iterator>)                      const_reverse_iterator;
+   typedef const_reverse_iterator                                                reverse_iterator;
+   typedef basic_string<CharT, Traits, Allocator>                                string_type;
+
+   static const size_type npos = size_type(-1);
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   BOOST_COPYABLE_AND_MOVABLE(basic_rope)
+
+   friend class dtl::rope_iterator<basic_rope>;
+
+   BOOST_CONTAINER_STATIC_ASSERT_MSG(dtl::alignment_of<CharT>::value <= dtl::alignment_of<node_t>::value,
+                                     "Characters are stored after the node, they can't be overaligned");
+
+   static const size_type chunk_size = size_type(dtl::rope_chunk_size<CharT, options_type>::value);
+
+   //Releases the node stored in the referenced variable, if any, when destroyed
+   class node_guard
+   {
+      public:
+      node_guard(basic_rope &r, node_ptr &n)
+         : m_r(r), m_n(n)
+      {}
+
+      ~node_guard()
+      {  m_r.priv_release(m_n);  }
+
+      private:
+      basic_rope &m_r;
+      node_ptr &m_n;
+   };
+
+   //Sources of characters
+   class ptr_source
+   {
+      public:
+      explicit ptr_source(const CharT *s)
+         : m_s(s)
+      {}
+
+      void copy(CharT *d, size_type n)
+      {  Traits::copy(d, m_s, n); m_s += n;  }
+
+      private:
+      const CharT *m_s;
+   };
+
+   class fill_source
+   {
+      public:
+      explicit fill_source(CharT c)
+         : m_c(c)
+      {}
+
+      void copy(CharT *d, size_type n)
+      {  Traits::assign(d, n, m_c);  }
+
+      private:
+      CharT m_c;
+   };
+
+   //Appends chunks to a rope
+   class appender
+   {
+      public:
+      explicit appender(basic_rope &r)
+         : m_r(r)
+      {}
+
+      void operator()(const CharT *s, size_type n)
+      {  m_r.append(s, n);  }
+
+      private:
+      basic_rope &m_r;
+   };
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   //////////////////////////////////////////////
+   //
+   //          construct/copy/destroy
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Constructs an empty rope.
+   //!
+   //! <b>Throws</b>: If allocator_type's default constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant.
+   basic_rope() BOOST_NOEXCEPT_IF(dtl::is_nothrow_default_constructible<allocator_type>::value)
+      : m_()
+   {}
+
+   //! <b>Effects</b>: Constructs an empty rope, using the specified allocator.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   explicit basic_rope(const allocator_type& a) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_(node_allocator_type(a))
+   {}
+
+   //! <b>Effects</b>: Constructs a rope with a copy of the first n characters of s.
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   basic_rope(const CharT* s, size_type n, const allocator_type& a = allocator_type())
+      : m_(node_allocator_type(a))
+   {  this->append(s, n);  }
+
+   //! <b>Effects</b>: Constructs a rope with a copy of the null-terminated string s.
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to the length of s.
+   basic_rope(const CharT* s, const allocator_type& a = allocator_type())
+      : m_(node_allocator_type(a))
+   {  this->append(s);  }
+
+   //! <b>Effects</b>: Constructs a rope with n copies of c.
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   basic_rope(size_type n, CharT c, const allocator_type& a = allocator_type())
+      : m_(node_allocator_type(a))
+   {  this->append(n, c);  }
+
+   //! <b>Effects</b>: Constructs a rope with a copy of the range [first, last).
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to the range [first, last).
+   template <class InputIterator>
+   basic_rope(InputIterator first, InputIterator last, const allocator_type& a = allocator_type()
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename dtl::disable_if_convertible<InputIterator BOOST_MOVE_I size_type>::type * = 0)
+      )
+      : m_(node_allocator_type(a))
+   {
+      for(; first != last; ++first){
+         this->push_back(*first);
+      }
+   }
+
+   //! <b>Effects</b>: Constructs a rope with a copy of the characters of s.
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to s.size().
+   template<class StrAllocator, class StrOptions>
+   explicit basic_rope(const basic_string<CharT, Traits, StrAllocator, StrOptions> &s, const allocator_type& a = allocator_type())
+      : m_(node_allocator_type(a))
+   {  this->append(s.data(), s.size());  }
+
+   //! <b>Effects</b>: Constructs a rope with a copy of the characters of the string view sv.
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Linear to sv.size().
+   template<template <class, class> class BasicStringView>
+   explicit basic_rope(BasicStringView<CharT, Traits> sv, const allocator_type& a = allocator_type()
+      BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename dtl::disable_if<is_string< BasicStringView<CharT BOOST_MOVE_I Traits> > >::type * = 0)
+      )
+      : m_(node_allocator_type(a))
+   {  this->append(sv.data(), static_cast<size_type>(sv.size()));  }
+
+   //! <b>Effects</b>: Copy constructs a rope. If the new allocator compares equal to x's allocator,
+   //!   chunks are shared, otherwise characters are copied.
+   //!
+   //! <b>Throws</b>: If allocator_type's copy constructor or allocation throws.
+   //!
+   //! <b>Complexity</b>: Constant if chunks are shared, linear to x.size() otherwise.
+   basic_rope(const basic_rope& x)
+      : m_(node_alloc_traits::select_on_container_copy_construction(x.priv_node_alloc()))
+   {  this->priv_copy_from(x);  }
+
+   //! <b>Effects</b>: Copy constructs a rope using the specified allocator. If a compares equal
+   //!   to x's allocator, chunks are shared, otherwise characters are copied.
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Constant if chunks are shared, linear to x.size() otherwise.
+   basic_rope(const basic_rope& x, const BOOST_CONTAINER_DOC1ST(allocator_type, typename dtl::type_identity<allocator_type>::type)& a)
+      : m_(node_allocator_type(a))
+   {  this->priv_copy_from(x);  }
+
+   //! <b>Effects</b>: Move constructor. Moves x's resources to *this.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   basic_rope(BOOST_RV_REF(basic_rope) x) BOOST_NOEXCEPT_OR_NOTHROW
+      : m_(::boost::move(x.m_))
+   {}
+
+   //! <b>Effects</b>: Move constructor using the specified allocator.
+   //!   Moves x's resources to *this if a == x.get_allocator(), otherwise characters are copied.
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Constant if a == x.get_allocator(), linear otherwise.
+   basic_rope(BOOST_RV_REF(basic_rope) x, const BOOST_CONTAINER_DOC1ST(allocator_type, typename dtl::type_identity<allocator_type>::type)& a)
+      : m_(node_allocator_type(a))
+   {
+      if(this->priv_node_alloc() == x.priv_node_alloc()){
+         this->priv_steal(x);
+      }
+      else{
+         this->priv_copy_from(x);
+      }
+   }
+
+   //! <b>Effects</b>: Releases the chunks of the rope, deallocating those not shared with other ropes.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the number of deallocated chunks.
+   ~basic_rope() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      this->priv_release(m_.root);
+      this->priv_release(m_.tail);
+   }
+
+   //! <b>Effects</b>: Makes *this contain the same characters as x, sharing its chunks if
+   //!   the allocators compare equal after the assignment.
+   //!
+   //! <b>Throws</b>: If allocation throws.
+   //!
+   //! <b>Complexity</b>: Constant if chunks are shared, linear to x.size() otherwise.
+   basic_rope& operator=(BOOST_COPY_ASSIGN_REF(basic_rope) x)
+   {
+      if (BOOST_LIKELY(this != &x)) {
+         const bool do_propagate = node_alloc_traits::propagate_on_container_copy_assignment::value;
+         basic_rope tmp(x, do_propagate ? x.get_allocator() : this->get_allocator());
+         this->clear();
+         dtl::assign_alloc(this->priv_node_alloc(), x.priv_node_alloc(), dtl::bool_<do_propagate>());
+         this->priv_steal(tmp);
+      }
+      return *this;
+   }
+
+   //! <b>Effects</b>: Move assignment. All x's chunks are transferred to *this.
+   //!
+   //! <b>Throws</b>: If allocators don't propagate and are not equal, allocation.
+   //!
+   //! <b>Complexity</b>: Constant if allocators propagate or are equal, linear otherwise.
+   basic_rope& operator=(BOOST_RV_REF(basic_rope) x)
+      BOOST_NOEXCEPT_IF(allocator_traits_type::propagate_on_container_move_assignment::value
+                     || allocator_traits_type::is_always_equal::value)
+   {
+      if (BOOST_LIKELY(this != &x)) {
+         const bool propagate_alloc = node_alloc_traits::propagate_on_container_move_assignment::value;
+         if(propagate_alloc || this->priv_node_alloc() == x.priv_node_alloc()){
+            this->clear();
+            dtl::move_alloc(this->priv_node_alloc(), x.priv_node_alloc(), dtl::bool_<propagate_alloc>());
+            this->priv_steal(x);
+         }
+         else{
+            basic_rope tmp(x, this->get_allocator());
+            this->clear();
+            this->priv_steal(tmp);
+         }
+      }
+      return *this;
+   }
+
+   //! <b>Effects</b>: Makes *this contain a copy of the null-terminated string s.
+   //!
+   //! <b>Complexity</b>: Linear to the length of s.
+   basic_rope& operator=(const CharT* s)
+   {  return this->assign(s, Traits::length(s));  }
+
+   //! <b>Effects</b>: Makes *this contain a copy of the characters of s.
+   //!
+   //! <b>Complexity</b>: Linear to s.size().
+   template<class StrAllocator, class StrOptions>
+   basic_rope& operator=(const basic_string<CharT, Traits, StrAllocator, StrOptions> &s)
+   {  return this->assign(s.data(), s.size());  }
+
+   //! <b>Effects</b>: Makes *this contain a copy of the first n characters of s.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   basic_rope& assign(const CharT* s, size_type n)
+   {
+      basic_rope tmp(s, n, this->get_allocator());
+      this->swap(tmp);
+      return *this;
+   }
+
+   //! <b>Effects</b>: Makes *this contain a copy of the null-terminated string s.
+   //!
+   //! <b>Complexity</b>: Linear to the length of s.
+   basic_rope& assign(const CharT* s)
+   {  return this->assign(s, Traits::length(s));  }
+
+   //! <b>Effects</b>: Makes *this contain n copies of c.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   basic_rope& assign(size_type n, CharT c)
+   {
+      basic_rope tmp(n, c, this->get_allocator());
+      this->swap(tmp);
+      return *this;
+   }
+
+   //! <b>Effects</b>: Returns a copy of the internal allocator.
+   //!
+   //! <b>Throws</b>: If allocator's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline
+      allocator_type get_allocator() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return allocator_type(this->priv_node_alloc());  }
+
+   //////////////////////////////////////////////
+   //
+   //                iterators
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns an iterator to the first character of the rope.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline
+      const_iterator begin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_iterator(this, 0u);  }
+
+   //! <b>Effects</b>: Returns an iterator to the end of the rope.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline
+      const_iterator end() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_iterator(this, this->size());  }
+
+   //! <b>Effects</b>: Returns an iterator to the first character of the rope.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline
+      const_iterator cbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->begin();  }
+
+   //! <b>Effects</b>: Returns an iterator to the end of the rope.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline
+      const_iterator cend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->end();  }
+
+   //! <b>Effects</b>: Returns a reverse iterator pointing to the beginning of the reversed rope.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline
+      const_reverse_iterator rbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_reverse_iterator(this->end());  }
+
+   //! <b>Effects</b>: Returns a reverse iterator pointing to the end of the reversed rope.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline
+      const_reverse_iterator rend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return const_reverse_iterator(this->begin());  }
+
+   //! <b>Effects</b>: Returns a reverse iterator pointing to the beginning of the reversed rope.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline
+      const_reverse_iterator crbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->rbegin();  }
+
+   //! <b>Effects</b>: Returns a reverse iterator pointing to the end of the reversed rope.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline
+      const_reverse_iterator crend() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->rend();  }
+
+   //////////////////////////////////////////////
+   //
+   //                capacity
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns true if the rope contains no characters.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline
+      bool empty() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !this->size();  }
+
+   //! <b>Effects</b>: Returns the number of characters in the rope.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline
+      size_type size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return size_type(this->priv_root_size() + (m_.tail ? m_.tail->size : 0u));  }
+
+   //! <b>Effects</b>: Returns the number of characters in the rope.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline
+      size_type length() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->size();  }
+
+   //! <b>Effects</b>: Returns the largest possible size of the rope.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD inline
+      size_type max_size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return size_type(size_type(-1)/2u);  }
+
+   //////////////////////////////////////////////
+   //
+   //               element access
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Requires</b>: n < size().
+   //!
+   //! <b>Effects</b>: Returns a reference to the nth character of the rope.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   BOOST_CONTAINER_NODISCARD
+      const_reference operator[](size_type n) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(n < this->size());
+      const CharT *chars;
+      size_type first, last;
+      this->priv_chunk_at(n, chars, first, last);
+      return chars[n - first];
+   }
+
+   //! <b>Effects</b>: Returns a reference to the nth character of the rope.
+   //!
+   //! <b>Throws</b>: out_of_range if n >= size().
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   BOOST_CONTAINER_NODISCARD
+      const_reference at(size_type n) const
+   {
+      if (n >= this->size())
+         throw_out_of_range("basic_rope::at invalid subscript");
+      return (*this)[n];
+   }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns a reference to the first character of the rope.
+   //!
+   //! <b>Complexity</b>: Logarithmic.
+   BOOST_CONTAINER_NODISCARD inline
+      const_reference front() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return (*this)[0u];  }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Returns a reference to the last character of the rope.
+   //!
+   //! <b>Complexity</b>: Constant if the last chunk is the tail, logarithmic otherwise.
+   BOOST_CONTAINER_NODISCARD inline
+      const_reference back() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return (*this)[this->size() - 1u];  }
+
+   //////////////////////////////////////////////
+   //
+   //                modifiers
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Appends the characters of x. If the allocators compare equal and x is
+   //!   not smaller than a chunk, x's chunks are shared instead of copied.
+   //!
+   //! <b>Throws</b>: If allocation throws or length_error if the new size would exceed max_size().
+   //!
+   //! <b>Complexity</b>: Logarithmic to size() + x.size() if chunks are shared, linear to x.size() otherwise.
+   basic_rope& append(const basic_rope& x)
+   {
+      if(this == &x){
+         const basic_rope tmp(x);
+         return this->append(tmp);
+      }
+      if(x.size() < chunk_size || !(this->priv_node_alloc() == x.priv_node_alloc())){
+         x.for_each_chunk(appender(*this));
+      }
+      else{
+         this->priv_check_length(x.size());
+         node_ptr w = this->priv_whole_of(x);
+         node_guard gw(*this, w);
+         this->priv_flush();
+         node_ptr r = this->priv_join(m_.root, w);
+         this->priv_release(m_.root);
+         m_.root = r;
+      }
+      return *this;
+   }
+
+   //! <b>Effects</b>: Appends the first n characters of s.
+   //!
+   //! <b>Throws</b>: If allocation throws or length_error if the new size would exceed max_size().
+   //!
+   //! <b>Complexity</b>: Linear to n, plus a logarithmic operation each time a chunk is filled.
+   basic_rope& append(const CharT* s, size_type n)
+   {
+      ptr_source src(s);
+      this->priv_append(src, n);
+      return *this;
+   }
+
+   //! <b>Effects</b>: Appends the null-terminated string s.
+   //!
+   //! <b>Complexity</b>: Linear to the length of s, plus a logarithmic operation each time a chunk is filled.
+   basic_rope& append(const CharT* s)
+   {  return this->append(s, Traits::length(s));  }
+
+   //! <b>Effects</b>: Appends n copies of c.
+   //!
+   //! <b>Complexity</b>: Linear to n, plus a logarithmic operation each time a chunk is filled.
+   basic_rope& append(size_type n, CharT c)
+   {
+      fill_source src(c);
+      this->priv_append(src, n);
+      return *this;
+   }
+
+   //! <b>Effects</b>: Appends the characters of s.
+   //!
+   //! <b>Complexity</b>: Linear to s.size(), plus a logarithmic operation each time a chunk is filled.
+   template<class StrAllocator, class StrOptions>
+   basic_rope& append(const basic_string<CharT, Traits, StrAllocator, StrOptions> &s)
+   {  return this->append(s.data(), s.size());  }
+
+   //! <b>Effects</b>: Appends the characters of the string view sv.
+   //!
+   //! <b>Complexity</b>: Linear to sv.size(), plus a logarithmic operation each time a chunk is filled.
+   template<template<class, class> class BasicStringView>
+   BOOST_CONTAINER_DOC1ST(basic_rope&, typename dtl::disable_if<is_string< BasicStringView<CharT BOOST_MOVE_I Traits> > BOOST_MOVE_I basic_rope& >::type)
+      append(BasicStringView<CharT, Traits> sv)
+   {  return this->append(sv.data(), static_cast<size_type>(sv.size()));  }
+
+   //! <b>Effects</b>: Appends c.
+   //!
+   //! <b>Complexity</b>: Amortized constant.
+   void push_back(CharT c)
+   {
+      node_ptr &t = m_.tail;
+      if(t && t->size != t->capacity && priv_unique(t)){
+         Traits::assign(priv_chars(t)[t->size], c);
+         ++t->size;
+      }
+      else{
+         this->append(size_type(1u), c);
+      }
+   }
+
+   //! <b>Effects</b>: Equivalent to append(x).
+   inline basic_rope& operator+=(const basic_rope& x)
+   {  return this->append(x);  }
+
+   //! <b>Effects</b>: Equivalent to append(s).
+   inline basic_rope& operator+=(const CharT* s)
+   {  return this->append(s);  }
+
+   //! <b>Effects</b>: Equivalent to push_back(c).
+   inline basic_rope& operator+=(CharT c)
+   {  this->push_back(c); return *this;  }
+
+   //! <b>Effects</b>: Equivalent to append(s).
+   template<class StrAllocator, class StrOptions>
+   inline basic_rope& operator+=(const basic_string<CharT, Traits, StrAllocator, StrOptions> &s)
+   {  return this->append(s);  }
+
+   //! <b>Effects</b>: Equivalent to append(sv).
+   template<template<class, class> class BasicStringView>
+   inline BOOST_CONTAINER_DOC1ST(basic_rope&, typename dtl::disable_if<is_string< BasicStringView<CharT BOOST_MOVE_I Traits> > BOOST_MOVE_I basic_rope& >::type)
+      operator+=(BasicStringView<CharT, Traits> sv)
+   {  return this->append(sv);  }
+
+   //! <b>Effects</b>: Inserts the characters of x before position pos. If the allocators compare equal,
+   //!   x's chunks are shared instead of copied.
+   //!
+   //! <b>Throws</b>: If allocation throws, out_of_range if pos > size() or length_error if the new size
+   //!   would exceed max_size().
+   //!
+   //! <b>Complexity</b>: Logarithmic to size() + x.size() if chunks are shared, linear to x.size() otherwise.
+   basic_rope& insert(size_type pos, const basic_rope& x)
+   {
+      this->priv_check_pos(pos, "basic_rope::insert out of range position");
+      if(pos == this->size()){
+         return this->append(x);
+      }
+      else if(!x.empty()){
+         this->priv_check_length(x.size());
+         if(!(this->priv_node_alloc() == x.priv_node_alloc())){
+            const basic_rope tmp(x, this->get_allocator());
+            return this->insert(pos, tmp);
+         }
+         node_ptr w = this->priv_whole_of(x);
+         node_guard gw(*this, w);
+         this->priv_replace(pos, 0u, w);
+      }
+      return *this;
+   }
+
+   //! <b>Effects</b>: Inserts the first n characters of s before position pos.
+   //!
+   //! <b>Throws</b>: If allocation throws, out_of_range if pos > size() or length_error if the new size
+   //!   would exceed max_size().
+   //!
+   //! <b>Complexity</b>: Linear to n plus logarithmic to size().
+   basic_rope& insert(size_type pos, const CharT* s, size_type n)
+   {
+      this->priv_check_pos(pos, "basic_rope::insert out of range position");
+      return this->insert(pos, basic_rope(s, n, this->get_allocator()));
+   }
+
+   //! <b>Effects</b>: Inserts the null-terminated string s before position pos.
+   //!
+   //! <b>Complexity</b>: Linear to the length of s plus logarithmic to size().
+   basic_rope& insert(size_type pos, const CharT* s)
+   {  return this->insert(pos, s, Traits::length(s));  }
+
+   //! <b>Effects</b>: Inserts n copies of c before position pos.
+   //!
+   //! <b>Complexity</b>: Linear to n plus logarithmic to size().
+   basic_rope& insert(size_type pos, size_type n, CharT c)
+   {
+      this->priv_check_pos(pos, "basic_rope::insert out of range position");
+      return this->insert(pos, basic_rope(n, c, this->get_allocator()));
+   }
+
+   //! <b>Effects</b>: Inserts the characters of s before position pos.
+   //!
+   //! <b>Complexity</b>: Linear to s.size() plus logarithmic to size().
+   template<class StrAllocator, class StrOptions>
+   basic_rope& insert(size_type pos, const basic_string<CharT, Traits, StrAllocator, StrOptions> &s)
+   {  return this->insert(pos, s.data(), s.size());  }
+
+   //! <b>Effects</b>: Inserts the characters of the string view sv before position pos.
+   //!
+   //! <b>Complexity</b>: Linear to sv.size() plus logarithmic to size().
+   template<template<class, class> class BasicStringView>
+   BOOST_CONTAINER_DOC1ST(basic_rope&, typename dtl::disable_if<is_string< BasicStringView<CharT BOOST_MOVE_I Traits> > BOOST_MOVE_I basic_rope& >::type)
+      insert(size_type pos, BasicStringView<CharT, Traits> sv)
+   {  return this->insert(pos, sv.data(), static_cast<size_type>(sv.size()));  }
+
+   //! <b>Effects</b>: Removes min(n, size() - pos) characters starting at position pos.
+   //!
+   //! <b>Throws</b>: If allocation throws or out_of_range if pos > size().
+   //!
+   //! <b>Complexity</b>: Logarithmic to size(). Constant if the characters are erased from the
+   //!   end of a tail not shared with other ropes.
+   basic_rope& erase(size_type pos = 0u, size_type n = npos)
+   {
+      this->priv_check_pos(pos, "basic_rope::erase out of range position");
+      const size_type sz = this->size();
+      n = dtl::min_value(n, size_type(sz - pos));
+      if(!n){
+         return *this;
+      }
+      const size_type rsize = this->priv_root_size();
+      if(pos == 0u && n == sz){
+         this->clear();
+      }
+      else if(pos >= rsize && pos + n == sz && priv_unique(m_.tail)){
+         m_.tail->size = size_type(m_.tail->size - n);
+      }
+      else{
+         node_ptr w = node_ptr();
+         this->priv_replace(pos, n, w);
+      }
+      return *this;
+   }
+
+   //! <b>Requires</b>: !empty()
+   //!
+   //! <b>Effects</b>: Removes the last character.
+   //!
+   //! <b>Complexity</b>: Constant if the last chunk is a tail not shared with other ropes, logarithmic otherwise.
+   inline void pop_back()
+   {
+      BOOST_ASSERT(!this->empty());
+      this->erase(size_type(this->size() - 1u), 1u);
+   }
+
+   //! <b>Effects</b>: Replaces min(n, size() - pos) characters starting at position pos
+   //!   with the characters of x.
+   //!
+   //! <b>Throws</b>: If allocation throws, out_of_range if pos > size() or length_error if the new size
+   //!   would exceed max_size().
+   //!
+   //! <b>Complexity</b>: Logarithmic to size() + x.size() if chunks are shared, linear to x.size() otherwise.
+   basic_rope& replace(size_type pos, size_type n, const basic_rope& x)
+   {
+      this->priv_check_pos(pos, "basic_rope::replace out of range position");
+      n = dtl::min_value(n, size_type(this->size() - pos));
+      if(!(this->priv_node_alloc() == x.priv_node_alloc())){
+         const basic_rope tmp(x, this->get_allocator());
+         return this->replace(pos, n, tmp);
+      }
+      if(x.size() > n){
+         this->priv_check_length(size_type(x.size() - n));
+      }
+      node_ptr w = this->priv_whole_of(x);
+      node_guard gw(*this, w);
+      this->priv_replace(pos, n, w);
+      return *this;
+   }
+
+   //! <b>Effects</b>: Replaces min(n, size() - pos) characters starting at position pos
+   //!   with the first n2 characters of s.
+   //!
+   //! <b>Complexity</b>: Linear to n2 plus logarithmic to size().
+   basic_rope& replace(size_type pos, size_type n, const CharT* s, size_type n2)
+   {
+      this->priv_check_pos(pos, "basic_rope::replace out of range position");
+      return this->replace(pos, n, basic_rope(s, n2, this->get_allocator()));
+   }
+
+   //! <b>Effects</b>: Replaces min(n, size() - pos) characters starting at position pos
+   //!   with the null-terminated string s.
+   //!
+   //! <b>Complexity</b>: Linear to the length of s plus logarithmic to size().
+   basic_rope& replace(size_type pos, size_type n, const CharT* s)
+   {  return this->replace(pos, n, s, Traits::length(s));  }
+
+   //! <b>Effects</b>: Swaps the contents of *this and x.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   void swap(basic_rope& x)
+      BOOST_NOEXCEPT_IF( allocator_traits_type::propagate_on_container_swap::value
+                      || allocator_traits_type::is_always_equal::value)
+   {
+      BOOST_CONSTEXPR_OR_CONST bool propagate_alloc = node_alloc_traits::propagate_on_container_swap::value;
+      BOOST_ASSERT(propagate_alloc || this->priv_node_alloc() == x.priv_node_alloc()); // else it's undefined behavior
+      ::boost::adl_move_swap(m_.root, x.m_.root);
+      ::boost::adl_move_swap(m_.tail, x.m_.tail);
+      dtl::swap_alloc(this->priv_node_alloc(), x.priv_node_alloc(), dtl::bool_<propagate_alloc>());
+   }
+
+   //! <b>Effects</b>: Erases all the characters of the rope.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Linear to the number of deallocated chunks.
+   void clear() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      this->priv_release(m_.root);
+      this->priv_release(m_.tail);
+      m_.root = node_ptr();
+      m_.tail = node_ptr();
+   }
+
+   //////////////////////////////////////////////
+   //
+   //                operations
+   //
+   //////////////////////////////////////////////
+
+   //! <b>Effects</b>: Returns a rope with the min(n, size() - pos) characters that start at position pos,
+   //!   which shares the chunks of *this and uses the same allocator.
+   //!
+   //! <b>Throws</b>: If allocation throws or out_of_range if pos > size().
+   //!
+   //! <b>Complexity</b>: Logarithmic to size().
+   BOOST_CONTAINER_NODISCARD
+      basic_rope substr(size_type pos = 0u, size_type n = npos) const
+   {
+      this->priv_check_pos(pos, "basic_rope::substr out of range position");
+      n = dtl::min_value(n, size_type(this->size() - pos));
+      //Nodes are allocated with the (equal) allocator of the result
+      basic_rope r(this->get_allocator());
+      if(n){
+         node_ptr w = r.priv_whole_of(*this), rest = node_ptr();
+         node_guard gw(r, w), grest(r, rest);
+         r.priv_split(w, pos, 0, &rest);
+         r.priv_split(rest, n, &r.m_.root, 0);
+      }
+      return r;
+   }
+
+   //! <b>Effects</b>: Returns a basic_string with a copy of the characters of the rope, that uses
+   //!   a copy of the allocator of the rope.
+   //!
+   //! <b>Complexity</b>: Linear to size().
+   BOOST_CONTAINER_NODISCARD
+      string_type str() const
+   {
+      string_type s(this->get_allocator());
+      s.reserve(this->size());
+      this->for_each_chunk(string_appender<string_type>(s));
+      return s;
+   }
+
+   //! <b>Effects</b>: Copies min(n, size() - pos) characters starting at position pos to s.
+   //!
+   //! <b>Returns</b>: The number of copied characters.
+   //!
+   //! <b>Throws</b>: out_of_range if pos > size().
+   //!
+   //! <b>Complexity</b>: Linear to the number of copied characters plus logarithmic to size().
+   size_type copy(CharT* s, size_type n, size_type pos = 0u) const
+   {
+      this->priv_check_pos(pos, "basic_rope::copy out of range position");
+      n = dtl::min_value(n, size_type(this->size() - pos));
+      this->for_each_chunk(pos, n, char_copier(s));
+      return n;
+   }
+
+   //! <b>Effects</b>: Calls f(p, n) for each chunk of the rope, in order, where p is a pointer
+   //!   to the first character of the chunk and n the number of characters of the chunk.
+   //!
+   //! <b>Returns</b>: f.
+   //!
+   //! <b>Note</b>: f must not modify the rope.
+   //!
+   //! <b>Complexity</b>: Linear to the number of chunks.
+   template<class Function>
+   Function for_each_chunk(Function f) const
+   {  return this->for_each_chunk(0u, this->size(), f);  }
+
+   //! <b>Effects</b>: Calls f(p, n) for each chunk of the characters [pos, pos + min(n, size() - pos)),
+   //!   in order, where p is a pointer to the first character of the range in the chunk and n the
+   //!   number of characters of the range in the chunk.
+   //!
+   //! <b>Returns</b>: f.
+   //!
+   //! <b>Throws</b>: out_of_range if pos > size().
+   //!
+   //! <b>Note</b>: f must not modify the rope.
+   //!
+   //! <b>Complexity</b>: Linear to the number of visited chunks plus logarithmic to size().
+   template<class Function>
+   Function for_each_chunk(size_type pos, size_type n, Function f) const
+   {
+      this->priv_check_pos(pos, "basic_rope::for_each_chunk out of range position");
+      const size_type last = size_type(pos + dtl::min_value(n, size_type(this->size() - pos)));
+      const size_type rsize = this->priv_root_size();
+      if(pos < rsize){
+         priv_visit(m_.root, pos, dtl::min_value(last, rsize), f);
+      }
+      if(last > rsize){
+         const size_type first = pos > rsize ? size_type(pos - rsize) : 0u;
+         f(static_cast<const CharT*>(priv_chars(m_.tail) + first), size_type(last - rsize - first));
+      }
+      return f;
+   }
+
+   //! <b>Effects</b>: Returns the position of the first occurrence of c at or after pos, or npos.
+   //!
+   //! <b>Complexity</b>: Linear to size() - pos.
+   BOOST_CONTAINER_NODISCARD
+      size_type find(CharT c, size_type pos = 0u) const
+   {
+      const size_type sz = this->size();
+      while(pos < sz){
+         const CharT *chars;
+         size_type first, last;
+         this->priv_chunk_at(pos, chars, first, last);
+         const CharT *const p = chars + (pos - first);
+         const CharT *const f = Traits::find(p, size_type(last - pos), c);
+         if(f){
+            return size_type(pos + size_type(f - p));
+         }
+         pos = last;
+      }
+      return npos;
+   }
+
+   //! <b>Effects</b>: Returns the position of the first occurrence of the first n characters of s
+   //!   at or after pos, or npos.
+   //!
+   //! <b>Complexity</b>: Linear to (size() - pos)*n.
+   BOOST_CONTAINER_NODISCARD
+      size_type find(const CharT* s, size_type pos, size_type n) const
+   {
+      const size_type sz = this->size();
+      if(!n){
+         return pos <= sz ? pos : npos;
+      }
+      while(pos < sz && n <= size_type(sz - pos)){
+         pos = this->find(s[0], pos);
+         if(pos == npos || n > size_type(sz - pos)){
+            break;
+         }
+         if(!this->priv_compare(pos, s, n)){
+            return pos;
+         }
+         ++pos;
+      }
+      return npos;
+   }
+
+   //! <b>Effects</b>: Returns the position of the first occurrence of the null-terminated
+   //!   string s at or after pos, or npos.
+   //!
+   //! <b>Complexity</b>: Linear to (size() - pos) times the length of s.
+   BOOST_CONTAINER_NODISCARD inline
+      size_type find(const CharT* s, size_type pos = 0u) const
+   {  return this->find(s, pos, Traits::length(s));  }
+
+   //! <b>Effects</b>: Compares *this and x lexicographically.
+   //!
+   //! <b>Returns</b>: A negative value if *this is less than x, zero if they are equal
+   //!   and a positive value otherwise.
+   //!
+   //! <b>Complexity</b>: Linear to min(size(), x.size()).
+   BOOST_CONTAINER_NODISCARD
+      int compare(const basic_rope& x) const
+   {
+      const size_type sz = this->size(), xsz = x.size();
+      const size_type n = dtl::min_value(sz, xsz);
+      if(m_.root != x.m_.root || m_.tail != x.m_.tail){
+         size_type pos = 0u;
+         while(pos < n){
+            const CharT *p, *q;
+            size_type pfirst, plast, qfirst, qlast;
+            this->priv_chunk_at(pos, p, pfirst, plast);
+            x.priv_chunk_at(pos, q, qfirst, qlast);
+            const size_type last = dtl::min_value(dtl::min_value(plast, qlast), n);
+            const int r = Traits::compare(p + (pos - pfirst), q + (pos - qfirst), size_type(last - pos));
+            if(r){
+               return r;
+            }
+            pos = last;
+         }
+      }
+      return priv_compare_size(sz, xsz);
+   }
+
+   //! <b>Effects</b>: Compares *this and the first n characters of s lexicographically.
+   //!
+   //! <b>Complexity</b>: Linear to min(size(), n).
+   BOOST_CONTAINER_NODISCARD
+      int compare(const CharT* s, size_type n) const
+   {
+      const size_type sz = this->size();
+      const size_type m = dtl::min_value(sz, n);
+      const int r = this->priv_compare(0u, s, m);
+      return r ? r : priv_compare_size(sz, n);
+   }
+
+   //! <b>Effects</b>: Compares *this and the null-terminated string s lexicographically.
+   //!
+   //! <b>Complexity</b>: Linear to min(size(), length of s).
+   BOOST_CONTAINER_NODISCARD inline
+      int compare(const CharT* s) const
+   {  return this->compare(s, Traits::length(s));  }
+
+   //! <b>Effects</b>: Compares *this and s lexicographically.
+   //!
+   //! <b>Complexity</b>: Linear to min(size(), s.size()).
+   template<class StrAllocator, class StrOptions>
+   BOOST_CONTAINER_NODISCARD inline
+      int compare(const basic_string<CharT, Traits, StrAllocator, StrOptions> &s) const
+   {  return this->compare(s.data(), s.size());  }
+
+   //! <b>Effects</b>: Compares *this and the string view sv lexicographically.
+   //!
+   //! <b>Complexity</b>: Linear to min(size(), sv.size()).
+   template<template <class, class> class BasicStringView>
+   BOOST_CONTAINER_NODISCARD inline
+      BOOST_CONTAINER_DOC1ST(int, typename dtl::disable_if<is_string< BasicStringView<CharT BOOST_MOVE_I Traits> > BOOST_MOVE_I int >::type)
+         compare(BasicStringView<CharT, Traits> sv) const
+   {  return this->compare(sv.data(), static_cast<size_type>(sv.size()));  }
+
+   //! <b>Effects</b>: Returns a rope with the characters of x followed by the characters of y.
+   //!
+   //! <b>Complexity</b>: Logarithmic to x.size() + y.size() if chunks can be shared.
+   BOOST_CONTAINER_NODISCARD
+      friend basic_rope operator+(const basic_rope& x, const basic_rope& y)
+   {
+      basic_rope r(x);
+      r.append(y);
+      return r;
+   }
+
+   //! <b>Effects</b>: Returns a rope with the characters of x followed by the null-terminated string s.
+   //!
+   //! <b>Complexity</b>: Linear to the length of s.
+   BOOST_CONTAINER_NODISCARD
+      friend basic_rope operator+(const basic_rope& x, const CharT* s)
+   {
+      basic_rope r(x);
+      r.append(s);
+      return r;
+   }
+
+   //! <b>Effects</b>: Returns x.compare(y) == 0.
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator==(const basic_rope& x, const basic_rope& y)
+   {  return x.size() == y.size() && !x.compare(y);  }
+
+   //! <b>Effects</b>: Returns x.compare(y) != 0.
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator!=(const basic_rope& x, const basic_rope& y)
+   {  return !(x == y);  }
+
+   //! <b>Effects</b>: Returns x.compare(y) < 0.
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator<(const basic_rope& x, const basic_rope& y)
+   {  return x.compare(y) < 0;  }
+
+   //! <b>Effects</b>: Returns x.compare(y) > 0.
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator>(const basic_rope& x, const basic_rope& y)
+   {  return x.compare(y) > 0;  }
+
+   //! <b>Effects</b>: Returns x.compare(y) <= 0.
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator<=(const basic_rope& x, const basic_rope& y)
+   {  return x.compare(y) <= 0;  }
+
+   //! <b>Effects</b>: Returns x.compare(y) >= 0.
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator>=(const basic_rope& x, const basic_rope& y)
+   {  return x.compare(y) >= 0;  }
+
+   //! <b>Effects</b>: Returns x.compare(s) == 0.
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator==(const basic_rope& x, const CharT* s)
+   {  return !x.compare(s);  }
+
+   //! <b>Effects</b>: Returns x.compare(s) == 0.
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator==(const CharT* s, const basic_rope& x)
+   {  return !x.compare(s);  }
+
+   //! <b>Effects</b>: Returns x.compare(s) != 0.
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator!=(const basic_rope& x, const CharT* s)
+   {  return x.compare(s) != 0;  }
+
+   //! <b>Effects</b>: Returns x.compare(s) != 0.
+   BOOST_CONTAINER_NODISCARD inline
+      friend bool operator!=(const CharT* s, const basic_rope& x)
+   {  return x.compare(s) != 0;  }
+
+   //! <b>Effects</b>: x.swap(y)
+   //!
+   //! <b>Complexity</b>: Constant.
+   inline friend void swap(basic_rope& x, basic_rope& y)
+      BOOST_NOEXCEPT_IF( allocator_traits_type::propagate_on_container_swap::value
+                      || allocator_traits_type::is_always_equal::value)
+   {  x.swap(y);  }
+
+   //! <b>Effects</b>: Writes the characters of x to os, chunk by chunk. Formatting flags are ignored.
+   friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const basic_rope& x)
+   {
+      x.for_each_chunk(ostream_writer(os));
+      return os;
+   }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+
+   template<class String>
+   class string_appender
+   {
+      public:
+      explicit string_appender(String &s)
+         : m_s(s)
+      {}
+
+      void operator()(const CharT *p, size_type n)
+      {  m_s.append(p, n);  }
+
+      private:
+      String &m_s;
+   };
+
+   class char_copier
+   {
+      public:
+      explicit char_copier(CharT *s)
+         : m_s(s)
+      {}
+
+      void operator()(const CharT *p, size_type n)
+      {  Traits::copy(m_s, p, n); m_s += n;  }
+
+      private:
+      CharT *m_s;
+   };
+
+   class ostream_writer
+   {
+      public:
+      explicit ostream_writer(std::basic_ostream<CharT, Traits> &os)
+         : m_os(os)
+      {}
+
+      void operator()(const CharT *p, size_type n)
+      {  m_os.write(p, static_cast<std::streamsize>(n));  }
+
+      private:
+      std::basic_ostream<CharT, Traits> &m_os;
+   };
+
+   inline node_allocator_type &priv_node_alloc() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_;  }
+
+   inline const node_allocator_type &priv_node_alloc() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_;  }
+
+   inline size_type priv_root_size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_.root ? m_.root->size : 0u;  }
+
+   inline static int priv_compare_size(size_type a, size_type b) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return a < b ? -1 : int(a != b);  }
+
+   void priv_check_pos(size_type pos, const char *msg) const
+   {
+      if(pos > this->size())
+         throw_out_of_range(msg);
+   }
+
+   void priv_check_length(size_type n) const
+   {
+      if(n > size_type(this->max_size() - this->size()))
+         throw_length_error("basic_rope: the new size exceeds max_size()");
+   }
+
+   inline void priv_steal(basic_rope &x) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      m_.root = x.m_.root;
+      m_.tail = x.m_.tail;
+      x.m_.root = node_ptr();
+      x.m_.tail = node_ptr();
+   }
+
+   //Precondition: *this is empty
+   void priv_copy_from(const basic_rope &x)
+   {
+      if(this->priv_node_alloc() == x.priv_node_alloc()){
+         m_.root = priv_retain(x.m_.root);
+         m_.tail = priv_retain(x.m_.tail);
+      }
+      else{
+         x.for_each_chunk(appender(*this));
+      }
+   }
+
+   //Compares characters [pos, pos + n) with s. Precondition: pos + n <= size()
+   int priv_compare(size_type pos, const CharT *s, size_type n) const
+   {
+      const size_type end = size_type(pos + n);
+      while(pos < end){
+         const CharT *chars;
+         size_type first, last;
+         this->priv_chunk_at(pos, chars, first, last);
+         last = dtl::min_value(last, end);
+         const int r = Traits::compare(chars + (pos - first), s, size_type(last - pos));
+         if(r){
+            return r;
+         }
+         s += last - pos;
+         pos = last;
+      }
+      return 0;
+   }
+
+   //Obtains the chunk that contains position pos: the characters of the chunk
+   //and its first and last positions in the rope. Precondition: pos < size()
+   void priv_chunk_at(size_type pos, const CharT *&chars, size_type &first, size_type &last) const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const size_type rsize = this->priv_root_size();
+      if(pos >= rsize){
+         chars = priv_chars(m_.tail);
+         first = rsize;
+         last  = size_type(rsize + m_.tail->size);
+         return;
+      }
+      size_type base = 0u;
+      node_t *n = boost::movelib::to_raw_pointer(m_.root);
+      while(n->height){
+         node_t *const l = boost::movelib::to_raw_pointer(n->left);
+         if(pos - base < l->size){
+            n = l;
+         }
+         else{
+            base = size_type(base + l->size);
+            n = boost::movelib::to_raw_pointer(n->right);
+         }
+      }
+      chars = priv_chars(n);
+      first = base;
+      last  = size_type(base + n->size);
+   }
+
+   //Calls f for the chunks of [first, last) of the tree n. Precondition: first < last <= n->size
+   template<class Function>
+   static void priv_visit(const node_ptr &n, size_type first, size_type last, Function &f)
+   {
+      if(!n->height){
+         f(static_cast<const CharT*>(priv_chars(n) + first), size_type(last - first));
+      }
+      else{
+         const size_type ls = n->left->size;
+         if(first < ls){
+            priv_visit(n->left, first, dtl::min_value(last, ls), f);
+         }
+         if(last > ls){
+            priv_visit(n->right, first > ls ? size_type(first - ls) : 0u, size_type(last - ls), f);
+         }
+      }
+   }
+
+   //////////////////////////////////////////////
+   //
+   //             node management
+   //
+   //////////////////////////////////////////////
+
+   template<class NodePtr>
+   inline static CharT *priv_chars(const NodePtr &n) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return reinterpret_cast<CharT*>(boost::movelib::to_raw_pointer(n) + 1);  }
+
+   //Number of nodes allocated for a leaf with capacity for cap characters
+   inline static std::size_t priv_units(size_type cap) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return 1u + (std::size_t(cap)*sizeof(CharT) + sizeof(node_t) - 1u)/sizeof(node_t);  }
+
+   inline static bool priv_unique(const node_ptr &n) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return n->refs.load(std::memory_order_acquire) == 1u;  }
+
+   inline static node_ptr priv_retain(const node_ptr &n) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      if(n){
+         n->refs.fetch_add(1u, std::memory_order_relaxed);
+      }
+      return n;
+   }
+
+   void priv_release(node_ptr n) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      //Recursion on the left child, iteration on the right child
+      while(n && n->refs.fetch_sub(1u, std::memory_order_acq_rel) == 1u){
+         const node_ptr r = n->right;
+         if(n->height){
+            this->priv_release(n->left);
+         }
+         const std::size_t units = priv_units(n->capacity);
+         boost::movelib::to_raw_pointer(n)->~node_t();
+         node_alloc_traits::deallocate(this->priv_node_alloc(), n, typename node_alloc_traits::size_type(units));
+         n = r;
+      }
+   }
+
+   //Allocates an empty leaf with capacity for at least cap characters
+   node_ptr priv_new_leaf(size_type cap)
+   {
+      const std::size_t units = priv_units(cap);
+      const node_ptr n = node_alloc_traits::allocate(this->priv_node_alloc(), typename node_alloc_traits::size_type(units));
+      ::new(boost::movelib::to_raw_pointer(n), boost_container_new_t())
+         node_t(size_type((units - 1u)*sizeof(node_t)/sizeof(CharT)));
+      return n;
+   }
+
+   node_ptr priv_new_leaf(const CharT *s, size_type n)
+   {
+      const node_ptr l = this->priv_new_leaf(n);
+      Traits::copy(priv_chars(l), s, n);
+      l->size = n;
+      return l;
+   }
+
+   //Creates a node with children l and r
+   node_ptr priv_new_inner(const node_ptr &l, const node_ptr &r)
+   {
+      const node_ptr n = node_alloc_traits::allocate(this->priv_node_alloc(), 1u);
+      ::new(boost::movelib::to_raw_pointer(n), boost_container_new_t()) node_t(l, r);
+      priv_retain(l);
+      priv_retain(r);
+      return n;
+   }
+
+   //Creates a node with the children of l and r, if both are leaves and fit in a chunk.
+   //Otherwise creates a node with children l and r.
+   node_ptr priv_new_inner_or_merge(const node_ptr &l, const node_ptr &r)
+   {
+      if(!l->height && !r->height && size_type(l->size + r->size) <= chunk_size){
+         const node_ptr n = this->priv_new_leaf(size_type(l->size + r->size));
+         Traits::copy(priv_chars(n), priv_chars(l), l->size);
+         Traits::copy(priv_chars(n) + l->size, priv_chars(r), r->size);
+         n->size = size_type(l->size + r->size);
+         return n;
+      }
+      return this->priv_new_inner(l, r);
+   }
+
+   //Rotations of a node whose children are unbalanced
+   node_ptr priv_rotate_left(const node_ptr &n)
+   {
+      const node_ptr &r = n->right;
+      node_ptr t = this->priv_new_inner(n->left, r->left);
+      node_guard gt(*this, t);
+      return this->priv_new_inner(t, r->right);
+   }
+
+   node_ptr priv_rotate_right(const node_ptr &n)
+   {
+      const node_ptr &l = n->left;
+      node_ptr t = this->priv_new_inner(l->right, n->right);
+      node_guard gt(*this, t);
+      return this->priv_new_inner(l->left, t);
+   }
+
+   //Concatenation of two AVL trees (see "Just Join for Parallel Ordered Sets", Blelloch et al.):
+   //the shorter tree is linked at the point of the spine of the taller tree where heights match,
+   //and the path is rebalanced with at most two rotations per level. The cost is proportional to
+   //the difference of heights. Arguments are borrowed, the result is owned by the caller.
+   node_ptr priv_join(const node_ptr &a, const node_ptr &b)
+   {
+      if(!a){
+         return priv_retain(b);
+      }
+      else if(!b){
+         return priv_retain(a);
+      }
+      else if(a->height > b->height + 1u){
+         return this->priv_join_right(a, b);
+      }
+      else if(b->height > a->height + 1u){
+         return this->priv_join_left(a, b);
+      }
+      return this->priv_new_inner_or_merge(a, b);
+   }
+
+   //Precondition: a->height > b->height + 1
+   node_ptr priv_join_right(const node_ptr &a, const node_ptr &b)
+   {
+      const node_ptr &l = a->left;
+      const node_ptr &c = a->right;
+      if(c->height <= b->height + 1u){
+         node_ptr t = this->priv_new_inner_or_merge(c, b);
+         node_guard gt(*this, t);
+         if(t->height <= l->height + 1u){
+            return this->priv_new_inner(l, t);
+         }
+         node_ptr rt = this->priv_rotate_right(t);
+         node_guard grt(*this, rt);
+         node_ptr x = this->priv_new_inner(l, rt);
+         node_guard gx(*this, x);
+         return this->priv_rotate_left(x);
+      }
+      else{
+         node_ptr t = this->priv_join_right(c, b);
+         node_guard gt(*this, t);
+         node_ptr x = this->priv_new_inner(l, t);
+         if(t->height <= l->height + 1u){
+            return x;
+         }
+         node_guard gx(*this, x);
+         return this->priv_rotate_left(x);
+      }
+   }
+
+   //Precondition: b->height > a->height + 1
+   node_ptr priv_join_left(const node_ptr &a, const node_ptr &b)
+   {
+      const node_ptr &c = b->left;
+      const node_ptr &r = b->right;
+      if(c->height <= a->height + 1u){
+         node_ptr t = this->priv_new_inner_or_merge(a, c);
+         node_guard gt(*this, t);
+         if(t->height <= r->height + 1u){
+            return this->priv_new_inner(t, r);
+         }
+         node_ptr lt = this->priv_rotate_left(t);
+         node_guard glt(*this, lt);
+         node_ptr x = this->priv_new_inner(lt, r);
+         node_guard gx(*this, x);
+         return this->priv_rotate_right(x);
+      }
+      else{
+         node_ptr t = this->priv_join_left(a, c);
+         node_guard gt(*this, t);
+         node_ptr x = this->priv_new_inner(t, r);
+         if(t->height <= r->height + 1u){
+            return x;
+         }
+         node_guard gx(*this, x);
+         return this->priv_rotate_right(x);
+      }
+   }
+
+   //Stores in *l (if not null) a tree with the first pos characters of the tree n, and in *r
+   //(if not null) a tree with the rest. Only the leaf that contains position pos is copied, the
+   //rest of the tree is shared. Trees are obtained joining subtrees along the path to pos, so
+   //the cost is logarithmic. On exception nothing is stored.
+   void priv_split(const node_ptr &n, size_type pos, node_ptr *l, node_ptr *r)
+   {
+      node_ptr ln = node_ptr(), rn = node_ptr();
+      node_guard gl(*this, ln), gr(*this, rn);
+      if(!pos){
+         rn = r ? priv_retain(n) : node_ptr();
+      }
+      else if(pos == n->size){
+         ln = l ? priv_retain(n) : node_ptr();
+      }
+      else if(!n->height){
+         if(l){
+            ln = this->priv_new_leaf(priv_chars(n), pos);
+         }
+         if(r){
+            rn = this->priv_new_leaf(priv_chars(n) + pos, size_type(n->size - pos));
+         }
+      }
+      else{
+         const size_type ls = n->left->size;
+         node_ptr t = node_ptr();
+         node_guard gt(*this, t);
+         if(pos <= ls){
+            this->priv_split(n->left, pos, l ? &ln : 0, r ? &t : 0);
+            if(r){
+               rn = this->priv_join(t, n->right);
+            }
+         }
+         else{
+            this->priv_split(n->right, size_type(pos - ls), l ? &t : 0, r ? &rn : 0);
+            if(l){
+               ln = this->priv_join(n->left, t);
+            }
+         }
+      }
+      if(l){
+         *l = ln;
+         ln = node_ptr();
+      }
+      if(r){
+         *r = rn;
+         rn = node_ptr();
+      }
+   }
+
+   //Builds a balanced tree with n > 0 characters obtained from src, in chunks of
+   //chunk_size characters (the last one can be smaller).
+   template<class Source>
+   node_ptr priv_build(Source &src, size_type n)
+   {
+      if(n <= chunk_size){
+         const node_ptr l = this->priv_new_leaf(n);
+         src.copy(priv_chars(l), n);
+         l->size = n;
+         return l;
+      }
+      const size_type chunks = size_type((n - 1u)/chunk_size + 1u);
+      const size_type ln = size_type(chunks/2u*chunk_size);
+      node_ptr l = this->priv_build(src, ln);
+      node_guard gl(*this, l);
+      node_ptr r = this->priv_build(src, size_type(n - ln));
+      node_guard gr(*this, r);
+      return this->priv_new_inner(l, r);
+   }
+
+   //Returns a tree with all the characters of x (owned by the caller).
+   //Precondition: x's allocator is equal to this allocator
+   node_ptr priv_whole_of(const basic_rope &x)
+   {  return this->priv_join(x.m_.root, x.m_.tail);  }
+
+   //Links the tail to the tree
+   void priv_flush()
+   {
+      if(m_.tail){
+         const node_ptr r = m_.tail->size ? this->priv_join(m_.root, m_.tail) : priv_retain(m_.root);
+         this->priv_release(m_.root);
+         this->priv_release(m_.tail);
+         m_.root = r;
+         m_.tail = node_ptr();
+      }
+   }
+
+   //Replaces characters [pos, pos + n) with the tree w (borrowed, can be null)
+   void priv_replace(size_type pos, size_type n, const node_ptr &w)
+   {
+      this->priv_flush();
+      node_ptr a = node_ptr(), c = node_ptr(), aw = node_ptr();
+      node_guard ga(*this, a), gc(*this, c), gaw(*this, aw);
+      this->priv_split(m_.root, pos, &a, 0);
+      this->priv_split(m_.root, size_type(pos + n), 0, &c);
+      aw = this->priv_join(a, w);
+      const node_ptr r = this->priv_join(aw, c);
+      this->priv_release(m_.root);
+      m_.root = r;
+   }
+
+   template<class Source>
+   void priv_append(Source &src, size_type n)
+   {
+      //Fast path: the characters fit in a tail not shared with other ropes
+      const node_ptr &t = m_.tail;
+      if(t && size_type(t->capacity - t->size) >= n && priv_unique(t)){
+         src.copy(priv_chars(t) + t->size, n);
+         t->size = size_type(t->size + n);
+      }
+      else if(n){
+         this->priv_check_length(n);
+         this->priv_append_slow(src, n);
+      }
+   }
+
+   template<class Source>
+   void priv_append_slow(Source &src, size_type n)
+   {
+      const size_type tsize = m_.tail ? m_.tail->size : 0u;
+      if(size_type(tsize + n) <= chunk_size){
+         //The result fits in a chunk: grow the tail geometrically (or unshare it)
+         size_type cap = m_.tail ? size_type(m_.tail->capacity*2u) : 0u;
+         cap = dtl::min_value(dtl::max_value(cap, size_type(tsize + n)), chunk_size);
+         const node_ptr nt = this->priv_new_leaf(cap);
+         if(tsize){
+            Traits::copy(priv_chars(nt), priv_chars(m_.tail), tsize);
+         }
+         src.copy(priv_chars(nt) + tsize, n);
+         nt->size = size_type(tsize + n);
+         this->priv_release(m_.tail);
+         m_.tail = nt;
+         return;
+      }
+
+      //A tail not shared with other ropes and with capacity for a chunk is completed in place,
+      //and restored if an exception is thrown. Otherwise the chunk is completed in a copy.
+      const bool in_place = tsize && m_.tail->capacity >= chunk_size && priv_unique(m_.tail);
+      BOOST_CONTAINER_TRY{
+         this->priv_append_chunks(src, n, in_place);
+      }
+      BOOST_CONTAINER_CATCH(...){
+         if(in_place){
+            m_.tail->size = tsize;
+         }
+         BOOST_CONTAINER_RETHROW
+      }
+      BOOST_CONTAINER_CATCH_END
+   }
+
+   //Completes a chunk with the tail and the first characters of src and links it to the tree.
+   //The rest of the characters are stored in chunks linked to the tree and in a new tail.
+   template<class Source>
+   void priv_append_chunks(Source &src, size_type n, bool in_place)
+   {
+      //The new state is built apart, so that the rope is not modified if an exception is thrown
+      node_ptr root = priv_retain(m_.root), tail = node_ptr();
+      node_guard groot(*this, root), gtail(*this, tail);
+      const size_type tsize = m_.tail ? m_.tail->size : 0u;
+      if(tsize){
+         if(in_place){
+            tail = priv_retain(m_.tail);
+         }
+         else{
+            tail = this->priv_new_leaf(dtl::max_value(tsize, chunk_size));
+            Traits::copy(priv_chars(tail), priv_chars(m_.tail), tsize);
+         }
+         const size_type k = dtl::min_value(size_type(tail->capacity - tsize), n);
+         src.copy(priv_chars(tail) + tsize, k);
+         tail->size = size_type(tsize + k);
+         n = size_type(n - k);
+         const node_ptr r = this->priv_join(root, tail);
+         this->priv_release(root);
+         root = r;
+         this->priv_release(tail);
+         tail = node_ptr();
+      }
+      if(n > chunk_size){
+         //Complete chunks are linked as a balanced tree, the rest goes to the new tail
+         size_type rest = size_type(n % chunk_size);
+         rest = rest ? rest : chunk_size;
+         node_ptr b = this->priv_build(src, size_type(n - rest));
+         node_guard gb(*this, b);
+         const node_ptr r = this->priv_join(root, b);
+         this->priv_release(root);
+         root = r;
+         n = rest;
+      }
+      if(n){
+         //Characters are being streamed, so the new tail can hold a whole chunk
+         tail = this->priv_new_leaf(chunk_size);
+         src.copy(priv_chars(tail), n);
+         tail->size = n;
+      }
+      this->priv_release(m_.root);
+      this->priv_release(m_.tail);
+      m_.root = root;
+      m_.tail = tail;
+      root = tail = node_ptr();
+   }
+
+   struct impl : node_allocator_type
+   {
+      BOOST_MOVABLE_BUT_NOT_COPYABLE(impl)
+
+      public:
+      impl()
+         : node_allocator_type(), root(), tail()
+      {}
+
+      explicit impl(const node_allocator_type &a)
+         : node_allocator_type(a), root(), tail()
+      {}
+
+      impl(BOOST_RV_REF(impl) m)
+         : node_allocator_type(BOOST_MOVE_BASE(node_allocator_type, m))
+         , root(m.root), tail(m.tail)
+      {
+         m.root = node_ptr();
+         m.tail = node_ptr();
+      }
+
+      node_ptr root;
+      node_ptr tail;
+   } m_;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+template <class CharT, class Traits, class Allocator, class Options>
+const typename basic_rope<CharT, Traits, Allocator, Options>::size_type
+   basic_rope<CharT, Traits, Allocator, Options>::npos;
+
+template <class CharT, class Traits, class Allocator, class Options>
+const typename basic_rope<CharT, Traits, Allocator, Options>::size_type
+   basic_rope<CharT, Traits, Allocator, Options>::chunk_size;
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_ROPE_HPP
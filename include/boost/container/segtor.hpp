@@ -22,6 +22,7 @@
 #include <boost/container/detail/config_begin.hpp>
 #include <boost/container/detail/workaround.hpp>
 #include <boost/container/detail/deque_impl.hpp>
+#include <boost/container/trivially_relocatable.hpp>
 
 namespace boost {
 namespace container {
@@ -890,6 +891,19 @@ struct has_trivial_destructor_after_move<boost::container::segtor<T, Allocator,
    : has_trivial_destructor_after_move<boost::container::deque_impl<T, Allocator, true, Options> >
 {};
 
+namespace container {
+
+//!is_trivially_relocatable<> == true_type
+//!specialization for optimizations
+template <class T, class Allocator, class Options>
+struct is_trivially_relocatable<boost::container::segtor<T, Allocator, Options> >
+   : dtl::is_trivially_relocatable_holder
+      < typename boost::container::segtor<T, Allocator, Options>::allocator_type
+      , typename boost::container::segtor<T, Allocator, Options>::pointer>
+{};
+
+}  //namespace container {
+
 }  //namespace boost {
 
 #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
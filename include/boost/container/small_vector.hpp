@@ -30,6 +30,9 @@
 // container/detail
 #include <boost/container/detail/type_traits.hpp>
 #include <boost/container/detail/version_type.hpp>
+#ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+#include <boost/container/inline_storage_stats.hpp>
+#endif
 
 //move
 #include <boost/move/adl_move_swap.hpp>
@@ -318,6 +321,20 @@ struct small_vector_storage<T, 0u, Alignment>
    BOOST_STATIC_CONSTEXPR std::size_t sms_size = 0u;
 };
 
+//The internal capacity is stored in the capacity field of the vector,
+//so it must be representable by the stored_size option, if any.
+template<class StoredSizeType, std::size_t N>
+struct small_vector_capacity_fits_stored_size
+{
+   BOOST_STATIC_CONSTEXPR bool value = N <= std::size_t(StoredSizeType(-1));
+};
+
+template<std::size_t N>
+struct small_vector_capacity_fits_stored_size<void, N>
+{
+   BOOST_STATIC_CONSTEXPR bool value = true;
+};
+
 #endif   //BOOST_CONTAINER_DOXYGEN_INVOKED
 
 //! This class consists of common code from all small_vector<T, N> types that don't depend on the
@@ -832,6 +849,29 @@ class small_vector
    //! @brief The capacity/max size of the container
    BOOST_STATIC_CONSTEXPR size_type static_capacity = small_vector_storage_definer<T, N, Options>::type::sms_size;
 
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   BOOST_CONTAINER_STATIC_ASSERT_MSG
+      (( small_vector_capacity_fits_stored_size
+            <typename dtl::get_small_vector_opt<Options>::type::stored_size_type, static_capacity>::value )
+      , "small_vector: the internal capacity is not representable by the stored_size option");
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   #ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+   //! <b>Returns</b>: The statistics of this small_vector instantiation.
+   //!
+   //! <b>Note</b>: Only available if BOOST_CONTAINER_INLINE_STORAGE_STATS is defined.
+   static inline_storage_stats &storage_stats() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return dtl::inline_storage_stats_of<small_vector, static_capacity>::instance;  }
+
+   //! <b>Effects</b>: Records in storage_stats() the maximum size reached by the small_vector
+   //!   and if dynamic storage was used, and destroys the elements.
+   ~small_vector()
+   {
+      const size_type max_size = this->protected_max_size_reached();
+      storage_stats().record(max_size, max_size > static_capacity || !this->is_small());
+   }
+   #endif   //#ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+
    public:
    //! <b>Effects</b>: Constructs an empty small_vector using its internal storage; no dynamic
    //!   memory allocation is performed.
@@ -0,0 +1,299 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_SPSC_QUEUE_HPP
+#define BOOST_CONTAINER_SPSC_QUEUE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#if defined(BOOST_NO_CXX11_HDR_ATOMIC) || defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+#error "boost/container/spsc_queue.hpp requires C++11 atomics and variadic templates"
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+// container
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/allocator_traits.hpp>
+// container/detail
+#include <boost/container/detail/bounded_queue_storage.hpp>
+#include <boost/container/detail/min_max.hpp>
+#include <boost/container/detail/placement_new.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// move
+#include <boost/move/utility_core.hpp>
+// std
+#include <atomic>
+#include <cstddef>
+
+namespace boost {
+namespace container {
+
+//! A bounded, lock-free, single-producer/single-consumer FIFO queue.
+//!
+//! One thread can push elements while another thread pops them, without locks:
+//! each side only writes its own index, and indices are placed in different
+//! cache lines. Each side also caches the last value it read from the other side's index,
+//! so that the shared cache line is only read when the queue looks full (producer) or empty (consumer).
+//!
+//! push_n and pop_n transfer several elements publishing the new index once.
+//!
+//! \tparam T The type of the stored elements.
+//! \tparam Capacity If not zero, the number of elements that can be stored in the queue,
+//!   which must be a power of two. Elements are stored inline, like in static_vector.
+//!   If zero, the capacity is specified at construction time (and rounded up to a power of two),
+//!   and the buffer is obtained from the allocator.
+//! \tparam Allocator The allocator used to obtain the buffer when Capacity is zero, use void
+//!   for the default allocator. Elements are constructed with placement new.
+template <class T, std::size_t Capacity BOOST_CONTAINER_DOCONLY(= 0u), class Allocator BOOST_CONTAINER_DOCONLY(= void)>
+class spsc_queue
+{
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   typedef dtl::bounded_queue_storage
+      <T, Capacity, typename real_allocator<T, Allocator>::type>   storage_t;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   public:
+   typedef T                                                      value_type;
+   typedef BOOST_CONTAINER_IMPDEF
+      (typename real_allocator<T BOOST_MOVE_I Allocator>::type)   allocator_type;
+   typedef std::size_t                                            size_type;
+
+   //! <b>Effects</b>: Constructs an empty queue that stores up to Capacity elements inline.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: Only available if Capacity is not zero.
+   spsc_queue() BOOST_NOEXCEPT_OR_NOTHROW
+      : m_storage(), m_tail(), m_head()
+   {}
+
+   //! <b>Effects</b>: Constructs an empty queue that stores up to `capacity` elements
+   //!   (rounded up to a power of two), allocating the buffer with a copy of a.
+   //!
+   //! <b>Throws</b>: length_error if capacity is zero or too big, or if the allocation throws.
+   //!
+   //! <b>Note</b>: Only available if Capacity is zero.
+   explicit spsc_queue(size_type capacity, const allocator_type &a = allocator_type())
+      : m_storage(capacity, a), m_tail(), m_head()
+   {}
+
+   //! <b>Effects</b>: Destroys the elements still in the queue and deallocates the buffer.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements in the queue.
+   ~spsc_queue()
+   {
+      BOOST_IF_CONSTEXPR(!dtl::is_trivially_destructible<T>::value){
+         const std::size_t tail = m_tail.index.load(std::memory_order_relaxed);
+         for(std::size_t head = m_head.index.load(std::memory_order_relaxed); head != tail; ++head){
+            this->priv_slot(head)->~T();
+         }
+      }
+   }
+
+   //! <b>Effects</b>: Returns a copy of the allocator used to obtain the buffer.
+   allocator_type get_allocator() const
+   {  return m_storage.get_allocator();  }
+
+   //! <b>Returns</b>: The maximum number of elements the queue can hold.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD size_type capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_storage.capacity();  }
+
+   //! <b>Returns</b>: The number of elements in the queue. If called while other threads push
+   //!   or pop elements, the value might be outdated when returned.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD size_type size() const BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const std::size_t head = m_head.index.load(std::memory_order_acquire);
+      const std::size_t tail = m_tail.index.load(std::memory_order_acquire);
+      return tail - head;
+   }
+
+   //! <b>Returns</b>: size() == 0.
+   //!
+   //! <b>Complexity</b>: Constant.
+   BOOST_CONTAINER_NODISCARD bool empty() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return !this->size();  }
+
+   //! <b>Effects</b>: If the queue is not full, constructs a new element at the end of the queue
+   //!   with std::forward<Args>(args)...
+   //!
+   //! <b>Returns</b>: true if the element was inserted, false if the queue was full.
+   //!
+   //! <b>Throws</b>: If T's constructor throws. In that case the queue is not modified.
+   //!
+   //! <b>Note</b>: Must only be called from the producer thread.
+   template<class ...Args>
+   bool try_emplace(BOOST_FWD_REF(Args)... args)
+   {
+      const std::size_t tail = m_tail.index.load(std::memory_order_relaxed);
+      if(!this->priv_free_slots(tail, 1u)){
+         return false;
+      }
+      ::new(this->priv_slot(tail), boost_container_new_t()) T(::boost::forward<Args>(args)...);
+      m_tail.index.store(tail + 1u, std::memory_order_release);
+      return true;
+   }
+
+   //! <b>Effects</b>: If the queue is not full, inserts a copy of x at the end of the queue.
+   //!
+   //! <b>Returns</b>: true if the element was inserted, false if the queue was full.
+   //!
+   //! <b>Note</b>: Must only be called from the producer thread.
+   bool try_push(const T &x)
+   {  return this->try_emplace(x);  }
+
+   //! <b>Effects</b>: If the queue is not full, inserts x at the end of the queue
+   //!   using T's move constructor.
+   //!
+   //! <b>Returns</b>: true if the element was inserted, false if the queue was full.
+   //!
+   //! <b>Note</b>: Must only be called from the producer thread.
+   bool try_push(BOOST_RV_REF(T) x)
+   {  return this->try_emplace(::boost::move(x));  }
+
+   //! <b>Effects</b>: Inserts at the end of the queue copies of the first
+   //!   min(n, capacity() - size()) elements of the range starting at first.
+   //!   Inserted elements are visible to the consumer all at once.
+   //!
+   //! <b>Returns</b>: The number of inserted elements.
+   //!
+   //! <b>Throws</b>: If T's constructor throws. Elements constructed before the exception
+   //!   are inserted.
+   //!
+   //! <b>Note</b>: Must only be called from the producer thread.
+   template<class InpIt>
+   size_type push_n(InpIt first, size_type n)
+   {
+      const std::size_t tail = m_tail.index.load(std::memory_order_relaxed);
+      n = dtl::min_value(n, this->priv_free_slots(tail, n));
+      std::size_t i = 0u;
+      BOOST_CONTAINER_TRY{
+         for(; i != n; ++i, ++first){
+            ::new(this->priv_slot(tail + i), boost_container_new_t()) T(*first);
+         }
+      }
+      BOOST_CONTAINER_CATCH(...){
+         m_tail.index.store(tail + i, std::memory_order_release);
+         BOOST_CONTAINER_RETHROW
+      }
+      BOOST_CONTAINER_CATCH_END
+      m_tail.index.store(tail + n, std::memory_order_release);
+      return n;
+   }
+
+   //! <b>Effects</b>: If the queue is not empty, move assigns the first element to out
+   //!   and removes it from the queue.
+   //!
+   //! <b>Returns</b>: true if an element was removed, false if the queue was empty.
+   //!
+   //! <b>Throws</b>: If T's move assignment throws. In that case the queue is not modified.
+   //!
+   //! <b>Note</b>: Must only be called from the consumer thread.
+   bool try_pop(T &out)
+   {
+      const std::size_t head = m_head.index.load(std::memory_order_relaxed);
+      if(!this->priv_available(head, 1u)){
+         return false;
+      }
+      T *const p = this->priv_slot(head);
+      out = ::boost::move(*p);
+      p->~T();
+      m_head.index.store(head + 1u, std::memory_order_release);
+      return true;
+   }
+
+   //! <b>Effects</b>: Move assigns up to n elements from the front of the queue to the range
+   //!   starting at out and removes them. Freed slots are visible to the producer all at once.
+   //!
+   //! <b>Returns</b>: The number of removed elements.
+   //!
+   //! <b>Throws</b>: If the assignment throws. Elements assigned before the exception are removed.
+   //!
+   //! <b>Note</b>: Must only be called from the consumer thread.
+   template<class OutIt>
+   size_type pop_n(OutIt out, size_type n)
+   {
+      const std::size_t head = m_head.index.load(std::memory_order_relaxed);
+      n = dtl::min_value(n, this->priv_available(head, n));
+      std::size_t i = 0u;
+      BOOST_CONTAINER_TRY{
+         for(; i != n; ++i, ++out){
+            T *const p = this->priv_slot(head + i);
+            *out = ::boost::move(*p);
+            p->~T();
+         }
+      }
+      BOOST_CONTAINER_CATCH(...){
+         m_head.index.store(head + i, std::memory_order_release);
+         BOOST_CONTAINER_RETHROW
+      }
+      BOOST_CONTAINER_CATCH_END
+      m_head.index.store(head + n, std::memory_order_release);
+      return n;
+   }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   private:
+   spsc_queue(const spsc_queue &);
+   spsc_queue &operator=(const spsc_queue &);
+
+   BOOST_CONTAINER_FORCEINLINE T *priv_slot(std::size_t index) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return m_storage.slots() + (index & (m_storage.capacity() - 1u));  }
+
+   //Number of free slots seen by the producer, that only reads the consumer
+   //index when the cached value says there are less than "wanted" free slots
+   BOOST_CONTAINER_FORCEINLINE std::size_t priv_free_slots(std::size_t tail, std::size_t wanted) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      const std::size_t cap = m_storage.capacity();
+      std::size_t free_slots = cap - (tail - m_tail.cached);
+      if(free_slots < wanted){
+         m_tail.cached = m_head.index.load(std::memory_order_acquire);
+         free_slots = cap - (tail - m_tail.cached);
+      }
+      return free_slots;
+   }
+
+   //Number of elements seen by the consumer, that only reads the producer
+   //index when the cached value says there are less than "wanted" elements
+   BOOST_CONTAINER_FORCEINLINE std::size_t priv_available(std::size_t head, std::size_t wanted) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      std::size_t available = m_head.cached - head;
+      if(available < wanted){
+         m_head.cached = m_tail.index.load(std::memory_order_acquire);
+         available = m_head.cached - head;
+      }
+      return available;
+   }
+
+   storage_t                              m_storage;
+   //Producer: index of the next slot to fill and cached consumer index
+   dtl::queue_index<std::size_t>          m_tail;
+   //Consumer: index of the next slot to read and cached producer index
+   dtl::queue_index<std::size_t>          m_head;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_SPSC_QUEUE_HPP
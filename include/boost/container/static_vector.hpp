@@ -36,6 +36,64 @@ namespace boost { namespace container {
 
 namespace dtl {
 
+//Raw storage for N elements of type T
+template<class T, std::size_t N, std::size_t Alignment, bool ElementArray>
+struct static_storage
+{
+   //GCC in C++03 regressions fails, due to a bug in strict-aliasing optimizations
+   #if defined(BOOST_GCC) && (BOOST_GCC >= 120000) && (BOOST_CXX_VERSION < 201103L)
+   #pragma GCC push_options
+   #pragma GCC optimize("no-strict-aliasing")
+   #endif
+
+   BOOST_CONTAINER_FORCEINLINE T* data() const BOOST_NOEXCEPT_OR_NOTHROW
+   //Avoiding launder due to performance regressions, see https://github.com/boostorg/container/issues/309
+   {  return const_cast<T*>(static_cast<const T*>(static_cast<const void*>(m_storage.data)));  }
+
+   #if defined(BOOST_GCC) && (BOOST_GCC >= 120000) && (BOOST_CXX_VERSION < 201103L)
+   #pragma GCC pop_options
+   #endif
+
+   typename dtl::aligned_storage<sizeof(T)*N, Alignment>::type m_storage;
+};
+
+#if defined(BOOST_CONTAINER_HAS_CXX20_CONSTEXPR)
+
+//Trivial types are stored in an array of T, as casts from raw memory are not allowed in constant
+//expressions. Elements are only initialized in constant evaluation (a constant can't hold
+//uninitialized objects), so runtime construction costs the same as the raw storage.
+template<class T, std::size_t N, std::size_t Alignment>
+struct static_storage<T, N, Alignment, true>
+{
+   constexpr static_storage() noexcept
+   {
+      if(BOOST_CONTAINER_IS_CONSTANT_EVALUATED()){
+         for(std::size_t i = 0; i != N; ++i){
+            ::std::construct_at(&m_elems[i]);
+         }
+      }
+   }
+
+   BOOST_CONTAINER_FORCEINLINE constexpr T* data() const noexcept
+   {  return const_cast<T*>(m_elems);  }
+
+   alignas(Alignment) T m_elems[N];
+};
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_CXX20_CONSTEXPR)
+
+//Selects static_storage's element array, which makes static_vector usable in constant expressions
+template<class T, std::size_t N, std::size_t Alignment>
+struct is_static_storage_element_array
+{
+   #if defined(BOOST_CONTAINER_HAS_CXX20_CONSTEXPR)
+   BOOST_STATIC_CONSTEXPR bool value = N != 0u && Alignment >= dtl::alignment_of<T>::value
+      && dtl::is_trivially_default_constructible<T>::value && dtl::is_trivially_destructible<T>::value;
+   #else
+   BOOST_STATIC_CONSTEXPR bool value = false;
+   #endif
+};
+
 template<class T, std::size_t N, std::size_t InplaceAlignment, bool ThrowOnOverflow>
 class static_storage_allocator
 {
@@ -54,35 +112,24 @@ class static_storage_allocator
    public:
    typedef T value_type;
 
-   inline static_storage_allocator() BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 static_storage_allocator() BOOST_NOEXCEPT_OR_NOTHROW
    {}
 
-   inline static_storage_allocator(const static_storage_allocator &) BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 static_storage_allocator(const static_storage_allocator &) BOOST_NOEXCEPT_OR_NOTHROW
    {}
 
-   inline static_storage_allocator & operator=(const static_storage_allocator &) BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 static_storage_allocator & operator=(const static_storage_allocator &) BOOST_NOEXCEPT_OR_NOTHROW
    {  return *this;  }
 
-   //GCC in C++03 regressions fails, due to a bug in strict-aliasing optimizations
-   #if defined(BOOST_GCC) && (BOOST_GCC >= 120000) && (BOOST_CXX_VERSION < 201103L)
-   #pragma GCC push_options
-   #pragma GCC optimize("no-strict-aliasing")
-   #endif
-
-   BOOST_CONTAINER_FORCEINLINE T* internal_storage() const BOOST_NOEXCEPT_OR_NOTHROW
-   //Avoiding launder due to performance regressions, see https://github.com/boostorg/container/issues/309
-   {  return const_cast<T*>(static_cast<const T*>(static_cast<const void*>(storage.data)));  }
-
-   #if defined(BOOST_GCC) && (BOOST_GCC >= 120000) && (BOOST_CXX_VERSION < 201103L)
-   #pragma GCC pop_options
-   #endif
+   BOOST_CONTAINER_FORCEINLINE BOOST_CONTAINER_CONSTEXPR20 T* internal_storage() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return storage.data();  }
 
    BOOST_STATIC_CONSTEXPR std::size_t internal_capacity = N;
 
-   std::size_t max_size() const
+   BOOST_CONTAINER_CONSTEXPR20 std::size_t max_size() const
    {  return N;   }
 
-   static inline void on_capacity_overflow()
+   static inline BOOST_CONTAINER_CONSTEXPR20 void on_capacity_overflow()
    {
       (on_capacity_overflow)(throw_on_overflow_t());
    }
@@ -98,7 +145,7 @@ class static_storage_allocator
    private:
    BOOST_CONTAINER_STATIC_ASSERT_MSG(!InplaceAlignment || (InplaceAlignment & (InplaceAlignment-1)) == 0, "Alignment option must be zero or power of two");
    BOOST_STATIC_CONSTEXPR std::size_t final_alignment = InplaceAlignment ? InplaceAlignment : dtl::alignment_of<T>::value;
-   typename dtl::aligned_storage<sizeof(T)*N, final_alignment>::type storage;
+   static_storage<T, N, final_alignment, is_static_storage_element_array<T, N, final_alignment>::value> storage;
 };
 
 template<class Options>
@@ -226,7 +273,7 @@ public:
     //!
     //! @par Complexity
     //!   Constant O(1).
-    inline static_vector() BOOST_NOEXCEPT_OR_NOTHROW
+    inline BOOST_CONTAINER_CONSTEXPR20 static_vector() BOOST_NOEXCEPT_OR_NOTHROW
         : base_t()
     {}
 
@@ -242,7 +289,7 @@ public:
     //!
     //! @par Complexity
     //!   Linear O(N).
-    inline explicit static_vector(size_type count)
+    inline BOOST_CONTAINER_CONSTEXPR20 explicit static_vector(size_type count)
         : base_t(count)
     {}
 
@@ -261,7 +308,7 @@ public:
     //!
     //! @par Note
     //!   Non-standard extension
-    inline static_vector(size_type count, default_init_t)
+    inline BOOST_CONTAINER_CONSTEXPR20 static_vector(size_type count, default_init_t)
         : base_t(count, default_init_t())
     {}
 
@@ -278,7 +325,7 @@ public:
     //!
     //! @par Complexity
     //!   Linear O(N).
-    inline static_vector(size_type count, value_type const& value)
+    inline BOOST_CONTAINER_CONSTEXPR20 static_vector(size_type count, value_type const& value)
         : base_t(count, value)
     {}
 
@@ -298,7 +345,7 @@ public:
     //! @par Complexity
     //!   Linear O(N).
     template <typename Iterator>
-    inline static_vector(Iterator first, Iterator last)
+    inline BOOST_CONTAINER_CONSTEXPR20 static_vector(Iterator first, Iterator last)
         : base_t(first, last)
     {}
 
@@ -316,7 +363,7 @@ public:
     //!
     //! @par Complexity
     //!   Linear O(N).
-    inline static_vector(std::initializer_list<value_type> il)
+    inline BOOST_CONTAINER_CONSTEXPR20 static_vector(std::initializer_list<value_type> il)
         : base_t(il)
     {}
 #endif
@@ -330,20 +377,20 @@ public:
     //!
     //! @par Complexity
     //!   Linear O(N).
-    inline static_vector(static_vector const& other)
+    inline BOOST_CONTAINER_CONSTEXPR20 static_vector(static_vector const& other)
         : base_t(other)
     {}
 
-    inline static_vector(static_vector const& other, const allocator_type &)
+    inline BOOST_CONTAINER_CONSTEXPR20 static_vector(static_vector const& other, const allocator_type &)
        : base_t(other)
     {}
 
-    inline static_vector(BOOST_RV_REF(static_vector) other,  const allocator_type &)
+    inline BOOST_CONTAINER_CONSTEXPR20 static_vector(BOOST_RV_REF(static_vector) other,  const allocator_type &)
        BOOST_NOEXCEPT_IF(boost::container::dtl::is_nothrow_move_constructible<value_type>::value)
        : base_t(BOOST_MOVE_BASE(base_t, other))
     {}
 
-    inline explicit static_vector(const allocator_type &)
+    inline BOOST_CONTAINER_CONSTEXPR20 explicit static_vector(const allocator_type &)
        : base_t()
     {}
 
@@ -360,7 +407,7 @@ public:
     //! @par Complexity
     //!   Linear O(N).
     template <std::size_t C, class O>
-    inline static_vector(static_vector<T, C, O> const& other)
+    inline BOOST_CONTAINER_CONSTEXPR20 static_vector(static_vector<T, C, O> const& other)
         : base_t(other)
     {}
 
@@ -374,7 +421,7 @@ public:
     //!
     //! @par Complexity
     //!   Linear O(N).
-    inline static_vector(BOOST_RV_REF(static_vector) other)
+    inline BOOST_CONTAINER_CONSTEXPR20 static_vector(BOOST_RV_REF(static_vector) other)
       BOOST_NOEXCEPT_IF(boost::container::dtl::is_nothrow_move_constructible<value_type>::value)
         : base_t(BOOST_MOVE_BASE(base_t, other))
     {}
@@ -393,7 +440,7 @@ public:
     //! @par Complexity
     //!   Linear O(N).
     template <std::size_t C, class O>
-    inline static_vector(BOOST_RV_REF_BEG static_vector<T, C, O> BOOST_RV_REF_END other)
+    inline BOOST_CONTAINER_CONSTEXPR20 static_vector(BOOST_RV_REF_BEG static_vector<T, C, O> BOOST_RV_REF_END other)
         : base_t(BOOST_MOVE_BASE(typename static_vector<T BOOST_MOVE_I C>::base_t, other))
     {}
 
@@ -406,7 +453,7 @@ public:
     //!
     //! @par Complexity
     //! Linear O(N).
-    inline static_vector & operator=(BOOST_COPY_ASSIGN_REF(static_vector) other)
+    inline BOOST_CONTAINER_CONSTEXPR20 static_vector & operator=(BOOST_COPY_ASSIGN_REF(static_vector) other)
     {
         return static_cast<static_vector&>(base_t::operator=(static_cast<base_t const&>(other)));
     }
@@ -422,7 +469,7 @@ public:
     //!
     //! @par Complexity
     //! Linear O(N).
-    inline static_vector & operator=(std::initializer_list<value_type> il)
+    inline BOOST_CONTAINER_CONSTEXPR20 static_vector & operator=(std::initializer_list<value_type> il)
     { return static_cast<static_vector&>(base_t::operator=(il));  }
 #endif
 
@@ -439,7 +486,7 @@ public:
     //! @par Complexity
     //!   Linear O(N).
     template <std::size_t C, class O>
-    inline static_vector & operator=(static_vector<T, C, O> const& other)
+    inline BOOST_CONTAINER_CONSTEXPR20 static_vector & operator=(static_vector<T, C, O> const& other)
     {
         return static_cast<static_vector&>(base_t::operator=
             (static_cast<typename static_vector<T, C, O>::base_t const&>(other)));
@@ -455,7 +502,7 @@ public:
     //!
     //! @par Complexity
     //!   Linear O(N).
-    inline static_vector & operator=(BOOST_RV_REF(static_vector) other)
+    inline BOOST_CONTAINER_CONSTEXPR20 static_vector & operator=(BOOST_RV_REF(static_vector) other)
        BOOST_NOEXCEPT_IF(boost::container::dtl::is_nothrow_move_assignable<value_type>::value)
     {
         return static_cast<static_vector&>(base_t::operator=(BOOST_MOVE_BASE(base_t, other)));
@@ -475,7 +522,7 @@ public:
     //! @par Complexity
     //!   Linear O(N).
     template <std::size_t C, class O>
-    inline static_vector & operator=(BOOST_RV_REF_BEG static_vector<T, C, O> BOOST_RV_REF_END other)
+    inline BOOST_CONTAINER_CONSTEXPR20 static_vector & operator=(BOOST_RV_REF_BEG static_vector<T, C, O> BOOST_RV_REF_END other)
     {
         return static_cast<static_vector&>(base_t::operator=
          (BOOST_MOVE_BASE(typename static_vector<T BOOST_MOVE_I C>::base_t, other)));
@@ -1228,7 +1275,7 @@ public:
    //!
    //! @par Complexity
    //!   Constant O(1).
-   inline static size_type capacity() BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 static size_type capacity() BOOST_NOEXCEPT_OR_NOTHROW
    { return static_capacity; }
 
    //! @brief Returns container's capacity.
@@ -1240,7 +1287,7 @@ public:
    //!
    //! @par Complexity
    //!   Constant O(1).
-   inline static size_type max_size() BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 static size_type max_size() BOOST_NOEXCEPT_OR_NOTHROW
    { return static_capacity; }
 
    #ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
@@ -1269,7 +1316,7 @@ public:
     bool empty() const BOOST_NOEXCEPT_OR_NOTHROW;
 #else
 
-   inline friend void swap(static_vector &x, static_vector &y)
+   inline BOOST_CONTAINER_CONSTEXPR20 friend void swap(static_vector &x, static_vector &y)
        BOOST_NOEXCEPT_IF(BOOST_NOEXCEPT(x.swap(y)))
    {
       x.swap(y);
@@ -1369,7 +1416,7 @@ inline void swap(static_vector<V, C1, O1> & x, static_vector<V, C2, O2> & y)
 #else
 
 template<typename V, std::size_t C1, std::size_t C2, class O1, class O2>
-inline void swap(static_vector<V, C1, O1> & x, static_vector<V, C2, O2> & y
+inline BOOST_CONTAINER_CONSTEXPR20 void swap(static_vector<V, C1, O1> & x, static_vector<V, C2, O2> & y
       , typename dtl::enable_if_c< C1 != C2>::type * = 0)
     BOOST_NOEXCEPT_IF(BOOST_NOEXCEPT(x.swap(y)))
 {
@@ -1400,6 +1447,17 @@ inline typename static_vector<T, N, O>::size_type erase_if(static_vector<T, N, O
    return old_size - c.size();
 }
 
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//!is_trivially_relocatable<> == true_type
+//!specialization for optimizations
+template <class T, std::size_t N, class O>
+struct is_trivially_relocatable< static_vector<T, N, O> >
+   : is_trivially_relocatable<T>
+{};
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
 }} // namespace boost::container
 
 #include <boost/container/detail/config_end.hpp>
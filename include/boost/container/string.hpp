@@ -27,6 +27,7 @@
 #include <boost/container/new_allocator.hpp> //new_allocator
 #include <boost/container/throw_exception.hpp>
 #include <boost/container/options.hpp>
+#include <boost/container/trivially_relocatable.hpp>
 // container/detail
 #include <boost/container/detail/alloc_helpers.hpp>
 #include <boost/container/detail/allocator_version_traits.hpp>
@@ -40,7 +41,11 @@
 #include <boost/container/detail/version_type.hpp>
 #include <boost/container/detail/type_traits.hpp>
 #include <boost/container/detail/algorithm.hpp>
+#include <boost/container/detail/string_algo.hpp>
 #include <boost/container/detail/minimal_char_traits_header.hpp>  // for char_traits
+#ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+#include <boost/container/inline_storage_stats.hpp>
+#endif
 //intrusive
 #include <boost/intrusive/pointer_traits.hpp>
 #include <boost/intrusive/detail/hash_combine.hpp>
@@ -128,24 +133,39 @@ class basic_string_base
 
    inline basic_string_base()
       : members_()
+      #ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+      , m_max_size(0u)
+      #endif
    {}
 
    inline explicit basic_string_base(const allocator_type& a)
       : members_(a)
+      #ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+      , m_max_size(0u)
+      #endif
    {}
 
    inline explicit basic_string_base(BOOST_RV_REF(allocator_type) a)
       :  members_(boost::move(a))
+      #ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+      , m_max_size(0u)
+      #endif
    {}
 
    inline basic_string_base(const allocator_type& a, size_type n)
       : members_(a)
+      #ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+      , m_max_size(0u)
+      #endif
    {
       this->allocate_initial_block(n);
    }
 
    inline explicit basic_string_base(size_type n)
       : members_()
+      #ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+      , m_max_size(0u)
+      #endif
    {
       this->allocate_initial_block(n);
    }
@@ -298,6 +318,21 @@ class basic_string_base
       repr_t m_repr;
    } members_;
 
+   #ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+   //Maximum size reached by the string
+   size_type m_max_size;
+   #endif
+
+   inline void priv_track_max_size(size_type sz)
+   {
+      #ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+      if(sz > m_max_size)
+         m_max_size = sz;
+      #else
+      (void)sz;
+      #endif
+   }
+
    inline const allocator_type &alloc() const
    {  return members_;  }
 
@@ -379,6 +414,33 @@ class basic_string_base
          reuse = 0;
          command &= ~(expand_fwd | expand_bwd);
       }
+      //The received size might not be representable in the (half) stored_size_type
+      size_type max_storage = allocator_traits_type::max_size(this->alloc());
+      (clamp_by_half_stored_size_type<size_type>)(max_storage, stored_size_type());
+      pointer const p = this->priv_allocation_command
+         (alloc_version(), command, limit_size, prefer_in_recvd_out_size, reuse, max_storage);
+      if(prefer_in_recvd_out_size > max_storage)
+         prefer_in_recvd_out_size = max_storage;
+      return p;
+   }
+
+   pointer priv_allocation_command(version_1, allocation_type command,
+                         size_type,
+                         size_type &prefer_in_recvd_out_size,
+                         pointer &reuse, size_type max_storage)
+   {
+      (void)command;
+      BOOST_ASSERT(command & allocate_new);
+      //Storage must be deallocated with the received size, so it can't be truncated
+      reuse = pointer();
+      return dtl::allocate_at_least_up_to(this->alloc(), prefer_in_recvd_out_size, max_storage);
+   }
+
+   pointer priv_allocation_command(version_2, allocation_type command,
+                         size_type limit_size,
+                         size_type &prefer_in_recvd_out_size,
+                         pointer &reuse, size_type)
+   {
       return dtl::allocator_version_traits<allocator_type>::allocation_command
          (this->alloc(), command, limit_size, prefer_in_recvd_out_size, reuse);
    }
@@ -398,7 +460,7 @@ class basic_string_base
       if ( achievable_additional_obj < min_additional_obj )
          boost::container::throw_length_error("get_next_capacity, allocator or storage_size_type's max size reached");
 
-      return growth_factor_type()
+      return dtl::growth_factor_next_capacity<growth_factor_type, sizeof(value_type)>
             ( current_storage, min_additional_obj, max_storage);
    }
 
@@ -521,6 +583,7 @@ class basic_string_base
       BOOST_ASSERT(sz < uchar_type(-1));
       BOOST_STATIC_CONSTEXPR uchar_type mask = uchar_type(uchar_type(-1) >> 1U);
       BOOST_ASSERT( sz <= mask );
+      this->priv_track_max_size(sz);
       //Make -Wconversion happy
       this->members_.pshort_repr()->h.length = uchar_type(uchar_type(sz) & mask);
    }
@@ -529,6 +592,7 @@ class basic_string_base
    {
       BOOST_STATIC_CONSTEXPR stored_size_type mask = static_cast<stored_size_type>(stored_size_type(-1) >> 1U);
       BOOST_ASSERT( sz <= mask );
+      this->priv_track_max_size(sz);
       //Make -Wconversion happy
       this->members_.plong_repr()->length = static_cast<stored_size_type>(sz & mask);
    }
@@ -564,6 +628,8 @@ class basic_string_base
             boost::adl_move_swap(*this->members_.plong_repr(), *other.members_.plong_repr());
          }
       }
+      this->priv_track_max_size(this->priv_size());
+      other.priv_track_max_size(other.priv_size());
    }
 };
 
@@ -621,39 +687,14 @@ class basic_string
    BOOST_STATIC_CONSTEXPR typename base_t::size_type InternalBufferChars = base_t::InternalBufferChars;
 
    private:
-   // Allocator helper class to use a char_traits as a function object.
-
-   template <class Tr>
-   struct Eq_traits
-   {
-      //Compatibility with std::binary_function
-      typedef typename Tr::char_type   first_argument_type;
-      typedef typename Tr::char_type   second_argument_type;
-      typedef bool   result_type;
-
-      bool operator()(const first_argument_type& x, const second_argument_type& y) const
-         { return Tr::eq(x, y); }
-   };
-
-   template <class Tr>
-   struct Not_within_traits
-   {
-      typedef typename Tr::char_type   argument_type;
-      typedef bool                     result_type;
-
-      typedef const typename Tr::char_type* Pointer;
-      const Pointer m_first;
-      const Pointer m_last;
-
-      Not_within_traits(Pointer f, Pointer l)
-         : m_first(f), m_last(l) {}
+   //Search kernels (vectorized for char and std::char_traits<char>)
+   typedef dtl::string_algo<Traits> string_algo_t;
 
-      bool operator()(const typename Tr::char_type& x) const
-      {
-         return boost::container::find_if(m_first, m_last,
-                        boost::container::bind1st(Eq_traits<Tr>(), x)) == m_last;
-      }
-   };
+   #if defined(BOOST_CONTAINER_STRING_LAZY_CONCAT)
+   //Writes the operands directly in the buffer
+   template<class String, class L, class R>
+   friend class basic_string_concat;
+   #endif
    #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
 
    public:
@@ -948,7 +989,20 @@ class basic_string
    //!
    //! <b>Complexity</b>: Constant.
    ~basic_string() BOOST_NOEXCEPT_OR_NOTHROW
-   {}
+   {
+      #ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+      storage_stats().record(this->m_max_size, this->m_max_size > InternalBufferChars - 1u || !this->is_short());
+      #endif
+   }
+
+   #ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+   //! <b>Returns</b>: The statistics of this basic_string instantiation. The inline capacity is
+   //!   the number of characters that fit in the internal buffer.
+   //!
+   //! <b>Note</b>: Only available if BOOST_CONTAINER_INLINE_STORAGE_STATS is defined.
+   static inline_storage_stats &storage_stats() BOOST_NOEXCEPT_OR_NOTHROW
+   {  return dtl::inline_storage_stats_of<basic_string, InternalBufferChars - 1u>::instance;  }
+   #endif
 
    //! <b>Effects</b>: Copy constructs a string.
    //!
@@ -1262,6 +1316,29 @@ class basic_string
       }
    }
 
+   //! <b>Requires</b>: op(p, n) writes characters in [p, p + n) and returns an integer r such that 0 <= r <= n.
+   //!
+   //! <b>Effects</b>: Makes sure that capacity() >= n, growing the storage geometrically, and calls
+   //!   op(data(), n). The first min(size(), n) characters keep their values before op is called and the
+   //!   rest are indeterminate. Then the size of the string becomes r and the characters [data(), data() + r)
+   //!   are the ones written by op.
+   //!
+   //! <b>Throws</b>: If memory allocation throws. If op throws, the string is left in a valid but unspecified state.
+   //!
+   //! <b>Complexity</b>: Linear to size() if the string is reallocated, plus the complexity of op.
+   //!
+   //! <b>Note</b>: This lets producers like snprintf, read or to_chars write directly in the string
+   //!   without initializing the characters first.
+   template<class Operation>
+   void resize_and_overwrite(size_type n, Operation op)
+   {
+      this->priv_reserve_no_null_end(n);
+      const size_type r = static_cast<size_type>(op(boost::movelib::to_raw_pointer(this->priv_addr()), n));
+      BOOST_ASSERT(r <= n);
+      this->priv_size(r);
+      this->priv_terminate_string();
+   }
+
    //! <b>Effects</b>: Number of elements for which memory has been allocated.
    //!   capacity() is always greater than or equal to size().
    //!
@@ -1291,6 +1368,7 @@ class basic_string
    {
       //Check if shrinking is possible
       if(this->priv_storage() > InternalBufferChars){
+         dtl::growth_factor_on_shrink_to_fit<growth_factor_type>(this->priv_storage(), this->priv_size());
          //Check if we should pass from dynamically allocated buffer
          //to the internal storage
          if(this->priv_size() < InternalBufferChars){
@@ -1988,6 +2066,8 @@ class basic_string
                               new_start + difference_type(new_length));
                this->priv_construct_null(new_start + difference_type(new_length));
 
+               if(!this->is_short())
+                  allocator_traits_type::on_relocation(this->alloc(), old_size);
                this->deallocate_block();
                this->assure_long();
                this->priv_long_addr(new_start);
@@ -2509,16 +2589,14 @@ class basic_string
       size_type find(const CharT* s, size_type pos, size_type n) const
    {
       BOOST_ASSERT(s != 0);
-      if (pos + n > this->size())
+      const size_type sz = this->size();
+      if (pos + n > sz)
          return npos;
+      else if (n == 0)
+         return pos;
       else {
-         const pointer addr = this->priv_addr();
-         pointer finish = addr + difference_type(this->priv_size());
-         const const_iterator result =
-            boost::container::search(boost::movelib::to_raw_pointer(addr + difference_type(pos)),
-                   boost::movelib::to_raw_pointer(finish),
-                   s, s + difference_type(n), Eq_traits<Traits>());
-         return result != finish ? size_type(result - begin()) : npos;
+         const CharT *const addr = boost::movelib::to_raw_pointer(this->priv_addr());
+         return this->priv_found_pos(pos, string_algo_t::search(addr + pos, sz - pos, s, n));
       }
    }
 
@@ -2544,12 +2622,8 @@ class basic_string
       if (pos >= sz)
          return npos;
       else {
-         const pointer addr    = this->priv_addr();
-         pointer finish = addr + difference_type(sz);
-         const const_iterator result =
-            boost::container::find_if(addr + difference_type(pos), finish,
-                  boost::container::bind2nd(Eq_traits<Traits>(), c));
-         return result != finish ? size_type(result - begin()) : npos;
+         const CharT *const addr = boost::movelib::to_raw_pointer(this->priv_addr());
+         return this->priv_found_pos(pos, string_algo_t::find_char(addr + pos, sz - pos, c, true));
       }
    }
 
@@ -2594,10 +2668,8 @@ class basic_string
       else if (n == 0)
          return dtl::min_value(len, pos);
       else {
-         const const_iterator last = begin() + difference_type(dtl::min_value(len - n, pos) + n);
-         const const_iterator result = boost::container::find_end
-            (begin(), last, s, s + difference_type(n), Eq_traits<Traits>());
-         return result != last ? size_type(result - begin()) : npos;
+         const CharT *const addr = boost::movelib::to_raw_pointer(this->priv_addr());
+         return this->priv_found_pos(0u, string_algo_t::rsearch(addr, dtl::min_value(len - n, pos) + n, s, n));
       }
    }
 
@@ -2625,11 +2697,8 @@ class basic_string
       if (len < 1)
          return npos;
       else {
-         const const_iterator last = begin() + dtl::min_value(len - 1, pos) + 1;
-         const_reverse_iterator rresult =
-            boost::container::find_if(const_reverse_iterator(last), rend(),
-                  boost::container::bind2nd(Eq_traits<Traits>(), c));
-         return rresult != rend() ? size_type((rresult.base() - 1) - begin()) : npos;
+         const CharT *const addr = boost::movelib::to_raw_pointer(this->priv_addr());
+         return this->priv_found_pos(0u, string_algo_t::rfind_char(addr, dtl::min_value(len - 1, pos) + 1, c, true));
       }
    }
 
@@ -2669,11 +2738,8 @@ class basic_string
       if (pos >= sz)
          return npos;
       else {
-         const pointer addr    = this->priv_addr();
-         pointer finish = addr + difference_type(sz);
-         const_iterator result = boost::container::find_first_of
-            (addr + difference_type(pos), finish, s, s + difference_type(n), Eq_traits<Traits>());
-         return result != finish ? size_type(result - this->begin()) : npos;
+         const CharT *const addr = boost::movelib::to_raw_pointer(this->priv_addr());
+         return this->priv_found_pos(pos, string_algo_t::find_of(addr + pos, sz - pos, s, n, true));
       }
    }
 
@@ -2735,12 +2801,8 @@ class basic_string
       if (len < 1)
          return npos;
       else {
-         const pointer addr    = this->priv_addr();
-         const const_iterator last = addr + difference_type(dtl::min_value(len - 1, pos) + 1);
-         const const_reverse_iterator rresult =
-            boost::container::find_first_of(const_reverse_iterator(last), rend(),
-                               s, s + difference_type(n), Eq_traits<Traits>());
-         return rresult != rend() ? size_type((rresult.base() - 1) - addr) : npos;
+         const CharT *const addr = boost::movelib::to_raw_pointer(this->priv_addr());
+         return this->priv_found_pos(0u, string_algo_t::rfind_of(addr, dtl::min_value(len - 1, pos) + 1, s, n, true));
       }
    }
 
@@ -2797,14 +2859,12 @@ class basic_string
       size_type find_first_not_of(const CharT* s, size_type pos, size_type n) const
    {
       BOOST_ASSERT(s != 0);
-      if (pos > this->size())
+      const size_type sz = this->size();
+      if (pos > sz)
          return npos;
       else {
-         const pointer addr   = this->priv_addr();
-         const pointer finish = addr + difference_type(this->priv_size());
-         const const_iterator result = boost::container::find_if
-            (addr + difference_type(pos), finish, Not_within_traits<Traits>(s, s + difference_type(n)));
-         return result != finish ? size_type(result - addr) : npos;
+         const CharT *const addr = boost::movelib::to_raw_pointer(this->priv_addr());
+         return this->priv_found_pos(pos, string_algo_t::find_of(addr + pos, sz - pos, s, n, false));
       }
    }
 
@@ -2826,15 +2886,12 @@ class basic_string
    BOOST_CONTAINER_NODISCARD inline
       size_type find_first_not_of(CharT c, size_type pos = 0) const
    {
-      if (pos > this->size())
+      const size_type sz = this->size();
+      if (pos > sz)
          return npos;
       else {
-         const pointer addr   = this->priv_addr();
-         const pointer finish = addr + difference_type(this->priv_size());
-         const const_iterator result
-            = boost::container::find_if(addr + difference_type(pos), finish,
-                     boost::container::not1(boost::container::bind2nd(Eq_traits<Traits>(), c)));
-         return result != finish ? size_type(result - begin()) : npos;
+         const CharT *const addr = boost::movelib::to_raw_pointer(this->priv_addr());
+         return this->priv_found_pos(pos, string_algo_t::find_char(addr + pos, sz - pos, c, false));
       }
    }
 
@@ -2875,11 +2932,8 @@ class basic_string
       if (len < 1)
          return npos;
       else {
-         const const_iterator last = begin() + dtl::min_value(len - 1, pos) + 1;
-         const const_reverse_iterator rresult =
-            boost::container::find_if(const_reverse_iterator(last), rend(),
-                    Not_within_traits<Traits>(s, s + difference_type(n)));
-         return rresult != rend() ? size_type((rresult.base() - 1) - begin()) : npos;
+         const CharT *const addr = boost::movelib::to_raw_pointer(this->priv_addr());
+         return this->priv_found_pos(0u, string_algo_t::rfind_of(addr, dtl::min_value(len - 1, pos) + 1, s, n, false));
       }
    }
 
@@ -2906,11 +2960,8 @@ class basic_string
       if (len < 1)
          return npos;
       else {
-         const const_iterator last = begin() + dtl::min_value(len - 1, pos) + 1;
-         const const_reverse_iterator rresult =
-            boost::container::find_if(const_reverse_iterator(last), rend(),
-                  boost::container::not1(boost::container::bind2nd(Eq_traits<Traits>(), c)));
-         return rresult != rend() ? size_type((rresult.base() - 1) - begin()) : npos;
+         const CharT *const addr = boost::movelib::to_raw_pointer(this->priv_addr());
+         return this->priv_found_pos(0u, string_algo_t::rfind_char(addr, dtl::min_value(len - 1, pos) + 1, c, false));
       }
    }
 
@@ -3183,6 +3234,10 @@ class basic_string
 
    #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
    private:
+   //Converts a position returned by string_algo_t, relative to pos, to a string position
+   static size_type priv_found_pos(size_type pos, std::size_t r) BOOST_NOEXCEPT_OR_NOTHROW
+   {  return r == string_algo_t::npos ? npos : size_type(pos + r);  }
+
    void priv_move_assign(BOOST_RV_REF(basic_string) x, dtl::bool_<true> /*steal_resources*/)
    {
       //Destroy objects but retain memory in case x reuses it in the future
@@ -3224,6 +3279,8 @@ class basic_string
          const pointer addr = this->priv_addr();
          size_type new_length = priv_uninitialized_copy
             (addr, addr + difference_type(this->priv_size()), new_start);
+         if(!this->is_short())
+            allocator_traits_type::on_relocation(this->alloc(), new_length);
          this->deallocate_block();
          this->assure_long();
          this->priv_long_addr(new_start);
@@ -3396,6 +3453,8 @@ struct is_string< basic_string<C, T, A> >
 
 // Operator+
 
+#if !defined(BOOST_CONTAINER_STRING_LAZY_CONCAT)
+
 template <class CharT, class Traits, class Allocator, class Options> inline
    basic_string<CharT,Traits,Allocator,Options>
    operator+(const basic_string<CharT,Traits,Allocator,Options>& x
@@ -3410,6 +3469,8 @@ template <class CharT, class Traits, class Allocator, class Options> inline
    return result;
 }
 
+#endif   //#if !defined(BOOST_CONTAINER_STRING_LAZY_CONCAT)
+
 template <class CharT, class Traits, class Allocator, class Options> inline
    basic_string<CharT, Traits, Allocator, Options> operator+
       ( BOOST_RV_REF_BEG basic_string<CharT, Traits, Allocator, Options> BOOST_RV_REF_END x
@@ -3437,6 +3498,8 @@ template <class CharT, class Traits, class Allocator, class Options> inline
    return boost::move(y);
 }
 
+#if !defined(BOOST_CONTAINER_STRING_LAZY_CONCAT)
+
 template <class CharT, class Traits, class Allocator, class Options> inline
    basic_string<CharT, Traits, Allocator, Options> operator+
       (const CharT* s, basic_string<CharT, Traits, Allocator, Options> y)
@@ -3470,6 +3533,375 @@ template <class CharT, class Traits, class Allocator, class Options> inline
    return x;
 }
 
+#else //#if !defined(BOOST_CONTAINER_STRING_LAZY_CONCAT)
+
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+#error "BOOST_CONTAINER_STRING_LAZY_CONCAT requires C++11 rvalue references"
+#endif
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace dtl {
+
+//Leaves of a basic_string_concat expression: a string, a null-terminated
+//array or a single character. They only refer to the operands, which live
+//until the end of the full-expression.
+template<class String>
+class string_concat_str
+{
+   public:
+   typedef typename String::size_type size_type;
+
+   explicit string_concat_str(const String &s)
+      : m_s(&s)
+   {}
+
+   size_type size() const
+   {  return m_s->size();  }
+
+   const String *string_ptr() const
+   {  return m_s;  }
+
+   bool aliases(const String &s) const
+   {  return m_s == &s;  }
+
+   typename String::value_type *write(typename String::value_type *p) const
+   {
+      String::traits_type::copy(p, m_s->data(), m_s->size());
+      return p + m_s->size();
+   }
+
+   private:
+   const String *m_s;
+};
+
+template<class String>
+class string_concat_ptr
+{
+   typedef typename String::value_type    value_type;
+   typedef typename String::traits_type   traits_type;
+
+   public:
+   typedef typename String::size_type size_type;
+
+   explicit string_concat_ptr(const value_type *s)
+      : m_s(s), m_n(traits_type::length(s))
+   {  BOOST_ASSERT(s != 0);  }
+
+   size_type size() const
+   {  return m_n;  }
+
+   const String *string_ptr() const
+   {  return 0;  }
+
+   bool aliases(const String &) const
+   {  return false;  }
+
+   value_type *write(value_type *p) const
+   {
+      traits_type::copy(p, m_s, m_n);
+      return p + m_n;
+   }
+
+   private:
+   const value_type *m_s;
+   size_type m_n;
+};
+
+template<class String>
+class string_concat_char
+{
+   typedef typename String::value_type    value_type;
+
+   public:
+   typedef typename String::size_type size_type;
+
+   explicit string_concat_char(value_type c)
+      : m_c(c)
+   {}
+
+   size_type size() const
+   {  return 1u;  }
+
+   const String *string_ptr() const
+   {  return 0;  }
+
+   bool aliases(const String &) const
+   {  return false;  }
+
+   value_type *write(value_type *p) const
+   {
+      String::traits_type::assign(*p, m_c);
+      return p + 1;
+   }
+
+   private:
+   value_type m_c;
+};
+
+}  //namespace dtl {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! The result of <code>operator+</code> between strings, null-terminated arrays and characters when
+//! BOOST_CONTAINER_STRING_LAZY_CONCAT is defined. It stores references to the operands and builds the
+//! concatenation when converted to <code>String</code>: the total length is computed once, the result
+//! is allocated once (or stored in the internal buffer if it fits) and each operand is copied once.
+//!
+//! <b>Note</b>: The expression refers to its operands, so it must be converted before the end of the
+//! full-expression. Don't store it in an <code>auto</code> variable: use <code>String</code> or <code>str()</code>.
+template<class String, class L, class R>
+class basic_string_concat
+{
+   public:
+   typedef String                         string_type;
+   typedef typename String::size_type     size_type;
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   basic_string_concat(const L &l, const R &r)
+      : m_l(l), m_r(r)
+   {}
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+   //! <b>Effects</b>: Returns the length of the concatenation.
+   //!
+   //! <b>Complexity</b>: Linear to the number of operands.
+   size_type size() const
+   {  return size_type(m_l.size() + m_r.size());  }
+
+   //! <b>Effects</b>: Returns a string with the concatenation of all operands. It uses the
+   //!   allocator of the leftmost string operand, as <code>operator+</code> does.
+   //!
+   //! <b>Complexity</b>: Linear to the length of the result plus the number of operands.
+   String str() const
+   {
+      const size_type n = this->size();
+      typename String::reserve_t reserve;
+      String r(reserve, n, this->string_ptr()->get_stored_allocator());
+      this->priv_append_to(r, n);
+      return r;
+   }
+
+   //! <b>Effects</b>: Returns str().
+   operator String() const
+   {  return this->str();  }
+
+   #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+   const String *string_ptr() const
+   {
+      const String *const p = m_l.string_ptr();
+      return p ? p : m_r.string_ptr();
+   }
+
+   bool aliases(const String &s) const
+   {  return m_l.aliases(s) || m_r.aliases(s);  }
+
+   typename String::value_type *write(typename String::value_type *p) const
+   {  return m_r.write(m_l.write(p));  }
+
+   //Appends the n characters of the expression to r, that must have enough capacity
+   void priv_append_to(String &r, size_type n) const
+   {
+      BOOST_ASSERT(r.capacity() - r.size() >= n);
+      const size_type sz = r.size();
+      this->write(boost::movelib::to_raw_pointer(r.priv_addr()) + sz);
+      r.priv_size(sz + n);
+      r.priv_terminate_string();
+   }
+
+   private:
+   L m_l;
+   R m_r;
+   #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+};
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//Strings, null-terminated arrays and characters
+
+template <class CharT, class Traits, class Allocator, class Options> inline
+   basic_string_concat< basic_string<CharT,Traits,Allocator,Options>
+                      , dtl::string_concat_str<basic_string<CharT,Traits,Allocator,Options> >
+                      , dtl::string_concat_str<basic_string<CharT,Traits,Allocator,Options> > >
+   operator+(const basic_string<CharT,Traits,Allocator,Options>& x
+            ,const basic_string<CharT,Traits,Allocator,Options>& y)
+{
+   typedef basic_string<CharT,Traits,Allocator,Options> str_t;
+   typedef dtl::string_concat_str<str_t> piece_t;
+   return basic_string_concat<str_t, piece_t, piece_t>(piece_t(x), piece_t(y));
+}
+
+template <class CharT, class Traits, class Allocator, class Options> inline
+   basic_string_concat< basic_string<CharT,Traits,Allocator,Options>
+                      , dtl::string_concat_ptr<basic_string<CharT,Traits,Allocator,Options> >
+                      , dtl::string_concat_str<basic_string<CharT,Traits,Allocator,Options> > >
+   operator+(const CharT* s, const basic_string<CharT,Traits,Allocator,Options>& y)
+{
+   typedef basic_string<CharT,Traits,Allocator,Options> str_t;
+   typedef dtl::string_concat_ptr<str_t> l_t;
+   typedef dtl::string_concat_str<str_t> r_t;
+   return basic_string_concat<str_t, l_t, r_t>(l_t(s), r_t(y));
+}
+
+template <class CharT, class Traits, class Allocator, class Options> inline
+   basic_string_concat< basic_string<CharT,Traits,Allocator,Options>
+                      , dtl::string_concat_str<basic_string<CharT,Traits,Allocator,Options> >
+                      , dtl::string_concat_ptr<basic_string<CharT,Traits,Allocator,Options> > >
+   operator+(const basic_string<CharT,Traits,Allocator,Options>& x, const CharT* s)
+{
+   typedef basic_string<CharT,Traits,Allocator,Options> str_t;
+   typedef dtl::string_concat_str<str_t> l_t;
+   typedef dtl::string_concat_ptr<str_t> r_t;
+   return basic_string_concat<str_t, l_t, r_t>(l_t(x), r_t(s));
+}
+
+template <class CharT, class Traits, class Allocator, class Options> inline
+   basic_string_concat< basic_string<CharT,Traits,Allocator,Options>
+                      , dtl::string_concat_char<basic_string<CharT,Traits,Allocator,Options> >
+                      , dtl::string_concat_str<basic_string<CharT,Traits,Allocator,Options> > >
+   operator+(CharT c, const basic_string<CharT,Traits,Allocator,Options>& y)
+{
+   typedef basic_string<CharT,Traits,Allocator,Options> str_t;
+   typedef dtl::string_concat_char<str_t> l_t;
+   typedef dtl::string_concat_str<str_t> r_t;
+   return basic_string_concat<str_t, l_t, r_t>(l_t(c), r_t(y));
+}
+
+template <class CharT, class Traits, class Allocator, class Options> inline
+   basic_string_concat< basic_string<CharT,Traits,Allocator,Options>
+                      , dtl::string_concat_str<basic_string<CharT,Traits,Allocator,Options> >
+                      , dtl::string_concat_char<basic_string<CharT,Traits,Allocator,Options> > >
+   operator+(const basic_string<CharT,Traits,Allocator,Options>& x, const CharT c)
+{
+   typedef basic_string<CharT,Traits,Allocator,Options> str_t;
+   typedef dtl::string_concat_str<str_t> l_t;
+   typedef dtl::string_concat_char<str_t> r_t;
+   return basic_string_concat<str_t, l_t, r_t>(l_t(x), r_t(c));
+}
+
+//Temporary strings are reused: the other operand is appended (or inserted) in place
+
+template <class CharT, class Traits, class Allocator, class Options> inline
+   basic_string<CharT,Traits,Allocator,Options> operator+
+      (const CharT* s, basic_string<CharT,Traits,Allocator,Options>&& y)
+{
+   BOOST_ASSERT(s != 0);
+   y.insert(y.begin(), s, s + Traits::length(s));
+   return boost::move(y);
+}
+
+template <class CharT, class Traits, class Allocator, class Options> inline
+   basic_string<CharT,Traits,Allocator,Options> operator+
+      (basic_string<CharT,Traits,Allocator,Options>&& x, const CharT* s)
+{
+   x += s;  //operator+= checks s != 0
+   return boost::move(x);
+}
+
+template <class CharT, class Traits, class Allocator, class Options> inline
+   basic_string<CharT,Traits,Allocator,Options> operator+
+      (CharT c, basic_string<CharT,Traits,Allocator,Options>&& y)
+{
+   y.insert(y.begin(), c);
+   return boost::move(y);
+}
+
+template <class CharT, class Traits, class Allocator, class Options> inline
+   basic_string<CharT,Traits,Allocator,Options> operator+
+      (basic_string<CharT,Traits,Allocator,Options>&& x, const CharT c)
+{
+   x += c;
+   return boost::move(x);
+}
+
+//Concatenation expressions
+
+template <class String, class L, class R> inline
+   basic_string_concat< String, basic_string_concat<String, L, R>, dtl::string_concat_str<String> >
+   operator+(const basic_string_concat<String, L, R>& e, const String& y)
+{
+   typedef dtl::string_concat_str<String> r_t;
+   return basic_string_concat<String, basic_string_concat<String, L, R>, r_t>(e, r_t(y));
+}
+
+template <class String, class L, class R> inline
+   basic_string_concat< String, dtl::string_concat_str<String>, basic_string_concat<String, L, R> >
+   operator+(const String& x, const basic_string_concat<String, L, R>& e)
+{
+   typedef dtl::string_concat_str<String> l_t;
+   return basic_string_concat<String, l_t, basic_string_concat<String, L, R> >(l_t(x), e);
+}
+
+template <class String, class L, class R> inline
+   basic_string_concat< String, basic_string_concat<String, L, R>, dtl::string_concat_ptr<String> >
+   operator+(const basic_string_concat<String, L, R>& e, const typename String::value_type* s)
+{
+   typedef dtl::string_concat_ptr<String> r_t;
+   return basic_string_concat<String, basic_string_concat<String, L, R>, r_t>(e, r_t(s));
+}
+
+template <class String, class L, class R> inline
+   basic_string_concat< String, dtl::string_concat_ptr<String>, basic_string_concat<String, L, R> >
+   operator+(const typename String::value_type* s, const basic_string_concat<String, L, R>& e)
+{
+   typedef dtl::string_concat_ptr<String> l_t;
+   return basic_string_concat<String, l_t, basic_string_concat<String, L, R> >(l_t(s), e);
+}
+
+template <class String, class L, class R> inline
+   basic_string_concat< String, basic_string_concat<String, L, R>, dtl::string_concat_char<String> >
+   operator+(const basic_string_concat<String, L, R>& e, const typename String::value_type c)
+{
+   typedef dtl::string_concat_char<String> r_t;
+   return basic_string_concat<String, basic_string_concat<String, L, R>, r_t>(e, r_t(c));
+}
+
+template <class String, class L, class R> inline
+   basic_string_concat< String, dtl::string_concat_char<String>, basic_string_concat<String, L, R> >
+   operator+(const typename String::value_type c, const basic_string_concat<String, L, R>& e)
+{
+   typedef dtl::string_concat_char<String> l_t;
+   return basic_string_concat<String, l_t, basic_string_concat<String, L, R> >(l_t(c), e);
+}
+
+template <class String, class L1, class R1, class L2, class R2> inline
+   basic_string_concat< String, basic_string_concat<String, L1, R1>, basic_string_concat<String, L2, R2> >
+   operator+(const basic_string_concat<String, L1, R1>& x, const basic_string_concat<String, L2, R2>& y)
+{
+   return basic_string_concat<String, basic_string_concat<String, L1, R1>, basic_string_concat<String, L2, R2> >(x, y);
+}
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! <b>Effects</b>: Appends the concatenation <code>e</code> to <code>s</code>, growing <code>s</code> at most once.
+//!
+//! <b>Returns</b>: s
+template <class String, class L, class R> inline
+   String& operator+=(String& s, const basic_string_concat<String, L, R>& e)
+{
+   if(e.aliases(s)){
+      //s is also an operand, so it can't be modified while the expression is evaluated
+      s.append(e.str());
+   }
+   else{
+      const typename String::size_type n = e.size();
+      s.reserve(s.size() + n);
+      e.priv_append_to(s, n);
+   }
+   return s;
+}
+
+//! <b>Effects</b>: Writes the concatenation <code>e</code> to <code>os</code>.
+template <class String, class L, class R> inline
+   std::basic_ostream<typename String::value_type, typename String::traits_type>&
+   operator<<(std::basic_ostream<typename String::value_type, typename String::traits_type>& os
+             ,const basic_string_concat<String, L, R>& e)
+{
+   return os << e.str();
+}
+
+#endif   //#if !defined(BOOST_CONTAINER_STRING_LAZY_CONCAT)
+
 // Operator== and operator!=
 
 template <class CharT, class Traits, class Allocator, class Options>
@@ -3875,16 +4307,29 @@ namespace boost {
 
 //!has_trivial_destructor_after_move<> == true_type
 //!specialization for optimizations
-template <class C, class T, class Allocator>
-struct has_trivial_destructor_after_move<boost::container::basic_string<C, T, Allocator> >
+template <class C, class T, class Allocator, class Options>
+struct has_trivial_destructor_after_move<boost::container::basic_string<C, T, Allocator, Options> >
 {
-   typedef typename boost::container::basic_string<C, T, Allocator>::allocator_type allocator_type;
+   typedef typename boost::container::basic_string<C, T, Allocator, Options>::allocator_type allocator_type;
    typedef typename boost::container::allocator_traits<allocator_type>::pointer pointer;
    BOOST_STATIC_CONSTEXPR bool value =
       ::boost::has_trivial_destructor_after_move<allocator_type>::value &&
       ::boost::has_trivial_destructor_after_move<pointer>::value;
 };
 
+namespace container {
+
+//!is_trivially_relocatable<> == true_type
+//!specialization for optimizations
+template <class C, class T, class Allocator, class Options>
+struct is_trivially_relocatable<boost::container::basic_string<C, T, Allocator, Options> >
+   : dtl::is_trivially_relocatable_holder
+      < typename boost::container::basic_string<C, T, Allocator, Options>::allocator_type
+      , typename boost::container::basic_string<C, T, Allocator, Options>::pointer>
+{};
+
+}  //namespace container {
+
 }
 
 #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
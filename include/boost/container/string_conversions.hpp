@@ -0,0 +1,623 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_STRING_CONVERSIONS_HPP
+#define BOOST_CONTAINER_STRING_CONVERSIONS_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+
+#include <boost/assert.hpp>
+
+// container
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/string.hpp>
+// container/detail
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/type_traits.hpp>
+// std
+#include <cstddef>
+#include <cstring>
+#include <limits>
+
+//Floating point values are formatted and parsed with std::to_chars/std::from_chars
+//when the standard library implements them. Otherwise a slower but also locale-independent
+//implementation based on snprintf/strtod is used. Define BOOST_CONTAINER_NO_FLOAT_CHARCONV
+//to force the latter.
+#if !defined(BOOST_CONTAINER_NO_FLOAT_CHARCONV)
+#  if defined(BOOST_CXX_VERSION) && (BOOST_CXX_VERSION >= 201703L) && defined(__has_include)
+#     if __has_include(<charconv>)
+#        include <charconv>
+#     endif
+#     if !defined(__cpp_lib_to_chars) || (__cpp_lib_to_chars < 201611L)
+#        define BOOST_CONTAINER_NO_FLOAT_CHARCONV
+#     endif
+#  else
+#     define BOOST_CONTAINER_NO_FLOAT_CHARCONV
+#  endif
+#endif
+
+#if defined(BOOST_CONTAINER_NO_FLOAT_CHARCONV)
+#  include <cerrno>
+#  include <clocale>
+#  include <cstdio>
+#  include <cstdlib>
+#endif
+
+namespace boost {
+namespace container {
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace dtl {
+
+template<class T>
+struct is_charconv_integer
+{
+   static const bool value = is_integral<T>::value && !is_same<typename remove_const<T>::type, bool>::value;
+};
+
+template<class T>
+struct is_charconv_signed
+{
+   static const bool value = T(-1) < T(0);
+};
+
+//Integers are converted using the narrowest unsigned type that holds their magnitude
+template<class T>
+struct charconv_uint
+{
+   typedef typename if_c< sizeof(T) <= sizeof(unsigned)
+                        , unsigned
+                        , ::boost::ulong_long_type>::type type;
+};
+
+template<class Dummy>
+struct charconv_tables
+{
+   static const char digit_pairs[201];
+   static const char digits[37];
+};
+
+template<class Dummy>
+const char charconv_tables<Dummy>::digit_pairs[201] =
+   "00010203040506070809"
+   "10111213141516171819"
+   "20212223242526272829"
+   "30313233343536373839"
+   "40414243444546474849"
+   "50515253545556575859"
+   "60616263646566676869"
+   "70717273747576777879"
+   "80818283848586878889"
+   "90919293949596979899";
+
+template<class Dummy>
+const char charconv_tables<Dummy>::digits[37] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+template<class UInt>
+inline std::size_t charconv_dec_digits(UInt v)
+{
+   std::size_t n = 1u;
+   for(;;){
+      if(v < 10u)    return n;
+      if(v < 100u)   return n + 1u;
+      if(v < 1000u)  return n + 2u;
+      if(v < 10000u) return n + 3u;
+      v = UInt(v / 10000u);
+      n += 4u;
+   }
+}
+
+template<class UInt>
+inline std::size_t charconv_digits(UInt v, unsigned base)
+{
+   if(base == 10u)
+      return charconv_dec_digits(v);
+   std::size_t n = 1u;
+   while(v >= base){
+      v = UInt(v / base);
+      ++n;
+   }
+   return n;
+}
+
+//Writes the digits of v backwards, ending at "end"
+template<class CharT, class UInt>
+inline void charconv_write_digits(CharT *end, UInt v, unsigned base)
+{
+   if(base == 10u){
+      const char *const pairs = charconv_tables<void>::digit_pairs;
+      while(v >= 100u){
+         const std::size_t i = std::size_t(v % 100u)*2u;
+         v = UInt(v / 100u);
+         *--end = CharT(pairs[i + 1u]);
+         *--end = CharT(pairs[i]);
+      }
+      if(v >= 10u){
+         const std::size_t i = std::size_t(v)*2u;
+         *--end = CharT(pairs[i + 1u]);
+         *--end = CharT(pairs[i]);
+      }
+      else{
+         *--end = CharT('0' + int(v));
+      }
+   }
+   else{
+      const char *const digits = charconv_tables<void>::digits;
+      do{
+         *--end = CharT(digits[std::size_t(v % base)]);
+         v = UInt(v / base);
+      } while(v);
+   }
+}
+
+template<class UInt>
+struct integer_appender
+{
+   integer_appender(std::size_t old_size, std::size_t n, UInt magnitude, bool negative, unsigned base)
+      : m_old_size(old_size), m_n(n), m_magnitude(magnitude), m_negative(negative), m_base(base)
+   {}
+
+   template<class CharT>
+   std::size_t operator()(CharT *p, std::size_t n) const
+   {
+      BOOST_ASSERT(n == m_old_size + m_n);
+      if(m_negative)
+         p[m_old_size] = CharT('-');
+      charconv_write_digits(p + n, m_magnitude, m_base);
+      return n;
+   }
+
+   std::size_t m_old_size;
+   std::size_t m_n;
+   UInt m_magnitude;
+   bool m_negative;
+   unsigned m_base;
+};
+
+template<class CharT>
+inline unsigned charconv_digit_value(CharT c)
+{
+   const unsigned u = unsigned(c);
+   if(u - unsigned('0') < 10u)
+      return u - unsigned('0');
+   else if(u - unsigned('a') < 26u)
+      return u - unsigned('a') + 10u;
+   else if(u - unsigned('A') < 26u)
+      return u - unsigned('A') + 10u;
+   return 36u;
+}
+
+//Big enough for the shortest representation of any floating point type
+static const std::size_t float_chars_max = 64u;
+
+template<class CharT>
+inline bool charconv_is_float_char(CharT c)
+{
+   const unsigned u = unsigned(c);
+   return charconv_digit_value(c) < 36u || u == unsigned('.') || u == unsigned('-') ||
+          u == unsigned('+') || u == unsigned('(') || u == unsigned(')') || u == unsigned('_');
+}
+
+#if !defined(BOOST_CONTAINER_NO_FLOAT_CHARCONV)
+
+template<class Float>
+inline std::size_t format_float(char *buf, Float value)
+{
+   const std::to_chars_result r = std::to_chars(buf, buf + float_chars_max, value);
+   BOOST_ASSERT(r.ec == std::errc());
+   (void)value;
+   return std::size_t(r.ptr - buf);
+}
+
+template<class Float>
+inline std::size_t parse_float(const char *first, const char *last, Float &value)
+{
+   const std::from_chars_result r = std::from_chars(first, last, value);
+   (void)last; (void)value;
+   return r.ec == std::errc() ? std::size_t(r.ptr - first) : 0u;
+}
+
+#else //BOOST_CONTAINER_NO_FLOAT_CHARCONV
+
+inline int format_float_c(char *buf, int precision, float value)
+{  return std::snprintf(buf, float_chars_max, "%.*g", precision, double(value));  }
+
+inline int format_float_c(char *buf, int precision, double value)
+{  return std::snprintf(buf, float_chars_max, "%.*g", precision, value);  }
+
+inline int format_float_c(char *buf, int precision, long double value)
+{  return std::snprintf(buf, float_chars_max, "%.*Lg", precision, value);  }
+
+inline void parse_float_c(const char *s, float &value)
+{  value = std::strtof(s, 0);  }
+
+inline void parse_float_c(const char *s, double &value)
+{  value = std::strtod(s, 0);  }
+
+inline void parse_float_c(const char *s, long double &value)
+{  value = std::strtold(s, 0);  }
+
+//The C library uses the decimal point of the global locale
+inline const char *locale_decimal_point()
+{
+   const char *const dp = std::localeconv()->decimal_point;
+   return (dp && *dp) ? dp : ".";
+}
+
+template<class Float>
+inline std::size_t format_float(char *buf, Float value)
+{
+   //Any decimal with digits10 significant digits survives a round trip, so if a normal
+   //value is printed back with digits10 digits it is the shortest representation after
+   //the trailing zeros are removed. Otherwise, try with up to max_digits10 digits.
+   //Subnormal values have less precision, so all the lengths are tried.
+   const Float abs_value = value < Float(0) ? -value : value;
+   const int min_digits = abs_value < (std::numeric_limits<Float>::min)() ? 1 : std::numeric_limits<Float>::digits10;
+   const int max_digits = 2 + std::numeric_limits<Float>::digits*30103/100000;
+   int len = 0;
+   for(int prec = min_digits; prec <= max_digits; ++prec){
+      len = format_float_c(buf, prec, value);
+      Float back;
+      parse_float_c(buf, back);
+      if(back == value || value != value)
+         break;
+   }
+   BOOST_ASSERT(len > 0 && std::size_t(len) < float_chars_max);
+   //Replace the decimal point of the locale with '.'
+   const char *const dp = locale_decimal_point();
+   const std::size_t dp_len = std::strlen(dp);
+   if(dp_len != 1u || *dp != '.'){
+      char *const pos = std::strstr(buf, dp);
+      if(pos){
+         *pos = '.';
+         std::memmove(pos + 1, pos + dp_len, std::size_t(buf + len + 1 - (pos + dp_len)));
+         len -= int(dp_len - 1u);
+      }
+   }
+   return std::size_t(len);
+}
+
+inline bool charconv_match_ci(const char *&p, const char *last, const char *word)
+{
+   const char *q = p;
+   for(; *word; ++word, ++q){
+      if(q == last || (*q | 0x20) != *word)
+         return false;
+   }
+   p = q;
+   return true;
+}
+
+//Returns the length of the longest prefix of [first, last) with the syntax of std::from_chars
+inline std::size_t float_syntax_length(const char *first, const char *last)
+{
+   const char *p = first;
+   if(p != last && *p == '-')
+      ++p;
+   if(charconv_match_ci(p, last, "inf")){
+      charconv_match_ci(p, last, "inity");
+      return std::size_t(p - first);
+   }
+   if(charconv_match_ci(p, last, "nan")){
+      if(p != last && *p == '('){
+         const char *q = p + 1;
+         while(q != last && (charconv_digit_value(*q) < 36u || *q == '_'))
+            ++q;
+         if(q != last && *q == ')')
+            p = q + 1;
+      }
+      return std::size_t(p - first);
+   }
+   std::size_t digits = 0u;
+   for(; p != last && unsigned(*p - '0') < 10u; ++p, ++digits){}
+   if(p != last && *p == '.'){
+      for(++p; p != last && unsigned(*p - '0') < 10u; ++p, ++digits){}
+   }
+   if(!digits)
+      return 0u;
+   if(p != last && (*p == 'e' || *p == 'E')){
+      const char *q = p + 1;
+      if(q != last && (*q == '-' || *q == '+'))
+         ++q;
+      if(q != last && unsigned(*q - '0') < 10u){
+         for(p = q; p != last && unsigned(*p - '0') < 10u; ++p){}
+      }
+   }
+   return std::size_t(p - first);
+}
+
+template<class Float>
+inline std::size_t parse_float(const char *first, const char *last, Float &value)
+{
+   const std::size_t len = float_syntax_length(first, last);
+   if(!len)
+      return 0u;
+   //Copy the number replacing '.' with the decimal point of the locale
+   const char *const dp = locale_decimal_point();
+   const std::size_t dp_len = std::strlen(dp);
+   string buf;
+   buf.reserve(len + dp_len);
+   for(const char *p = first; p != first + len; ++p){
+      if(*p == '.')
+         buf.append(dp, dp_len);
+      else
+         buf.push_back(*p);
+   }
+   const int old_errno = errno;
+   errno = 0;
+   Float v;
+   parse_float_c(buf.c_str(), v);
+   //Like std::from_chars, subnormal results are accepted
+   const bool out_of_range = errno == ERANGE &&
+      (v == Float(0) || v == std::numeric_limits<Float>::infinity() || v == -std::numeric_limits<Float>::infinity());
+   errno = old_errno;
+   if(out_of_range)
+      return 0u;
+   value = v;
+   return len;
+}
+
+#endif   //BOOST_CONTAINER_NO_FLOAT_CHARCONV
+
+}  //namespace dtl {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! <b>Effects</b>: Appends to s the representation of value in the given base, with the same
+//!   format as std::to_chars: lowercase digits, a leading '-' for negative values and no prefix.
+//!   The characters are written directly in the storage of s.
+//!
+//! <b>Requires</b>: 2 <= base <= 36. Integer is an integral type other than bool.
+//!
+//! <b>Returns</b>: s.
+//!
+//! <b>Throws</b>: If memory allocation throws.
+//!
+//! <b>Complexity</b>: Linear to the number of digits, amortized.
+//!
+//! <b>Note</b>: Non-standard extension. It does not depend on the locale.
+template<class CharT, class Traits, class Allocator, class Options, class Integer>
+inline typename dtl::enable_if_c< dtl::is_charconv_integer<Integer>::value
+                                , basic_string<CharT, Traits, Allocator, Options>& >::type
+   append_integer(basic_string<CharT, Traits, Allocator, Options> &s, Integer value, int base = 10)
+{
+   BOOST_ASSERT(base >= 2 && base <= 36);
+   typedef typename dtl::charconv_uint<Integer>::type uint_t;
+   const bool negative = dtl::is_charconv_signed<Integer>::value && value < Integer(0);
+   const uint_t magnitude = negative ? uint_t(uint_t(0u) - uint_t(value)) : uint_t(value);
+   const std::size_t n = dtl::charconv_digits(magnitude, unsigned(base)) + std::size_t(negative);
+   const std::size_t old_size = s.size();
+   s.resize_and_overwrite
+      (old_size + n, dtl::integer_appender<uint_t>(old_size, n, magnitude, negative, unsigned(base)));
+   return s;
+}
+
+//! <b>Effects</b>: Appends to s the shortest representation of value that is parsed back to
+//!   the same value, with the same format as std::to_chars(first, last, value): the shorter
+//!   of the fixed and scientific notations, "inf", "-inf", "nan" or "-nan".
+//!
+//! <b>Requires</b>: Float is float, double or long double.
+//!
+//! <b>Returns</b>: s.
+//!
+//! <b>Throws</b>: If memory allocation throws.
+//!
+//! <b>Note</b>: Non-standard extension. It does not depend on the locale. If the standard library
+//!   does not provide std::to_chars for floating point types (or BOOST_CONTAINER_NO_FLOAT_CHARCONV
+//!   is defined) a slower implementation that produces the shortest round-trip digits in
+//!   the "%g" notation of printf is used.
+template<class CharT, class Traits, class Allocator, class Options, class Float>
+inline typename dtl::enable_if_c< dtl::is_floating_point<Float>::value
+                                , basic_string<CharT, Traits, Allocator, Options>& >::type
+   append_float(basic_string<CharT, Traits, Allocator, Options> &s, Float value)
+{
+   //The length is not known in advance, so the value is formatted in a local buffer
+   //instead of reserving the maximum length, which would defeat the internal buffer.
+   char buf[dtl::float_chars_max];
+   const std::size_t n = dtl::format_float(buf, value);
+   s.append(buf, buf + n);
+   return s;
+}
+
+//! <b>Effects</b>: Parses an integer in the given base at the beginning of [first, last),
+//!   with the same syntax as std::from_chars: an optional '-' (only for signed types)
+//!   followed by one or more digits, with no leading whitespace, '+' or prefix.
+//!   If successful, stores the parsed number in value.
+//!
+//! <b>Requires</b>: 2 <= base <= 36. Integer is an integral type other than bool.
+//!
+//! <b>Returns</b>: A pointer to the first character not parsed. If there is no number at
+//!   the beginning of the range, or it is out of the range of Integer, first is returned
+//!   and value is unmodified.
+//!
+//! <b>Note</b>: Non-standard extension. It does not depend on the locale.
+template<class CharT, class Integer>
+inline typename dtl::enable_if_c<dtl::is_charconv_integer<Integer>::value, const CharT*>::type
+   parse_integer(const CharT *first, const CharT *last, Integer &value, int base = 10)
+{
+   BOOST_ASSERT(base >= 2 && base <= 36);
+   typedef typename dtl::charconv_uint<Integer>::type uint_t;
+   const CharT *p = first;
+   const bool negative = dtl::is_charconv_signed<Integer>::value && p != last && *p == CharT('-');
+   p += negative;
+   const uint_t limit = negative ? uint_t(uint_t(0u) - uint_t((std::numeric_limits<Integer>::min)()))
+                                 : uint_t((std::numeric_limits<Integer>::max)());
+   const unsigned ubase = unsigned(base);
+   const CharT *const digits_begin = p;
+   uint_t acc = 0u;
+   for(; p != last; ++p){
+      const unsigned d = dtl::charconv_digit_value(*p);
+      if(d >= ubase)
+         break;
+      if(acc > uint_t((limit - d)/ubase))
+         return first;
+      acc = uint_t(acc*ubase + d);
+   }
+   if(p == digits_begin)
+      return first;
+   value = negative ? Integer(uint_t(uint_t(0u) - acc)) : Integer(acc);
+   return p;
+}
+
+//! <b>Effects</b>: Same as parse_integer(s.data(), s.data() + s.size(), value, base), but the whole
+//!   string must be parsed.
+//!
+//! <b>Returns</b>: true if s holds a number in the range of Integer and value was assigned.
+//!
+//! <b>Note</b>: Non-standard extension.
+template<class CharT, class Traits, class Allocator, class Options, class Integer>
+inline typename dtl::enable_if_c<dtl::is_charconv_integer<Integer>::value, bool>::type
+   parse_integer(const basic_string<CharT, Traits, Allocator, Options> &s, Integer &value, int base = 10)
+{
+   const CharT *const first = s.data();
+   const CharT *const last = first + s.size();
+   Integer v = Integer();
+   if(parse_integer(first, last, v, base) != last || first == last)
+      return false;
+   value = v;
+   return true;
+}
+
+//! <b>Effects</b>: Parses a floating point value at the beginning of [first, last), with the
+//!   same syntax as std::from_chars with std::chars_format::general: an optional '-' followed by
+//!   a decimal number with an optional exponent, "inf", "infinity" or "nan" (case insensitive),
+//!   with no leading whitespace or '+'. If successful, stores the parsed number in value.
+//!
+//! <b>Requires</b>: Float is float, double or long double.
+//!
+//! <b>Returns</b>: A pointer to the first character not parsed. If there is no number at
+//!   the beginning of the range, or it is out of the range of Float, first is returned
+//!   and value is unmodified.
+//!
+//! <b>Note</b>: Non-standard extension. It does not depend on the locale.
+template<class CharT, class Float>
+inline typename dtl::enable_if_c<dtl::is_floating_point<Float>::value, const CharT*>::type
+   parse_float(const CharT *first, const CharT *last, Float &value)
+{
+   //Narrow the characters that can be part of a number
+   char buf[dtl::float_chars_max*4u];
+   std::size_t n = 0u;
+   for(const CharT *p = first; p != last && n != sizeof(buf) && dtl::charconv_is_float_char(*p); ++p, ++n){
+      buf[n] = char(*p);
+   }
+   std::size_t len;
+   if(n == sizeof(buf)){
+      //Unusually long number (e.g. many leading zeros)
+      string long_buf;
+      for(const CharT *p = first; p != last && dtl::charconv_is_float_char(*p); ++p){
+         long_buf.push_back(char(*p));
+      }
+      len = dtl::parse_float(long_buf.data(), long_buf.data() + long_buf.size(), value);
+   }
+   else{
+      len = dtl::parse_float(buf, buf + n, value);
+   }
+   return first + len;
+}
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+template<class Float>
+inline typename dtl::enable_if_c<dtl::is_floating_point<Float>::value, const char*>::type
+   parse_float(const char *first, const char *last, Float &value)
+{
+   return first + dtl::parse_float(first, last, value);
+}
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! <b>Effects</b>: Same as parse_float(s.data(), s.data() + s.size(), value), but the whole
+//!   string must be parsed.
+//!
+//! <b>Returns</b>: true if s holds a number in the range of Float and value was assigned.
+//!
+//! <b>Note</b>: Non-standard extension.
+template<class CharT, class Traits, class Allocator, class Options, class Float>
+inline typename dtl::enable_if_c<dtl::is_floating_point<Float>::value, bool>::type
+   parse_float(const basic_string<CharT, Traits, Allocator, Options> &s, Float &value)
+{
+   const CharT *const first = s.data();
+   const CharT *const last = first + s.size();
+   Float v = Float();
+   if(parse_float(first, last, v) != last || first == last)
+      return false;
+   value = v;
+   return true;
+}
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace dtl {
+
+template<class String, class T>
+inline void append_number(String &s, T value, true_type)
+{  (append_integer)(s, value);  }
+
+template<class String, class T>
+inline void append_number(String &s, T value, false_type)
+{  (append_float)(s, value);  }
+
+template<class T>
+struct is_charconv_number
+{
+   static const bool value = is_charconv_integer<T>::value || is_floating_point<T>::value;
+};
+
+}  //namespace dtl {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+//! <b>Returns</b>: A string with the representation of value produced by append_integer (in base 10)
+//!   or append_float.
+//!
+//! <b>Throws</b>: If memory allocation throws.
+//!
+//! <b>Note</b>: Unlike std::to_string, it does not depend on the locale and floating point values
+//!   are represented with the shortest round-trip representation instead of "%f".
+template<class T>
+inline typename dtl::enable_if_c<dtl::is_charconv_number<T>::value, string>::type
+   to_string(T value)
+{
+   string s;
+   dtl::append_number(s, value, dtl::bool_<dtl::is_charconv_integer<T>::value>());
+   return s;
+}
+
+//! <b>Returns</b>: A wstring with the representation of value produced by append_integer (in base 10)
+//!   or append_float.
+//!
+//! <b>Throws</b>: If memory allocation throws.
+//!
+//! <b>Note</b>: See to_string.
+template<class T>
+inline typename dtl::enable_if_c<dtl::is_charconv_number<T>::value, wstring>::type
+   to_wstring(T value)
+{
+   wstring s;
+   dtl::append_number(s, value, dtl::bool_<dtl::is_charconv_integer<T>::value>());
+   return s;
+}
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //BOOST_CONTAINER_STRING_CONVERSIONS_HPP
@@ -0,0 +1,130 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_TRIVIALLY_RELOCATABLE_HPP
+#define BOOST_CONTAINER_TRIVIALLY_RELOCATABLE_HPP
+
+#ifndef BOOST_CONFIG_HPP
+#  include <boost/config.hpp>
+#endif
+
+#if defined(BOOST_HAS_PRAGMA_ONCE)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/container_fwd.hpp>
+#include <boost/container/detail/type_traits.hpp>
+#include <boost/intrusive/detail/minimal_pair_header.hpp>
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace boost {
+namespace movelib {
+
+template <class T, class D>
+class unique_ptr;
+
+}  //namespace movelib {
+}  //namespace boost {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+namespace boost {
+namespace container {
+
+//! <b>Remark</b>: A type `T` is <b>trivially relocatable</b> if moving an object to a new address
+//! and destroying the source is equivalent to copying its object representation with `std::memcpy`
+//! and abandoning the source storage (no destructor call).
+//!
+//! Containers that store elements contiguously (vector, devector, small_vector...) use this trait
+//! to replace element-wise "move construct + destroy" sequences with a single `std::memmove` on
+//! reallocation, insertion shifts and erasure.
+//!
+//! By default the trait is true if `T` is trivially move constructible and trivially destructible.
+//! Users can specialize this trait for their own types (e.g. types holding a heap pointer but
+//! having user-defined move constructors/destructors) if their move construction + destruction
+//! has no observable effect other than transferring the object representation. Types holding
+//! pointers to themselves (or to subobjects of themselves) must not be marked as trivially relocatable.
+template <class T>
+struct is_trivially_relocatable
+{
+   BOOST_STATIC_CONSTEXPR bool value = dtl::is_trivially_move_constructible<T>::value &&
+                                       dtl::is_trivially_destructible<T>::value;
+};
+
+#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+template <class T>
+struct is_trivially_relocatable<const T>
+   : is_trivially_relocatable<T>
+{};
+
+template <class T1, class T2>
+struct is_trivially_relocatable< std::pair<T1, T2> >
+{
+   BOOST_STATIC_CONSTEXPR bool value = is_trivially_relocatable<T1>::value &&
+                                       is_trivially_relocatable<T2>::value;
+};
+
+template <class T, class D>
+struct is_trivially_relocatable< ::boost::movelib::unique_ptr<T, D> >
+{
+   BOOST_STATIC_CONSTEXPR bool value = is_trivially_relocatable<D>::value;
+};
+
+//Standard and Boost.Container allocators are stateless or just hold a pointer
+
+template <class T>
+struct is_trivially_relocatable< std::allocator<T> >
+{
+   BOOST_STATIC_CONSTEXPR bool value = true;
+};
+
+template <class T>
+struct is_trivially_relocatable< new_allocator<T> >
+{
+   BOOST_STATIC_CONSTEXPR bool value = true;
+};
+
+template <class T, unsigned Version, unsigned int AllocationDisableMask>
+struct is_trivially_relocatable< allocator<T, Version, AllocationDisableMask> >
+{
+   BOOST_STATIC_CONSTEXPR bool value = true;
+};
+
+template <class T>
+struct is_trivially_relocatable< pmr::polymorphic_allocator<T> >
+{
+   BOOST_STATIC_CONSTEXPR bool value = true;
+};
+
+namespace dtl {
+
+//A container that only holds an allocator, pointers and integers is trivially relocatable
+//if the allocator and its pointer types are.
+template <class Allocator, class Pointer>
+struct is_trivially_relocatable_holder
+{
+   BOOST_STATIC_CONSTEXPR bool value = is_trivially_relocatable<Allocator>::value &&
+                                       is_trivially_relocatable<Pointer>::value;
+};
+
+}  //namespace dtl {
+
+#endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
+
+}  //namespace container {
+}  //namespace boost {
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif   //#ifndef BOOST_CONTAINER_TRIVIALLY_RELOCATABLE_HPP
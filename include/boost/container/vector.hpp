@@ -28,7 +28,9 @@
 #include <boost/container/new_allocator.hpp> //new_allocator
 #include <boost/container/throw_exception.hpp>
 #include <boost/container/options.hpp>
+#include <boost/container/trivially_relocatable.hpp>
 // container detail
+#include <boost/container/detail/addressof.hpp>
 #include <boost/container/detail/advanced_insert_int.hpp>
 #include <boost/container/detail/algorithm.hpp> //equal()
 #include <boost/container/detail/alloc_helpers.hpp>
@@ -40,6 +42,7 @@
 #include <boost/move/detail/iterator_to_raw_pointer.hpp>
 #include <boost/container/detail/mpl.hpp>
 #include <boost/container/detail/next_capacity.hpp>
+#include <boost/container/detail/parallel_algo.hpp>
 #include <boost/container/detail/value_functors.hpp>
 #include <boost/move/detail/to_raw_pointer.hpp>
 #include <boost/container/detail/type_traits.hpp>
@@ -161,7 +164,7 @@ class vec_iterator
    class nat
    {
       public:
-      Pointer get_ptr() const
+      BOOST_CONTAINER_CONSTEXPR20 Pointer get_ptr() const
       { return Pointer();  }
    };
    typedef typename dtl::if_c< IsConst
@@ -169,15 +172,15 @@ class vec_iterator
                              , nat>::type                                           nonconst_iterator;
 
    public:
-   inline
+   inline BOOST_CONTAINER_CONSTEXPR20
       const Pointer &get_ptr() const BOOST_NOEXCEPT_OR_NOTHROW
    {  return   m_ptr;  }
 
-   inline
+   inline BOOST_CONTAINER_CONSTEXPR20
       Pointer &get_ptr() BOOST_NOEXCEPT_OR_NOTHROW
    {  return   m_ptr;  }
 
-   inline explicit vec_iterator(Pointer ptr) BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 explicit vec_iterator(Pointer ptr) BOOST_NOEXCEPT_OR_NOTHROW
       : m_ptr(ptr)
    {}
    #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
@@ -185,93 +188,93 @@ class vec_iterator
    public:
 
    //Constructors
-   inline vec_iterator() BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 vec_iterator() BOOST_NOEXCEPT_OR_NOTHROW
       : m_ptr()   //Value initialization to achieve "null iterators" (N3644)
    {}
 
-   inline vec_iterator(const vec_iterator& other) BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 vec_iterator(const vec_iterator& other) BOOST_NOEXCEPT_OR_NOTHROW
       :  m_ptr(other.get_ptr())
    {}
 
-   inline vec_iterator(const nonconst_iterator &other) BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 vec_iterator(const nonconst_iterator &other) BOOST_NOEXCEPT_OR_NOTHROW
       :  m_ptr(other.get_ptr())
    {}
 
-   inline vec_iterator & operator=(const vec_iterator& other) BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 vec_iterator & operator=(const vec_iterator& other) BOOST_NOEXCEPT_OR_NOTHROW
    {  m_ptr = other.get_ptr();   return *this;  }
 
    //Pointer like operators
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       reference operator*()   const BOOST_NOEXCEPT_OR_NOTHROW
    {  BOOST_ASSERT(!!m_ptr);  return *m_ptr;  }
 
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       pointer operator->()  const BOOST_NOEXCEPT_OR_NOTHROW
    {  return m_ptr;  }
 
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       reference operator[](difference_type off) const BOOST_NOEXCEPT_OR_NOTHROW
    {  BOOST_ASSERT(!!m_ptr);  return m_ptr[off];  }
 
    //Increment / Decrement
-   inline vec_iterator& operator++() BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 vec_iterator& operator++() BOOST_NOEXCEPT_OR_NOTHROW
    {  BOOST_ASSERT(!!m_ptr); ++m_ptr;  return *this; }
 
-   inline vec_iterator operator++(int) BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 vec_iterator operator++(int) BOOST_NOEXCEPT_OR_NOTHROW
    {  BOOST_ASSERT(!!m_ptr); return vec_iterator(m_ptr++); }
 
-   inline vec_iterator& operator--() BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 vec_iterator& operator--() BOOST_NOEXCEPT_OR_NOTHROW
    {  BOOST_ASSERT(!!m_ptr); --m_ptr; return *this;  }
 
-   inline vec_iterator operator--(int) BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 vec_iterator operator--(int) BOOST_NOEXCEPT_OR_NOTHROW
    {  BOOST_ASSERT(!!m_ptr); return vec_iterator(m_ptr--); }
 
    //Arithmetic
-   inline vec_iterator& operator+=(difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 vec_iterator& operator+=(difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
    {  BOOST_ASSERT(m_ptr || !off); m_ptr += off; return *this;   }
 
-   inline vec_iterator& operator-=(difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 vec_iterator& operator-=(difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
    {  BOOST_ASSERT(m_ptr || !off); m_ptr -= off; return *this;   }
 
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       friend vec_iterator operator+(const vec_iterator &x, difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
    {  BOOST_ASSERT(x.m_ptr || !off); return vec_iterator(x.m_ptr+off);  }
 
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       friend vec_iterator operator+(difference_type off, vec_iterator right) BOOST_NOEXCEPT_OR_NOTHROW
    {  BOOST_ASSERT(right.m_ptr || !off); right.m_ptr += off;  return right; }
 
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       friend vec_iterator operator-(vec_iterator left, difference_type off) BOOST_NOEXCEPT_OR_NOTHROW
    {  BOOST_ASSERT(left.m_ptr || !off); left.m_ptr -= off;  return left; }
 
    //Difference
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       friend difference_type operator-(const vec_iterator &left, const vec_iterator& right) BOOST_NOEXCEPT_OR_NOTHROW
    {  return left.m_ptr - right.m_ptr;   }
 
    //Comparison operators
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       friend bool operator==   (const vec_iterator& l, const vec_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
    {  return l.m_ptr == r.m_ptr;  }
 
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       friend bool operator!=   (const vec_iterator& l, const vec_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
    {  return l.m_ptr != r.m_ptr;  }
 
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       friend bool operator<    (const vec_iterator& l, const vec_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
    {  return l.m_ptr < r.m_ptr;  }
 
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       friend bool operator<=   (const vec_iterator& l, const vec_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
    {  return l.m_ptr <= r.m_ptr;  }
 
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       friend bool operator>    (const vec_iterator& l, const vec_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
    {  return l.m_ptr > r.m_ptr;  }
 
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       friend bool operator>=   (const vec_iterator& l, const vec_iterator& r) BOOST_NOEXCEPT_OR_NOTHROW
    {  return l.m_ptr >= r.m_ptr;  }
 };
@@ -307,11 +310,11 @@ struct vector_insert_ordered_cursor
 };
 
 template<class Pointer, bool IsConst>
-inline const Pointer &vector_iterator_get_ptr(const vec_iterator<Pointer, IsConst> &it) BOOST_NOEXCEPT_OR_NOTHROW
+inline BOOST_CONTAINER_CONSTEXPR20 const Pointer &vector_iterator_get_ptr(const vec_iterator<Pointer, IsConst> &it) BOOST_NOEXCEPT_OR_NOTHROW
 {  return   it.get_ptr();  }
 
 template<class Pointer, bool IsConst>
-inline Pointer &get_ptr(vec_iterator<Pointer, IsConst> &it) BOOST_NOEXCEPT_OR_NOTHROW
+inline BOOST_CONTAINER_CONSTEXPR20 Pointer &get_ptr(vec_iterator<Pointer, IsConst> &it) BOOST_NOEXCEPT_OR_NOTHROW
 {  return  it.get_ptr();  }
 
 struct initial_capacity_t {};
@@ -326,6 +329,11 @@ struct vector_value_traits_base
 {
    BOOST_STATIC_CONSTEXPR bool trivial_dctr = dtl::is_trivially_destructible<T>::value;
    BOOST_STATIC_CONSTEXPR bool trivial_dctr_after_move = has_trivial_destructor_after_move<T>::value;
+   //Trivially relocatable but not trivially copyable elements are shifted with memmove
+   //instead of the move construct + move assign sequence
+   BOOST_STATIC_CONSTEXPR bool relocate_shift = is_trivially_relocatable<T>::value && !dtl::is_trivially_copy_constructible<T>::value;
+   //Version 2 allocators can move the buffer with its contents when expanding
+   BOOST_STATIC_CONSTEXPR bool relocate_expand = is_trivially_relocatable<T>::value;
 };
 
 template <class Allocator>
@@ -344,6 +352,38 @@ struct vector_value_traits
    typedef dtl::scoped_array_deallocator<Allocator> ArrayDeallocator;
 };
 
+#ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+
+//Maximum size reached by a vector that uses internal storage (small_vector),
+//the size must be tracked before it's decreased
+template<class SizeType, bool Enabled>
+struct vector_max_size_tracker
+{
+   vector_max_size_tracker()
+      : m_max_size()
+   {}
+
+   BOOST_CONTAINER_FORCEINLINE void track_max_size(SizeType sz) BOOST_NOEXCEPT_OR_NOTHROW
+   {  if(sz > m_max_size) m_max_size = sz;  }
+
+   BOOST_CONTAINER_FORCEINLINE SizeType max_size_reached(SizeType sz) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return sz > m_max_size ? sz : m_max_size;  }
+
+   SizeType m_max_size;
+};
+
+template<class SizeType>
+struct vector_max_size_tracker<SizeType, false>
+{
+   BOOST_CONTAINER_FORCEINLINE void track_max_size(SizeType) BOOST_NOEXCEPT_OR_NOTHROW
+   {}
+
+   BOOST_CONTAINER_FORCEINLINE SizeType max_size_reached(SizeType sz) const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return sz;  }
+};
+
+#endif   //#ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+
 //!This struct deallocates and allocated memory
 template < class Allocator
          , class StoredSizeType
@@ -351,9 +391,19 @@ template < class Allocator
          >
 struct vector_alloc_holder
    : public Allocator
+   #ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+   , private vector_max_size_tracker
+      < typename allocator_traits<Allocator>::size_type
+      , allocator_traits<Allocator>::is_partially_propagable::value>
+   #endif
 {
    private:
    BOOST_MOVABLE_BUT_NOT_COPYABLE(vector_alloc_holder)
+   #ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+   typedef vector_max_size_tracker
+      < typename allocator_traits<Allocator>::size_type
+      , allocator_traits<Allocator>::is_partially_propagable::value>   max_size_tracker_t;
+   #endif
 
    public:
    typedef Allocator                                           allocator_type;
@@ -487,6 +537,7 @@ struct vector_alloc_holder
       , m_size(holder.m_size)
       , m_capacity(holder.m_capacity)
    {
+      holder.track_max_size();
       holder.m_start = pointer();
       holder.m_size = holder.m_capacity = 0;
    }
@@ -499,10 +550,16 @@ struct vector_alloc_holder
    }
 
    BOOST_CONTAINER_FORCEINLINE void set_stored_size(size_type s) BOOST_NOEXCEPT_OR_NOTHROW
-      {  this->m_size = static_cast<stored_size_type>(s);   }
+   {
+      this->track_max_size();
+      this->m_size = static_cast<stored_size_type>(s);
+   }
 
    BOOST_CONTAINER_FORCEINLINE void dec_stored_size(size_type s) BOOST_NOEXCEPT_OR_NOTHROW
-      {  this->m_size = static_cast<stored_size_type>(this->m_size - s);   }
+   {
+      this->track_max_size();
+      this->m_size = static_cast<stored_size_type>(this->m_size - s);
+   }
 
    BOOST_CONTAINER_FORCEINLINE void inc_stored_size(size_type s) BOOST_NOEXCEPT_OR_NOTHROW
       {  this->m_size = static_cast<stored_size_type>(this->m_size + s);   }
@@ -527,6 +584,18 @@ struct vector_alloc_holder
       return allocator_traits_type::allocate(this->alloc(), n);
    }
 
+   //Allocates at least n elements and updates n with the number of elements
+   //the new storage can hold (limited by stored_size_type).
+   inline pointer allocate_at_least(size_type &n)
+   {
+      const size_type max_alloc = allocator_traits_type::max_size(this->alloc());
+      const size_type max = dtl::limit_by_stored_size_type<size_type, stored_size_type>::clamp(max_alloc);
+      if (BOOST_UNLIKELY(max < n) )
+         boost::container::throw_length_error("get_next_capacity, allocator's max size reached");
+
+      return dtl::allocate_at_least_up_to(this->alloc(), n, max);
+   }
+
    inline void deallocate(const pointer &p, size_type n)
    {
       allocator_traits_type::deallocate(this->alloc(), p, n);
@@ -538,7 +607,8 @@ struct vector_alloc_holder
       const size_type new_cap = size_type(this->capacity() + at_least);
       size_type real_cap = new_cap;
       pointer reuse = this->start();
-      bool const success = !!this->allocation_command(expand_fwd, new_cap, real_cap, reuse);
+      //Failing to expand is not an error, the caller will reallocate or report it
+      bool const success = !!this->allocation_command(expand_fwd | nothrow_allocation, new_cap, real_cap, reuse);
       //Check for forward expansion
       if(success){
          #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
@@ -561,15 +631,31 @@ struct vector_alloc_holder
       if ( remaining_cap < min_additional_cap )
          boost::container::throw_length_error("get_next_capacity, allocator's max size reached");
 
-      return GrowthFactorType()( size_type(this->m_capacity), min_additional_cap, max);
+      return dtl::growth_factor_next_capacity<GrowthFactorType, sizeof(value_type)>
+         ( size_type(this->m_capacity), min_additional_cap, max);
    }
 
    pointer           m_start;
    stored_size_type  m_size;
    stored_size_type  m_capacity;
 
+   //Must be called before the size is decreased, so that the maximum size reached is known
+   BOOST_CONTAINER_FORCEINLINE void track_max_size() BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      #ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+      this->max_size_tracker_t::track_max_size(size_type(this->m_size));
+      #endif
+   }
+
+   #ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+   size_type max_size_reached() const BOOST_NOEXCEPT_OR_NOTHROW
+   {  return this->max_size_tracker_t::max_size_reached(size_type(this->m_size));  }
+   #endif
+
    void swap_resources(vector_alloc_holder &x) BOOST_NOEXCEPT_OR_NOTHROW
    {
+      this->track_max_size();
+      x.track_max_size();
       boost::adl_move_swap(this->m_start, x.m_start);
       boost::adl_move_swap(this->m_size, x.m_size);
       boost::adl_move_swap(this->m_capacity, x.m_capacity);
@@ -577,6 +663,8 @@ struct vector_alloc_holder
 
    void steal_resources(vector_alloc_holder &x) BOOST_NOEXCEPT_OR_NOTHROW
    {
+      this->track_max_size();
+      x.track_max_size();
       this->m_start     = x.m_start;
       this->m_size      = x.m_size;
       this->m_capacity  = x.m_capacity;
@@ -626,7 +714,7 @@ struct vector_alloc_holder
       //First detect overflow on smaller stored_size_types
       vec_on_type_overflow<size_type, stored_size_type>::throw_length(limit_size, "get_next_capacity, allocator's max size reached");
       (clamp_by_stored_size_type<size_type>)(prefer_in_recvd_out_size, stored_size_type());
-      pointer const p = this->allocate(prefer_in_recvd_out_size);
+      pointer const p = this->allocate_at_least(prefer_in_recvd_out_size);
       reuse = pointer();
       return p;
    }
@@ -638,6 +726,9 @@ struct vector_alloc_holder
    {
       //First detect overflow on smaller stored_size_types
       vec_on_type_overflow<size_type, stored_size_type>::throw_length(limit_size, "get_next_capacity, allocator's max size reached");
+      //Version 2 allocators just fail when the limit is not achievable, report it as version 1 allocation does
+      if (BOOST_UNLIKELY(!(command & nothrow_allocation) && allocator_traits_type::max_size(this->alloc()) < limit_size))
+         boost::container::throw_length_error("get_next_capacity, allocator's max size reached");
       (clamp_by_stored_size_type<size_type>)(prefer_in_recvd_out_size, stored_size_type());
       //Allocate memory 
       pointer p = this->alloc().allocation_command(command, limit_size, prefer_in_recvd_out_size, reuse);
@@ -668,20 +759,20 @@ struct vector_alloc_holder<Allocator, StoredSizeType, version_0>
    friend struct vector_alloc_holder;
 
    //Constructor, does not throw
-   vector_alloc_holder()
+   BOOST_CONTAINER_CONSTEXPR20 vector_alloc_holder()
       BOOST_NOEXCEPT_IF(dtl::is_nothrow_default_constructible<allocator_type>::value)
       : allocator_type(), m_size()
    {}
 
    //Constructor, does not throw
    template<class AllocConvertible>
-   explicit vector_alloc_holder(BOOST_FWD_REF(AllocConvertible) a) BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_CONSTEXPR20 explicit vector_alloc_holder(BOOST_FWD_REF(AllocConvertible) a) BOOST_NOEXCEPT_OR_NOTHROW
       : allocator_type(boost::forward<AllocConvertible>(a)), m_size()
    {}
 
    //Constructor, does not throw
    template<class AllocConvertible>
-   vector_alloc_holder(vector_uninitialized_size_t, BOOST_FWD_REF(AllocConvertible) a, size_type initial_size)
+   BOOST_CONTAINER_CONSTEXPR20 vector_alloc_holder(vector_uninitialized_size_t, BOOST_FWD_REF(AllocConvertible) a, size_type initial_size)
       : allocator_type(boost::forward<AllocConvertible>(a))
       , m_size(static_cast<stored_size_type>(initial_size))  //Size is initialized here...
    {
@@ -690,7 +781,7 @@ struct vector_alloc_holder<Allocator, StoredSizeType, version_0>
    }
 
    //Constructor, does not throw
-   vector_alloc_holder(vector_uninitialized_size_t, size_type initial_size)
+   BOOST_CONTAINER_CONSTEXPR20 vector_alloc_holder(vector_uninitialized_size_t, size_type initial_size)
       : allocator_type()
       , m_size(static_cast<stored_size_type>(initial_size))  //Size is initialized here...
    {
@@ -698,19 +789,17 @@ struct vector_alloc_holder<Allocator, StoredSizeType, version_0>
       this->priv_first_allocation(initial_size);
    }
 
-   vector_alloc_holder(BOOST_RV_REF(vector_alloc_holder) holder)
+   BOOST_CONTAINER_CONSTEXPR20 vector_alloc_holder(BOOST_RV_REF(vector_alloc_holder) holder)
       : allocator_type(BOOST_MOVE_BASE(allocator_type, holder))
       , m_size(holder.m_size) //Size is initialized here so vector should only call uninitialized_xxx after this
    {
-      ::boost::container::uninitialized_move_alloc_n
+      ::boost::container::uninitialized_relocate_alloc_n
          (this->alloc(), boost::movelib::to_raw_pointer(holder.start()), m_size, boost::movelib::to_raw_pointer(this->start()));
-      ::boost::container::destroy_alloc_n
-         (this->alloc(), boost::movelib::to_raw_pointer(holder.start()), m_size);
       holder.m_size = 0;
    }
 
    template<class OtherAllocator, class OtherStoredSizeType, class OtherAllocatorVersion>
-   vector_alloc_holder(BOOST_RV_REF_BEG vector_alloc_holder<OtherAllocator, OtherStoredSizeType, OtherAllocatorVersion> BOOST_RV_REF_END holder)
+   BOOST_CONTAINER_CONSTEXPR20 vector_alloc_holder(BOOST_RV_REF_BEG vector_alloc_holder<OtherAllocator, OtherStoredSizeType, OtherAllocatorVersion> BOOST_RV_REF_END holder)
       : allocator_type()
       , m_size(holder.m_size) //Initialize it to m_size as first_allocation can only succeed or abort
    {
@@ -721,30 +810,30 @@ struct vector_alloc_holder<Allocator, StoredSizeType, version_0>
          (this->alloc(), boost::movelib::to_raw_pointer(holder.start()), n, boost::movelib::to_raw_pointer(this->start()));
    }
 
-   static inline void on_capacity_overflow()
+   static inline BOOST_CONTAINER_CONSTEXPR20 void on_capacity_overflow()
    {  allocator_type::on_capacity_overflow();  }
 
-   inline void set_stored_size(size_type s) BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 void set_stored_size(size_type s) BOOST_NOEXCEPT_OR_NOTHROW
       {  this->m_size = static_cast<stored_size_type>(s);   }
 
-   inline void dec_stored_size(size_type s) BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 void dec_stored_size(size_type s) BOOST_NOEXCEPT_OR_NOTHROW
       {  this->m_size = static_cast<stored_size_type>(this->m_size - s);   }
 
-   inline void inc_stored_size(size_type s) BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 void inc_stored_size(size_type s) BOOST_NOEXCEPT_OR_NOTHROW
       {  this->m_size = static_cast<stored_size_type>(this->m_size + s);   }
 
-   inline void priv_first_allocation(size_type cap)
+   inline BOOST_CONTAINER_CONSTEXPR20 void priv_first_allocation(size_type cap)
    {
       if(cap > allocator_type::internal_capacity){
          on_capacity_overflow();
       }
    }
 
-   inline void deep_swap(vector_alloc_holder &x)
+   inline BOOST_CONTAINER_CONSTEXPR20 void deep_swap(vector_alloc_holder &x)
       {  this->priv_deep_swap(x);   }
 
    template<class OtherAllocator, class OtherStoredSizeType, class OtherAllocatorVersion>
-   void deep_swap(vector_alloc_holder<OtherAllocator, OtherStoredSizeType, OtherAllocatorVersion> &x)
+   BOOST_CONTAINER_CONSTEXPR20 void deep_swap(vector_alloc_holder<OtherAllocator, OtherStoredSizeType, OtherAllocatorVersion> &x)
    {
       typedef typename real_allocator<value_type, OtherAllocator>::type other_allocator_type;
       if(this->m_size > other_allocator_type::internal_capacity || x.m_size > allocator_type::internal_capacity){
@@ -753,29 +842,32 @@ struct vector_alloc_holder<Allocator, StoredSizeType, version_0>
       this->priv_deep_swap(x);
    }
 
-   inline void swap_resources(vector_alloc_holder &) BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 void swap_resources(vector_alloc_holder &) BOOST_NOEXCEPT_OR_NOTHROW
    {  //Containers with version 0 allocators can't be moved without moving elements one by one
       on_capacity_overflow();
    }
 
-   inline void steal_resources(vector_alloc_holder &)
+   inline BOOST_CONTAINER_CONSTEXPR20 void steal_resources(vector_alloc_holder &)
    {  //Containers with version 0 allocators can't be moved without moving elements one by one
       on_capacity_overflow();
    }
 
-   inline allocator_type &alloc() BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 allocator_type &alloc() BOOST_NOEXCEPT_OR_NOTHROW
    {  return *this;  }
 
-   inline const allocator_type &alloc() const BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 const allocator_type &alloc() const BOOST_NOEXCEPT_OR_NOTHROW
    {  return *this;  }
 
-   BOOST_CONTAINER_FORCEINLINE bool try_expand_fwd(size_type at_least)
+   BOOST_CONTAINER_FORCEINLINE BOOST_CONTAINER_CONSTEXPR20 bool try_expand_fwd(size_type at_least)
    {  return !at_least;  }
 
-   BOOST_CONTAINER_FORCEINLINE pointer start() const       BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_FORCEINLINE BOOST_CONTAINER_CONSTEXPR20 void track_max_size() BOOST_NOEXCEPT_OR_NOTHROW
+   {}
+
+   BOOST_CONTAINER_FORCEINLINE BOOST_CONTAINER_CONSTEXPR20 pointer start() const       BOOST_NOEXCEPT_OR_NOTHROW
    {  return allocator_type::internal_storage();  }
    
-   BOOST_CONTAINER_FORCEINLINE size_type capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_FORCEINLINE BOOST_CONTAINER_CONSTEXPR20 size_type capacity() const BOOST_NOEXCEPT_OR_NOTHROW
    {  return allocator_type::internal_capacity;  }
    
    stored_size_type m_size;
@@ -783,7 +875,7 @@ struct vector_alloc_holder<Allocator, StoredSizeType, version_0>
    private:
 
    template<class OtherAllocator, class OtherStoredSizeType, class OtherAllocatorVersion>
-   void priv_deep_swap(vector_alloc_holder<OtherAllocator, OtherStoredSizeType, OtherAllocatorVersion> &x)
+   BOOST_CONTAINER_CONSTEXPR20 void priv_deep_swap(vector_alloc_holder<OtherAllocator, OtherStoredSizeType, OtherAllocatorVersion> &x)
    {
       const size_type MaxTmpStorage = sizeof(value_type)*allocator_type::internal_capacity;
       value_type *const first_this = boost::movelib::to_raw_pointer(this->start());
@@ -795,7 +887,9 @@ struct vector_alloc_holder<Allocator, StoredSizeType, version_0>
       else{
          boost::container::deep_swap_alloc_n<MaxTmpStorage>(this->alloc(), first_x, x.m_size, first_this, this->m_size);
       }
-      boost::adl_move_swap(this->m_size, x.m_size);
+      const stored_size_type sz = this->m_size;
+      this->m_size = x.m_size;
+      x.m_size = sz;
    }
 };
 
@@ -879,11 +973,11 @@ private:
 
    protected:
    template <bool PropagateAllocator>
-   inline static bool is_propagable_from(const allocator_type &from_alloc, pointer p, const allocator_type &to_alloc)
+   inline BOOST_CONTAINER_CONSTEXPR20 static bool is_propagable_from(const allocator_type &from_alloc, pointer p, const allocator_type &to_alloc)
    {  return alloc_holder_t::template is_propagable_from<PropagateAllocator>(from_alloc, p, to_alloc);  }
 
    template <bool PropagateAllocator>
-   inline static bool are_swap_propagable( const allocator_type &l_a, pointer l_p
+   inline BOOST_CONTAINER_CONSTEXPR20 static bool are_swap_propagable( const allocator_type &l_a, pointer l_p
                                          , const allocator_type &r_a, pointer r_p)
    {  return alloc_holder_t::template are_swap_propagable<PropagateAllocator>(l_a, l_p, r_a, r_p);  }
 
@@ -896,19 +990,24 @@ private:
 
    protected:
 
-   inline void steal_resources(vector &x)
+   inline BOOST_CONTAINER_CONSTEXPR20 void steal_resources(vector &x)
    {  return this->m_holder.steal_resources(x.m_holder);   }
 
-   inline void protected_set_size(size_type n)
-   {  this->m_holder.m_size = static_cast<stored_size_type>(n);   }
+   inline BOOST_CONTAINER_CONSTEXPR20 void protected_set_size(size_type n)
+   {  this->m_holder.set_stored_size(n);   }
+
+   #ifdef BOOST_CONTAINER_INLINE_STORAGE_STATS
+   inline BOOST_CONTAINER_CONSTEXPR20 size_type protected_max_size_reached() const
+   {  return this->m_holder.max_size_reached();   }
+   #endif
 
    template<class AllocFwd>
-   inline vector(initial_capacity_t, pointer initial_memory, size_type cap, BOOST_FWD_REF(AllocFwd) a)
+   inline BOOST_CONTAINER_CONSTEXPR20 vector(initial_capacity_t, pointer initial_memory, size_type cap, BOOST_FWD_REF(AllocFwd) a)
       : m_holder(initial_capacity_t(), initial_memory, cap, ::boost::forward<AllocFwd>(a))
    {}
 
    template<class AllocFwd>
-   inline vector(initial_capacity_t, pointer initial_memory, size_type cap, BOOST_FWD_REF(AllocFwd) a, vector &x)
+   inline BOOST_CONTAINER_CONSTEXPR20 vector(initial_capacity_t, pointer initial_memory, size_type cap, BOOST_FWD_REF(AllocFwd) a, vector &x)
       : m_holder(initial_capacity_t(), initial_memory, cap, ::boost::forward<AllocFwd>(a))
    {
       allocator_type &this_al = this->get_stored_allocator();
@@ -926,12 +1025,12 @@ private:
       }
    }
 
-   inline vector(initial_capacity_t, pointer initial_memory, size_type cap)
+   inline BOOST_CONTAINER_CONSTEXPR20 vector(initial_capacity_t, pointer initial_memory, size_type cap)
       : m_holder(initial_capacity_t(), initial_memory, cap)
    {}
 
    template<class SizeType, class AllocFwd>
-   inline vector(maybe_initial_capacity_t, pointer p, SizeType initial_capacity, BOOST_FWD_REF(AllocFwd) a)
+   inline BOOST_CONTAINER_CONSTEXPR20 vector(maybe_initial_capacity_t, pointer p, SizeType initial_capacity, BOOST_FWD_REF(AllocFwd) a)
       : m_holder(maybe_initial_capacity_t(), p, initial_capacity, ::boost::forward<AllocFwd>(a))
    {
       #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
@@ -940,7 +1039,7 @@ private:
    }
 
    template<class SizeType>
-   inline vector(maybe_initial_capacity_t, pointer p, SizeType initial_capacity)
+   inline BOOST_CONTAINER_CONSTEXPR20 vector(maybe_initial_capacity_t, pointer p, SizeType initial_capacity)
       : m_holder(maybe_initial_capacity_t(), p, initial_capacity)
    {
       #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
@@ -949,7 +1048,7 @@ private:
    }
 
    template <class U>
-   void protected_init_n(const size_type new_size, const U& u)
+   BOOST_CONTAINER_CONSTEXPR20 void protected_init_n(const size_type new_size, const U& u)
    {
       BOOST_ASSERT(this->empty());
       this->priv_resize_proxy(u).uninitialized_copy_n_and_update(this->m_holder.alloc(), this->priv_raw_begin(), new_size);
@@ -970,7 +1069,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   vector() BOOST_NOEXCEPT_IF(dtl::is_nothrow_default_constructible<allocator_type>::value)
+   BOOST_CONTAINER_CONSTEXPR20 vector() BOOST_NOEXCEPT_IF(dtl::is_nothrow_default_constructible<allocator_type>::value)
       : m_holder()
    {}
 
@@ -979,7 +1078,7 @@ private:
    //! <b>Throws</b>: Nothing
    //!
    //! <b>Complexity</b>: Constant.
-   explicit vector(const allocator_type& a) BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_CONSTEXPR20 explicit vector(const allocator_type& a) BOOST_NOEXCEPT_OR_NOTHROW
       : m_holder(a)
    {}
 
@@ -989,7 +1088,7 @@ private:
    //!   throws or T's value initialization throws.
    //!
    //! <b>Complexity</b>: Linear to n.
-   explicit vector(size_type n)
+   BOOST_CONTAINER_CONSTEXPR20 explicit vector(size_type n)
       :  m_holder(vector_uninitialized_size, n)
    {
       #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
@@ -1006,7 +1105,7 @@ private:
    //!   throws or T's value initialization throws.
    //!
    //! <b>Complexity</b>: Linear to n.
-   explicit vector(size_type n, const allocator_type &a)
+   BOOST_CONTAINER_CONSTEXPR20 explicit vector(size_type n, const allocator_type &a)
       :  m_holder(vector_uninitialized_size, a, n)
    {
       #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
@@ -1025,7 +1124,7 @@ private:
    //! <b>Complexity</b>: Linear to n.
    //!
    //! <b>Note</b>: Non-standard extension
-   vector(size_type n, default_init_t)
+   BOOST_CONTAINER_CONSTEXPR20 vector(size_type n, default_init_t)
       :  m_holder(vector_uninitialized_size, n)
    {
       #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
@@ -1044,7 +1143,7 @@ private:
    //! <b>Complexity</b>: Linear to n.
    //!
    //! <b>Note</b>: Non-standard extension
-   vector(size_type n, default_init_t, const allocator_type &a)
+   BOOST_CONTAINER_CONSTEXPR20 vector(size_type n, default_init_t, const allocator_type &a)
       :  m_holder(vector_uninitialized_size, a, n)
    {
       #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
@@ -1054,6 +1153,49 @@ private:
          (this->m_holder.alloc(), n, this->priv_raw_begin());
    }
 
+   //! <b>Effects</b>: Constructs a vector and inserts n value initialized values.
+   //!   Elements are constructed concurrently by several threads.
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation
+   //!   throws or T's value initialization throws. If a construction
+   //!   throws, all constructed elements are destroyed.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   //!
+   //! <b>Note</b>: Non-standard extension. allocator_type's construct and destroy
+   //!   must be callable concurrently.
+   BOOST_CONTAINER_CONSTEXPR20 vector(size_type n, parallel_init_t)
+      :  m_holder(vector_uninitialized_size, n)
+   {
+      #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
+      this->num_alloc += n != 0;
+      #endif
+      boost::container::parallel_uninitialized_value_init_alloc_n
+         (this->m_holder.alloc(), n, this->priv_raw_begin());
+   }
+
+   //! <b>Effects</b>: Constructs a vector that will use a copy of allocator a
+   //!   and inserts n value initialized values.
+   //!   Elements are constructed concurrently by several threads.
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation
+   //!   throws or T's value initialization throws. If a construction
+   //!   throws, all constructed elements are destroyed.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   //!
+   //! <b>Note</b>: Non-standard extension. allocator_type's construct and destroy
+   //!   must be callable concurrently.
+   BOOST_CONTAINER_CONSTEXPR20 vector(size_type n, parallel_init_t, const allocator_type &a)
+      :  m_holder(vector_uninitialized_size, a, n)
+   {
+      #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
+      this->num_alloc += n != 0;
+      #endif
+      boost::container::parallel_uninitialized_value_init_alloc_n
+         (this->m_holder.alloc(), n, this->priv_raw_begin());
+   }
+
    //! <b>Effects</b>: Constructs a vector
    //!   and inserts n copies of value.
    //!
@@ -1061,7 +1203,7 @@ private:
    //!   throws or T's copy constructor throws.
    //!
    //! <b>Complexity</b>: Linear to n.
-   vector(size_type n, const T& value)
+   BOOST_CONTAINER_CONSTEXPR20 vector(size_type n, const T& value)
       :  m_holder(vector_uninitialized_size, n)
    {
       #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
@@ -1078,7 +1220,7 @@ private:
    //!   throws or T's copy constructor throws.
    //!
    //! <b>Complexity</b>: Linear to n.
-   vector(size_type n, const T& value, const allocator_type& a)
+   BOOST_CONTAINER_CONSTEXPR20 vector(size_type n, const T& value, const allocator_type& a)
       :  m_holder(vector_uninitialized_size, a, n)
    {
       #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
@@ -1088,6 +1230,50 @@ private:
          (this->m_holder.alloc(), value, n, this->priv_raw_begin());
    }
 
+   //! <b>Effects</b>: Constructs a vector
+   //!   and inserts n copies of value.
+   //!   Elements are constructed concurrently by several threads.
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation
+   //!   throws or T's copy constructor throws. If a construction
+   //!   throws, all constructed elements are destroyed.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   //!
+   //! <b>Note</b>: Non-standard extension. allocator_type's construct and destroy
+   //!   must be callable concurrently.
+   BOOST_CONTAINER_CONSTEXPR20 vector(size_type n, const T& value, parallel_init_t)
+      :  m_holder(vector_uninitialized_size, n)
+   {
+      #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
+      this->num_alloc += n != 0;
+      #endif
+      boost::container::parallel_uninitialized_fill_alloc_n
+         (this->m_holder.alloc(), value, n, this->priv_raw_begin());
+   }
+
+   //! <b>Effects</b>: Constructs a vector that will use a copy of allocator a
+   //!   and inserts n copies of value.
+   //!   Elements are constructed concurrently by several threads.
+   //!
+   //! <b>Throws</b>: If allocation
+   //!   throws or T's copy constructor throws. If a construction
+   //!   throws, all constructed elements are destroyed.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   //!
+   //! <b>Note</b>: Non-standard extension. allocator_type's construct and destroy
+   //!   must be callable concurrently.
+   BOOST_CONTAINER_CONSTEXPR20 vector(size_type n, const T& value, parallel_init_t, const allocator_type& a)
+      :  m_holder(vector_uninitialized_size, a, n)
+   {
+      #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
+      this->num_alloc += n != 0;
+      #endif
+      boost::container::parallel_uninitialized_fill_alloc_n
+         (this->m_holder.alloc(), value, n, this->priv_raw_begin());
+   }
+
    //! <b>Effects</b>: Constructs a vector
    //!   and inserts a copy of the range [first, last) in the vector.
    //!
@@ -1096,7 +1282,7 @@ private:
    //!
    //! <b>Complexity</b>: Linear to the range [first, last).
    template <class InIt>
-   vector(InIt first, InIt last
+   BOOST_CONTAINER_CONSTEXPR20 vector(InIt first, InIt last
       BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename dtl::disable_if_c
          < dtl::is_convertible<InIt BOOST_MOVE_I size_type>::value
          BOOST_MOVE_I dtl::nat >::type * = 0)
@@ -1112,7 +1298,7 @@ private:
    //!
    //! <b>Complexity</b>: Linear to the range [first, last).
    template <class InIt>
-   vector(InIt first, InIt last, const allocator_type& a
+   BOOST_CONTAINER_CONSTEXPR20 vector(InIt first, InIt last, const allocator_type& a
       BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename dtl::disable_if_c
          < dtl::is_convertible<InIt BOOST_MOVE_I size_type>::value
          BOOST_MOVE_I dtl::nat >::type * = 0)
@@ -1128,7 +1314,7 @@ private:
    //!   throws or T's copy constructor throws.
    //!
    //! <b>Complexity</b>: Linear to the elements x contains.
-   vector(const vector &x)
+   BOOST_CONTAINER_CONSTEXPR20 vector(const vector &x)
       :  m_holder( vector_uninitialized_size
                  , allocator_traits_type::select_on_container_copy_construction(x.m_holder.alloc())
                  , x.size())
@@ -1141,12 +1327,38 @@ private:
          , x.size(), this->priv_raw_begin());
    }
 
+   //! <b>Effects</b>: Copy constructs a vector. Elements are constructed
+   //!   concurrently by several threads.
+   //!
+   //! <b>Postcondition</b>: x == *this.
+   //!
+   //! <b>Throws</b>: If allocator_type's allocation
+   //!   throws or T's copy constructor throws. If a construction
+   //!   throws, all constructed elements are destroyed.
+   //!
+   //! <b>Complexity</b>: Linear to the elements x contains.
+   //!
+   //! <b>Note</b>: Non-standard extension. allocator_type's construct and destroy
+   //!   must be callable concurrently.
+   BOOST_CONTAINER_CONSTEXPR20 vector(const vector &x, parallel_init_t)
+      :  m_holder( vector_uninitialized_size
+                 , allocator_traits_type::select_on_container_copy_construction(x.m_holder.alloc())
+                 , x.size())
+   {
+      #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
+      this->num_alloc += x.size() != 0;
+      #endif
+      ::boost::container::parallel_uninitialized_copy_alloc_n
+         ( this->m_holder.alloc(), x.priv_raw_begin()
+         , x.size(), this->priv_raw_begin());
+   }
+
    //! <b>Effects</b>: Move constructor. Moves x's resources to *this.
    //!
    //! <b>Throws</b>: Nothing
    //!
    //! <b>Complexity</b>: Constant.
-   vector(BOOST_RV_REF(vector) x) BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_CONSTEXPR20 vector(BOOST_RV_REF(vector) x) BOOST_NOEXCEPT_OR_NOTHROW
       :  m_holder(boost::move(x.m_holder))
    {  BOOST_CONTAINER_STATIC_ASSERT((!allocator_traits_type::is_partially_propagable::value));  }
 
@@ -1157,7 +1369,7 @@ private:
    //! <b>Throws</b>: If T's constructor taking a dereferenced initializer_list iterator throws.
    //!
    //! <b>Complexity</b>: Linear to the range [il.begin(), il.end()).
-   vector(std::initializer_list<value_type> il, const allocator_type& a = allocator_type())
+   BOOST_CONTAINER_CONSTEXPR20 vector(std::initializer_list<value_type> il, const allocator_type& a = allocator_type())
       :  m_holder(vector_uninitialized_size, a, il.size())
    {
       #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
@@ -1179,7 +1391,7 @@ private:
    //!
    //! <b>Note</b>: Non-standard extension to support static_vector
    template<class OtherA>
-   vector(BOOST_RV_REF_BEG vector<T, OtherA, Options> BOOST_RV_REF_END x
+   BOOST_CONTAINER_CONSTEXPR20 vector(BOOST_RV_REF_BEG vector<T, OtherA, Options> BOOST_RV_REF_END x
          , typename dtl::enable_if_c
             < dtl::is_version<typename real_allocator<T, OtherA>::type, 0>::value>::type * = 0
          )
@@ -1196,7 +1408,7 @@ private:
    //!   throws or T's copy constructor throws.
    //!
    //! <b>Complexity</b>: Linear to the elements x contains.
-   vector(const vector &x, const BOOST_CONTAINER_DOC1ST(allocator_type, typename dtl::type_identity<allocator_type>::type) &a)
+   BOOST_CONTAINER_CONSTEXPR20 vector(const vector &x, const BOOST_CONTAINER_DOC1ST(allocator_type, typename dtl::type_identity<allocator_type>::type) &a)
       :  m_holder(vector_uninitialized_size, a, x.size())
    {
       #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
@@ -1214,7 +1426,7 @@ private:
    //! <b>Throws</b>: If allocation or T's copy constructor throws.
    //!
    //! <b>Complexity</b>: Constant if a == x.get_allocator(), linear otherwise.
-   vector(BOOST_RV_REF(vector) x, const BOOST_CONTAINER_DOC1ST(allocator_type, typename dtl::type_identity<allocator_type>::type) &a)
+   BOOST_CONTAINER_CONSTEXPR20 vector(BOOST_RV_REF(vector) x, const BOOST_CONTAINER_DOC1ST(allocator_type, typename dtl::type_identity<allocator_type>::type) &a)
       :  m_holder( vector_uninitialized_size, a
                  //In this allocator move constructor the allocator won't be propagated --v
                  , is_propagable_from<false>(x.get_stored_allocator(), x.m_holder.start(), a) ? 0 : x.size()
@@ -1241,7 +1453,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Linear to the number of elements.
-   ~vector() BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_CONSTEXPR20 ~vector() BOOST_NOEXCEPT_OR_NOTHROW
    #if defined(BOOST_INTRUSIVE_CONCEPTS_BASED_OVERLOADING)
       requires (!dtl::is_version_0_alloc_and_trivially_destructible<allocator_type>::value)
    #endif
@@ -1253,7 +1465,7 @@ private:
 
    #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED) && defined(BOOST_INTRUSIVE_CONCEPTS_BASED_OVERLOADING)
    //Default destructor for normal links (allows conditional triviality)
-   ~vector()
+   BOOST_CONTAINER_CONSTEXPR20 ~vector()
       requires (dtl::is_version_0_alloc_and_trivially_destructible<allocator_type>::value)
       = default;
    #endif
@@ -1266,7 +1478,7 @@ private:
    //! <b>Throws</b>: If memory allocation throws or T's copy/move constructor/assignment throws.
    //!
    //! <b>Complexity</b>: Linear to the number of elements in x.
-   inline vector& operator=(BOOST_COPY_ASSIGN_REF(vector) x)
+   inline BOOST_CONTAINER_CONSTEXPR20 vector& operator=(BOOST_COPY_ASSIGN_REF(vector) x)
    {
       if (BOOST_LIKELY(&x != this)){
          this->priv_copy_assign(x);
@@ -1278,7 +1490,7 @@ private:
    //! <b>Effects</b>: Make *this container contains elements from il.
    //!
    //! <b>Complexity</b>: Linear to the range [il.begin(), il.end()).
-   inline vector& operator=(std::initializer_list<value_type> il)
+   inline BOOST_CONTAINER_CONSTEXPR20 vector& operator=(std::initializer_list<value_type> il)
    {
       this->assign(il.begin(), il.end());
       return *this;
@@ -1296,7 +1508,7 @@ private:
    //! <b>Complexity</b>: Constant if allocator_traits_type::
    //!   propagate_on_container_move_assignment is true or
    //!   this->get>allocator() == x.get_allocator(). Linear otherwise.
-   inline vector& operator=(BOOST_RV_REF(vector) x)
+   inline BOOST_CONTAINER_CONSTEXPR20 vector& operator=(BOOST_RV_REF(vector) x)
       BOOST_NOEXCEPT_IF(allocator_traits_type::propagate_on_container_move_assignment::value
                         || allocator_traits_type::is_always_equal::value)
    {
@@ -1319,7 +1531,7 @@ private:
    //!
    //! <b>Note</b>: Non-standard extension to support static_vector
    template<class OtherA>
-   inline typename dtl::enable_if_and
+   inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_and
                            < vector&
                            , dtl::is_version<typename real_allocator<T, OtherA>::type, 0>
                            , dtl::is_different<typename real_allocator<T, OtherA>::type, allocator_type>
@@ -1341,7 +1553,7 @@ private:
    //!
    //! <b>Note</b>: Non-standard extension to support static_vector
    template<class OtherA>
-   inline typename dtl::enable_if_and
+   inline BOOST_CONTAINER_CONSTEXPR20 typename dtl::enable_if_and
                            < vector&
                            , dtl::is_version<typename real_allocator<T, OtherA>::type, 0>
                            , dtl::is_different<typename real_allocator<T, OtherA>::type, allocator_type>
@@ -1361,7 +1573,7 @@ private:
    //!
    //! <b>Complexity</b>: Linear to n.
    template <class InIt>
-   void assign(InIt first, InIt last
+   BOOST_CONTAINER_CONSTEXPR20 void assign(InIt first, InIt last
       //Input iterators or version 0 allocator
       BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename dtl::disable_if_or
          < void
@@ -1398,7 +1610,7 @@ private:
    //! <b>Throws</b>: If memory allocation throws or
    //!   T's constructor from dereferencing iniializer_list iterator throws.
    //!
-   inline void assign(std::initializer_list<T> il)
+   inline BOOST_CONTAINER_CONSTEXPR20 void assign(std::initializer_list<T> il)
    {
       this->assign(il.begin(), il.end());
    }
@@ -1411,7 +1623,7 @@ private:
    //!
    //! <b>Complexity</b>: Linear to n.
    template <class FwdIt>
-   void assign(FwdIt first, FwdIt last
+   BOOST_CONTAINER_CONSTEXPR20 void assign(FwdIt first, FwdIt last
       //Forward iterators and version > 0 allocator
       BOOST_CONTAINER_DOCIGN(BOOST_MOVE_I typename dtl::disable_if_or
          < void
@@ -1444,7 +1656,7 @@ private:
             }
             this->m_holder.start(ret);
             this->m_holder.capacity(real_cap);
-            this->m_holder.m_size = 0;
+            this->m_holder.set_stored_size(0u);
             this->priv_uninitialized_construct_at_end(first, last);
             return;
          }
@@ -1467,7 +1679,7 @@ private:
    //!   T's copy/move constructor/assignment throws.
    //!
    //! <b>Complexity</b>: Linear to n.
-   inline void assign(size_type n, const value_type& val)
+   inline BOOST_CONTAINER_CONSTEXPR20 void assign(size_type n, const value_type& val)
    {  this->assign(cvalue_iterator(val, n), cvalue_iterator());   }
 
    //! <b>Effects</b>: Returns a copy of the internal allocator.
@@ -1475,7 +1687,7 @@ private:
    //! <b>Throws</b>: If allocator's copy constructor throws.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline allocator_type get_allocator() const BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 allocator_type get_allocator() const BOOST_NOEXCEPT_OR_NOTHROW
    { return this->m_holder.alloc();  }
 
    //! <b>Effects</b>: Returns a reference to the internal allocator.
@@ -1485,7 +1697,7 @@ private:
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: Non-standard extension.
-   BOOST_CONTAINER_NODISCARD inline 
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 
       stored_allocator_type &get_stored_allocator() BOOST_NOEXCEPT_OR_NOTHROW
    {  return this->m_holder.alloc(); }
 
@@ -1496,7 +1708,7 @@ private:
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: Non-standard extension.
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       const stored_allocator_type &get_stored_allocator() const BOOST_NOEXCEPT_OR_NOTHROW
    {  return this->m_holder.alloc(); }
 
@@ -1511,7 +1723,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline iterator begin() BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 iterator begin() BOOST_NOEXCEPT_OR_NOTHROW
    { return iterator(this->m_holder.start()); }
 
    //! <b>Effects</b>: Returns a const_iterator to the first element contained in the vector.
@@ -1519,7 +1731,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline const_iterator begin() const BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 const_iterator begin() const BOOST_NOEXCEPT_OR_NOTHROW
    { return const_iterator(this->m_holder.start()); }
 
    //! <b>Effects</b>: Returns an iterator to the end of the vector.
@@ -1527,7 +1739,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline iterator end() BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 iterator end() BOOST_NOEXCEPT_OR_NOTHROW
    {
       iterator it (this->m_holder.start());
       it += difference_type(this->m_holder.m_size);
@@ -1539,7 +1751,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline const_iterator end() const BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 const_iterator end() const BOOST_NOEXCEPT_OR_NOTHROW
    { return this->cend(); }
 
    //! <b>Effects</b>: Returns a reverse_iterator pointing to the beginning
@@ -1548,7 +1760,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline reverse_iterator rbegin() BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 reverse_iterator rbegin() BOOST_NOEXCEPT_OR_NOTHROW
    { return reverse_iterator(this->end());      }
 
    //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the beginning
@@ -1557,7 +1769,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline const_reverse_iterator rbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 const_reverse_iterator rbegin() const BOOST_NOEXCEPT_OR_NOTHROW
    { return this->crbegin(); }
 
    //! <b>Effects</b>: Returns a reverse_iterator pointing to the end
@@ -1566,7 +1778,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline reverse_iterator rend() BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 reverse_iterator rend() BOOST_NOEXCEPT_OR_NOTHROW
    { return reverse_iterator(this->begin());       }
 
    //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
@@ -1575,7 +1787,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline const_reverse_iterator rend() const BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 const_reverse_iterator rend() const BOOST_NOEXCEPT_OR_NOTHROW
    { return this->crend(); }
 
    //! <b>Effects</b>: Returns a const_iterator to the first element contained in the vector.
@@ -1583,7 +1795,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline const_iterator cbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 const_iterator cbegin() const BOOST_NOEXCEPT_OR_NOTHROW
    { return const_iterator(this->m_holder.start()); }
 
    //! <b>Effects</b>: Returns a const_iterator to the end of the vector.
@@ -1591,7 +1803,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline const_iterator cend() const BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 const_iterator cend() const BOOST_NOEXCEPT_OR_NOTHROW
    {
       const_iterator it (this->m_holder.start());
       it += difference_type(this->m_holder.m_size);
@@ -1604,7 +1816,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline const_reverse_iterator crbegin() const BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 const_reverse_iterator crbegin() const BOOST_NOEXCEPT_OR_NOTHROW
    { return const_reverse_iterator(this->end());}
 
    //! <b>Effects</b>: Returns a const_reverse_iterator pointing to the end
@@ -1613,7 +1825,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline const_reverse_iterator crend() const BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 const_reverse_iterator crend() const BOOST_NOEXCEPT_OR_NOTHROW
    { return const_reverse_iterator(this->begin()); }
 
    //////////////////////////////////////////////
@@ -1627,7 +1839,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline bool empty() const BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 bool empty() const BOOST_NOEXCEPT_OR_NOTHROW
    { return !this->m_holder.m_size; }
 
    //! <b>Effects</b>: Returns the number of the elements contained in the vector.
@@ -1635,7 +1847,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline size_type size() const BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 size_type size() const BOOST_NOEXCEPT_OR_NOTHROW
    { return this->m_holder.m_size; }
 
    //! <b>Effects</b>: Returns the largest possible size of the vector.
@@ -1643,7 +1855,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline size_type max_size() const BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 size_type max_size() const BOOST_NOEXCEPT_OR_NOTHROW
    { return allocator_traits_type::max_size(this->m_holder.alloc()); }
 
    //! <b>Effects</b>: Inserts or erases elements at the end such that
@@ -1652,7 +1864,7 @@ private:
    //! <b>Throws</b>: If memory allocation throws, or T's copy/move or value initialization throws.
    //!
    //! <b>Complexity</b>: Linear to the difference between size() and new_size.
-   inline void resize(size_type new_size)
+   inline BOOST_CONTAINER_CONSTEXPR20 void resize(size_type new_size)
    {  this->priv_resize(new_size, value_init, alloc_version());  }
 
    //! <b>Effects</b>: Inserts or erases elements at the end such that
@@ -1663,7 +1875,7 @@ private:
    //! <b>Complexity</b>: Linear to the difference between size() and new_size.
    //!
    //! <b>Note</b>: Non-standard extension
-   inline void resize(size_type new_size, default_init_t)
+   inline BOOST_CONTAINER_CONSTEXPR20 void resize(size_type new_size, default_init_t)
    {  this->priv_resize(new_size, default_init, alloc_version());  }
 
    //! <b>Effects</b>: Inserts or erases elements at the end such that
@@ -1672,16 +1884,42 @@ private:
    //! <b>Throws</b>: If memory allocation throws, or T's copy/move constructor throws.
    //!
    //! <b>Complexity</b>: Linear to the difference between size() and new_size.
-   inline void resize(size_type new_size, const T& x)
+   inline BOOST_CONTAINER_CONSTEXPR20 void resize(size_type new_size, const T& x)
    {  this->priv_resize(new_size, x, alloc_version());  }
 
+   //! <b>Effects</b>: Inserts or erases elements at the end such that
+   //!   the size becomes n. New elements are value initialized concurrently
+   //!   by several threads.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or T's copy/move or value initialization throws.
+   //!
+   //! <b>Complexity</b>: Linear to the difference between size() and new_size.
+   //!
+   //! <b>Note</b>: Non-standard extension. allocator_type's construct and destroy
+   //!   must be callable concurrently.
+   inline BOOST_CONTAINER_CONSTEXPR20 void resize(size_type new_size, parallel_init_t)
+   {  this->priv_resize_parallel(new_size, value_init);  }
+
+   //! <b>Effects</b>: Inserts or erases elements at the end such that
+   //!   the size becomes n. New elements are copy constructed from x concurrently
+   //!   by several threads.
+   //!
+   //! <b>Throws</b>: If memory allocation throws, or T's copy/move constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to the difference between size() and new_size.
+   //!
+   //! <b>Note</b>: Non-standard extension. allocator_type's construct and destroy
+   //!   must be callable concurrently.
+   inline BOOST_CONTAINER_CONSTEXPR20 void resize(size_type new_size, const T& x, parallel_init_t)
+   {  this->priv_resize_parallel(new_size, x);  }
+
    //! <b>Effects</b>: Number of elements for which memory has been allocated.
    //!   capacity() is always greater than or equal to size().
    //!
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline size_type capacity() const BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 size_type capacity() const BOOST_NOEXCEPT_OR_NOTHROW
    { return this->m_holder.capacity(); }
 
    //! <b>Effects</b>: If n is less than or equal to capacity(), this call has no
@@ -1690,7 +1928,7 @@ private:
    //!   n; otherwise, capacity() is unchanged. In either case, size() is unchanged.
    //!
    //! <b>Throws</b>: If memory allocation allocation throws or T's copy/move constructor throws.
-   inline void reserve(size_type new_cap)
+   inline BOOST_CONTAINER_CONSTEXPR20 void reserve(size_type new_cap)
    {
       if (this->capacity() < new_cap){
          this->priv_move_to_new_buffer(new_cap, alloc_version());
@@ -1703,8 +1941,50 @@ private:
    //! <b>Throws</b>: If memory allocation throws, or T's copy/move constructor throws.
    //!
    //! <b>Complexity</b>: Linear to size().
-   inline void shrink_to_fit()
-   {  this->priv_shrink_to_fit(alloc_version());   }
+   inline BOOST_CONTAINER_CONSTEXPR20 void shrink_to_fit()
+   {
+      dtl::growth_factor_on_shrink_to_fit<growth_factor_type>(this->m_holder.m_capacity, this->m_holder.m_size);
+      this->priv_shrink_to_fit(alloc_version());
+   }
+
+   //! <b>Effects</b>: Makes sure that n elements can be added at the end without reallocation,
+   //!   growing the storage geometrically, and returns a pointer to the uninitialized storage
+   //!   that follows the last element. size() is unchanged.
+   //!
+   //! <b>Returns</b>: A pointer p to storage for n elements. Elements constructed in [p, p + k)
+   //!   can be added to the vector calling commit(k).
+   //!
+   //! <b>Throws</b>: If memory allocation throws or T's move constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to size() if the vector is reallocated, constant otherwise.
+   //!
+   //! <b>Note</b>: Non-standard extension. It lets producers like read() or a decompressor write
+   //!   trivially copyable elements directly in the vector without initializing them first.
+   //!   The pointer is invalidated by any operation that modifies the vector except commit.
+   T* append_uninitialized(size_type n)
+   {
+      if (size_type(this->m_holder.capacity() - this->m_holder.m_size) < n){
+         this->priv_reserve_additional(n, alloc_version());
+      }
+      return this->priv_raw_end();
+   }
+
+   //! <b>Requires</b>: k is not greater than the argument of the last call to append_uninitialized,
+   //!   and k elements were constructed (or, for trivially copyable types, written) in the storage
+   //!   returned by it.
+   //!
+   //! <b>Effects</b>: Adds those k elements at the end of the vector.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: Non-standard extension.
+   void commit(size_type k) BOOST_NOEXCEPT_OR_NOTHROW
+   {
+      BOOST_ASSERT(k <= size_type(this->m_holder.capacity() - this->m_holder.m_size));
+      this->m_holder.inc_stored_size(k);
+   }
 
    //////////////////////////////////////////////
    //
@@ -1720,7 +2000,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline reference front() BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 reference front() BOOST_NOEXCEPT_OR_NOTHROW
    {
       BOOST_ASSERT(!this->empty());
       return *this->m_holder.start();
@@ -1734,7 +2014,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline const_reference front() const BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 const_reference front() const BOOST_NOEXCEPT_OR_NOTHROW
    {
       BOOST_ASSERT(!this->empty());
       return *this->m_holder.start();
@@ -1748,7 +2028,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline reference back() BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 reference back() BOOST_NOEXCEPT_OR_NOTHROW
    {
       BOOST_ASSERT(!this->empty());
       return this->m_holder.start()[difference_type(this->m_holder.m_size - 1u)];
@@ -1762,7 +2042,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline const_reference back()  const BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 const_reference back()  const BOOST_NOEXCEPT_OR_NOTHROW
    {
       BOOST_ASSERT(!this->empty());
       return this->m_holder.start()[this->m_holder.m_size - 1];
@@ -1776,7 +2056,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline reference operator[](size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 reference operator[](size_type n) BOOST_NOEXCEPT_OR_NOTHROW
    {
       BOOST_ASSERT(this->m_holder.m_size > n);
       return this->m_holder.start()[difference_type(n)];
@@ -1790,7 +2070,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       const_reference operator[](size_type n) const BOOST_NOEXCEPT_OR_NOTHROW
    {
       BOOST_ASSERT(this->m_holder.m_size > n);
@@ -1808,7 +2088,7 @@ private:
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: Non-standard extension
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       iterator nth(size_type n) BOOST_NOEXCEPT_OR_NOTHROW
    {
       BOOST_ASSERT(this->m_holder.m_size >= n);
@@ -1826,7 +2106,7 @@ private:
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: Non-standard extension
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       const_iterator nth(size_type n) const BOOST_NOEXCEPT_OR_NOTHROW
    {
       BOOST_ASSERT(this->m_holder.m_size >= n);
@@ -1843,7 +2123,7 @@ private:
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: Non-standard extension
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       size_type index_of(iterator p) BOOST_NOEXCEPT_OR_NOTHROW
    {
       //Range check assert done in priv_index_of
@@ -1860,7 +2140,7 @@ private:
    //! <b>Complexity</b>: Constant.
    //!
    //! <b>Note</b>: Non-standard extension
-   BOOST_CONTAINER_NODISCARD inline
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20
       size_type index_of(const_iterator p) const BOOST_NOEXCEPT_OR_NOTHROW
    {
       //Range check assert done in priv_index_of
@@ -1875,7 +2155,7 @@ private:
    //! <b>Throws</b>: range_error if n >= size()
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline reference at(size_type n)
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 reference at(size_type n)
    {
       this->priv_throw_if_out_of_range(n);
       return this->m_holder.start()[difference_type(n)];
@@ -1889,7 +2169,7 @@ private:
    //! <b>Throws</b>: range_error if n >= size()
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline const_reference at(size_type n) const
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 const_reference at(size_type n) const
    {
       this->priv_throw_if_out_of_range(n);
       return this->m_holder.start()[n];
@@ -1907,7 +2187,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline T* data() BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 T* data() BOOST_NOEXCEPT_OR_NOTHROW
    { return this->priv_raw_begin(); }
 
    //! <b>Returns</b>: A pointer such that [data(),data() + size()) is a valid range.
@@ -1916,7 +2196,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   BOOST_CONTAINER_NODISCARD inline const T * data()  const BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 const T * data()  const BOOST_NOEXCEPT_OR_NOTHROW
    { return this->priv_raw_begin(); }
 
    //////////////////////////////////////////////
@@ -1936,7 +2216,7 @@ private:
    //!
    //! <b>Complexity</b>: Amortized constant time.
    template<class ...Args>
-   inline reference emplace_back(BOOST_FWD_REF(Args)...args)
+   inline BOOST_CONTAINER_CONSTEXPR20 reference emplace_back(BOOST_FWD_REF(Args)...args)
    {
       if (BOOST_LIKELY(this->room_enough())){
          //There is more memory, just construct a new object at the end.
@@ -1965,7 +2245,7 @@ private:
    //!
    //! <b>Note</b>: Non-standard extension.
    template<class ...Args>
-   inline bool stable_emplace_back(BOOST_FWD_REF(Args)...args)
+   inline BOOST_CONTAINER_CONSTEXPR20 bool stable_emplace_back(BOOST_FWD_REF(Args)...args)
    {
       const bool is_room_enough = this->room_enough() || (alloc_version::value == 2 && this->m_holder.try_expand_fwd(1u));
       if (BOOST_LIKELY(is_room_enough)){
@@ -1988,7 +2268,7 @@ private:
    //!
    //! <b>Note</b>: Non-standard extension.
    template<class ...Args>
-   BOOST_CONTAINER_FORCEINLINE reference unchecked_emplace_back(BOOST_FWD_REF(Args)...args)
+   BOOST_CONTAINER_FORCEINLINE BOOST_CONTAINER_CONSTEXPR20 reference unchecked_emplace_back(BOOST_FWD_REF(Args)...args)
    {
       BOOST_ASSERT(this->size() < this->capacity());
       T* const p = this->priv_raw_end();
@@ -2008,7 +2288,7 @@ private:
    //! <b>Complexity</b>: If position is end(), amortized constant time
    //!   Linear time otherwise.
    template<class ...Args>
-   inline iterator emplace(const_iterator position, BOOST_FWD_REF(Args) ...args)
+   inline BOOST_CONTAINER_CONSTEXPR20 iterator emplace(const_iterator position, BOOST_FWD_REF(Args) ...args)
    {
       BOOST_ASSERT(this->priv_in_range_or_end(position));
       //Just call more general insert(pos, size, value) and return iterator
@@ -2021,7 +2301,7 @@ private:
 
    #define BOOST_CONTAINER_VECTOR_EMPLACE_CODE(N) \
    BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
-   inline reference emplace_back(BOOST_MOVE_UREF##N)\
+   inline BOOST_CONTAINER_CONSTEXPR20 reference emplace_back(BOOST_MOVE_UREF##N)\
    {\
       if (BOOST_LIKELY(this->room_enough())){\
          /*Derive the end pointer inside this branch so the optimizer can fold*/\
@@ -2041,7 +2321,7 @@ private:
    }\
    \
    BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
-   inline bool stable_emplace_back(BOOST_MOVE_UREF##N)\
+   inline BOOST_CONTAINER_CONSTEXPR20 bool stable_emplace_back(BOOST_MOVE_UREF##N)\
    {\
       const bool is_room_enough = this->room_enough() || (alloc_version::value == 2 && this->m_holder.try_expand_fwd(1u));\
       if (BOOST_LIKELY(is_room_enough)){\
@@ -2053,7 +2333,7 @@ private:
    }\
    \
    BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
-   inline reference unchecked_emplace_back(BOOST_MOVE_UREF##N)\
+   inline BOOST_CONTAINER_CONSTEXPR20 reference unchecked_emplace_back(BOOST_MOVE_UREF##N)\
    {\
       BOOST_ASSERT(this->size() < this->capacity());\
       T* const p = this->priv_raw_end();\
@@ -2064,7 +2344,7 @@ private:
    }\
    \
    BOOST_MOVE_TMPL_LT##N BOOST_MOVE_CLASS##N BOOST_MOVE_GT##N \
-   inline iterator emplace(const_iterator pos BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
+   inline BOOST_CONTAINER_CONSTEXPR20 iterator emplace(const_iterator pos BOOST_MOVE_I##N BOOST_MOVE_UREF##N)\
    {\
       BOOST_ASSERT(this->priv_in_range_or_end(pos));\
       typedef dtl::insert_emplace_proxy_arg##N<allocator_type BOOST_MOVE_I##N BOOST_MOVE_TARG##N> proxy_t;\
@@ -2083,7 +2363,7 @@ private:
    //!   T's copy/move constructor throws.
    //!
    //! <b>Complexity</b>: Amortized constant time.
-   void push_back(const T &x);
+   BOOST_CONTAINER_CONSTEXPR20 void push_back(const T &x);
 
    //! <b>Effects</b>: Constructs a new element in the end of the vector
    //!   and moves the resources of x to this new element.
@@ -2092,7 +2372,7 @@ private:
    //!   T's copy/move constructor throws.
    //!
    //! <b>Complexity</b>: Amortized constant time.
-   void push_back(T &&x);
+   BOOST_CONTAINER_CONSTEXPR20 void push_back(T &&x);
 
    //! <b>Requires</b>: Before the call to this function size() < capacity() must be true.
    //!   Otherwise, the behavior is undefined.
@@ -2102,7 +2382,7 @@ private:
    //! <b>Throws</b>: If T's copy/move constructor throws.
    //!
    //! <b>Complexity</b>: Constant time.
-   void unchecked_push_back(const T &x);
+   BOOST_CONTAINER_CONSTEXPR20 void unchecked_push_back(const T &x);
 
    //! <b>Requires</b>: Before the call to this function size() < capacity() must be true.
    //!   Otherwise, the behavior is undefined.
@@ -2113,7 +2393,20 @@ private:
    //! <b>Throws</b>: If T's copy/move constructor throws.
    //!
    //! <b>Complexity</b>: Constant time.
-   void unchecked_push_back(T &&x);
+   BOOST_CONTAINER_CONSTEXPR20 void unchecked_push_back(T &&x);
+   #elif defined(BOOST_CONTAINER_HAS_CXX20_CONSTEXPR)
+   //Same overloads as BOOST_MOVE_CONVERSION_AWARE_CATCH, usable in constant expressions
+   BOOST_CONTAINER_FORCEINLINE constexpr void push_back(const T &x)
+   {  this->priv_push_back(x);  }
+
+   BOOST_CONTAINER_FORCEINLINE constexpr void push_back(T &&x)
+   {  this->priv_push_back(::boost::move(x));  }
+
+   BOOST_CONTAINER_FORCEINLINE constexpr void unchecked_push_back(const T &x)
+   {  this->priv_unchecked_push_back(x);  }
+
+   BOOST_CONTAINER_FORCEINLINE constexpr void unchecked_push_back(T &&x)
+   {  this->priv_unchecked_push_back(::boost::move(x));  }
    #else
    BOOST_MOVE_CONVERSION_AWARE_CATCH(push_back, T, void, priv_push_back)
    BOOST_MOVE_CONVERSION_AWARE_CATCH(unchecked_push_back, T, void, priv_unchecked_push_back)
@@ -2128,7 +2421,7 @@ private:
    //!
    //! <b>Complexity</b>: If position is end(), amortized constant time
    //!   Linear time otherwise.
-   iterator insert(const_iterator position, const T &x);
+   BOOST_CONTAINER_CONSTEXPR20 iterator insert(const_iterator position, const T &x);
 
    //! <b>Requires</b>: position must be a valid iterator of *this.
    //!
@@ -2138,7 +2431,13 @@ private:
    //!
    //! <b>Complexity</b>: If position is end(), amortized constant time
    //!   Linear time otherwise.
-   iterator insert(const_iterator position, T &&x);
+   BOOST_CONTAINER_CONSTEXPR20 iterator insert(const_iterator position, T &&x);
+   #elif defined(BOOST_CONTAINER_HAS_CXX20_CONSTEXPR)
+   BOOST_CONTAINER_FORCEINLINE constexpr iterator insert(const_iterator position, const T &x)
+   {  return this->priv_insert(position, x);  }
+
+   BOOST_CONTAINER_FORCEINLINE constexpr iterator insert(const_iterator position, T &&x)
+   {  return this->priv_insert(position, ::boost::move(x));  }
    #else
    BOOST_MOVE_CONVERSION_AWARE_CATCH_1ARG(insert, T, iterator, priv_insert, const_iterator, const_iterator)
    #endif
@@ -2152,7 +2451,7 @@ private:
    //! <b>Throws</b>: If memory allocation throws or T's copy/move constructor throws.
    //!
    //! <b>Complexity</b>: Linear to n.
-   inline iterator insert(const_iterator p, size_type n, const T& x)
+   inline BOOST_CONTAINER_CONSTEXPR20 iterator insert(const_iterator p, size_type n, const T& x)
    {
       BOOST_ASSERT(this->priv_in_range_or_end(p));
       dtl::insert_n_copies_proxy<allocator_type> proxy(x);
@@ -2170,7 +2469,7 @@ private:
    //!
    //! <b>Complexity</b>: Linear to boost::container::iterator_distance [first, last).
    template <class InIt>
-   iterator insert(const_iterator pos, InIt first, InIt last
+   BOOST_CONTAINER_CONSTEXPR20 iterator insert(const_iterator pos, InIt first, InIt last
       #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
       , typename dtl::disable_if_or
          < void
@@ -2192,7 +2491,7 @@ private:
 
    #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
    template <class FwdIt>
-   inline iterator insert(const_iterator pos, FwdIt first, FwdIt last
+   inline BOOST_CONTAINER_CONSTEXPR20 iterator insert(const_iterator pos, FwdIt first, FwdIt last
       , typename dtl::disable_if_or
          < void
          , dtl::is_convertible<FwdIt, size_type>
@@ -2226,7 +2525,7 @@ private:
    //!   a non-standard extension.
    #if !defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
    template <class InIt>
-   inline iterator insert(const_iterator pos, size_type num, InIt first, InIt last)
+   inline BOOST_CONTAINER_CONSTEXPR20 iterator insert(const_iterator pos, size_type num, InIt first, InIt last)
    {
       BOOST_ASSERT(this->priv_in_range_or_end(pos));
       BOOST_ASSERT(dtl::is_input_iterator<InIt>::value ||
@@ -2245,7 +2544,7 @@ private:
    //! <b>Returns</b>: an iterator to the first inserted element or position if first == last.
    //!
    //! <b>Complexity</b>: Linear to the range [il.begin(), il.end()).
-   inline iterator insert(const_iterator position, std::initializer_list<value_type> il)
+   inline BOOST_CONTAINER_CONSTEXPR20 iterator insert(const_iterator position, std::initializer_list<value_type> il)
    {
       //Assertion done in insert()
       return this->insert(position, il.begin(), il.end());
@@ -2257,12 +2556,12 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant time.
-   inline void pop_back() BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 void pop_back() BOOST_NOEXCEPT_OR_NOTHROW
    {
       BOOST_ASSERT(!this->empty());
       //Destroy last element
       allocator_traits_type::destroy(this->get_stored_allocator(), this->priv_raw_end() - 1);
-      --this->m_holder.m_size;
+      this->m_holder.dec_stored_size(1u);
    }
 
    //! <b>Effects</b>: Erases the element at position pos.
@@ -2271,21 +2570,16 @@ private:
    //!
    //! <b>Complexity</b>: Linear to the elements between pos and the
    //!   last element. Constant if pos is the last element.
-   iterator erase(const_iterator position)
+   BOOST_CONTAINER_CONSTEXPR20 iterator erase(const_iterator position)
    {
       BOOST_ASSERT(this->priv_in_range(position));
       const pointer p = vector_iterator_get_ptr(position);
       T *const pos_ptr = boost::movelib::to_raw_pointer(p);
-      T *const end_ptr = this->priv_raw_end();
-
-      //Move elements forward and destroy last
-      (void)::boost::container::move(pos_ptr + 1, end_ptr, pos_ptr);
 
-      T *const last_ptr = end_ptr-1;
-      if(!value_traits::trivial_dctr_after_move || pos_ptr == last_ptr){
-         allocator_traits_type::destroy(this->get_stored_allocator(), last_ptr);
-      }
-      --this->m_holder.m_size;
+      //Move (or relocate) elements forward and destroy last
+      (void)::boost::container::shift_erase_forward_alloc
+         (this->get_stored_allocator(), pos_ptr, pos_ptr + 1, this->priv_raw_end());
+      this->m_holder.dec_stored_size(1u);
       return iterator(p);
    }
 
@@ -2295,7 +2589,7 @@ private:
    //!
    //! <b>Complexity</b>: Linear to the distance between first and last
    //!   plus linear to the elements between pos and the last element.
-   iterator erase(const_iterator first, const_iterator last)
+   BOOST_CONTAINER_CONSTEXPR20 iterator erase(const_iterator first, const_iterator last)
    {
       BOOST_ASSERT(this->priv_in_range_or_end(first));
       BOOST_ASSERT(this->priv_in_range_or_end(last));
@@ -2304,12 +2598,9 @@ private:
          T* const old_end_ptr = this->priv_raw_end();
          T* const first_ptr = boost::movelib::to_raw_pointer(vector_iterator_get_ptr(first));
          T* const last_ptr  = boost::movelib::to_raw_pointer(vector_iterator_get_ptr(last));
-         T* const new_last_ptr = boost::movelib::to_raw_pointer(boost::container::move(last_ptr, old_end_ptr, first_ptr));
-         const size_type n = static_cast<size_type>(old_end_ptr - new_last_ptr);
-         if(!value_traits::trivial_dctr_after_move || old_end_ptr == last_ptr){
-            boost::container::destroy_alloc_n(this->get_stored_allocator(), new_last_ptr, n);
-         }
-         this->m_holder.dec_stored_size(n);
+         T* const new_last_ptr = ::boost::container::shift_erase_forward_alloc
+            (this->get_stored_allocator(), first_ptr, last_ptr, old_end_ptr);
+         this->m_holder.dec_stored_size(static_cast<size_type>(old_end_ptr - new_last_ptr));
       }
       return iterator(vector_iterator_get_ptr(first));
    }
@@ -2319,7 +2610,7 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Constant.
-   inline void swap(vector& x)
+   inline BOOST_CONTAINER_CONSTEXPR20 void swap(vector& x)
       BOOST_NOEXCEPT_IF( ((allocator_traits_type::propagate_on_container_swap::value
                                     || allocator_traits_type::is_always_equal::value) &&
                                     !dtl::is_version<allocator_type, 0>::value))
@@ -2337,7 +2628,7 @@ private:
    //!
    //! <b>Note</b>: Non-standard extension to support static_vector
    template<class OtherA>
-   inline void swap(vector<T, OtherA, Options> & x
+   inline BOOST_CONTAINER_CONSTEXPR20 void swap(vector<T, OtherA, Options> & x
             , typename dtl::enable_if_and
                      < void
                      , dtl::is_version<typename real_allocator<T, OtherA>::type, 0>
@@ -2353,19 +2644,19 @@ private:
    //! <b>Throws</b>: Nothing.
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
-   inline void clear() BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 void clear() BOOST_NOEXCEPT_OR_NOTHROW
    {  this->priv_destroy_all();  }
 
    //! <b>Effects</b>: Returns true if x and y are equal
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
-   BOOST_CONTAINER_NODISCARD inline friend bool operator==(const vector& x, const vector& y)
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 friend bool operator==(const vector& x, const vector& y)
    {  return x.size() == y.size() && ::boost::container::algo_equal(x.begin(), x.end(), y.begin());  }
 
    //! <b>Effects</b>: Returns true if x and y are unequal
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
-   BOOST_CONTAINER_NODISCARD inline friend bool operator!=(const vector& x, const vector& y)
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 friend bool operator!=(const vector& x, const vector& y)
    {  return !(x == y); }
 
    //! <b>Effects</b>: Returns true if x is less than y
@@ -2377,25 +2668,25 @@ private:
    //! <b>Effects</b>: Returns true if x is greater than y
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
-   BOOST_CONTAINER_NODISCARD inline friend bool operator>(const vector& x, const vector& y)
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 friend bool operator>(const vector& x, const vector& y)
    {  return y < x;  }
 
    //! <b>Effects</b>: Returns true if x is equal or less than y
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
-   BOOST_CONTAINER_NODISCARD inline friend bool operator<=(const vector& x, const vector& y)
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 friend bool operator<=(const vector& x, const vector& y)
    {  return !(y < x);  }
 
    //! <b>Effects</b>: Returns true if x is equal or greater than y
    //!
    //! <b>Complexity</b>: Linear to the number of elements in the container.
-   BOOST_CONTAINER_NODISCARD inline friend bool operator>=(const vector& x, const vector& y)
+   BOOST_CONTAINER_NODISCARD inline BOOST_CONTAINER_CONSTEXPR20 friend bool operator>=(const vector& x, const vector& y)
    {  return !(x < y);  }
 
    //! <b>Effects</b>: x.swap(y)
    //!
    //! <b>Complexity</b>: Constant.
-   inline friend void swap(vector& x, vector& y)
+   inline BOOST_CONTAINER_CONSTEXPR20 friend void swap(vector& x, vector& y)
        BOOST_NOEXCEPT_IF(BOOST_NOEXCEPT(x.swap(y)))
    {  x.swap(y);  }
 
@@ -2409,7 +2700,7 @@ private:
    //! <b>Throws</b>: If memory allocation allocation throws or T's copy/move constructor throws.
    //!
    //! <b>Note</b>: Non-standard extension.
-   bool stable_reserve(size_type new_cap)
+   BOOST_CONTAINER_CONSTEXPR20 bool stable_reserve(size_type new_cap)
    {
       const size_type cp = this->capacity();
       return cp >= new_cap || (alloc_version::value == 2 && this->m_holder.try_expand_fwd(size_type(new_cap - cp)));
@@ -2418,18 +2709,18 @@ private:
    #ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
    //Absolutely experimental. This function might change, disappear or simply crash!
    template<class BiDirPosConstIt, class BiDirValueIt>
-   inline void insert_ordered_at(const size_type element_count, BiDirPosConstIt last_position_it, BiDirValueIt last_value_it)
+   inline BOOST_CONTAINER_CONSTEXPR20 void insert_ordered_at(const size_type element_count, BiDirPosConstIt last_position_it, BiDirValueIt last_value_it)
    {
       typedef vector_insert_ordered_cursor<BiDirPosConstIt, BiDirValueIt> inserter_t;
       return this->priv_insert_ordered_at(element_count, inserter_t(last_position_it, last_value_it));
    }
 
    template<class InputIt>
-   inline void merge(InputIt first, InputIt last)
+   inline BOOST_CONTAINER_CONSTEXPR20 void merge(InputIt first, InputIt last)
    {  this->merge(first, last, value_less_t());  }
 
    template<class InputIt, class Compare>
-   inline 
+   inline BOOST_CONTAINER_CONSTEXPR20 
       typename dtl::enable_if_c
          < !dtl::is_input_iterator<InputIt>::value &&
            dtl::is_same<value_type, typename iterator_traits<InputIt>::value_type>::value
@@ -2450,7 +2741,7 @@ private:
    }
 
    template<class InputIt, class Compare>
-   inline 
+   inline BOOST_CONTAINER_CONSTEXPR20 
       typename dtl::enable_if_c
          < dtl::is_input_iterator<InputIt>::value ||
            !dtl::is_same<value_type, typename iterator_traits<InputIt>::value_type>::value
@@ -2461,11 +2752,11 @@ private:
    }
 
    template<class InputIt>
-   inline void merge_unique(InputIt first, InputIt last)
+   inline BOOST_CONTAINER_CONSTEXPR20 void merge_unique(InputIt first, InputIt last)
    {  this->merge_unique(first, last, value_less_t());  }
 
    template<class InputIt, class Compare>
-   inline 
+   inline BOOST_CONTAINER_CONSTEXPR20 
       typename dtl::enable_if_c
          < !dtl::is_input_iterator<InputIt>::value &&
            dtl::is_same<value_type, typename iterator_traits<InputIt>::value_type>::value
@@ -2481,7 +2772,7 @@ private:
    }
 
    template<class InputIt, class Compare>
-   inline 
+   inline BOOST_CONTAINER_CONSTEXPR20 
       typename dtl::enable_if_c
          < dtl::is_input_iterator<InputIt>::value ||
            !dtl::is_same<value_type, typename iterator_traits<InputIt>::value_type>::value
@@ -2506,7 +2797,7 @@ private:
 
    private:
    template<class InputIt, class Compare>
-   inline void priv_merge_generic(InputIt first, InputIt last, Compare comp)
+   inline BOOST_CONTAINER_CONSTEXPR20 void priv_merge_generic(InputIt first, InputIt last, Compare comp)
    {
       size_type const old_s = this->size();
       this->insert(this->cend(), first, last);
@@ -2517,7 +2808,7 @@ private:
    }
 
    template<class PositionValue>
-   void priv_insert_ordered_at(const size_type element_count, PositionValue position_value)
+   BOOST_CONTAINER_CONSTEXPR20 void priv_insert_ordered_at(const size_type element_count, PositionValue position_value)
    {
       const size_type old_size_pos = this->size();
       this->reserve(old_size_pos + element_count);
@@ -2574,7 +2865,7 @@ private:
    }
 
    template<class InputIt, class Compare>
-   void priv_set_difference_back(InputIt first1, InputIt last1, Compare comp)
+   BOOST_CONTAINER_CONSTEXPR20 void priv_set_difference_back(InputIt first1, InputIt last1, Compare comp)
    {
       T * old_first2 = this->priv_raw_begin();
       T * first2 = old_first2;
@@ -2608,13 +2899,13 @@ private:
    }
 
    template<class FwdIt, class Compare>
-   inline void priv_merge_in_new_buffer(FwdIt, size_type, Compare, version_0)
+   inline BOOST_CONTAINER_CONSTEXPR20 void priv_merge_in_new_buffer(FwdIt, size_type, Compare, version_0)
    {
       alloc_holder_t::on_capacity_overflow();
    }
 
    template<class FwdIt, class Compare, class Version>
-   void priv_merge_in_new_buffer(FwdIt first, size_type n, Compare comp, Version)
+   BOOST_CONTAINER_CONSTEXPR20 void priv_merge_in_new_buffer(FwdIt first, size_type n, Compare comp, Version)
    {
       size_type const new_size = this->size() + n;
       size_type new_cap = new_size;
@@ -2670,13 +2961,13 @@ private:
       new_values_destroyer.release();
    }
 
-   BOOST_CONTAINER_FORCEINLINE bool room_enough() const
+   BOOST_CONTAINER_FORCEINLINE BOOST_CONTAINER_CONSTEXPR20 bool room_enough() const
    {  return this->m_holder.m_size != this->m_holder.capacity();   }
 
-   inline pointer back_ptr() const
+   inline BOOST_CONTAINER_CONSTEXPR20 pointer back_ptr() const
    {  return this->m_holder.start() + difference_type(this->m_holder.m_size);  }
 
-   inline size_type priv_index_of(pointer p) const
+   inline BOOST_CONTAINER_CONSTEXPR20 size_type priv_index_of(pointer p) const
    {
       BOOST_ASSERT(this->m_holder.start() <= p);
       BOOST_ASSERT(p <= (this->m_holder.start()+difference_type(this->size())));
@@ -2684,7 +2975,7 @@ private:
    }
 
    template<class OtherA>
-   void priv_move_assign(BOOST_RV_REF_BEG vector<T, OtherA, Options> BOOST_RV_REF_END x
+   BOOST_CONTAINER_CONSTEXPR20 void priv_move_assign(BOOST_RV_REF_BEG vector<T, OtherA, Options> BOOST_RV_REF_END x
       , typename dtl::enable_if_c
          < dtl::is_version<typename real_allocator<T, OtherA>::type, 0>::value >::type * = 0)
    {
@@ -2704,7 +2995,7 @@ private:
    }
 
    template<class OtherA>
-   void priv_move_assign_steal_or_assign(BOOST_RV_REF_BEG vector<T, OtherA, Options> BOOST_RV_REF_END x, dtl::true_type /*data_can_be_always_stolen*/)
+   BOOST_CONTAINER_CONSTEXPR20 void priv_move_assign_steal_or_assign(BOOST_RV_REF_BEG vector<T, OtherA, Options> BOOST_RV_REF_END x, dtl::true_type /*data_can_be_always_stolen*/)
    {
       this->clear();
       if (BOOST_LIKELY(!!this->m_holder.m_start))
@@ -2713,7 +3004,7 @@ private:
    }
 
    template<class OtherA>
-   void priv_move_assign_steal_or_assign(BOOST_RV_REF_BEG vector<T, OtherA, Options> BOOST_RV_REF_END x, dtl::false_type /*data_can_be_always_stolen*/)
+   BOOST_CONTAINER_CONSTEXPR20 void priv_move_assign_steal_or_assign(BOOST_RV_REF_BEG vector<T, OtherA, Options> BOOST_RV_REF_END x, dtl::false_type /*data_can_be_always_stolen*/)
    {
       const bool propagate_alloc = allocator_traits_type::propagate_on_container_move_assignment::value;
       allocator_type& this_alloc = this->m_holder.alloc();
@@ -2736,7 +3027,7 @@ private:
    }
 
    template<class OtherA>
-   void priv_move_assign(BOOST_RV_REF_BEG vector<T, OtherA, Options> BOOST_RV_REF_END x
+   BOOST_CONTAINER_CONSTEXPR20 void priv_move_assign(BOOST_RV_REF_BEG vector<T, OtherA, Options> BOOST_RV_REF_END x
       , typename dtl::disable_if_or
          < void
          , dtl::is_version<typename real_allocator<T, OtherA>::type, 0>
@@ -2760,7 +3051,7 @@ private:
    }
 
    template<class OtherA>
-   void priv_copy_assign(const vector<T, OtherA, Options> &x
+   BOOST_CONTAINER_CONSTEXPR20 void priv_copy_assign(const vector<T, OtherA, Options> &x
       , typename dtl::enable_if_c
          < dtl::is_version<typename real_allocator<T, OtherA>::type, 0>::value >::type * = 0)
    {
@@ -2777,7 +3068,7 @@ private:
    }
 
    template<class OtherA>
-   typename dtl::disable_if_or
+   BOOST_CONTAINER_CONSTEXPR20 typename dtl::disable_if_or
       < void
       , dtl::is_version<typename real_allocator<T, OtherA>::type, 0>
       , dtl::is_different<typename real_allocator<T, OtherA>::type, allocator_type>
@@ -2797,11 +3088,11 @@ private:
    }
 
    template<class Vector>  //Template it to avoid it in explicit instantiations
-   inline void priv_swap(Vector &x, dtl::true_type)   //version_0
+   inline BOOST_CONTAINER_CONSTEXPR20 void priv_swap(Vector &x, dtl::true_type)   //version_0
    {  this->m_holder.deep_swap(x.m_holder);  }
 
    template<class Vector>  //Template it to avoid it in explicit instantiations
-   void priv_swap(Vector &x, dtl::false_type)  //version_N
+   BOOST_CONTAINER_CONSTEXPR20 void priv_swap(Vector &x, dtl::false_type)  //version_N
    {
       BOOST_ASSERT(allocator_traits_type::propagate_on_container_swap::value ||
                    allocator_traits_type::is_always_equal::value ||
@@ -2820,7 +3111,7 @@ private:
 
    protected:
    template<class Vector>  //Template it to avoid it in explicit instantiations
-   void prot_swap_small(Vector &x, std::size_t internal_capacity)  //version_N
+   BOOST_CONTAINER_CONSTEXPR20 void prot_swap_small(Vector &x, std::size_t internal_capacity)  //version_N
    {
       if (BOOST_UNLIKELY(&x == this)){
          return;
@@ -2912,20 +3203,27 @@ private:
       }
    }
    private:
-   inline void priv_move_to_new_buffer(size_type, version_0)
+   inline BOOST_CONTAINER_CONSTEXPR20 void priv_move_to_new_buffer(size_type, version_0)
+   {  alloc_holder_t::on_capacity_overflow();  }
+
+   void priv_reserve_additional(size_type, version_0)
    {  alloc_holder_t::on_capacity_overflow();  }
 
-   inline dtl::insert_range_proxy<allocator_type, boost::move_iterator<T*> > priv_dummy_empty_proxy()
+   template<class AllocVersion>
+   void priv_reserve_additional(size_type n, AllocVersion)
+   {  this->reserve(this->m_holder.template next_capacity<growth_factor_type>(n));  }
+
+   inline BOOST_CONTAINER_CONSTEXPR20 dtl::insert_range_proxy<allocator_type, boost::move_iterator<T*> > priv_dummy_empty_proxy()
    {
       return dtl::insert_range_proxy<allocator_type, boost::move_iterator<T*> >
          (::boost::make_move_iterator((T *)0));
    }
 
-   inline void priv_move_to_new_buffer(size_type new_cap, version_1)
+   inline BOOST_CONTAINER_CONSTEXPR20 void priv_move_to_new_buffer(size_type new_cap, version_1)
    {
       //There is not enough memory, allocate a new buffer
       //Pass the hint so that allocators can take advantage of this.
-      pointer const p = this->m_holder.allocate(new_cap);
+      pointer const p = this->m_holder.allocate_at_least(new_cap);
       #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
       ++this->num_alloc;
       #endif
@@ -2934,16 +3232,18 @@ private:
          ( boost::movelib::to_raw_pointer(p), new_cap, this->priv_raw_end(), 0, this->priv_dummy_empty_proxy());
    }
 
-   void priv_move_to_new_buffer(size_type new_cap, version_2)
+   BOOST_CONTAINER_CONSTEXPR20 void priv_move_to_new_buffer(size_type new_cap, version_2)
    {
       //There is not enough memory, allocate a new
       //buffer or expand the old one.
       bool same_buffer_start;
       size_type real_cap = 0;
       pointer reuse(this->m_holder.start());
-      pointer const ret(this->m_holder.allocation_command(allocate_new | expand_fwd | expand_bwd, new_cap, real_cap = new_cap, reuse));
+      pointer const ret(this->m_holder.allocation_command
+         (allocate_new | expand_fwd | expand_bwd | priv_relocation_command(), new_cap, real_cap = new_cap, reuse));
 
-      //Check for forward expansion
+      //Check for forward expansion (maybe relocated by the allocator)
+      this->priv_update_start_if_relocated(ret, reuse);
       same_buffer_start = reuse && this->m_holder.start() == ret;
       if(same_buffer_start){
          #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
@@ -2971,7 +3271,21 @@ private:
       }
    }
 
-   void priv_destroy_last_n(const size_type n) BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 static allocation_type priv_relocation_command()
+   {  return value_traits::relocate_expand ? allow_relocation : allocation_type(0);  }
+
+   //An allocator that moves the buffer with its contents (allow_relocation)
+   //returns the new address both as result and in "reuse"
+   inline BOOST_CONTAINER_CONSTEXPR20 bool priv_update_start_if_relocated(const pointer &ret, const pointer &reuse)
+   {
+      const bool relocated = value_traits::relocate_expand && reuse && reuse == ret && this->m_holder.start() != ret;
+      if(relocated){
+         this->m_holder.start(ret);
+      }
+      return relocated;
+   }
+
+   BOOST_CONTAINER_CONSTEXPR20 void priv_destroy_last_n(const size_type n) BOOST_NOEXCEPT_OR_NOTHROW
    {
       BOOST_ASSERT(n <= this->m_holder.m_size);
       boost::container::destroy_alloc_n(this->get_stored_allocator(), this->priv_raw_end() - n, n);
@@ -2979,63 +3293,64 @@ private:
    }
 
    template<class InpIt>
-   void priv_uninitialized_construct_at_end(InpIt first, InpIt last)
+   BOOST_CONTAINER_CONSTEXPR20 void priv_uninitialized_construct_at_end(InpIt first, InpIt last)
    {
       T* const old_end_pos = this->priv_raw_end();
       T* const new_end_pos = boost::container::uninitialized_copy_alloc(this->m_holder.alloc(), first, last, old_end_pos);
       this->m_holder.inc_stored_size(static_cast<size_type>(new_end_pos - old_end_pos));
    }
 
-   void priv_destroy_all() BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_CONSTEXPR20 void priv_destroy_all() BOOST_NOEXCEPT_OR_NOTHROW
    {
       boost::container::destroy_alloc_n
          (this->get_stored_allocator(), this->priv_raw_begin(), this->m_holder.m_size);
-      this->m_holder.m_size = 0;
+      this->m_holder.set_stored_size(0u);
    }
 
    template<class U>
-   BOOST_CONTAINER_FORCEINLINE iterator priv_insert(const const_iterator &p, BOOST_FWD_REF(U) u)
+   BOOST_CONTAINER_FORCEINLINE BOOST_CONTAINER_CONSTEXPR20 iterator priv_insert(const const_iterator &p, BOOST_FWD_REF(U) u)
    {
       return this->emplace(p, ::boost::forward<U>(u));
    }
 
    template <class U>
-   BOOST_CONTAINER_FORCEINLINE void priv_push_back(BOOST_FWD_REF(U) u)
+   BOOST_CONTAINER_FORCEINLINE BOOST_CONTAINER_CONSTEXPR20 void priv_push_back(BOOST_FWD_REF(U) u)
    {
       this->emplace_back(::boost::forward<U>(u));
    }
 
    template <class U>
-   BOOST_CONTAINER_FORCEINLINE void priv_unchecked_push_back(BOOST_FWD_REF(U) u)
+   BOOST_CONTAINER_FORCEINLINE BOOST_CONTAINER_CONSTEXPR20 void priv_unchecked_push_back(BOOST_FWD_REF(U) u)
    {
       this->unchecked_emplace_back(::boost::forward<U>(u));
    }
 
    //Overload to support compiler errors that instantiate too much
-   inline void priv_push_back(::boost::move_detail::nat)
+   inline BOOST_CONTAINER_CONSTEXPR20 void priv_push_back(::boost::move_detail::nat)
    {}
 
    //Overload to support compiler errors that instantiate too much
-   inline void priv_unchecked_push_back(::boost::move_detail::nat)
+   inline BOOST_CONTAINER_CONSTEXPR20 void priv_unchecked_push_back(::boost::move_detail::nat)
    {}
 
-   inline iterator priv_insert(const_iterator, ::boost::move_detail::nat)
+   inline BOOST_CONTAINER_CONSTEXPR20 iterator priv_insert(const_iterator, ::boost::move_detail::nat)
    {  return iterator();  }
 
-   inline dtl::insert_n_copies_proxy<allocator_type> priv_resize_proxy(const T &x)
+   inline BOOST_CONTAINER_CONSTEXPR20 dtl::insert_n_copies_proxy<allocator_type> priv_resize_proxy(const T &x)
    {  return dtl::insert_n_copies_proxy<allocator_type>(x);   }
 
-   inline dtl::insert_default_initialized_n_proxy<allocator_type> priv_resize_proxy(default_init_t)
+   inline BOOST_CONTAINER_CONSTEXPR20 dtl::insert_default_initialized_n_proxy<allocator_type> priv_resize_proxy(default_init_t)
    {  return dtl::insert_default_initialized_n_proxy<allocator_type>();  }
 
-   inline dtl::insert_value_initialized_n_proxy<allocator_type> priv_resize_proxy(value_init_t)
+   inline BOOST_CONTAINER_CONSTEXPR20 dtl::insert_value_initialized_n_proxy<allocator_type> priv_resize_proxy(value_init_t)
    {  return dtl::insert_value_initialized_n_proxy<allocator_type>(); }
 
    protected:
-   void prot_shrink_to_fit_small(pointer const small_buffer, const size_type small_capacity)
+   BOOST_CONTAINER_CONSTEXPR20 void prot_shrink_to_fit_small(pointer const small_buffer, const size_type small_capacity)
    {
       const size_type cp = this->m_holder.capacity();
       if (cp && this->m_holder.m_start != small_buffer) {   //Do something only if a dynamic buffer is used
+         dtl::growth_factor_on_shrink_to_fit<growth_factor_type>(cp, this->m_holder.m_size);
          const size_type sz = this->size();
          if (!sz) {
             if (BOOST_LIKELY(!!this->m_holder.m_start))
@@ -3045,13 +3360,12 @@ private:
          }
          else if(sz <= small_capacity) {
             T *const oldbuf = boost::movelib::to_raw_pointer(this->m_holder.m_start);
-            ::boost::container::uninitialized_move_alloc_n
+            ::boost::container::uninitialized_relocate_alloc_n
                ( this->get_stored_allocator()
                , oldbuf
                , sz
                , boost::movelib::to_raw_pointer(small_buffer)
                );
-            boost::container::destroy_alloc_n(this->get_stored_allocator(), oldbuf, sz);
 
             if (BOOST_LIKELY(!!this->m_holder.m_start))
                this->m_holder.deallocate(this->m_holder.m_start, cp);
@@ -3066,10 +3380,10 @@ private:
    }
 
    private:
-   inline void priv_shrink_to_fit(version_0) BOOST_NOEXCEPT_OR_NOTHROW
+   inline BOOST_CONTAINER_CONSTEXPR20 void priv_shrink_to_fit(version_0) BOOST_NOEXCEPT_OR_NOTHROW
    {}
 
-   void priv_shrink_to_fit(version_1)
+   BOOST_CONTAINER_CONSTEXPR20 void priv_shrink_to_fit(version_1)
    {
       const size_type cp = this->m_holder.capacity();
       if(cp){
@@ -3086,7 +3400,7 @@ private:
       }
    }
 
-   void priv_shrink_to_fit(version_2) BOOST_NOEXCEPT_OR_NOTHROW
+   BOOST_CONTAINER_CONSTEXPR20 void priv_shrink_to_fit(version_2) BOOST_NOEXCEPT_OR_NOTHROW
    {
       const size_type cp = this->m_holder.capacity();
       if(cp){
@@ -3116,7 +3430,7 @@ private:
    #pragma warning(disable: 4702)   //Disable unreachable code warning
    #endif
    template <class InsertionProxy>
-   inline iterator priv_insert_forward_range_no_capacity
+   inline BOOST_CONTAINER_CONSTEXPR20 iterator priv_insert_forward_range_no_capacity
       (T * const, const size_type, const InsertionProxy , version_0)
    {
       return alloc_holder_t::on_capacity_overflow(), iterator();
@@ -3130,9 +3444,9 @@ private:
    iterator priv_insert_forward_range_no_capacity
       (T *const raw_pos, const size_type n, const InsertionProxy insert_range_proxy, version_1)
    {
-      const size_type new_cap = this->m_holder.template next_capacity<growth_factor_type>(n);
+      size_type new_cap = this->m_holder.template next_capacity<growth_factor_type>(n);
       //Pass the hint so that allocators can take advantage of this.
-      T * const new_buf = boost::movelib::to_raw_pointer(this->m_holder.allocate(new_cap));
+      T * const new_buf = boost::movelib::to_raw_pointer(this->m_holder.allocate_at_least(new_cap));
       #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
       ++this->num_alloc;
       #endif
@@ -3153,20 +3467,25 @@ private:
       //buffer or expand the old one.
       size_type real_cap = this->m_holder.template next_capacity<growth_factor_type>(n);
       pointer reuse(this->m_holder.start());
+      //Don't move the buffer if the inserted values might be read from it
+      T *const raw_beg = this->priv_raw_begin();
+      const allocation_type relocation =
+         dtl::insert_proxy_alias<allocator_type, InsertionProxy>::check(insert_range_proxy, raw_beg, raw_beg + this->m_holder.capacity())
+            ? allocation_type(0) : priv_relocation_command();
       pointer const ret (this->m_holder.allocation_command
-         (allocate_new | expand_fwd | expand_bwd, size_type(this->m_holder.m_size + n), real_cap, reuse));
+         (allocate_new | expand_fwd | expand_bwd | relocation, size_type(this->m_holder.m_size + n), real_cap, reuse));
 
       //Buffer reallocated
       if(reuse){
-         //Forward expansion, delay insertion
-         if(this->m_holder.start() == ret){
+         //Forward expansion (maybe relocated by the allocator), delay insertion
+         if(this->priv_update_start_if_relocated(ret, reuse) || this->m_holder.start() == ret){
             #ifdef BOOST_CONTAINER_VECTOR_ALLOC_STATS
             ++this->num_expand_fwd;
             #endif
             this->m_holder.capacity(real_cap);
             //Expand forward
             this->priv_insert_forward_range_expand_forward
-               (raw_pos, n, insert_range_proxy, dtl::bool_<dtl::is_single_value_proxy<InsertionProxy>::value>());
+               (this->priv_raw_begin() + n_pos, n, insert_range_proxy, dtl::bool_<dtl::is_single_value_proxy<InsertionProxy>::value && !value_traits::relocate_shift>());
          }
          //Backwards (and possibly forward) expansion
          else{
@@ -3190,7 +3509,7 @@ private:
    }
 
    template <class InsertionProxy>
-   inline iterator priv_insert_forward_range
+   inline BOOST_CONTAINER_CONSTEXPR20 iterator priv_insert_forward_range
       (const pointer &pos, const size_type n, const InsertionProxy insert_range_proxy)
    {
       BOOST_ASSERT(this->m_holder.capacity() >= this->m_holder.m_size);
@@ -3199,7 +3518,7 @@ private:
       if (BOOST_LIKELY(n <= (this->m_holder.capacity() - this->m_holder.m_size))){
          //Expand forward
          this->priv_insert_forward_range_expand_forward
-            (p, n, insert_range_proxy, dtl::bool_<dtl::is_single_value_proxy<InsertionProxy>::value>());
+            (p, n, insert_range_proxy, dtl::bool_<dtl::is_single_value_proxy<InsertionProxy>::value && !value_traits::relocate_shift>());
          return iterator(pos);
       }
       else{
@@ -3208,7 +3527,7 @@ private:
    }
 
    template <class U>
-   void priv_resize(const size_type new_size, const U &u, version_0)
+   BOOST_CONTAINER_CONSTEXPR20 void priv_resize(const size_type new_size, const U &u, version_0)
    {
       const size_type sz = this->m_holder.m_size;
       if (new_size > this->capacity()){
@@ -3226,8 +3545,54 @@ private:
       }
    }
 
+   inline BOOST_CONTAINER_CONSTEXPR20 void priv_parallel_construct_at_end(const size_type n, value_init_t)
+   {
+      boost::container::parallel_uninitialized_value_init_alloc_n
+         (this->m_holder.alloc(), n, this->priv_raw_end());
+   }
+
+   inline BOOST_CONTAINER_CONSTEXPR20 void priv_parallel_construct_at_end(const size_type n, const T &x)
+   {
+      boost::container::parallel_uninitialized_fill_alloc_n
+         (this->m_holder.alloc(), x, n, this->priv_raw_end());
+   }
+
+   inline BOOST_CONTAINER_CONSTEXPR20 size_type priv_index_of_alias(value_init_t) const
+   {  return size_type(-1);  }
+
+   inline BOOST_CONTAINER_CONSTEXPR20 size_type priv_index_of_alias(const T &x) const
+   {
+      const T *const p = boost::container::dtl::addressof(x);
+      return (this->priv_raw_begin() <= p && p < this->priv_raw_end())
+         ? size_type(p - this->priv_raw_begin()) : size_type(-1);
+   }
+
+   template <class U>
+   BOOST_CONTAINER_CONSTEXPR20 void priv_resize_parallel(const size_type new_size, const U &u)
+   {
+      const size_type sz = this->m_holder.m_size;
+      if (new_size < sz){
+         //Destroy last elements
+         this->priv_destroy_last_n(size_type(sz - new_size));
+      }
+      else if (new_size > sz){
+         if (new_size > this->capacity()){
+            //u might be an element of the vector, relocated by reserve
+            const size_type n_pos = this->priv_index_of_alias(u);
+            this->reserve(new_size);
+            if(n_pos != size_type(-1)){
+               this->priv_parallel_construct_at_end(size_type(new_size - sz), this->priv_raw_begin()[n_pos]);
+               this->m_holder.set_stored_size(new_size);
+               return;
+            }
+         }
+         this->priv_parallel_construct_at_end(size_type(new_size - sz), u);
+         this->m_holder.set_stored_size(new_size);
+      }
+   }
+
    template <class U, class AllocVersion>
-   void priv_resize(const size_type new_size, const U &u, AllocVersion)
+   BOOST_CONTAINER_CONSTEXPR20 void priv_resize(const size_type new_size, const U &u, AllocVersion)
    {
       const size_type sz = this->m_holder.m_size;
       if (new_size < sz){
@@ -3328,14 +3693,14 @@ private:
    }
 
    private:
-   BOOST_CONTAINER_FORCEINLINE T *priv_raw_begin() const
+   BOOST_CONTAINER_FORCEINLINE BOOST_CONTAINER_CONSTEXPR20 T *priv_raw_begin() const
    {  return boost::movelib::to_raw_pointer(m_holder.start());  }
 
-   BOOST_CONTAINER_FORCEINLINE T* priv_raw_end() const
+   BOOST_CONTAINER_FORCEINLINE BOOST_CONTAINER_CONSTEXPR20 T* priv_raw_end() const
    {  return this->priv_raw_begin() + this->m_holder.m_size;  }
 
    template <class InsertionProxy>  //inline single-element version as it is significantly smaller
-   inline void priv_insert_forward_range_expand_forward
+   inline BOOST_CONTAINER_CONSTEXPR20 void priv_insert_forward_range_expand_forward
       (T* const raw_pos, const size_type, InsertionProxy insert_range_proxy, dtl::true_type)
    {
       BOOST_ASSERT(this->room_enough());
@@ -3366,7 +3731,7 @@ private:
    }
 
    template <class InsertionProxy>
-   inline void priv_insert_forward_range_expand_forward
+   inline BOOST_CONTAINER_CONSTEXPR20 void priv_insert_forward_range_expand_forward
       (T* const raw_pos, const size_type n, InsertionProxy insert_range_proxy, dtl::false_type)
    {
       //There is enough memory
@@ -3384,14 +3749,16 @@ private:
       T * const raw_old_buffer = this->priv_raw_begin();
 
       typename value_traits::ArrayDeallocator new_buffer_deallocator(new_start, a, new_cap);
-      boost::container::uninitialized_move_and_insert_alloc
+      //Old elements are relocated (destroyed) by the call
+      boost::container::uninitialized_relocate_and_insert_alloc
          (a, raw_old_buffer, pos, this->priv_raw_end(), new_start, n, insert_range_proxy);
       new_buffer_deallocator.release();
 
-      //Destroy and deallocate old elements
+      //Deallocate old buffer
       if(raw_old_buffer){
-         BOOST_IF_CONSTEXPR(!has_trivial_destructor_after_move<value_type>::value)
-            boost::container::destroy_alloc_n(a, raw_old_buffer, this->m_holder.m_size);
+         //shrink_to_fit also reallocates, but that is not a relocation due to growth
+         if(new_cap > this->m_holder.capacity())
+            allocator_traits_type::on_relocation(a, this->m_holder.m_size);
          this->m_holder.deallocate(this->m_holder.start(), this->m_holder.capacity());
       }
 
@@ -3412,7 +3779,7 @@ private:
       //Update the vector buffer information to a safe state
       this->m_holder.start(new_start);
       this->m_holder.capacity(new_capacity);
-      this->m_holder.m_size = 0;
+      this->m_holder.set_stored_size(0u);
 
       expand_backward_forward_and_insert_alloc(old_start, old_size, new_start, pos, n, insert_range_proxy, a);
 
@@ -3420,7 +3787,7 @@ private:
       this->m_holder.m_size = stored_size_type(old_size + n);
    }
 
-   void priv_throw_if_out_of_range(size_type n) const
+   BOOST_CONTAINER_CONSTEXPR20 void priv_throw_if_out_of_range(size_type n) const
    {
       //If n is out of range, throw an out_of_range exception
       if (n >= this->size()){
@@ -3428,12 +3795,12 @@ private:
       }
    }
 
-   inline bool priv_in_range(const_iterator pos) const
+   inline BOOST_CONTAINER_CONSTEXPR20 bool priv_in_range(const_iterator pos) const
    {
       return (this->begin() <= pos) && (pos < this->end());
    }
 
-   inline bool priv_in_range_or_end(const_iterator pos) const
+   inline BOOST_CONTAINER_CONSTEXPR20 bool priv_in_range_or_end(const_iterator pos) const
    {
       return (this->begin() <= pos) && (pos <= this->end());
    }
@@ -3444,7 +3811,7 @@ private:
    unsigned int num_expand_bwd;
    unsigned int num_shrink;
    unsigned int num_alloc;
-   void reset_alloc_stats()
+   BOOST_CONTAINER_CONSTEXPR20 void reset_alloc_stats()
    {  num_expand_fwd = num_expand_bwd = num_alloc = 0, num_shrink = 0;   }
    #endif
    #endif   //#ifndef BOOST_CONTAINER_DOXYGEN_INVOKED
@@ -3501,6 +3868,19 @@ struct has_trivial_destructor_after_move<boost::container::vector<T, Allocator,
                                                 ::boost::has_trivial_destructor_after_move<pointer>::value;
 };
 
+namespace container {
+
+//!is_trivially_relocatable<> == true_type
+//!specialization for optimizations
+template <class T, class Allocator, class Options>
+struct is_trivially_relocatable<boost::container::vector<T, Allocator, Options> >
+   : dtl::is_trivially_relocatable_holder
+      < typename boost::container::vector<T, Allocator, Options>::allocator_type
+      , typename boost::container::vector<T, Allocator, Options>::pointer>
+{};
+
+}  //namespace container {
+
 }
 
 //See comments on vec_iterator::element_type to know why is this needed
@@ -11,6 +11,8 @@
 #define BOOST_CONTAINER_SOURCE
 #include <boost/container/pmr/memory_resource.hpp>
 #include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/synchronized_pool_resource.hpp>
+#include <boost/container/pmr/unsynchronized_pool_resource.hpp>
 #include <boost/container/throw_exception.hpp>
 #include <boost/container/detail/dlmalloc.hpp>  //For global lock
 #include <boost/container/detail/singleton.hpp>
@@ -143,6 +145,20 @@ BOOST_CONTAINER_DECL memory_resource* get_default_resource() BOOST_NOEXCEPT
 
 #endif
 
+BOOST_CONTAINER_DECL std::size_t allocation_size
+   (const memory_resource &r, std::size_t bytes, std::size_t alignment) BOOST_NOEXCEPT
+{
+   #if !defined(BOOST_NO_RTTI)
+   if(const unsynchronized_pool_resource *const upr = dynamic_cast<const unsynchronized_pool_resource*>(&r))
+      return upr->allocation_size(bytes, alignment);
+   if(const synchronized_pool_resource *const spr = dynamic_cast<const synchronized_pool_resource*>(&r))
+      return spr->allocation_size(bytes, alignment);
+   #else
+   (void)r; (void)alignment;
+   #endif
+   return bytes;
+}
+
 }  //namespace pmr {
 }  //namespace container {
 }  //namespace boost {
@@ -237,6 +237,17 @@ void pool_resource::do_deallocate(void* p, std::size_t bytes, std::size_t alignm
    }
 }
 
+std::size_t pool_resource::do_allocation_size(std::size_t bytes, std::size_t alignment) const BOOST_NOEXCEPT
+{
+   (void)alignment;  //alignment ignored here, max_align is used by pools
+   if(bytes > m_options.largest_required_pool_block){
+      return bytes;
+   }
+   else{
+      return priv_pool_block(priv_pool_index(bytes));
+   }
+}
+
 std::size_t pool_resource::pool_count() const
 {
    if(BOOST_LIKELY((0 != m_pool_data))){
@@ -57,6 +57,9 @@ void unsynchronized_pool_resource::do_deallocate(void* p, std::size_t bytes, std
 bool unsynchronized_pool_resource::do_is_equal(const memory_resource& other) const BOOST_NOEXCEPT //virtual
 {  return this == &other;  }
 
+std::size_t unsynchronized_pool_resource::allocation_size(std::size_t bytes, std::size_t alignment) const BOOST_NOEXCEPT
+{  return m_resource.do_allocation_size(bytes, alignment);  }
+
 std::size_t unsynchronized_pool_resource::pool_count() const
 {  return m_resource.pool_count();  }
 
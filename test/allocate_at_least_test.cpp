@@ -0,0 +1,208 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#define BOOST_CONTAINER_PMR_ALLOCATE_AT_LEAST
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/new_allocator.hpp>
+#include <boost/container/allocator.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/container/devector.hpp>
+#include <boost/container/small_vector.hpp>
+#include <boost/container/string.hpp>
+#include <boost/container/pmr/polymorphic_allocator.hpp>
+#include <boost/container/pmr/unsynchronized_pool_resource.hpp>
+#include <boost/container/pmr/synchronized_pool_resource.hpp>
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <memory>
+
+using namespace boost::container;
+
+//An allocator without allocate_at_least
+template<class T>
+class plain_allocator
+   : public std::allocator<T>
+{
+   public:
+   typedef T value_type;
+
+   template<class U>
+   struct rebind {  typedef plain_allocator<U> other;  };
+
+   plain_allocator() {}
+
+   template<class U>
+   plain_allocator(const plain_allocator<U> &) {}
+};
+
+//An allocator that always returns three extra elements and checks
+//that the container deallocates the storage with the returned count
+template<class T>
+class extra_allocator
+{
+   public:
+   typedef T value_type;
+
+   static std::size_t outstanding;
+
+   extra_allocator() {}
+
+   template<class U>
+   extra_allocator(const extra_allocator<U> &) {}
+
+   T* allocate(std::size_t n)
+   {  return new_allocator<T>().allocate(n);  }
+
+   allocation_result<T*> allocate_at_least(std::size_t n)
+   {
+      allocation_result<T*> r = { new_allocator<T>().allocate(n + 3u), n + 3u };
+      outstanding += r.count;
+      return r;
+   }
+
+   void deallocate(T* p, std::size_t n)
+   {
+      outstanding -= n;
+      new_allocator<T>().deallocate(p, n);
+   }
+
+   friend bool operator==(const extra_allocator &, const extra_allocator &)
+   {  return true;  }
+
+   friend bool operator!=(const extra_allocator &, const extra_allocator &)
+   {  return false;  }
+};
+
+template<class T>
+std::size_t extra_allocator<T>::outstanding = 0u;
+
+void test_allocator_traits()
+{
+   {  //Fallback to allocate
+      plain_allocator<int> a;
+      allocation_result<int*> r = allocator_traits< plain_allocator<int> >::allocate_at_least(a, 5u);
+      BOOST_TEST_EQ(r.count, 5u);
+      a.deallocate(r.ptr, r.count);
+   }
+   {  //new_allocator can't know the usable size
+      new_allocator<char> a;
+      allocation_result<char*> r = allocator_traits< new_allocator<char> >::allocate_at_least(a, 7u);
+      BOOST_TEST_EQ(r.count, 7u);
+      a.deallocate(r.ptr, r.count);
+   }
+   {  //allocator reports the usable size of the dlmalloc chunk
+      allocator<int> a;
+      allocation_result<int*, std::size_t> r = a.allocate_at_least(3u);
+      BOOST_TEST(r.count >= 3u);
+      BOOST_TEST(r.count*sizeof(int) <= dlmalloc_size(r.ptr));
+      a.deallocate(r.ptr, r.count);
+   }
+}
+
+void test_pmr()
+{
+   //Default resource returns at least the requested size
+   pmr::polymorphic_allocator<char> a;
+   allocation_result<char*> r = a.allocate_at_least(3u);
+   BOOST_TEST(r.count >= 3u);
+   a.deallocate(r.ptr, r.count);
+
+   //Pool resources return the block size of the selected pool
+   pmr::unsynchronized_pool_resource pool;
+   BOOST_TEST_EQ(pool.allocation_size(5u), pool.pool_block(0u));
+   BOOST_TEST_EQ(pool.allocation_size(pool.pool_block(0u) + 1u), pool.pool_block(1u));
+   const std::size_t big = pool.options().largest_required_pool_block + 1u;
+   BOOST_TEST_EQ(pool.allocation_size(big), big);
+
+   pmr::polymorphic_allocator<int> pa(&pool);
+   allocation_result<int*> pr = pa.allocate_at_least(1u);
+   BOOST_TEST_EQ(pr.count, pool.pool_block(0u)/sizeof(int));
+   pa.deallocate(pr.ptr, pr.count);
+
+   //The free function finds the pool through a memory_resource reference
+   const pmr::memory_resource &res = pool;
+   BOOST_TEST_EQ(pmr::allocation_size(res, 5u, 1u), pool.pool_block(0u));
+   pmr::synchronized_pool_resource spool;
+   BOOST_TEST_EQ(pmr::allocation_size(spool, 5u, 1u), spool.pool_block(0u));
+
+   //Other resources do not round
+   BOOST_TEST_EQ(pmr::allocation_size(*pmr::null_memory_resource(), 3u, 1u), 3u);
+}
+
+template<class Vector>
+void test_capacity_feedback()
+{
+   typedef typename Vector::allocator_type allocator_type;
+   typedef typename allocator_type::value_type value_type;
+   {
+      Vector v;
+      v.push_back(value_type(1));
+      BOOST_TEST_EQ(v.capacity(), v.size() + 3u);
+      for(int i = 0; i != 100; ++i){
+         v.push_back(value_type(i));
+      }
+      const std::size_t cap = v.capacity();
+      v.reserve(cap + 1u);
+      BOOST_TEST_EQ(v.capacity(), cap + 4u);
+      BOOST_TEST_EQ(extra_allocator<value_type>::outstanding, v.capacity());
+   }
+   BOOST_TEST_EQ(extra_allocator<value_type>::outstanding, 0u);
+}
+
+void test_devector_capacity_feedback()
+{
+   typedef devector<int, extra_allocator<int> > devector_t;
+   {
+      devector_t v;
+      v.reserve_back(100u);
+      BOOST_TEST_EQ(v.back_capacity(), 100u + 3u);
+      for(int i = 0; i != 1000; ++i){
+         v.push_back(i);
+         v.push_front(i);
+      }
+      BOOST_TEST_EQ(v.size(), 2000u);
+   }
+   BOOST_TEST_EQ(extra_allocator<int>::outstanding, 0u);
+}
+
+void test_string_capacity_feedback()
+{
+   typedef basic_string<char, std::char_traits<char>, extra_allocator<char> > string_t;
+   {
+      string_t s;
+      s.reserve(100u);
+      BOOST_TEST(s.capacity() >= 100u);
+      //The whole allocation is used, one element is reserved for the null terminator
+      BOOST_TEST_EQ(extra_allocator<char>::outstanding, s.capacity() + 1u);
+      s.append(200u, 'a');
+      BOOST_TEST_EQ(extra_allocator<char>::outstanding, s.capacity() + 1u);
+   }
+   BOOST_TEST_EQ(extra_allocator<char>::outstanding, 0u);
+}
+
+void test_pool_capacity_feedback()
+{
+   //A vector of 5 chars gets the whole pool block
+   pmr::unsynchronized_pool_resource pool;
+   vector<char, pmr::polymorphic_allocator<char> > v(&pool);
+   v.reserve(5u);
+   BOOST_TEST_EQ(v.capacity(), pool.pool_block(0u));
+}
+
+int main()
+{
+   test_allocator_traits();
+   test_pmr();
+   test_capacity_feedback< vector<int, extra_allocator<int> > >();
+   test_capacity_feedback< small_vector<int, 0, extra_allocator<int> > >();
+   test_devector_capacity_feedback();
+   test_string_capacity_feedback();
+   test_pool_capacity_feedback();
+   return boost::report_errors();
+}
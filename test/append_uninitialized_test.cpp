@@ -0,0 +1,186 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/vector.hpp>
+#include <boost/container/small_vector.hpp>
+#include <boost/container/static_vector.hpp>
+#include <boost/container/devector.hpp>
+#include <boost/container/string.hpp>
+#include <boost/container/instrumented_allocator.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdio>
+#include <cstring>
+
+using namespace boost::container;
+
+//Simulates a read() that returns a variable number of bytes
+std::size_t fake_read(unsigned char *buf, std::size_t n, std::size_t call)
+{
+   const std::size_t k = call % (n + 1u);
+   for(std::size_t i = 0; i != k; ++i){
+      buf[i] = (unsigned char)(call + i);
+   }
+   return k;
+}
+
+template<class Vector>
+void test_append_uninitialized(Vector &v)
+{
+   const std::size_t chunk = 64u;
+   std::size_t expected_size = 0u;
+   for(std::size_t call = 0; call != 1000u; ++call){
+      unsigned char *const p = v.append_uninitialized(chunk);
+      //The whole chunk is writable
+      std::memset(p, 0, chunk);
+      BOOST_TEST_EQ(v.size(), expected_size);
+      const std::size_t k = fake_read(p, chunk, call);
+      v.commit(k);
+      expected_size += k;
+   }
+   BOOST_TEST_EQ(v.size(), expected_size);
+   //Check contents
+   std::size_t pos = 0u;
+   for(std::size_t call = 0; call != 1000u; ++call){
+      for(std::size_t i = 0, k = call % (chunk + 1u); i != k; ++i, ++pos){
+         BOOST_TEST_EQ(v[pos], (unsigned char)(call + i));
+      }
+   }
+   //Committing nothing is allowed
+   v.append_uninitialized(0u);
+   v.commit(0u);
+   BOOST_TEST_EQ(v.size(), expected_size);
+}
+
+void test_vectors()
+{
+   statistics_observer obs;
+   {
+      vector<unsigned char, instrumented_allocator<unsigned char> > v((instrumented_allocator<unsigned char>(obs)));
+      test_append_uninitialized(v);
+      //Geometric growth: a few allocations for ~32KB
+      BOOST_TEST(obs.statistics().allocations < 20u);
+   }
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 0u);
+   {
+      small_vector<unsigned char, 100> v;
+      //Fits in the internal storage
+      unsigned char *const p = v.append_uninitialized(100u);
+      BOOST_TEST(p == v.data());
+      std::memset(p, 'x', 50u);
+      v.commit(50u);
+      BOOST_TEST_EQ(v.size(), 50u);
+      BOOST_TEST_EQ(v[49], 'x');
+      v.clear();
+      test_append_uninitialized(v);
+   }
+   {
+      devector<unsigned char> v;
+      v.push_front('f');
+      v.pop_front();
+      test_append_uninitialized(v);
+      //Elements pushed to the front are kept
+      v.push_front('f');
+      unsigned char *const p = v.append_uninitialized(3u);
+      p[0] = 'a';
+      v.commit(1u);
+      BOOST_TEST_EQ(v.front(), 'f');
+      BOOST_TEST_EQ(v.back(), 'a');
+   }
+   {
+      static_vector<unsigned char, 8> v;
+      unsigned char *const p = v.append_uninitialized(8u);
+      p[0] = 'a';
+      p[1] = 'b';
+      v.commit(2u);
+      BOOST_TEST_EQ(v.size(), 2u);
+      BOOST_TEST_EQ(v[1], 'b');
+      BOOST_TEST_THROWS(v.append_uninitialized(7u), std::exception);
+   }
+}
+
+struct snprintf_op
+{
+   explicit snprintf_op(int value) : m_value(value) {}
+
+   std::size_t operator()(char *p, std::size_t n) const
+   {
+      //Formatted in a local buffer, as the compiler can't prove that n is big enough
+      char buf[32];
+      const int r = std::snprintf(buf, sizeof(buf), "value=%d", m_value);
+      const std::size_t len = r < 0 ? 0u : std::size_t(r) > n ? n : std::size_t(r);
+      std::memcpy(p, buf, len);
+      return len;
+   }
+
+   int m_value;
+};
+
+struct prefix_op
+{
+   std::size_t operator()(char *p, std::size_t n) const
+   {
+      //The characters that were in the string before are kept
+      BOOST_TEST(std::memcmp(p, "value=", 6u) == 0);
+      std::memset(p + 6u, '#', n - 6u);
+      return n;
+   }
+};
+
+struct append_op
+{
+   explicit append_op(std::size_t old_size) : m_old_size(old_size) {}
+
+   std::size_t operator()(char *p, std::size_t n) const
+   {
+      std::memset(p + m_old_size, 'a', n - m_old_size);
+      return n - 1u;
+   }
+
+   std::size_t m_old_size;
+};
+
+void test_string()
+{
+   {
+      string s;
+      s.resize_and_overwrite(31u, snprintf_op(12345));
+      BOOST_TEST(s == "value=12345");
+      BOOST_TEST_EQ(s.c_str()[s.size()], '\0');
+      //Shrinking keeps the first characters
+      s.resize_and_overwrite(8u, prefix_op());
+      BOOST_TEST(s == "value=##");
+   }
+   statistics_observer obs;
+   {
+      typedef basic_string<char, std::char_traits<char>, instrumented_allocator<char> > inst_string;
+      inst_string s((instrumented_allocator<char>(obs)));
+      //Short strings use the internal buffer
+      s.resize_and_overwrite(5u, snprintf_op(7));
+      BOOST_TEST(s == "value");
+      BOOST_TEST_EQ(obs.statistics().allocations, 0u);
+      //Appending through resize_and_overwrite grows geometrically
+      for(std::size_t i = 0; i != 1000u; ++i){
+         const std::size_t old_size = s.size();
+         s.resize_and_overwrite(old_size + 33u, append_op(old_size));
+         BOOST_TEST_EQ(s.size(), old_size + 32u);
+      }
+      BOOST_TEST_EQ(s.size(), 5u + 32000u);
+      BOOST_TEST(s.compare(0u, 5u, "value") == 0);
+      BOOST_TEST_EQ(s[s.size() - 1u], 'a');
+      BOOST_TEST(obs.statistics().allocations < 30u);
+   }
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 0u);
+}
+
+int main()
+{
+   test_vectors();
+   test_string();
+   return boost::report_errors();
+}
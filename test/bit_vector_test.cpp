@@ -0,0 +1,351 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/bit_vector.hpp>
+#include <boost/container/allocator.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class bit_vector<>;
+template class bit_vector<std::allocator<int> >;
+template class small_bit_vector<100>;
+
+}} //boost::container
+
+using namespace boost::container;
+
+typedef std::vector<bool> ref_t;
+
+template<class BitVector>
+bool equal_to_ref(const BitVector &b, const ref_t &r)
+{
+   if(b.size() != r.size())
+      return false;
+   for(std::size_t i = 0; i != r.size(); ++i){
+      if(b[i] != r[i])
+         return false;
+   }
+   //Unused bits of the last block must be zero
+   const std::size_t tail = b.size() % 64u;
+   return !tail || !(b.data()[b.num_blocks()-1u] >> tail);
+}
+
+ref_t random_bits(std::size_t n, int density)
+{
+   ref_t r(n);
+   for(std::size_t i = 0; i != n; ++i)
+      r[i] = (std::rand() % 100) < density;
+   return r;
+}
+
+template<class BitVector>
+void test_basic()
+{
+   BitVector b;
+   BOOST_TEST(b.empty());
+   BOOST_TEST_EQ(b.count(), 0u);
+   BOOST_TEST(b.none());
+   BOOST_TEST(b.all());
+   BOOST_TEST_EQ(b.find_first(), BitVector::npos);
+
+   ref_t r;
+   for(std::size_t i = 0; i != 300; ++i){
+      b.push_back(i % 3 == 0);
+      r.push_back(i % 3 == 0);
+   }
+   BOOST_TEST(equal_to_ref(b, r));
+   BOOST_TEST_EQ(b.num_blocks(), 5u);
+   BOOST_TEST(b.capacity() >= b.size());
+   BOOST_TEST(b.front());
+   BOOST_TEST(!b.back());
+
+   b[1] = true;   r[1] = true;
+   b.flip(2);     r[2] = !r[2];
+   b.set(4);      r[4] = true;
+   b.reset(0);    r[0] = false;
+   b[5] = b[4];   r[5] = r[4];
+   BOOST_TEST(equal_to_ref(b, r));
+   BOOST_TEST(b.test(1));
+   #ifndef BOOST_NO_EXCEPTIONS
+   BOOST_TEST_THROWS((void)b.test(300), std::exception);
+   #endif
+
+   //pop_back keeps the unused bits zeroed
+   b.back() = true;
+   for(std::size_t i = 0; i != 45; ++i){
+      b.pop_back();
+      r.pop_back();
+   }
+   BOOST_TEST(equal_to_ref(b, r));
+   b.pop_back();  r.pop_back();
+   BOOST_TEST_EQ(b.num_blocks(), 4u);
+   BOOST_TEST(equal_to_ref(b, r));
+
+   //resize with true fills the tail of the last block
+   b.resize(400u, true);   r.resize(400u, true);
+   BOOST_TEST(equal_to_ref(b, r));
+   b.resize(70u);          r.resize(70u);
+   BOOST_TEST(equal_to_ref(b, r));
+
+   //Iterators
+   std::size_t n = 0;
+   for(typename BitVector::const_iterator it = b.cbegin(); it != b.cend(); ++it, ++n){
+      BOOST_TEST_EQ(*it, r[n]);
+   }
+   BOOST_TEST_EQ(n, b.size());
+   BOOST_TEST_EQ(std::size_t(b.end() - b.begin()), b.size());
+   BOOST_TEST_EQ(*b.rbegin(), r.back());
+   *b.begin() = true;      r[0] = true;
+   b.begin()[3] = false;   r[3] = false;
+   BOOST_TEST(equal_to_ref(b, r));
+
+   b.set();
+   BOOST_TEST(b.all());
+   BOOST_TEST_EQ(b.count(), 70u);
+   b.flip();
+   BOOST_TEST(b.none());
+   BOOST_TEST(equal_to_ref(b, ref_t(70u, false)));
+   b.flip();
+   BOOST_TEST(equal_to_ref(b, ref_t(70u, true)));
+   b.reset();
+   BOOST_TEST(b.none());
+
+   b.clear();
+   BOOST_TEST(b.empty());
+   b.assign(10u, true);
+   BOOST_TEST_EQ(b.count(), 10u);
+}
+
+template<class BitVector>
+void test_bulk()
+{
+   //Sizes around the SIMD strides and block boundaries
+   const std::size_t sizes[] = { 1u, 63u, 64u, 65u, 127u, 128u, 129u, 255u, 256u, 257u, 511u, 512u, 1000u, 4097u };
+   const int densities[] = { 0, 1, 50, 99, 100 };
+   for(std::size_t si = 0; si != sizeof(sizes)/sizeof(sizes[0]); ++si){
+      for(std::size_t di = 0; di != sizeof(densities)/sizeof(densities[0]); ++di){
+         const std::size_t sz = sizes[si];
+         const ref_t ra = random_bits(sz, densities[di]);
+         const ref_t rb = random_bits(sz, 50);
+         const BitVector a(ra.begin(), ra.end());
+         const BitVector b(rb.begin(), rb.end());
+         BOOST_TEST(equal_to_ref(a, ra));
+
+         //count/any/none/all
+         std::size_t cnt = 0;
+         for(std::size_t i = 0; i != sz; ++i)
+            cnt += ra[i];
+         BOOST_TEST_EQ(a.count(), cnt);
+         BOOST_TEST_EQ(a.any(), cnt != 0u);
+         BOOST_TEST_EQ(a.none(), cnt == 0u);
+         BOOST_TEST_EQ(a.all(), cnt == sz);
+
+         //find_first/find_next visit every set bit in order
+         std::size_t expected = 0;
+         for(; expected != sz && !ra[expected]; ++expected){}
+         std::size_t pos = a.find_first();
+         std::size_t visited = 0;
+         while(pos != BitVector::npos){
+            BOOST_TEST_EQ(pos, expected);
+            ++visited;
+            for(++expected; expected != sz && !ra[expected]; ++expected){}
+            pos = a.find_next(pos);
+         }
+         BOOST_TEST_EQ(expected, sz);
+         BOOST_TEST_EQ(visited, cnt);
+
+         //Bitwise operators
+         ref_t r_and(sz), r_or(sz), r_xor(sz), r_diff(sz), r_not(sz);
+         for(std::size_t i = 0; i != sz; ++i){
+            r_and[i]  = ra[i] && rb[i];
+            r_or[i]   = ra[i] || rb[i];
+            r_xor[i]  = ra[i] != rb[i];
+            r_diff[i] = ra[i] && !rb[i];
+            r_not[i]  = !ra[i];
+         }
+         BitVector t(a);
+         t &= b;  BOOST_TEST(equal_to_ref(t, r_and));
+         t = a;
+         t |= b;  BOOST_TEST(equal_to_ref(t, r_or));
+         t = a;
+         t ^= b;  BOOST_TEST(equal_to_ref(t, r_xor));
+         t = a;
+         t -= b;  BOOST_TEST(equal_to_ref(t, r_diff));
+         t = a;
+         t.flip();
+         BOOST_TEST(equal_to_ref(t, r_not));
+         BOOST_TEST(t != a);
+         t.flip();
+         BOOST_TEST(t == a);
+      }
+   }
+}
+
+void test_free_operators()
+{
+   const ref_t ra = random_bits(200u, 50);
+   const ref_t rb = random_bits(200u, 50);
+   const bit_vector<> a(ra.begin(), ra.end());
+   const bit_vector<> b(rb.begin(), rb.end());
+   BOOST_TEST((a & b).count() + (a | b).count() == a.count() + b.count());
+   BOOST_TEST((a ^ b) == ((a | b) - (a & b)));
+   BOOST_TEST((~a).count() == a.size() - a.count());
+
+   //Mixing bit_vector and small_bit_vector
+   small_bit_vector<256> s(rb.begin(), rb.end());
+   s &= a;
+   BOOST_TEST_EQ(s.count(), (a & b).count());
+}
+
+void test_copy_move()
+{
+   bit_vector<> a(130u, true);
+   bit_vector<> b(a);
+   BOOST_TEST(a == b);
+   bit_vector<> c(boost::move(b));
+   BOOST_TEST(c == a);
+   BOOST_TEST(b.empty());
+   b = c;
+   BOOST_TEST(b == a);
+   c = boost::move(b);
+   BOOST_TEST(b.empty());
+   c.swap(b);
+   BOOST_TEST(c.empty());
+   BOOST_TEST(b == a);
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   bit_vector<> il = { true, false, true };
+   BOOST_TEST_EQ(il.size(), 3u);
+   BOOST_TEST_EQ(il.count(), 2u);
+   #endif
+}
+
+void test_small_bit_vector()
+{
+   typedef small_bit_vector<100> sbv_t;
+   BOOST_TEST_EQ(sbv_t::static_capacity, 128u);
+   sbv_t s;
+   BOOST_TEST_EQ(s.capacity(), 128u);
+   const void *const inline_data = s.data();
+   s.resize(128u, true);
+   BOOST_TEST(s.data() == inline_data);
+   BOOST_TEST(s.all());
+   s.push_back(false);
+   BOOST_TEST(s.data() != inline_data);
+   BOOST_TEST_EQ(s.count(), 128u);
+
+   sbv_t m(boost::move(s));
+   BOOST_TEST_EQ(m.size(), 129u);
+   BOOST_TEST(s.empty());
+   s = m;
+   BOOST_TEST(s == m);
+}
+
+//Allocator that throws when allocations are disabled
+template<class T>
+class failing_allocator
+{
+   public:
+   typedef T value_type;
+
+   failing_allocator() {}
+
+   template<class U>
+   failing_allocator(const failing_allocator<U> &) {}
+
+   T *allocate(std::size_t n)
+   {
+      if(!allocation_enabled)
+         throw std::bad_alloc();
+      return std::allocator<T>().allocate(n);
+   }
+
+   void deallocate(T *p, std::size_t n)
+   {  std::allocator<T>().deallocate(p, n);  }
+
+   friend bool operator==(const failing_allocator &, const failing_allocator &) {  return true;  }
+   friend bool operator!=(const failing_allocator &, const failing_allocator &) {  return false;  }
+
+   static bool allocation_enabled;
+};
+
+template<class T>
+bool failing_allocator<T>::allocation_enabled = true;
+
+void test_options()
+{
+   //stored_size limits both the number of blocks and bits
+   typedef vector_options< stored_size<unsigned short> >::type small_size_opt_t;
+   typedef bit_vector<void, small_size_opt_t> bv_t;
+   BOOST_CONTAINER_STATIC_ASSERT((sizeof(bv_t) < sizeof(bit_vector<>)));
+   bv_t b;
+   BOOST_TEST_EQ(b.max_size(), 65535u);
+   b.resize(65535u, true);
+   BOOST_TEST_EQ(b.count(), 65535u);
+   #ifndef BOOST_NO_EXCEPTIONS
+   BOOST_TEST_THROWS(b.push_back(true), std::exception);
+   BOOST_TEST_THROWS(b.resize(65536u), std::exception);
+   #endif
+
+   //growth_factor is applied to the block container
+   typedef vector_options< growth_factor<growth_factor_100> >::type growth_opt_t;
+   bit_vector<void, growth_opt_t> g;
+   g.resize(64u);
+   g.shrink_to_fit();
+   BOOST_TEST_EQ(g.capacity(), 64u);
+   g.push_back(true);
+   BOOST_TEST_EQ(g.capacity(), 128u);
+
+   //Version 2 allocators are rebound to the block type
+   bit_vector< allocator<int> > v2(1000u, true);
+   BOOST_TEST_EQ(v2.count(), 1000u);
+
+   typedef small_vector_options< growth_factor<growth_factor_100> >::type sgrowth_opt_t;
+   small_bit_vector<64, void, sgrowth_opt_t> sg(64u);
+   sg.push_back(true);
+   BOOST_TEST_EQ(sg.capacity(), 128u);
+}
+
+void test_resize_strong_guarantee()
+{
+   #ifndef BOOST_NO_EXCEPTIONS
+   typedef failing_allocator<int> alloc_t;
+   typedef bit_vector<alloc_t> bv_t;
+   bv_t b(70u, false);
+   b.shrink_to_fit();
+   b[3] = true;
+   const ref_t r(b.begin(), b.end());
+   failing_allocator<dtl::bit_block_t>::allocation_enabled = false;
+   BOOST_TEST_THROWS(b.resize(1000u, true), std::bad_alloc);
+   failing_allocator<dtl::bit_block_t>::allocation_enabled = true;
+   //Unused bits of the last block are still zero
+   BOOST_TEST(equal_to_ref(b, r));
+   BOOST_TEST_EQ(b.count(), 1u);
+   BOOST_TEST(b == bv_t(r.begin(), r.end()));
+   #endif
+}
+
+int main()
+{
+   test_basic< bit_vector<> >();
+   test_basic< small_bit_vector<100> >();
+   test_bulk< bit_vector<> >();
+   test_bulk< small_bit_vector<256> >();
+   test_free_operators();
+   test_copy_move();
+   test_small_bit_vector();
+   test_options();
+   test_resize_strong_guarantee();
+   return boost::report_errors();
+}
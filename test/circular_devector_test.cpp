@@ -0,0 +1,392 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/circular_devector.hpp>
+#include <boost/container/instrumented_allocator.hpp>
+#include <boost/container/experimental/segmented_count.hpp>
+#include <boost/container/experimental/segmented_find.hpp>
+#include <boost/container/experimental/segmented_fill.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <list>
+#include <sstream>
+#include <iterator>
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class circular_devector<int>;
+template class circular_devector<int, std::allocator<int> >;
+
+}} //boost::container
+
+using namespace boost::container;
+
+//Non-trivial type that counts live instances and can be told to throw on copy
+class counted
+{
+   public:
+   static int live;
+   static int throw_countdown;
+
+   counted(int v = 0)
+      : m_v(new int(v))
+   {  ++live;  }
+
+   counted(const counted &o)
+      : m_v()
+   {
+      if(throw_countdown > 0 && !--throw_countdown)
+         throw std::exception();
+      m_v = new int(*o.m_v);
+      ++live;
+   }
+
+   counted &operator=(const counted &o)
+   {  *m_v = *o.m_v;  return *this;  }
+
+   ~counted()
+   {  delete m_v;  --live;  }
+
+   int value() const {  return *m_v;  }
+
+   friend bool operator==(const counted &a, const counted &b)
+   {  return *a.m_v == *b.m_v;  }
+
+   friend bool operator==(const counted &a, int b)
+   {  return *a.m_v == b;  }
+
+   private:
+   int *m_v;
+};
+
+int counted::live = 0;
+int counted::throw_countdown = 0;
+
+template<class C, class R>
+bool equal_to_ref(const C &c, const R &r)
+{
+   if(c.size() != r.size())
+      return false;
+   typename R::const_iterator rit = r.begin();
+   for(typename C::const_iterator it = c.begin(); it != c.end(); ++it, ++rit){
+      if(!(*it == *rit))
+         return false;
+   }
+   for(std::size_t i = 0; i != r.size(); ++i){
+      if(!(c[i] == r[i]))
+         return false;
+   }
+   return true;
+}
+
+template<class T>
+void test_wrap_around()
+{
+   circular_devector<T> c;
+   std::deque<T> r;
+   c.reserve(8u);
+   const std::size_t cap = c.capacity();
+
+   //push_front on an empty buffer wraps to the buffer end
+   c.push_front(T(1));  r.push_front(T(1));
+   c.push_back(T(2));   r.push_back(T(2));
+   c.push_front(T(0));  r.push_front(T(0));
+   BOOST_TEST(c.is_wrapped());
+   BOOST_TEST(equal_to_ref(c, r));
+   BOOST_TEST_EQ(c.front().value(), 0);
+   BOOST_TEST_EQ(c.back().value(), 2);
+
+   //Fill the buffer, no reallocation
+   for(int i = 3; c.size() != cap; ++i){
+      c.push_back(T(i));   r.push_back(T(i));
+   }
+   BOOST_TEST_EQ(c.capacity(), cap);
+   BOOST_TEST(equal_to_ref(c, r));
+
+   //Growing a wrapped buffer unwraps it
+   c.push_back(T(100)); r.push_back(T(100));
+   BOOST_TEST(c.capacity() > cap);
+   BOOST_TEST(!c.is_wrapped());
+   BOOST_TEST(equal_to_ref(c, r));
+
+   //Growing at the front too
+   circular_devector<T> f;
+   std::deque<T> rf;
+   for(int i = 0; i != 50; ++i){
+      f.push_front(T(i));  rf.push_front(T(i));
+   }
+   BOOST_TEST(equal_to_ref(f, rf));
+   while(!f.empty()){
+      BOOST_TEST(f.back() == rf.back());
+      f.pop_back();  rf.pop_back();
+   }
+}
+
+void test_fifo_no_relocation()
+{
+   statistics_observer obs;
+   typedef instrumented_allocator<int> alloc_t;
+   circular_devector<int, alloc_t> c((alloc_t(obs)));
+   c.reserve(16u);
+   const std::size_t cap = c.capacity();
+   const int *const buf = &*c.begin();
+   const std::size_t allocs = obs.statistics().allocations;
+
+   //Steady state FIFO traffic never relocates
+   int next_in = 0, next_out = 0;
+   for(int i = 0; i != 10000; ++i){
+      while(c.size() != cap){
+         c.push_back(next_in++);
+      }
+      for(std::size_t j = 0, n = std::size_t(i % 5) + 1u; j != n; ++j){
+         BOOST_TEST_EQ(c.front(), next_out);
+         c.pop_front();
+         ++next_out;
+      }
+   }
+   BOOST_TEST_EQ(c.capacity(), cap);
+   BOOST_TEST_EQ(obs.statistics().allocations, allocs);
+   BOOST_TEST_EQ(obs.statistics().reallocations, 0u);
+   BOOST_TEST(&c[0] >= buf && &c[0] < buf + cap);
+
+   //Elements stay in place while other elements are pushed and popped
+   const int *const front_addr = &c.front();
+   const int front_val = c.front();
+   c.pop_back();
+   c.push_back(-1);
+   BOOST_TEST(&c.front() == front_addr);
+   BOOST_TEST_EQ(c.front(), front_val);
+
+   //Growing the buffer is reported as a relocation
+   while(c.size() != cap){
+      c.push_back(-2);
+   }
+   c.push_back(-3);
+   BOOST_TEST_EQ(obs.statistics().reallocations, 1u);
+}
+
+template<class T>
+void test_middle_insert_erase()
+{
+   std::srand(1234u);
+   for(std::size_t cap_req = 1u; cap_req != 40u; cap_req += 3u){
+      circular_devector<T> c;
+      std::deque<T> r;
+      c.reserve(cap_req);
+      //Place head at different positions
+      for(std::size_t i = 0; i != cap_req/2u; ++i){
+         c.push_back(T(-1));
+         c.pop_front();
+      }
+      for(int step = 0; step != 200; ++step){
+         const int op = std::rand() % 8;
+         const std::size_t pos = r.empty() ? 0u : std::size_t(std::rand()) % (r.size() + 1u);
+         const std::size_t n = std::size_t(std::rand() % 5);
+         if(op < 2){
+            c.insert(c.nth(pos), T(step));
+            r.insert(r.begin() + std::ptrdiff_t(pos), T(step));
+         }
+         else if(op == 2){
+            c.insert(c.nth(pos), n, T(step));
+            r.insert(r.begin() + std::ptrdiff_t(pos), n, T(step));
+         }
+         else if(op == 3){
+            std::deque<T> src(n, T(step));
+            c.insert(c.nth(pos), src.begin(), src.end());
+            r.insert(r.begin() + std::ptrdiff_t(pos), src.begin(), src.end());
+         }
+         else if(op == 4 && !r.empty()){
+            //Pushing an element of the container itself, even if it reallocates
+            const std::size_t from = std::size_t(std::rand()) % r.size();
+            if(n & 1u){
+               c.push_back(c[from]);
+               r.push_back(T(r[from]));
+            }
+            else{
+               c.push_front(c[from]);
+               r.push_front(T(r[from]));
+            }
+         }
+         else if(op == 5 && pos != r.size()){
+            c.erase(c.nth(pos));
+            r.erase(r.begin() + std::ptrdiff_t(pos));
+         }
+         else if(op == 6){
+            const std::size_t last = dtl::min_value(r.size(), pos + n);
+            c.erase(c.nth(pos), c.nth(last));
+            r.erase(r.begin() + std::ptrdiff_t(pos), r.begin() + std::ptrdiff_t(last));
+         }
+         else{
+            c.push_front(T(step));
+            r.push_front(T(step));
+         }
+         BOOST_TEST(equal_to_ref(c, r));
+      }
+   }
+}
+
+void test_input_iterators()
+{
+   std::stringstream ss("1 2 3 4 5");
+   circular_devector<int> c;
+   c.push_back(0);
+   c.push_back(6);
+   c.insert(c.nth(1u), std::istream_iterator<int>(ss), std::istream_iterator<int>());
+   BOOST_TEST_EQ(c.size(), 7u);
+   for(int i = 0; i != 7; ++i)
+      BOOST_TEST_EQ(c[std::size_t(i)], i);
+}
+
+void test_exceptions()
+{
+   #ifndef BOOST_NO_EXCEPTIONS
+   {
+      circular_devector<counted> c;
+      c.reserve(8u);
+      for(int i = 0; i != 6; ++i){
+         c.push_back(counted(i));
+         c.pop_front();
+      }
+      for(int i = 0; i != 5; ++i)
+         c.push_back(counted(i));
+      BOOST_TEST(c.is_wrapped());
+      const circular_devector<counted> orig(c);
+      std::list<counted> src(4u, counted(9));
+
+      //Throwing in the middle of an insertion in place
+      counted::throw_countdown = 2;
+      BOOST_TEST_THROWS(c.insert(c.nth(4u), src.begin(), src.end()), std::exception);
+      counted::throw_countdown = 0;
+      BOOST_TEST_EQ(c.size(), orig.size());
+
+      //Throwing while reallocating keeps the container unchanged
+      std::list<counted> big(10u, counted(7));
+      counted::throw_countdown = 3;
+      BOOST_TEST_THROWS(c.insert(c.nth(2u), big.begin(), big.end()), std::exception);
+      counted::throw_countdown = 0;
+      BOOST_TEST(c == orig);
+
+      BOOST_TEST_THROWS((void)c.at(c.size()), std::exception);
+   }
+   BOOST_TEST_EQ(counted::live, 0);
+
+   {
+      //stored_size limits the capacity
+      typedef devector_options< stored_size<unsigned char> >::type opt_t;
+      circular_devector<int, void, opt_t> c;
+      BOOST_CONTAINER_STATIC_ASSERT((sizeof(c) < sizeof(circular_devector<int>)));
+      c.resize(255u);
+      BOOST_TEST_THROWS(c.push_back(1), std::exception);
+      BOOST_TEST_THROWS(c.reserve(256u), std::exception);
+      BOOST_TEST_EQ(c.size(), 255u);
+   }
+   #endif
+}
+
+void test_copy_move_assign()
+{
+   circular_devector<int> a;
+   a.reserve(6u);
+   for(int i = 0; i != 4; ++i){
+      a.push_back(i);
+      a.pop_front();
+   }
+   for(int i = 0; i != 5; ++i)
+      a.push_back(i);
+   BOOST_TEST(a.is_wrapped());
+
+   circular_devector<int> b(a);
+   BOOST_TEST(a == b);
+   BOOST_TEST(!b.is_wrapped());
+   circular_devector<int> m(boost::move(b));
+   BOOST_TEST(b.empty());
+   BOOST_TEST(m == a);
+   b = m;
+   BOOST_TEST(b == a);
+   b.assign(3u, 7);
+   BOOST_TEST_EQ(b.size(), 3u);
+   BOOST_TEST(a < b);
+   m = boost::move(b);
+   BOOST_TEST_EQ(m.size(), 3u);
+   m.swap(a);
+   BOOST_TEST_EQ(a.size(), 3u);
+   BOOST_TEST_EQ(m.size(), 5u);
+
+   m.shrink_to_fit();
+   BOOST_TEST_EQ(m.capacity(), 5u);
+   m.resize(8u);
+   BOOST_TEST_EQ(m.back(), 0);
+   m.resize(2u);
+   BOOST_TEST_EQ(m.size(), 2u);
+   m.clear();
+   m.shrink_to_fit();
+   BOOST_TEST_EQ(m.capacity(), 0u);
+
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   circular_devector<int> il = { 1, 2, 3 };
+   il.insert(il.begin() + 1, { 4, 5 });
+   const int expected [] = { 1, 4, 5, 2, 3 };
+   BOOST_TEST_ALL_EQ(il.begin(), il.end(), expected, expected + 5);
+   BOOST_TEST_EQ(erase(il, 5), 1u);
+   BOOST_TEST_EQ(erase_if(il, [](int v){ return v > 3; }), 1u);
+   BOOST_TEST_EQ(il.size(), 3u);
+   #endif
+}
+
+void test_segmented_algorithms()
+{
+   circular_devector<int> c;
+   c.reserve(32u);
+   const std::size_t cap = c.capacity();
+   for(std::size_t i = 0; i != cap/2u + 3u; ++i){
+      c.push_back(0);
+      c.pop_front();
+   }
+   for(std::size_t i = 0; i != cap; ++i)
+      c.push_back(int(i % 3u));
+   BOOST_TEST(c.is_wrapped());
+
+   typedef segmented_iterator_traits<circular_devector<int>::iterator> traits;
+   BOOST_CONTAINER_STATIC_ASSERT((dtl::is_same<traits::is_segmented_iterator, segmented_iterator_tag>::value));
+   BOOST_TEST(traits::segment(c.begin()) != traits::segment(c.end() - 1));
+   BOOST_TEST(traits::compose(traits::segment(c.begin() + 7), traits::local(c.begin() + 7)) == c.begin() + 7);
+
+   std::ptrdiff_t expected = 0;
+   for(std::size_t i = 0; i != c.size(); ++i)
+      expected += c[i] == 1;
+   BOOST_TEST_EQ(segmented_count(c.begin(), c.end(), 1), expected);
+   BOOST_TEST_EQ(segmented_count(c.cbegin() + 3, c.cend() - 3, 2), std::ptrdiff_t(std::count(c.cbegin() + 3, c.cend() - 3, 2)));
+
+   c.back() = 42;
+   BOOST_TEST(segmented_find(c.begin(), c.end(), 42) == c.end() - 1);
+   BOOST_TEST(segmented_find(c.begin(), c.end(), 43) == c.end());
+
+   segmented_fill(c.begin() + 1, c.end() - 1, 5);
+   BOOST_TEST_EQ(c.front(), 0);
+   BOOST_TEST_EQ(c.back(), 42);
+   BOOST_TEST_EQ(segmented_count(c.begin(), c.end(), 5), std::ptrdiff_t(c.size() - 2u));
+}
+
+int main()
+{
+   test_wrap_around<counted>();
+   test_fifo_no_relocation();
+   test_middle_insert_erase<int>();
+   test_middle_insert_erase<counted>();
+   test_input_iterators();
+   test_exceptions();
+   test_copy_move_assign();
+   test_segmented_algorithms();
+   BOOST_TEST_EQ(counted::live, 0);
+   return boost::report_errors();
+}
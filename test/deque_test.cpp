@@ -404,6 +404,33 @@ bool do_test_default_block_size()
    return 0 == boost::report_errors();
 }
 
+template<bool Reservable>
+bool do_test_map_expansion()
+{
+   //Version 2 allocators try to expand the index map in place
+   typedef deque< int, allocator<int>
+                , typename deque_options<reservable<Reservable>, block_size<4u> >::type > deque_t;
+   std::deque<int> stdd;
+   deque_t d;
+   for(int i = 0; i != 5000; ++i){
+      if(i % 3){
+         d.push_back(i);
+         stdd.push_back(i);
+      }
+      else{
+         d.push_front(i);
+         stdd.push_front(i);
+      }
+      if(i % 1000 == 999){
+         d.erase(d.begin() + 10, d.begin() + 400);
+         stdd.erase(stdd.begin() + 10, stdd.begin() + 400);
+      }
+   }
+   d.insert(d.begin() + 3, 2000u, -1);
+   stdd.insert(stdd.begin() + 3, 2000u, -1);
+   return test::CheckEqualContainers(d, stdd);
+}
+
 struct boost_container_deque;
 
 namespace boost { namespace container {   namespace test {
@@ -448,6 +475,10 @@ int main ()
    if(!do_test_default_block_size())
       return 1;
 
+   //In-place map expansion
+   if(!do_test_map_expansion<false>() || !do_test_map_expansion<true>())
+      return 1;
+
    //Test non-copy-move operations
    {
       deque<test::non_copymovable_int> d;
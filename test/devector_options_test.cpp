@@ -111,6 +111,38 @@ void test_growth_factor_100()
    BOOST_TEST(new_capacity == 2*old_capacity);
 }
 
+struct adaptive_tag;
+
+template<class Devector>
+std::size_t total_capacity(const Devector &v)
+{  return v.size() + v.back_free_capacity() + v.front_free_capacity();  }
+
+void test_adaptive_growth_factor()
+{
+   typedef adaptive_growth_factor<adaptive_tag> growth_t;
+   #if !defined(BOOST_NO_CXX11_TEMPLATE_ALIASES)
+   using options_t = devector_options_t< growth_factor<growth_t> >;
+   #else
+   typedef devector_options
+      < growth_factor<growth_t> >::type options_t;
+   #endif
+   growth_t::reset();
+
+   //Doubles and rounds 50 ints to a 224 byte size class
+   devector<int, new_allocator<int>, options_t> v(25,0);
+   v.push_back(0);
+   BOOST_TEST_EQ(total_capacity(v), 56u);
+
+   //shrink_to_fit with a lot of unused capacity backs off the growth
+   v.reserve_back(1000u);
+   v.shrink_to_fit();
+   BOOST_TEST_EQ(growth_t::backoff_level(), 1u);
+   BOOST_TEST_EQ(total_capacity(v), 26u);
+   v.resize(25u);
+   v.shrink_to_fit();
+   v.push_back(0);
+   BOOST_TEST_EQ(total_capacity(v), 40u);
+}
 
 void  test_stored_reloc_on_66()
 {
@@ -208,6 +240,7 @@ int main()
    test_growth_factor_50();
    test_growth_factor_60();
    test_growth_factor_100();
+   test_adaptive_growth_factor();
    test_stored_size_type<unsigned char>();
    test_stored_size_type<unsigned short>();
    test_stored_reloc_on_66();
@@ -3824,9 +3824,153 @@ struct GetAllocatorCont
 #endif
 
 
+//Version 2 allocator that serves a single buffer from a fixed arena and
+//expands it in place, forward and backwards, within the arena
+struct arena_state
+{
+   arena_state(int *a, std::size_t sz, std::size_t off)
+      : arena(a), arena_size(sz), offset(off), start(), size(), allocations()
+   {}
+
+   int *arena;
+   std::size_t arena_size;
+   std::size_t offset;
+   int *start;
+   std::size_t size;
+   unsigned allocations;
+};
+
+class arena_expand_allocator
+{
+   public:
+   typedef int          value_type;
+   typedef int *        pointer;
+   typedef const int *  const_pointer;
+   typedef int &        reference;
+   typedef const int &  const_reference;
+   typedef std::size_t  size_type;
+   typedef std::ptrdiff_t difference_type;
+   typedef dtl::version_type<arena_expand_allocator, 2> version;
+   struct multiallocation_chain{};
+
+   explicit arena_expand_allocator(arena_state &st)
+      : st_(&st)
+   {}
+
+   int *allocate(std::size_t n)
+   {
+      BOOST_TEST(st_->allocations == 0u);
+      BOOST_TEST(st_->offset + n <= st_->arena_size);
+      ++st_->allocations;
+      st_->start = st_->arena + st_->offset;
+      st_->size = n;
+      return st_->start;
+   }
+
+   void deallocate(int *p, std::size_t)
+   {  BOOST_TEST(p == st_->start);  st_->start = 0;  }
+
+   std::size_t max_size() const
+   {  return st_->arena_size;  }
+
+   int *allocation_command(allocation_type command, std::size_t limit, std::size_t &prefer_in_recvd_out_size, int *&reuse)
+   {
+      BOOST_TEST(reuse == st_->start);
+      int *const arena_end = st_->arena + st_->arena_size;
+      if(command & expand_fwd){
+         const std::size_t avail = std::size_t(arena_end - st_->start);
+         if(avail >= limit){
+            st_->size = prefer_in_recvd_out_size < avail ? prefer_in_recvd_out_size : avail;
+            prefer_in_recvd_out_size = st_->size;
+            return st_->start;
+         }
+      }
+      if(command & expand_bwd){
+         //Take all the space before the buffer (and after it, if allowed)
+         const std::size_t avail = (command & expand_fwd) ? st_->arena_size : std::size_t(st_->start + st_->size - st_->arena);
+         if(avail >= limit){
+            st_->start = st_->arena;
+            st_->size = prefer_in_recvd_out_size = avail;
+            return st_->start;
+         }
+      }
+      if(!(command & nothrow_allocation))
+         throw_bad_alloc();
+      return 0;
+   }
+
+   std::size_t size(int *) const
+   {  return st_->size;  }
+
+   friend bool operator==(const arena_expand_allocator &a, const arena_expand_allocator &b)
+   {  return a.st_ == b.st_;  }
+
+   friend bool operator!=(const arena_expand_allocator &a, const arena_expand_allocator &b)
+   {  return a.st_ != b.st_;  }
+
+   private:
+   arena_state *st_;
+};
+
+void test_expand_in_place()
+{
+   typedef devector<int, arena_expand_allocator> devector_t;
+   int arena[2000];
+   {  //The buffer is placed at the end of the arena, so push_front is served by backwards expansion
+      arena_state st(arena, 2000u, 1990u);
+      devector_t d((arena_expand_allocator(st)));
+      for(int i = 0; i != 1000; ++i){
+         d.push_front(i);
+      }
+      for(int i = 0; i != 5; ++i){
+         d.push_back(-i);
+      }
+      BOOST_TEST_EQ(st.allocations, 1u);
+      BOOST_TEST_EQ(d.get_alloc_count(), 1u);
+      BOOST_TEST(d.data() >= arena && d.data() + d.size() <= arena + 2000);
+      BOOST_TEST_EQ(d.size(), 1005u);
+      BOOST_TEST_EQ(d.front(), 999);
+      BOOST_TEST_EQ(d[999], 0);
+      BOOST_TEST_EQ(d.back(), -4);
+      bool ok = true;
+      for(int i = 0; i != 1000; ++i){
+         ok = ok && d[std::size_t(i)] == 999 - i;
+      }
+      BOOST_TEST(ok);
+   }
+   {  //push_back, resize and reserve_back are served by forward expansion
+      arena_state st(arena, 2000u, 0u);
+      devector_t d((arena_expand_allocator(st)));
+      for(int i = 0; i != 500; ++i){
+         d.push_back(i);
+      }
+      d.resize(1000u, -1);
+      d.reserve_back(1500u);
+      BOOST_TEST(d.back_capacity() >= 1500u);
+      BOOST_TEST_EQ(st.allocations, 1u);
+      BOOST_TEST_EQ(d[499], 499);
+      BOOST_TEST_EQ(d[500], -1);
+   }
+   {  //reserve_front and resize_front are served by backwards expansion
+      arena_state st(arena, 2000u, 1000u);
+      devector_t d((arena_expand_allocator(st)));
+      d.push_back(1);
+      d.push_back(2);
+      d.reserve_front(800u);
+      BOOST_TEST(d.front_capacity() >= 800u);
+      d.resize_front(900u, 7);
+      BOOST_TEST_EQ(st.allocations, 1u);
+      BOOST_TEST_EQ(d.size(), 900u);
+      BOOST_TEST_EQ(d.front(), 7);
+      BOOST_TEST_EQ(d[898], 1);
+      BOOST_TEST_EQ(d[899], 2);
+   }
+}
+
 void test_all()
 {
    test_recursive_devector();
+   test_expand_in_place();
    test_max_size();
    //test_exceeding_max_size();
    //shrink_to_fit();
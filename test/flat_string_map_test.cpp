@@ -0,0 +1,279 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) && !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+
+#include <boost/container/flat_string_map.hpp>
+#include <boost/container/flat_map.hpp>
+#include <boost/container/instrumented_allocator.hpp>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class flat_string_map<int>;
+template class flat_string_map<string, std::allocator<char> >;
+template class flat_string_map<int, void, flat_string_map_options<stored_size<unsigned> >::type>;
+
+}} //boost::container
+
+using namespace boost::container;
+
+class lcg
+{
+   public:
+   lcg() : m_state(12345u) {}
+
+   std::size_t operator()(std::size_t n)
+   {
+      m_state = m_state*1103515245u + 12345u;
+      return std::size_t((m_state >> 16u) % n);
+   }
+
+   private:
+   unsigned m_state;
+};
+
+//Keys with long common prefixes, embedded nulls and characters >= 0x80
+std::string random_key(lcg &rnd)
+{
+   static const char *const prefixes[] = { "", "metric.", "metric.cpu.", "\x80\xff", "a\0b" };
+   const std::size_t p = rnd(5u);
+   std::string s(prefixes[p], p == 4u ? 3u : std::strlen(prefixes[p]));
+   for(std::size_t i = 0, n = rnd(14u); i != n; ++i)
+      s += char(rnd(3u) ? 'a' + rnd(4u) : 0x7e + rnd(4u));
+   return s;
+}
+
+template<class Map>
+bool check_equal(const Map &m, const flat_map<std::string, int> &ref)
+{
+   if(m.size() != ref.size() || m.empty() != ref.empty())
+      return false;
+   typename Map::const_iterator it = m.begin();
+   for(flat_map<std::string, int>::const_iterator r = ref.begin(); r != ref.end(); ++r, ++it){
+      if(std::string(it->first.data(), it->first.size()) != r->first || it->second != r->second)
+         return false;
+      //Stored keys are null-terminated
+      if(it->first.c_str()[it->first.size()] != '\0')
+         return false;
+   }
+   return it == m.end();
+}
+
+template<class Map>
+void test_random_operations(const typename Map::allocator_type &a)
+{
+   lcg rnd;
+   Map m(a);
+   flat_map<std::string, int> ref;
+   for(int it = 0; it != 5000; ++it){
+      const std::string k = random_key(rnd);
+      switch(rnd(8u)){
+         case 0:
+         case 1:
+         {
+            const std::pair<typename Map::iterator, bool> r = m.try_emplace(k, it);
+            BOOST_TEST_EQ(r.second, ref.try_emplace(k, it).second);
+            BOOST_TEST(r.first.key() == k);
+            BOOST_TEST_EQ(r.first->second, ref[k]);
+         }
+         break;
+         case 2:
+            m[k] = it;
+            ref[k] = it;
+         break;
+         case 3:
+            BOOST_TEST_EQ(m.erase(k), ref.erase(k));
+         break;
+         case 4:
+            if(!ref.empty()){
+               const std::size_t i = rnd(ref.size());
+               const std::size_t n = rnd(4u);
+               const std::size_t e = i + n > ref.size() ? ref.size() : i + n;
+               m.erase(m.nth(i), m.nth(e));
+               ref.erase(ref.nth(i), ref.nth(e));
+            }
+         break;
+         case 5:
+         {
+            //Bulk insertion with repeated keys
+            std::vector<std::pair<std::string, int> > v;
+            for(std::size_t i = 0, n = rnd(20u); i != n; ++i){
+               v.push_back(std::pair<std::string, int>(rnd(4u) ? random_key(rnd) : k, it + int(i)));
+            }
+            m.insert(v.begin(), v.end());
+            ref.insert(v.begin(), v.end());
+         }
+         break;
+         case 6:
+         {
+            //Keys stored in the map can be used to insert
+            if(!m.empty()){
+               const typename Map::iterator src = m.nth(rnd(m.size()));
+               BOOST_TEST(!m.insert_or_assign(src->first, -1).second);
+               ref[std::string(src.key().data(), src.key().size())] = -1;
+            }
+         }
+         break;
+         default:
+         {
+            const typename Map::const_iterator f = m.find(k);
+            const flat_map<std::string, int>::const_iterator rf = ref.find(k);
+            BOOST_TEST_EQ(f == m.end(), rf == ref.end());
+            BOOST_TEST_EQ(m.contains(k), ref.contains(k));
+            BOOST_TEST_EQ(m.index_of(m.lower_bound(k)), ref.index_of(ref.lower_bound(k)));
+            BOOST_TEST_EQ(m.index_of(m.upper_bound(k)), ref.index_of(ref.upper_bound(k)));
+         }
+      }
+      BOOST_TEST(check_equal(m, ref));
+      //Unused characters are reclaimed
+      BOOST_TEST(m.key_storage_size() <= 2u*(ref.size() + 256u) + 4u*m.key_storage_size()/4u);
+   }
+   //Copies and moves
+   Map c(m);
+   BOOST_TEST(c == m);
+   BOOST_TEST(check_equal(c, ref));
+   Map mv(boost::move(c));
+   BOOST_TEST(mv == m);
+   BOOST_TEST(c.empty());
+   c = mv;
+   BOOST_TEST(c == m);
+   m.shrink_to_fit();
+   BOOST_TEST(check_equal(m, ref));
+   std::size_t live = 0;
+   for(typename Map::const_iterator i = m.begin(); i != m.end(); ++i)
+      live += i->first.size() + 1u;
+   BOOST_TEST_EQ(m.key_storage_size(), live);
+   m.clear();
+   BOOST_TEST(m.empty());
+   BOOST_TEST(m != c);
+   m.swap(c);
+   BOOST_TEST(check_equal(m, ref));
+}
+
+void test_interface()
+{
+   flat_string_map<int> m;
+   m["beta"] = 2;
+   m[std::string("alpha")] = 1;
+   m[string("gamma")] = 3;
+   BOOST_TEST(m.emplace("delta", 4).second);
+   BOOST_TEST(!m.emplace("delta", 5).second);
+   BOOST_TEST(m.insert(std::make_pair("epsilon", 5)).second);
+   BOOST_TEST_EQ(m.size(), 5u);
+   BOOST_TEST_EQ(m.at("delta"), 4);
+   BOOST_TEST_THROWS(m.at("omega"), boost::container::out_of_range);
+   BOOST_TEST_EQ(m.count(flat_string_key("alphabet", 5u)), 1u);
+   BOOST_TEST(m.begin()->first == "alpha");
+   BOOST_TEST((--m.end())->first == "gamma");
+   BOOST_TEST(m.rbegin()->first == "gamma");
+   BOOST_TEST(m.crbegin().base() == m.cend());
+   BOOST_TEST(m.equal_range("beta").first->second == 2);
+   BOOST_TEST(m.equal_range("beta").second->first == "delta");
+   BOOST_TEST(m.lower_bound("c")->first == "delta");
+   BOOST_TEST(m.upper_bound("zeta") == m.end());
+   //Iterators
+   flat_string_map<int>::iterator it = m.begin();
+   (*it).second = 10;
+   it[1].second = 20;
+   BOOST_TEST_EQ(m["alpha"], 10);
+   BOOST_TEST_EQ(m["beta"], 20);
+   flat_string_map<int>::const_iterator cit = it;
+   BOOST_TEST(cit == m.cbegin());
+   BOOST_TEST(m.cend() - cit == 5);
+   BOOST_TEST(cit + 5 == m.cend());
+   BOOST_TEST(cit < m.cend());
+   //Keys
+   const flat_string_key k = m.nth(1).key();
+   BOOST_TEST(k == "beta" && k.size() == 4u && k[1] == 'e');
+   BOOST_TEST(k.str() == "beta");
+   BOOST_TEST(k < flat_string_key("betb"));
+   BOOST_TEST(flat_string_key("b") < k);
+   BOOST_TEST(flat_string_key("\x80") > flat_string_key("a"));
+   std::ostringstream os;
+   os << k;
+   BOOST_TEST(os.str() == "beta");
+   //Empty key
+   m[""] = 0;
+   BOOST_TEST(m.begin()->first.empty());
+   BOOST_TEST_EQ(m.erase(""), 1u);
+   BOOST_TEST_EQ(m.erase(""), 0u);
+   BOOST_TEST(m.erase(m.begin())->first == "beta");
+   //Range constructor
+   const std::pair<const char*, int> init[] = { std::make_pair("x", 1), std::make_pair("y", 2), std::make_pair("x", 3) };
+   const flat_string_map<int> r(&init[0], &init[0] + 3);
+   BOOST_TEST_EQ(r.size(), 2u);
+   BOOST_TEST_EQ(r.at("x"), 1);
+}
+
+void test_stored_size()
+{
+   typedef flat_string_map<int, void, flat_string_map_options<stored_size<unsigned char> >::type> tiny_map;
+   tiny_map m;
+   //Up to 255 characters, including terminators
+   m[std::string(200u, 'a')] = 1;
+   BOOST_TEST_THROWS(m[std::string(60u, 'b')] = 2, boost::container::length_error);
+   BOOST_TEST_EQ(m.size(), 1u);
+   BOOST_TEST_EQ(m.key_storage_size(), 201u);
+   m[std::string(50u, 'b')] = 2;
+   BOOST_TEST_EQ(m.size(), 2u);
+}
+
+void test_allocations()
+{
+   statistics_observer obs;
+   {
+      typedef flat_string_map<int, instrumented_allocator<char> > inst_map;
+      inst_map m((instrumented_allocator<char>(obs)));
+      m.reserve(10000u, 10000u*16u);
+      const std::size_t allocs = obs.statistics().allocations;
+      char buf[32];
+      for(int i = 0; i != 10000; ++i){
+         std::sprintf(buf, "key%011d", (i*7919) % 10000);
+         m[buf] = i;
+      }
+      //Keys don't allocate
+      BOOST_TEST_EQ(obs.statistics().allocations, allocs);
+      BOOST_TEST_EQ(m.key_storage_size(), 10000u*15u);
+   }
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 0u);
+}
+
+int main()
+{
+   test_random_operations<flat_string_map<int> >(flat_string_map<int>::allocator_type());
+   statistics_observer obs;
+   test_random_operations<flat_string_map<int, instrumented_allocator<char> > >(instrumented_allocator<char>(obs));
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 0u);
+   test_random_operations<flat_string_map<int, void, flat_string_map_options<stored_size<unsigned> >::type> >
+      (flat_string_map<int>::allocator_type());
+   test_interface();
+   test_stored_size();
+   test_allocations();
+   return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+   return boost::report_errors();
+}
+
+#endif
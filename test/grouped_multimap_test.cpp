@@ -0,0 +1,193 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/grouped_multimap.hpp>
+#include <boost/container/pmr/grouped_multimap.hpp>
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+#include <boost/container/map.hpp>
+#include <boost/container/allocator.hpp>
+#include <boost/container/detail/type_traits.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include "movable_int.hpp"
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class grouped_multimap
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   >;
+
+template class grouped_multimap
+   < int
+   , int
+   , std::less<int>
+   , allocator<std::pair<const int, int> >
+   >;
+
+}} //boost::container
+
+using namespace boost::container;
+
+typedef grouped_multimap<int, int> gmap_t;
+
+void test_insert_and_lookup()
+{
+   gmap_t m;
+   BOOST_TEST(m.empty());
+   BOOST_TEST_EQ(m.size(), 0u);
+   BOOST_TEST_EQ(m.key_count(), 0u);
+
+   //Insert interleaved keys, each key gets 10 values
+   for(int i = 0; i != 10; ++i){
+      for(int k = 0; k != 5; ++k){
+         gmap_t::mapped_iterator it = m.insert(gmap_t::value_type(k, k*100 + i));
+         BOOST_TEST_EQ(*it, k*100 + i);
+      }
+   }
+   BOOST_TEST_EQ(m.size(), 50u);
+   BOOST_TEST_EQ(m.key_count(), 5u);
+   BOOST_TEST_EQ(m.count(3), 10u);
+   BOOST_TEST_EQ(m.count(7), 0u);
+   BOOST_TEST(m.contains(4));
+   BOOST_TEST(!m.contains(5));
+
+   //Groups are ordered by key, values in insertion order
+   int expected_key = 0;
+   for(gmap_t::const_iterator it = m.cbegin(); it != m.cend(); ++it, ++expected_key){
+      BOOST_TEST_EQ(it->first, expected_key);
+      BOOST_TEST_EQ(it->second.size(), 10u);
+      for(std::size_t i = 0; i != it->second.size(); ++i){
+         BOOST_TEST_EQ(it->second[i], expected_key*100 + int(i));
+      }
+   }
+
+   //equal_range is contiguous
+   std::pair<gmap_t::mapped_iterator, gmap_t::mapped_iterator> r = m.equal_range(2);
+   BOOST_TEST_EQ(r.second - r.first, 10);
+   BOOST_TEST_EQ(&*r.first + 9, &*(r.second - 1));
+   *r.first = -1;
+   BOOST_TEST_EQ(m.find(2)->second.front(), -1);
+
+   const gmap_t &cm = m;
+   std::pair<gmap_t::const_mapped_iterator, gmap_t::const_mapped_iterator> cr = cm.equal_range(9);
+   BOOST_TEST(cr.first == cr.second);
+
+   BOOST_TEST(m.lower_bound(2) == m.find(2));
+   BOOST_TEST(m.upper_bound(2) == m.find(3));
+   BOOST_TEST(m.upper_bound(4) == m.end());
+}
+
+void test_erase()
+{
+   gmap_t m;
+   for(int i = 0; i != 20; ++i){
+      m.emplace(i % 4, i);
+   }
+   BOOST_TEST_EQ(m.size(), 20u);
+
+   BOOST_TEST_EQ(m.erase(1), 5u);
+   BOOST_TEST_EQ(m.erase(1), 0u);
+   BOOST_TEST_EQ(m.size(), 15u);
+   BOOST_TEST_EQ(m.key_count(), 3u);
+
+   //Erase single mapped values, the group is erased when it becomes empty
+   gmap_t::iterator g = m.find(2);
+   while(!g->second.empty() && g->second.size() > 1u){
+      g = m.erase(g, g->second.begin());
+      BOOST_TEST_EQ(g->first, 2);
+   }
+   BOOST_TEST_EQ(m.count(2), 1u);
+   BOOST_TEST_EQ(g->second.front(), 18);
+   g = m.erase(g, g->second.begin());
+   BOOST_TEST(!m.contains(2));
+   BOOST_TEST_EQ(g->first, 3);
+   BOOST_TEST_EQ(m.size(), 10u);
+
+   g = m.erase(g);
+   BOOST_TEST(g == m.end());
+   BOOST_TEST_EQ(m.size(), 5u);
+   BOOST_TEST_EQ(m.key_count(), 1u);
+
+   m.clear();
+   BOOST_TEST(m.empty());
+   BOOST_TEST_EQ(m.key_count(), 0u);
+}
+
+void test_copy_move_compare()
+{
+   gmap_t m;
+   m.insert(1, 10);
+   m.insert(1, 11);
+   m.insert(2, 20);
+
+   gmap_t c(m);
+   BOOST_TEST(c == m);
+   c.insert(2, 21);
+   BOOST_TEST(c != m);
+   BOOST_TEST(m < c);
+
+   gmap_t mv(boost::move(c));
+   BOOST_TEST(c.empty());
+   BOOST_TEST_EQ(mv.size(), 4u);
+
+   c = mv;
+   BOOST_TEST(c == mv);
+   m = boost::move(mv);
+   BOOST_TEST(mv.empty());
+   BOOST_TEST(m == c);
+
+   m.swap(mv);
+   BOOST_TEST(m.empty());
+   BOOST_TEST_EQ(mv.size(), 4u);
+
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   gmap_t il = { {3, 1}, {1, 2}, {3, 3} };
+   BOOST_TEST_EQ(il.size(), 3u);
+   BOOST_TEST_EQ(il.key_count(), 2u);
+   BOOST_TEST_EQ(il.find(3)->second.back(), 3);
+   #endif
+
+   //Range construction from a multimap
+   multimap<int, int> mm;
+   mm.emplace(5, 1);
+   mm.emplace(5, 2);
+   mm.emplace(6, 3);
+   gmap_t fm(mm.begin(), mm.end());
+   BOOST_TEST_EQ(fm.size(), mm.size());
+   BOOST_TEST_EQ(fm.count(5), mm.count(5));
+   fm.shrink_to_fit();
+   BOOST_TEST_EQ(fm.find(5)->second.capacity(), 2u);
+}
+
+void test_pmr()
+{
+   BOOST_CONTAINER_STATIC_ASSERT(( dtl::is_same
+      < grouped_multimap<int, float, std::less<int>, pmr::polymorphic_allocator<std::pair<const int, float> > >
+      , pmr::grouped_multimap_of<int, float>::type >::value ));
+
+   char buffer[4096];
+   pmr::monotonic_buffer_resource mr(buffer, sizeof(buffer));
+   pmr::grouped_multimap_of<int, int>::type m(&mr);
+   m.insert(1, 1);
+   m.insert(1, 2);
+   //Mapped value sequences must use the same resource as the container
+   BOOST_TEST(m.find(1)->second.get_allocator().resource() == &mr);
+}
+
+int main()
+{
+   test_insert_and_lookup();
+   test_erase();
+   test_copy_move_compare();
+   test_pmr();
+   return boost::report_errors();
+}
@@ -16,6 +16,11 @@ int main() { return 0; }
 #include <algorithm>
 #include <boost/config.hpp>
 #include <boost/config/workaround.hpp>
+#include <boost/container/experimental/segmented_count.hpp>
+#include <boost/container/experimental/segmented_fill.hpp>
+#include <boost/container/experimental/segmented_find.hpp>
+#include <boost/container/experimental/segmented_find_last.hpp>
+#include <boost/container/experimental/segmented_reverse.hpp>
 #include <boost/container/hub.hpp>
 #include <boost/container/pmr/hub.hpp>
 #include <boost/container/throw_exception.hpp>
@@ -153,6 +158,56 @@ void test_global_erase(const R& rng, const typename Hub::allocator_type& al)
   BOOST_TEST_EQ(x.size(), s - n);
 }
 
+template<typename Hub>
+void test_segmented_algorithms()
+{
+  using iterator = typename Hub::iterator;
+  using traits = boost::container::segmented_iterator_traits<iterator>;
+  using const_traits =
+    boost::container::segmented_iterator_traits<typename Hub::const_iterator>;
+  BOOST_TEST(traits::is_segmented_iterator::value);
+  BOOST_TEST(const_traits::is_segmented_iterator::value);
+
+  /* sparse blocks */
+  Hub                   x;
+  std::vector<iterator> its;
+  for(int i = 0; i < 1000; ++i) its.push_back(x.insert(i % 7));
+  for(int i = 0; i < 1000; i += 3) x.erase(its[(std::size_t)i]);
+  std::vector<int> data(x.begin(), x.end());
+
+  auto first = std::next(x.begin(), 10), last = std::next(x.begin(), 500);
+  BOOST_TEST(traits::compose(traits::segment(first), traits::local(first)) == first);
+  BOOST_TEST(traits::segment(first) != traits::segment(last));
+  for(int v = 0; v < 8; ++v) {
+    BOOST_TEST_EQ(
+      boost::container::segmented_count(x.begin(), x.end(), v),
+      std::count(data.begin(), data.end(), v));
+    BOOST_TEST_EQ(
+      boost::container::segmented_count(first, last, v),
+      std::count(first, last, v));
+    BOOST_TEST(
+      boost::container::segmented_find(x.cbegin(), x.cend(), v) ==
+      std::find(x.cbegin(), x.cend(), v));
+    BOOST_TEST(
+      boost::container::segmented_find_last(x.begin(), x.end(), v) ==
+      std::find_end(x.begin(), x.end(), &v, &v + 1));
+  }
+
+  boost::container::segmented_reverse(x.begin(), x.end());
+  std::reverse(data.begin(), data.end());
+  test_traversal(x.begin(), x.end(), data);
+
+  boost::container::segmented_fill(first, last, 42);
+  std::fill(
+    std::next(data.begin(), 10), std::next(data.begin(), 500), 42);
+  test_traversal(x.begin(), x.end(), data);
+
+  Hub empty;
+  BOOST_TEST(
+    boost::container::segmented_find(empty.begin(), empty.end(), 0) ==
+    empty.end());
+}
+
 template<typename T> void avoid_unused_local_typedef() {}
 
 template<typename Hub>
@@ -783,6 +838,8 @@ int main()
 
   test_ctad<boost::container::hub>();
 
+  test_segmented_algorithms<boost::container::hub<int>>();
+
   return boost::report_errors();
 }
 
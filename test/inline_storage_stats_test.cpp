@@ -0,0 +1,137 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#define BOOST_CONTAINER_INLINE_STORAGE_STATS
+#include <boost/container/small_vector.hpp>
+#include <boost/container/string.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdio>
+
+using namespace boost::container;
+
+void test_buckets()
+{
+   typedef inline_storage_stats stats_t;
+   BOOST_TEST_EQ(stats_t::bucket(0u), 0u);
+   BOOST_TEST_EQ(stats_t::bucket(31u), 31u);
+   BOOST_TEST_EQ(stats_t::bucket(32u), 32u);
+   BOOST_TEST_EQ(stats_t::bucket(63u), 32u);
+   BOOST_TEST_EQ(stats_t::bucket(64u), 33u);
+   BOOST_TEST_EQ(stats_t::bucket(std::size_t(-1)), stats_t::buckets - 1u);
+   for(std::size_t b = 0u; b != stats_t::buckets; ++b){
+      BOOST_TEST_EQ(stats_t::bucket(stats_t::bucket_min(b)), b);
+      BOOST_TEST_EQ(stats_t::bucket(stats_t::bucket_max(b)), b);
+   }
+   BOOST_TEST_EQ(stats_t::bucket_max(stats_t::buckets - 1u), std::size_t(-1));
+}
+
+void test_small_vector()
+{
+   typedef small_vector<int, 4> vector_t;
+   inline_storage_stats &stats = vector_t::storage_stats();
+   BOOST_TEST_EQ(stats.inline_capacity(), 4u);
+   BOOST_TEST_EQ(stats.containers(), 0u);
+   {
+      vector_t v;
+      v.push_back(1);
+      v.push_back(2);
+      v.push_back(3);
+   }
+   BOOST_TEST_EQ(stats.containers(), 1u);
+   BOOST_TEST_EQ(stats.spills(), 0u);
+   BOOST_TEST_EQ(stats.bucket_count(3u), 1u);
+   {
+      //The maximum is recorded even if elements are erased
+      vector_t v(10u, 1);
+      v.pop_back();
+      v.erase(v.begin());
+      v.clear();
+   }
+   BOOST_TEST_EQ(stats.containers(), 2u);
+   BOOST_TEST_EQ(stats.spills(), 1u);
+   BOOST_TEST_EQ(stats.bucket_count(10u), 1u);
+   {
+      //Moved-from and swapped containers keep their own maximum
+      vector_t a(6u, 1), b(2u, 1);
+      a.swap(b);
+      vector_t c(boost::move(b));
+      a.push_back(1);
+   }
+   BOOST_TEST_EQ(stats.containers(), 5u);
+   BOOST_TEST_EQ(stats.spills(), 4u);
+   BOOST_TEST_EQ(stats.bucket_count(6u), 3u);
+   BOOST_TEST_EQ(stats.containers_fitting(4u), 1u);
+   BOOST_TEST_EQ(stats.containers_fitting(10u), 5u);
+
+   stats.reset();
+   BOOST_TEST_EQ(stats.containers(), 0u);
+   BOOST_TEST_EQ(stats.bucket_count(6u), 0u);
+
+   //Other instantiations have their own statistics
+   {
+      small_vector<int, 8> v(5u, 1);
+   }
+   BOOST_TEST_EQ((small_vector<int, 8>::storage_stats().spills()), 0u);
+   BOOST_TEST_EQ(stats.containers(), 0u);
+}
+
+void test_string()
+{
+   inline_storage_stats &stats = string::storage_stats();
+   const std::size_t inline_cap = stats.inline_capacity();
+   BOOST_TEST_EQ(inline_cap, string().capacity());
+   stats.reset();
+   {
+      string s("abc");
+      s.append(2u, 'd');
+      s.erase(1u, 3u);
+   }
+   BOOST_TEST_EQ(stats.containers(), 1u);
+   BOOST_TEST_EQ(stats.spills(), 0u);
+   BOOST_TEST_EQ(stats.bucket_count(5u), 1u);
+   {
+      string s(inline_cap + 1u, 'a');
+      s.clear();
+      s.shrink_to_fit();
+      string t;
+      t.swap(s);
+   }
+   BOOST_TEST_EQ(stats.containers(), 3u);
+   BOOST_TEST_EQ(stats.spills(), 1u);
+   BOOST_TEST_EQ(stats.bucket_count(inline_storage_stats::bucket(inline_cap + 1u)), 1u);
+   BOOST_TEST_EQ(stats.bucket_count(0u), 1u);
+}
+
+void test_registry()
+{
+   bool found_vector = false, found_string = false;
+   for(const inline_storage_stats *s = inline_storage_stats::first(); s; s = s->next()){
+      found_vector = found_vector || s == &small_vector<int, 4>::storage_stats();
+      found_string = found_string || s == &string::storage_stats();
+      BOOST_TEST(s->name() != 0);
+   }
+   BOOST_TEST(found_vector);
+   BOOST_TEST(found_string);
+
+   std::FILE *f = std::tmpfile();
+   if(f){
+      inline_storage_stats::print_all(f);
+      BOOST_TEST(std::ftell(f) > 0);
+      std::fclose(f);
+   }
+}
+
+int main()
+{
+   test_buckets();
+   test_small_vector();
+   test_string();
+   test_registry();
+   return boost::report_errors();
+}
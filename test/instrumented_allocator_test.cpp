@@ -0,0 +1,284 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/instrumented_allocator.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/container/devector.hpp>
+#include <boost/container/deque.hpp>
+#include <boost/container/small_vector.hpp>
+#include <boost/container/string.hpp>
+#include <boost/container/map.hpp>
+#include <boost/container/flat_map.hpp>
+#include <boost/container/hub.hpp>
+#include <boost/container/allocator.hpp>
+#include <boost/container/options.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <functional>
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class instrumented_allocator<int>;
+template class instrumented_allocator<int, std::allocator<int> >;
+template class vector<int, instrumented_allocator<int> >;
+
+}} //boost::container
+
+using namespace boost::container;
+
+//Returns much more memory than requested from allocate_at_least
+template<class T>
+class generous_allocator
+   : public new_allocator<T>
+{
+   public:
+   template<class T2>
+   struct rebind
+   {  typedef generous_allocator<T2> other;  };
+
+   generous_allocator()
+   {}
+
+   template<class T2>
+   generous_allocator(const generous_allocator<T2> &)
+   {}
+
+   allocation_result<T*, std::size_t> allocate_at_least(std::size_t n)
+   {
+      allocation_result<T*, std::size_t> r = { this->allocate(n + 1000u), n + 1000u };
+      return r;
+   }
+};
+
+void test_observer_sharing()
+{
+   statistics_observer obs;
+   instrumented_allocator<int> a(obs);
+   BOOST_TEST(a.observer() == &obs);
+
+   instrumented_allocator<char> c(a);
+   BOOST_TEST(c.observer() == &obs);
+   BOOST_TEST(instrumented_allocator<int>(c) == a);
+   BOOST_TEST(instrumented_allocator<int>() != a);
+   BOOST_TEST(allocator_traits< instrumented_allocator<int> >
+      ::select_on_container_copy_construction(a) == a);
+
+   int *p = a.allocate(10u);
+   char *q = c.allocate(3u);
+   BOOST_TEST_EQ(obs.statistics().allocations, 2u);
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 10u*sizeof(int) + 3u);
+   c.deallocate(q, 3u);
+   a.deallocate(p, 10u);
+   BOOST_TEST_EQ(obs.statistics().deallocations, 2u);
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 0u);
+   BOOST_TEST_EQ(obs.statistics().peak_live_bytes, 10u*sizeof(int) + 3u);
+
+   //allocate_at_least reports the real size of the allocation
+   allocation_result<int*, std::size_t> r = a.allocate_at_least(5u);
+   BOOST_TEST(r.count >= 5u);
+   BOOST_TEST_EQ(obs.statistics().live_bytes, r.count*sizeof(int));
+   a.deallocate(r.ptr, r.count);
+
+   obs.reset();
+   BOOST_TEST_EQ(obs.statistics().allocations, 0u);
+   BOOST_TEST_EQ(obs.statistics().peak_live_bytes, 0u);
+
+   //Without observer nothing is reported
+   instrumented_allocator<int> n;
+   n.deallocate(n.allocate(1u), 1u);
+   BOOST_TEST(n.observer() == 0);
+}
+
+template<class Vector>
+void test_growing_sequence()
+{
+   statistics_observer obs;
+   {
+      typename Vector::allocator_type a(obs);
+      Vector v(a);
+      for(int i = 0; i != 1000; ++i)
+         v.push_back(i);
+      const allocation_statistics &s = obs.statistics();
+      BOOST_TEST(s.reallocations > 0u);
+      //Each reallocation (but the first allocation) moves the previous buffer
+      BOOST_TEST_EQ(s.reallocations + 1u, s.allocations);
+      BOOST_TEST_EQ(s.allocations, s.deallocations + 1u);
+      BOOST_TEST(s.bytes_relocated >= 500u*sizeof(int));
+      BOOST_TEST(s.bytes_relocated < 3000u*sizeof(int));
+      BOOST_TEST(s.peak_live_bytes >= s.live_bytes);
+
+      //reserve relocates the current elements
+      const std::size_t relocs = s.reallocations;
+      v.reserve(v.capacity()*2u);
+      BOOST_TEST_EQ(s.reallocations, relocs + 1u);
+
+      //reserve without growth doesn't reallocate
+      v.reserve(1u);
+      BOOST_TEST_EQ(s.reallocations, relocs + 1u);
+
+      //shrink_to_fit is not a relocation due to growth
+      const std::size_t allocs = s.allocations;
+      v.shrink_to_fit();
+      BOOST_TEST_EQ(s.allocations, allocs + 1u);
+      BOOST_TEST_EQ(s.reallocations, relocs + 1u);
+   }
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 0u);
+   BOOST_TEST_EQ(obs.statistics().allocations, obs.statistics().deallocations);
+}
+
+void test_small_vector()
+{
+   typedef instrumented_allocator<int> alloc_t;
+   statistics_observer obs;
+   {
+      small_vector<int, 10, alloc_t> v((alloc_t(obs)));
+      for(int i = 0; i != 10; ++i)
+         v.push_back(i);
+      BOOST_TEST_EQ(obs.statistics().allocations, 0u);
+      //Moving elements from the internal to dynamic storage is a relocation
+      v.push_back(10);
+      BOOST_TEST_EQ(obs.statistics().allocations, 1u);
+      BOOST_TEST_EQ(obs.statistics().reallocations, 1u);
+      BOOST_TEST_EQ(obs.statistics().bytes_relocated, 10u*sizeof(int));
+      v.resize(100u);
+      BOOST_TEST_EQ(obs.statistics().reallocations, 2u);
+   }
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 0u);
+}
+
+void test_string()
+{
+   typedef basic_string<char, std::char_traits<char>, instrumented_allocator<char> > string_t;
+   statistics_observer obs;
+   {
+      string_t s((instrumented_allocator<char>(obs)));
+      s.append(8u, 'a');
+      for(int i = 0; i != 100; ++i)
+         s.append(10u, 'b');
+      const allocation_statistics &st = obs.statistics();
+      BOOST_TEST(st.allocations > 1u);
+      BOOST_TEST(st.reallocations > 0u);
+      BOOST_TEST(st.reallocations < st.allocations);
+      BOOST_TEST(st.bytes_relocated > 0u);
+   }
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 0u);
+}
+
+void test_deque()
+{
+   typedef instrumented_allocator<int> alloc_t;
+   statistics_observer obs;
+   {
+      deque<int, alloc_t> d((alloc_t(obs)));
+      for(int i = 0; i != 100000; ++i)
+         d.push_back(i);
+      //Blocks are never relocated, but the map of blocks is
+      BOOST_TEST(obs.statistics().allocations > 1u);
+      BOOST_TEST(obs.statistics().reallocations > 0u);
+      BOOST_TEST(obs.statistics().bytes_relocated > 0u);
+      BOOST_TEST(obs.statistics().bytes_relocated < 100000u);
+   }
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 0u);
+}
+
+void test_stored_size()
+{
+   //The received size is not representable by the stored size type, so live bytes
+   //are correct only if the allocation is deallocated with the same size
+   typedef instrumented_allocator<int, generous_allocator<int> > alloc_t;
+   typedef vector_options<stored_size<unsigned char> >::type vector_opt_t;
+   typedef devector_options<stored_size<unsigned char> >::type devector_opt_t;
+   statistics_observer obs;
+   {
+      vector<int, alloc_t, vector_opt_t> v((alloc_t(obs)));
+      v.reserve(100u);
+      BOOST_TEST_EQ(v.capacity(), 100u);
+      v.push_back(1);
+      devector<int, alloc_t, devector_opt_t> d((alloc_t(obs)));
+      d.reserve(100u);
+      BOOST_TEST(d.capacity() <= 255u);
+      //Storage that can be fully used is kept
+      vector<int, alloc_t> v2((alloc_t(obs)));
+      v2.reserve(1u);
+      BOOST_TEST_EQ(v2.capacity(), 1001u);
+   }
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 0u);
+}
+
+void test_version_2()
+{
+   typedef instrumented_allocator<int, allocator<int, 2> > alloc_t;
+   BOOST_CONTAINER_STATIC_ASSERT((dtl::version<alloc_t>::value == 2u));
+   statistics_observer obs;
+   {
+      vector<int, alloc_t> v((alloc_t(obs)));
+      for(int i = 0; i != 10000; ++i)
+         v.push_back(i);
+      const allocation_statistics &s = obs.statistics();
+      //Buffers expanded in place are not relocations
+      BOOST_TEST_EQ(s.reallocations + 1u, s.allocations);
+      BOOST_TEST_EQ(s.live_bytes, v.capacity()*sizeof(int));
+      v.resize(10u);
+      v.shrink_to_fit();
+      BOOST_TEST(s.in_place_resizes > 0u);
+      BOOST_TEST_EQ(s.live_bytes, v.capacity()*sizeof(int));
+   }
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 0u);
+   BOOST_TEST_EQ(obs.statistics().allocations, obs.statistics().deallocations);
+}
+
+template<class Container>
+void test_node_container()
+{
+   statistics_observer obs;
+   {
+      typename Container::allocator_type a(obs);
+      Container c(a);
+      for(int i = 0; i != 100; ++i)
+         c.insert(typename Container::value_type(i, i));
+      BOOST_TEST(obs.statistics().allocations > 0u);
+      BOOST_TEST(obs.statistics().live_bytes > 0u);
+      c.clear();
+   }
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 0u);
+   BOOST_TEST_EQ(obs.statistics().allocations, obs.statistics().deallocations);
+}
+
+void test_hub()
+{
+   typedef instrumented_allocator<int> alloc_t;
+   statistics_observer obs;
+   {
+      hub<int, alloc_t> h((alloc_t(obs)));
+      for(int i = 0; i != 1000; ++i)
+         h.insert(i);
+      BOOST_TEST(obs.statistics().allocations > 0u);
+      BOOST_TEST_EQ(obs.statistics().reallocations, 0u);
+   }
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 0u);
+}
+
+int main()
+{
+   test_observer_sharing();
+   test_growing_sequence< vector<int, instrumented_allocator<int> > >();
+   test_growing_sequence< devector<int, instrumented_allocator<int> > >();
+   test_small_vector();
+   test_string();
+   test_deque();
+   test_node_container< map<int, int, std::less<int>, instrumented_allocator<std::pair<const int, int> > > >();
+   test_node_container< flat_map<int, int, std::less<int>, instrumented_allocator<std::pair<int, int> > > >();
+   test_node_container< map<int, int, std::less<int>
+      , instrumented_allocator<std::pair<const int, int>, allocator<std::pair<const int, int>, 2> > > >();
+   test_stored_size();
+   test_version_2();
+   test_hub();
+   return boost::report_errors();
+}
@@ -0,0 +1,203 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC) && !defined(BOOST_NO_CXX11_HDR_THREAD) && !defined(BOOST_NO_CXX11_LAMBDAS)
+
+#include <boost/container/interned_string.hpp>
+#include <boost/container/pmr/interned_string.hpp>
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+#include <boost/container/instrumented_allocator.hpp>
+#include <boost/container/flat_map.hpp>
+#include <cstdio>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class basic_interned_string<char>;
+template class basic_interned_string<wchar_t>;
+template class basic_intern_table<char>;
+template class basic_intern_table<wchar_t, std::char_traits<wchar_t>, std::allocator<wchar_t> >;
+
+}} //boost::container
+
+using namespace boost::container;
+
+template<class CharT, class Traits>
+struct test_string_view
+{
+   test_string_view(const CharT *d, std::size_t n) : m_d(d), m_n(n) {}
+   const CharT *data() const { return m_d; }
+   std::size_t size() const { return m_n; }
+   const CharT *m_d;
+   std::size_t m_n;
+};
+
+std::string make_key(std::size_t i)
+{
+   char buf[32];
+   std::sprintf(buf, "key/%u", unsigned(i));
+   return buf;
+}
+
+void test_basic()
+{
+   intern_table t;
+   BOOST_TEST(t.empty());
+   const interned_string a = t.intern("alpha");
+   const interned_string b = t.intern(string("beta"));
+   const interned_string a2 = t.intern("alphabet", 5u);
+   BOOST_TEST(a == a2);
+   BOOST_TEST(a != b);
+   BOOST_TEST(a.c_str() == a2.c_str());
+   BOOST_TEST_EQ(t.size(), 2u);
+   BOOST_TEST_EQ(a.size(), 5u);
+   BOOST_TEST(a == "alpha");
+   BOOST_TEST("beta" == b);
+   BOOST_TEST(a != "alph");
+   BOOST_TEST_EQ(a.c_str()[5], '\0');
+   BOOST_TEST_EQ(a[1], 'l');
+   BOOST_TEST(a.str() == "alpha");
+   BOOST_TEST(std::string(a.begin(), a.end()) == "alpha");
+   BOOST_TEST_EQ(a.hash(), a2.hash());
+   BOOST_TEST_EQ(hash_value(a), a.hash());
+   BOOST_TEST(a < b);
+   BOOST_TEST(b > a);
+   BOOST_TEST(a <= a2 && a >= a2);
+   BOOST_TEST_EQ(a.compare(b), string("alpha").compare("beta"));
+
+   //The empty string is the default constructed handle
+   const interned_string e = t.intern("");
+   BOOST_TEST(e == interned_string());
+   BOOST_TEST(e.empty());
+   BOOST_TEST_EQ(e.size(), 0u);
+   BOOST_TEST_EQ(*e.c_str(), '\0');
+   BOOST_TEST(e < a);
+   BOOST_TEST_EQ(t.size(), 2u);
+
+   //Lookups
+   BOOST_TEST(t.find("alpha") == a);
+   BOOST_TEST(t.find("gamma").empty());
+   BOOST_TEST_EQ(t.size(), 2u);
+
+   //Interoperability
+   const test_string_view<char, std::char_traits<char> > sv = a;
+   BOOST_TEST(sv.data() == a.data() && sv.size() == 5u);
+   BOOST_TEST(t.intern(test_string_view<char, std::char_traits<char> >("beta", 4u)) == b);
+   std::ostringstream os;
+   os << a << '/' << b;
+   BOOST_TEST(os.str() == "alpha/beta");
+
+   //Handles as keys of a flat_map
+   flat_map<interned_string, int> m;
+   m[b] = 2;
+   m[a] = 1;
+   BOOST_TEST_EQ(m[t.intern("alpha")], 1);
+   BOOST_TEST(m.begin()->first == a);
+}
+
+void test_many_strings()
+{
+   statistics_observer obs;
+   {
+      basic_intern_table<char, std::char_traits<char>, instrumented_allocator<char> > t((instrumented_allocator<char>(obs)));
+      std::vector<interned_string> v;
+      //Short strings share blocks, long strings get their own
+      const std::string long_str(5000u, 'L');
+      for(std::size_t i = 0; i != 20000u; ++i){
+         v.push_back(t.intern(make_key(i)));
+         if(i % 1000u == 0u){
+            v.push_back(t.intern(long_str + make_key(i)));
+         }
+      }
+      BOOST_TEST_EQ(t.size(), v.size());
+      std::size_t j = 0;
+      for(std::size_t i = 0; i != 20000u; ++i, ++j){
+         BOOST_TEST(v[j] == make_key(i).c_str());
+         BOOST_TEST(t.intern(make_key(i)) == v[j]);
+         if(i % 1000u == 0u){
+            ++j;
+            BOOST_TEST(v[j].str() == (long_str + make_key(i)).c_str());
+            BOOST_TEST(t.find((long_str + make_key(i)).c_str()) == v[j]);
+         }
+      }
+      //Interning again does not allocate
+      const std::size_t allocs = obs.statistics().allocations;
+      for(std::size_t i = 0; i != 20000u; ++i){
+         t.intern(make_key(i));
+      }
+      BOOST_TEST_EQ(obs.statistics().allocations, allocs);
+      BOOST_TEST_EQ(t.size(), v.size());
+   }
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 0u);
+}
+
+void test_pmr()
+{
+   char buffer[16384];
+   pmr::monotonic_buffer_resource mr(buffer, sizeof(buffer));
+   pmr::intern_table t(&mr);
+   BOOST_TEST(t.get_allocator().resource() == &mr);
+   const interned_string a = t.intern("pmr");
+   BOOST_TEST(a == t.intern("pmr"));
+   BOOST_TEST(a.data() >= buffer && a.data() < buffer + sizeof(buffer));
+}
+
+void test_concurrent_interning()
+{
+   intern_table t;
+   t.reserve(100u);
+   const std::size_t n = 4000u;
+   std::vector<interned_string> results[4];
+   std::vector<std::thread> threads;
+   for(std::size_t th = 0; th != 4u; ++th){
+      threads.push_back(std::thread([&t, &results, th, n]{
+         //Each thread interns the same vocabulary in a different order
+         for(std::size_t i = 0; i != n; ++i){
+            const std::size_t k = (i*(2u*th + 1u)) % n;
+            results[th].push_back(t.intern(make_key(k)));
+         }
+      }));
+   }
+   for(std::size_t th = 0; th != 4u; ++th){
+      threads[th].join();
+   }
+   BOOST_TEST_EQ(t.size(), n);
+   for(std::size_t th = 0; th != 4u; ++th){
+      for(std::size_t i = 0; i != n; ++i){
+         const std::size_t k = (i*(2u*th + 1u)) % n;
+         BOOST_TEST(results[th][i] == t.find(make_key(k).c_str()));
+         BOOST_TEST(results[th][i] == make_key(k).c_str());
+      }
+   }
+}
+
+int main()
+{
+   test_basic();
+   test_many_strings();
+   test_pmr();
+   test_concurrent_interning();
+   return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+   return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,366 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_HAS_UNISTD_H)
+
+#include <boost/container/mmap_allocator.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/container/string.hpp>
+#include <boost/container/instrumented_allocator.hpp>
+#include <unistd.h>
+#include <sys/mman.h>
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class mmap_allocator<int>;
+template class vector<int, mmap_allocator<int> >;
+
+}} //boost::container
+
+using namespace boost::container;
+
+typedef mmap_allocator<int> alloc_t;
+
+std::size_t page_size()
+{  return std::size_t(::sysconf(_SC_PAGESIZE));  }
+
+void test_allocator()
+{
+   BOOST_CONTAINER_STATIC_ASSERT(( dtl::version<alloc_t>::value == 2 ));
+   alloc_t a;
+
+   //Capacities are page-granular
+   allocation_result<int*> r = a.allocate_at_least(1u);
+   BOOST_TEST(r.count >= 1u);
+   BOOST_TEST(r.count*sizeof(int) <= page_size());
+   //The whole page but the small bookkeeping header is usable
+   BOOST_TEST((r.count + 1u)*sizeof(int) + 64u > page_size());
+   BOOST_TEST_EQ(a.size(r.ptr), r.count);
+   for(std::size_t i = 0; i != r.count; ++i){
+      r.ptr[i] = int(i);
+   }
+
+   //Forward expansion either grows in place keeping the contents or fails without side effects
+   std::size_t recvd = r.count*4u;
+   int *reuse = r.ptr;
+   int *const e = a.allocation_command(expand_fwd | nothrow_allocation, r.count + 1u, recvd, reuse);
+   if(e){
+      BOOST_TEST(e == r.ptr);
+      BOOST_TEST(recvd >= r.count + 1u);
+      BOOST_TEST_EQ(a.size(e), recvd);
+      for(std::size_t i = 0; i != r.count; ++i){
+         BOOST_TEST_EQ(e[i], int(i));
+      }
+      e[recvd - 1u] = -1;
+   }
+   else{
+      BOOST_TEST_EQ(a.size(r.ptr), r.count);
+   }
+   const std::size_t cap = a.size(r.ptr);
+
+   //Shrink in place
+   recvd = 1u;
+   reuse = r.ptr;
+   int *const s = a.allocation_command(shrink_in_place | nothrow_allocation, cap, recvd, reuse);
+   if(cap != r.count){
+      BOOST_TEST(s == r.ptr);
+      BOOST_TEST_EQ(recvd, r.count);
+      BOOST_TEST_EQ(a.size(r.ptr), r.count);
+   }
+   BOOST_TEST_EQ(r.ptr[r.count - 1u], int(r.count - 1u));
+
+   //Failed expansion without allocate_new and nothrow returns null, otherwise throws
+   recvd = a.max_size();
+   reuse = r.ptr;
+   BOOST_TEST(!a.allocation_command(expand_fwd | nothrow_allocation, a.max_size(), recvd, reuse));
+   BOOST_TEST_THROWS((void)a.allocation_command(expand_fwd, a.max_size(), recvd, reuse), bad_alloc_t);
+
+   //New allocation
+   recvd = 10000u;
+   reuse = r.ptr;
+   int *const n = a.allocation_command(allocate_new | expand_fwd, 10000u, recvd, reuse);
+   BOOST_TEST(n != 0);
+   BOOST_TEST(recvd >= 10000u);
+   BOOST_TEST(reuse == 0 || n == r.ptr);
+   if(n != r.ptr){
+      a.deallocate(n, recvd);
+   }
+   a.deallocate(r.ptr, r.count);
+}
+
+void test_relocation()
+{
+   #if defined(BOOST_CONTAINER_MMAP_ALLOCATOR_HAS_MREMAP)
+   alloc_t a;
+   int *const p = a.allocate(1u);
+   p[0] = 42;
+   const std::size_t cap = a.size(p);
+   //Block the address range after the buffer so that it can't grow in place.
+   //If the kernel does not honor the address hint, that range is already in use.
+   char *const next = reinterpret_cast<char*>(std::size_t(p) & ~(page_size() - 1u)) + page_size();
+   void *const blocker = ::mmap(next, page_size(), PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+   std::size_t recvd = cap*4u;
+   int *reuse = p;
+   BOOST_TEST(!a.allocation_command(expand_fwd | nothrow_allocation, cap + 1u, recvd, reuse));
+   recvd = cap*4u;
+   int *const r = a.allocation_command(expand_fwd | allow_relocation, cap + 1u, recvd, reuse);
+   BOOST_TEST(r != p);
+   BOOST_TEST(reuse == r);
+   BOOST_TEST(recvd >= cap*4u);
+   BOOST_TEST_EQ(r[0], 42);
+   a.deallocate(r, recvd);
+   if(blocker != MAP_FAILED){
+      ::munmap(blocker, page_size());
+   }
+   #endif
+}
+
+#if defined(BOOST_CONTAINER_MMAP_ALLOCATOR_HAS_MREMAP)
+
+typedef vector<int, alloc_t> mmap_vector_t;
+
+//Returns a full vector whose buffer can't grow in place, so that
+//growing it moves the buffer if the allocator is allowed to.
+template<class Vector>
+void *make_full_blocked(Vector &v)
+{
+   v.clear();
+   v.shrink_to_fit();
+   v.resize(std::size_t(1u) << 16u);
+   v.resize(v.capacity());
+   for(std::size_t i = 0; i != v.size(); ++i){
+      v[i] = int(i);
+   }
+   const std::size_t end = std::size_t(v.data() + v.capacity());
+   char *const next = reinterpret_cast<char*>((end + page_size() - 1u) & ~(page_size() - 1u));
+   return ::mmap(next, page_size(), PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+}
+
+void unblock(void *blocker)
+{
+   if(blocker != MAP_FAILED){
+      ::munmap(blocker, page_size());
+   }
+}
+
+bool check_sequence(const mmap_vector_t &v, std::size_t first, std::size_t n, int value)
+{
+   bool ok = true;
+   for(std::size_t i = 0; i != n; ++i){
+      ok = ok && v[first + i] == value + int(i);
+   }
+   return ok;
+}
+
+#endif   //BOOST_CONTAINER_MMAP_ALLOCATOR_HAS_MREMAP
+
+//Inserted values that live in the buffer must be read before the buffer is moved
+void test_vector_aliasing()
+{
+   #if defined(BOOST_CONTAINER_MMAP_ALLOCATOR_HAS_MREMAP)
+   mmap_vector_t v;
+   {
+      void *const blocker = make_full_blocked(v);
+      const std::size_t n = v.size();
+      v.push_back(v[7]);
+      BOOST_TEST_EQ(v.back(), 7);
+      BOOST_TEST(check_sequence(v, 0u, n, 0));
+      unblock(blocker);
+   }
+   {
+      void *const blocker = make_full_blocked(v);
+      const std::size_t n = v.size();
+      v.push_back(boost::move(v[n - 1u]));
+      BOOST_TEST_EQ(v.back(), int(n - 1u));
+      v.emplace_back(v[3]);
+      BOOST_TEST_EQ(v.back(), 3);
+      unblock(blocker);
+   }
+   {
+      void *const blocker = make_full_blocked(v);
+      const std::size_t n = v.size();
+      v.insert(v.begin() + 1, v[n - 2u]);
+      BOOST_TEST_EQ(v[1], int(n - 2u));
+      BOOST_TEST_EQ(v[0], 0);
+      BOOST_TEST(check_sequence(v, 2u, n - 1u, 1));
+      unblock(blocker);
+   }
+   {
+      void *const blocker = make_full_blocked(v);
+      const std::size_t n = v.size();
+      v.resize(n + 1000u, v[5]);
+      BOOST_TEST_EQ(v.size(), n + 1000u);
+      BOOST_TEST(check_sequence(v, 0u, n, 0));
+      bool ok = true;
+      for(std::size_t i = n; i != v.size(); ++i){
+         ok = ok && v[i] == 5;
+      }
+      BOOST_TEST(ok);
+      unblock(blocker);
+   }
+   {
+      void *const blocker = make_full_blocked(v);
+      const std::size_t n = v.size();
+      v.insert(v.begin() + 1, v.begin(), v.end());
+      BOOST_TEST_EQ(v.size(), 2u*n);
+      BOOST_TEST_EQ(v[0], 0);
+      BOOST_TEST(check_sequence(v, 1u, n, 0));
+      BOOST_TEST(check_sequence(v, n + 1u, n - 1u, 1));
+      unblock(blocker);
+   }
+   {
+      //Values that don't live in the buffer still allow moving it
+      void *const blocker = make_full_blocked(v);
+      const std::size_t n = v.size();
+      const int x = -1;
+      v.push_back(x);
+      v.resize(2u*n);
+      BOOST_TEST_EQ(v[n], -1);
+      BOOST_TEST(check_sequence(v, 0u, n, 0));
+      unblock(blocker);
+   }
+   #endif
+}
+
+template<class T>
+void test_vector_growth()
+{
+   vector<T, mmap_allocator<T> > v;
+   const int N = 1 << 20;
+   for(int i = 0; i != N; ++i){
+      v.push_back(T(i));
+   }
+   v.insert(v.begin() + 1, T(-1));
+   BOOST_TEST_EQ(v.size(), std::size_t(N + 1));
+   BOOST_TEST_EQ(v.capacity(), mmap_allocator<T>().size(v.data()));
+   bool ok = v[1] == T(-1);
+   for(int i = 1; i != N; ++i){
+      ok = ok && v[std::size_t(i) + 1u] == T(i);
+   }
+   BOOST_TEST(ok);
+}
+
+//Not trivially relocatable
+struct non_trivial
+{
+   int i;
+   explicit non_trivial(int x) : i(x) {}
+   non_trivial(const non_trivial &o) : i(o.i) {}
+   ~non_trivial() {}
+   non_trivial &operator=(const non_trivial &o) {  i = o.i; return *this;  }
+   bool operator==(const non_trivial &o) const {  return i == o.i;  }
+};
+
+void test_vector()
+{
+   vector<int, alloc_t> v;
+   const int N = 1 << 20;
+   for(int i = 0; i != N; ++i){
+      v.push_back(i);
+   }
+   BOOST_TEST_EQ(v.size(), std::size_t(N));
+   BOOST_TEST_EQ(v.capacity(), alloc_t().size(v.data()));
+   bool ok = true;
+   for(int i = 0; i != N; ++i){
+      ok = ok && v[std::size_t(i)] == i;
+   }
+   BOOST_TEST(ok);
+
+   //Shrinking keeps the buffer in place
+   v.erase(v.begin() + 10, v.end());
+   const int *const d = v.data();
+   v.shrink_to_fit();
+   BOOST_TEST(v.data() == d);
+   BOOST_TEST(v.capacity()*sizeof(int) < page_size());
+   BOOST_TEST_EQ(v.back(), 9);
+
+   //stable_reserve never reallocates nor throws
+   const std::size_t cap = v.capacity();
+   if(v.stable_reserve(cap + 1u)){
+      BOOST_TEST(v.data() == d);
+      BOOST_TEST(v.capacity() > cap);
+   }
+   else{
+      BOOST_TEST_EQ(v.capacity(), cap);
+   }
+
+   basic_string<char, std::char_traits<char>, mmap_allocator<char> > s(1000u, 'a');
+   s.append(10000u, 'b');
+   BOOST_TEST_EQ(s.size(), 11000u);
+   BOOST_TEST_EQ(s[999], 'a');
+   BOOST_TEST_EQ(s[1000], 'b');
+}
+
+//Insertions that don't read from the buffer let the allocator move it
+void test_vector_relocation()
+{
+   #if defined(BOOST_CONTAINER_MMAP_ALLOCATOR_HAS_MREMAP)
+   typedef instrumented_allocator<int, alloc_t> instr_alloc_t;
+   statistics_observer obs;
+   vector<int, instr_alloc_t> v((instr_alloc_t(obs)));
+   {
+      void *const blocker = make_full_blocked(v);
+      const std::size_t allocs = obs.statistics().allocations;
+      v.emplace_back(-2L);
+      BOOST_TEST_EQ(obs.statistics().allocations, allocs);
+      BOOST_TEST_EQ(v.back(), -2);
+      BOOST_TEST_EQ(v[7], 7);
+      unblock(blocker);
+   }
+   {
+      void *const blocker = make_full_blocked(v);
+      const std::size_t allocs = obs.statistics().allocations;
+      const int values[] = { -1, -2, -3 };
+      v.insert(v.begin() + 1, values, values + 3);
+      BOOST_TEST_EQ(obs.statistics().allocations, allocs);
+      BOOST_TEST_EQ(v[0], 0);
+      BOOST_TEST_EQ(v[3], -3);
+      BOOST_TEST_EQ(v[4], 1);
+      unblock(blocker);
+   }
+   {
+      //The range lives in the buffer, so a new buffer is allocated
+      void *const blocker = make_full_blocked(v);
+      const std::size_t allocs = obs.statistics().allocations;
+      v.insert(v.begin() + 1, v.begin() + 5, v.begin() + 8);
+      BOOST_TEST_EQ(obs.statistics().allocations, allocs + 1u);
+      BOOST_TEST_EQ(v[0], 0);
+      BOOST_TEST_EQ(v[1], 5);
+      BOOST_TEST_EQ(v[3], 7);
+      BOOST_TEST_EQ(v[4], 1);
+      unblock(blocker);
+   }
+   #endif
+}
+
+int main()
+{
+   test_allocator();
+   test_relocation();
+   test_vector_growth<int>();
+   test_vector_growth<non_trivial>();
+   test_vector();
+   test_vector_aliasing();
+   test_vector_relocation();
+   return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+   return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,163 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC) && !defined(BOOST_NO_CXX11_HDR_THREAD) && !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+#include <boost/container/mpmc_queue.hpp>
+#include <boost/container/string.hpp>
+#include <boost/move/iterator.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace boost::container;
+
+template<class Queue>
+void test_single_thread(Queue &q)
+{
+   const std::size_t cap = q.capacity();
+   BOOST_TEST(q.empty());
+   for(std::size_t i = 0; i != cap; ++i){
+      const string s(i + 20u, char('a' + i % 26u));
+      BOOST_TEST(q.try_push(s));
+   }
+   string full("full");
+   BOOST_TEST(!q.try_push(boost::move(full)));
+   BOOST_TEST_EQ(full, string("full"));
+   BOOST_TEST_EQ(q.size(), cap);
+
+   string s;
+   BOOST_TEST(q.try_pop(s));
+   BOOST_TEST_EQ(s, string(20u, 'a'));
+   BOOST_TEST(q.try_emplace(5u, 'z'));
+   BOOST_TEST(!q.try_emplace(5u, 'z'));
+
+   //Batch operations wrap around the buffer end
+   std::vector<string> out(cap);
+   BOOST_TEST_EQ(q.pop_n(out.begin(), 3u), 3u);
+   BOOST_TEST_EQ(out[0], string(21u, 'b'));
+   string in[] = { string("x"), string("y"), string("z"), string("w") };
+   BOOST_TEST_EQ(q.push_n(boost::make_move_iterator(&in[0]), 4u), 3u);
+   BOOST_TEST_EQ(q.size(), cap);
+   BOOST_TEST_EQ(q.pop_n(out.begin(), 2u*cap), cap);
+   BOOST_TEST_EQ(out[cap - 4u], string(5u, 'z'));
+   BOOST_TEST_EQ(out[cap - 1u], string("z"));
+   BOOST_TEST(q.empty());
+   BOOST_TEST_EQ(q.pop_n(out.begin(), 1u), 0u);
+   BOOST_TEST(!q.try_pop(s));
+
+   //Elements left in the queue are destroyed by the destructor
+   BOOST_TEST_EQ(q.push_n(boost::make_move_iterator(&in[0]), 1u), 1u);
+}
+
+template<class Queue>
+void test_threads(Queue &q)
+{
+   const std::size_t Producers = 3u, Consumers = 3u, PerProducer = 20000u;
+   const std::size_t N = Producers*PerProducer;
+   std::vector<std::atomic<unsigned> > seen(N);
+   std::atomic<std::size_t> consumed(0u);
+   std::atomic<bool> ordered(true);
+
+   std::vector<std::thread> threads;
+   for(std::size_t p = 0; p != Producers; ++p){
+      threads.push_back(std::thread([&q, p, PerProducer]{
+         //Each producer pushes the values [p*PerProducer, (p+1)*PerProducer)
+         std::size_t i = 0;
+         std::size_t batch[4];
+         while(i != PerProducer){
+            if(i % 2u){
+               if(q.try_push(p*PerProducer + i))
+                  ++i;
+               else
+                  std::this_thread::yield();
+            }
+            else{
+               const std::size_t n = PerProducer - i < 4u ? PerProducer - i : 4u;
+               for(std::size_t j = 0; j != n; ++j)
+                  batch[j] = p*PerProducer + i + j;
+               const std::size_t pushed = q.push_n(batch, n);
+               if(!pushed)
+                  std::this_thread::yield();
+               i += pushed;
+            }
+         }
+      }));
+   }
+   for(std::size_t c = 0; c != Consumers; ++c){
+      threads.push_back(std::thread([&]{
+         //Values of a producer must be received in increasing order
+         std::vector<std::size_t> last(Producers, std::size_t(-1));
+         std::size_t batch[3];
+         while(consumed.load() != N){
+            std::size_t n = q.pop_n(batch, 3u);
+            if(!n && q.try_pop(batch[0]))
+               n = 1u;
+            if(!n)
+               std::this_thread::yield();
+            for(std::size_t j = 0; j != n; ++j){
+               const std::size_t v = batch[j];
+               const std::size_t p = v / PerProducer;
+               if(last[p] != std::size_t(-1) && last[p] >= v)
+                  ordered = false;
+               last[p] = v;
+               seen[v].fetch_add(1u);
+            }
+            consumed += n;
+         }
+      }));
+   }
+   for(std::size_t t = 0; t != threads.size(); ++t)
+      threads[t].join();
+
+   BOOST_TEST(ordered.load());
+   std::size_t once = 0;
+   for(std::size_t i = 0; i != N; ++i)
+      once += seen[i].load() == 1u;
+   BOOST_TEST_EQ(once, N);
+   BOOST_TEST(q.empty());
+}
+
+int main()
+{
+   {
+      mpmc_queue<string, 8> q;
+      BOOST_TEST_EQ(q.capacity(), 8u);
+      test_single_thread(q);
+   }
+   {
+      mpmc_queue<string> q(7u);
+      BOOST_TEST_EQ(q.capacity(), 8u);
+      test_single_thread(q);
+   }
+   #ifndef BOOST_NO_EXCEPTIONS
+   BOOST_TEST_THROWS(mpmc_queue<int> q(0u), std::exception);
+   #endif
+   {
+      mpmc_queue<std::size_t, 64> q;
+      test_threads(q);
+   }
+   {
+      mpmc_queue<std::size_t, 0, std::allocator<std::size_t> > q(16u);
+      test_threads(q);
+   }
+   return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+   return boost::report_errors();
+}
+
+#endif
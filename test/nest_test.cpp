@@ -9,9 +9,15 @@
 //////////////////////////////////////////////////////////////////////////////
 
 #include <boost/container/experimental/nest.hpp>
+#include <boost/container/experimental/segmented_count.hpp>
+#include <boost/container/experimental/segmented_fill.hpp>
+#include <boost/container/experimental/segmented_find.hpp>
+#include <boost/container/experimental/segmented_find_last.hpp>
+#include <boost/container/experimental/segmented_reverse.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include <algorithm>
 #include <functional>
+#include <iterator>
 #include <vector>
 #include <cstddef>
 
@@ -749,6 +755,46 @@ void test_initializer_list_operations()
 }
 #endif
 
+void test_segmented_algorithms()
+{
+   typedef nest<int>::iterator iterator;
+   typedef segmented_iterator_traits<iterator> traits;
+   BOOST_CONTAINER_STATIC_ASSERT((dtl::is_same<traits::is_segmented_iterator, segmented_iterator_tag>::value));
+   BOOST_CONTAINER_STATIC_ASSERT((dtl::is_same<segmented_iterator_traits<nest<int>::const_iterator>::is_segmented_iterator, segmented_iterator_tag>::value));
+
+   //Blocks with holes
+   nest<int> h;
+   std::vector<iterator> its;
+   for(int i = 0; i != 1000; ++i)
+      its.push_back(h.insert(i % 7));
+   for(std::size_t i = 0; i < its.size(); i += 3u)
+      h.erase(its[i]);
+   std::vector<int> v(h.begin(), h.end());
+
+   iterator first = h.begin(), last = h.begin();
+   std::advance(first, 10);
+   std::advance(last, 500);
+   BOOST_TEST(traits::compose(traits::segment(first), traits::local(first)) == first);
+   BOOST_TEST(traits::segment(first) != traits::segment(last));
+   for(int i = 0; i != 8; ++i){
+      BOOST_TEST_EQ(segmented_count(h.begin(), h.end(), i), std::count(v.begin(), v.end(), i));
+      BOOST_TEST_EQ(segmented_count(first, last, i), std::count(first, last, i));
+      BOOST_TEST(segmented_find(h.cbegin(), h.cend(), i) == std::find(h.cbegin(), h.cend(), i));
+      BOOST_TEST(segmented_find_last(h.begin(), h.end(), i) == std::find_end(h.begin(), h.end(), &i, &i + 1));
+   }
+
+   segmented_reverse(h.begin(), h.end());
+   std::reverse(v.begin(), v.end());
+   BOOST_TEST(std::equal(v.begin(), v.end(), h.begin()));
+
+   segmented_fill(first, last, 42);
+   std::fill(v.begin() + 10, v.begin() + 500, 42);
+   BOOST_TEST(std::equal(v.begin(), v.end(), h.begin()));
+
+   nest<int> e;
+   BOOST_TEST(segmented_find(e.begin(), e.end(), 0) == e.end());
+}
+
 int main()
 {
    test_default_construction();
@@ -801,5 +847,6 @@ int main()
    #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
    test_initializer_list_operations();
    #endif
+   test_segmented_algorithms();
    return boost::report_errors();
 }
@@ -0,0 +1,190 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+//Small thresholds so that tests use several threads and non-temporal stores
+#define BOOST_CONTAINER_PARALLEL_INIT_MIN_BYTES 64u
+#define BOOST_CONTAINER_PARALLEL_INIT_THREADS 4u
+#define BOOST_CONTAINER_NONTEMPORAL_MIN_BYTES 256u
+
+#include <boost/container/vector.hpp>
+#include <boost/container/devector.hpp>
+#include <boost/container/detail/parallel_algo.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <cstring>
+
+#if defined(BOOST_CONTAINER_HAS_PARALLEL_INIT)
+#include <atomic>
+#endif
+
+using namespace boost::container;
+
+void test_nontemporal_kernels()
+{
+   unsigned char src[256 + 16];
+   for(std::size_t i = 0; i != sizeof(src); ++i){
+      src[i] = static_cast<unsigned char>(i*7u + 1u);
+   }
+
+   //Copies with all misalignments and sizes around the streaming block size
+   for(std::size_t off = 0; off != 16u; ++off){
+      for(std::size_t n = 0; n != 80u; ++n){
+         unsigned char dst[256 + 32];
+         std::memset(dst, 0, sizeof(dst));
+         dtl::nontemporal_memcpy(dst + off, src + 3, n);
+         BOOST_TEST(0 == std::memcmp(dst + off, src + 3, n));
+         BOOST_TEST(dst[off + n] == 0);
+      }
+   }
+
+   //Fills with all object sizes that divide 16
+   for(std::size_t sz = 1; sz <= 16u; sz *= 2u){
+      for(std::size_t off = 0; off < 16u; off += sz){
+         for(std::size_t n = 0; n*sz < 96u; ++n){
+            unsigned char dst[256];
+            std::memset(dst, 0, sizeof(dst));
+            dtl::nontemporal_fill(dst + off, src, sz, n*sz);
+            bool ok = true;
+            for(std::size_t i = 0; i != n; ++i){
+               ok = ok && 0 == std::memcmp(dst + off + i*sz, src, sz);
+            }
+            BOOST_TEST(ok);
+            BOOST_TEST(dst[off + n*sz] == 0);
+         }
+      }
+   }
+}
+
+template<class Container>
+void test_trivial_container()
+{
+   const std::size_t N = 10000u;
+   {
+      Container c(N, parallel_init);
+      BOOST_TEST_EQ(c.size(), N);
+      bool ok = true;
+      for(std::size_t i = 0; i != N; ++i)
+         ok = ok && c[i] == 0;
+      BOOST_TEST(ok);
+   }
+   {
+      Container c(N, 7, parallel_init);
+      BOOST_TEST_EQ(c.size(), N);
+      bool ok = true;
+      for(std::size_t i = 0; i != N; ++i)
+         ok = ok && c[i] == 7;
+      BOOST_TEST(ok);
+   }
+   {
+      Container c;
+      for(int i = 0; i != int(N); ++i)
+         c.push_back(i);
+      Container d(c, parallel_init);
+      BOOST_TEST(c == d);
+
+      //Grows with value initialized elements and copies of an element of the container
+      d.resize(2*N, parallel_init);
+      BOOST_TEST_EQ(d.size(), 2*N);
+      BOOST_TEST_EQ(d[N - 1], int(N - 1));
+      BOOST_TEST_EQ(d[N], 0);
+      BOOST_TEST_EQ(d.back(), 0);
+      d.resize(N, parallel_init);
+      BOOST_TEST(c == d);
+      d.shrink_to_fit();
+      d.resize(3*N, d[5], parallel_init);
+      BOOST_TEST_EQ(d.size(), 3*N);
+      BOOST_TEST_EQ(d[N], 5);
+      BOOST_TEST_EQ(d.back(), 5);
+      d.resize(10u, -1, parallel_init);
+      BOOST_TEST_EQ(d.size(), 10u);
+      BOOST_TEST_EQ(d.back(), 9);
+   }
+}
+
+template<class Container>
+void test_string_container()
+{
+   const std::string value("a string long enough to avoid the small string optimization");
+   Container c(1000u, value, parallel_init);
+   BOOST_TEST_EQ(c.size(), 1000u);
+   BOOST_TEST(c.front() == value && c.back() == value);
+   Container d(c, parallel_init);
+   BOOST_TEST(c == d);
+   d.resize(3000u, parallel_init);
+   BOOST_TEST(d[999] == value && d[1000].empty() && d.back().empty());
+   d.resize(5000u, d[0], parallel_init);
+   BOOST_TEST(d.back() == value);
+}
+
+#if defined(BOOST_CONTAINER_HAS_PARALLEL_INIT)
+
+struct throwing_int
+{
+   static std::atomic<int> live;
+   static std::atomic<int> countdown;
+
+   static void maybe_throw()
+   {
+      if(--countdown == 0)
+         throw int(1);
+   }
+
+   throwing_int() : v(0)
+   {  maybe_throw();  ++live;  }
+
+   throwing_int(const throwing_int &o) : v(o.v)
+   {  maybe_throw();  ++live;  }
+
+   ~throwing_int()
+   {  --live;  }
+
+   int v;
+};
+
+std::atomic<int> throwing_int::live(0);
+std::atomic<int> throwing_int::countdown(0);
+
+template<class Container>
+void test_rollback()
+{
+   const int N = 1000;
+   for(int k = 1; k < N; k += 97){
+      throwing_int::countdown = k;
+      BOOST_TEST_THROWS(Container c(std::size_t(N), parallel_init), int);
+      BOOST_TEST_EQ(throwing_int::live.load(), 0);
+   }
+
+   throwing_int::countdown = -1;
+   Container c(std::size_t(N), parallel_init);
+   BOOST_TEST_EQ(throwing_int::live.load(), N);
+   for(int k = 1; k < N; k += 97){
+      throwing_int::countdown = k;
+      BOOST_TEST_THROWS(Container d(c, parallel_init), int);
+      BOOST_TEST_EQ(throwing_int::live.load(), N);
+   }
+   throwing_int::countdown = -1;
+}
+
+#endif   //#if defined(BOOST_CONTAINER_HAS_PARALLEL_INIT)
+
+int main()
+{
+   test_nontemporal_kernels();
+   test_trivial_container< vector<int> >();
+   test_trivial_container< devector<int> >();
+   test_string_container< vector<std::string> >();
+   test_string_container< devector<std::string> >();
+   #if defined(BOOST_CONTAINER_HAS_PARALLEL_INIT)
+   test_rollback< vector<throwing_int> >();
+   test_rollback< devector<throwing_int> >();
+   BOOST_TEST_EQ(throwing_int::live.load(), 0);
+   #endif
+   return boost::report_errors();
+}
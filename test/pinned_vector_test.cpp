@@ -0,0 +1,176 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_HAS_UNISTD_H)
+
+#include <boost/container/pinned_vector.hpp>
+#include <string>
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class pinned_allocator<int>;
+template class pinned_vector<int>;
+
+}} //boost::container
+
+using namespace boost::container;
+
+typedef pinned_allocator<int> alloc_t;
+
+void test_allocator()
+{
+   BOOST_CONTAINER_STATIC_ASSERT(( dtl::version<alloc_t>::value == 2 ));
+   BOOST_TEST_EQ(alloc_t().max_size(), 0u);
+
+   alloc_t a(100000u);
+   BOOST_TEST(a.max_capacity() >= 100000u);
+   BOOST_TEST_EQ(pinned_allocator<char>(a).max_capacity()/sizeof(int), a.max_capacity());
+
+   int *const p = a.allocate(1u);
+   const std::size_t cap = a.size(p);
+   BOOST_TEST(cap >= 1u && cap < a.max_capacity());
+   p[cap - 1u] = 42;
+
+   //Expansion commits more pages in place, even over the preferred size
+   std::size_t recvd = a.max_capacity()*2u;
+   int *reuse = p;
+   BOOST_TEST(p == a.allocation_command(expand_fwd, cap + 1u, recvd, reuse));
+   BOOST_TEST_EQ(recvd, a.max_capacity());
+   BOOST_TEST_EQ(a.size(p), a.max_capacity());
+   BOOST_TEST_EQ(p[cap - 1u], 42);
+   p[recvd - 1u] = 1;
+
+   //Beyond the reservation the buffer is never moved nor a new one allocated
+   recvd = a.max_capacity() + 1u;
+   BOOST_TEST(!a.allocation_command( expand_fwd | allocate_new | allow_relocation | nothrow_allocation
+                                   , a.max_capacity() + 1u, recvd, reuse));
+   BOOST_TEST(reuse == p);
+   BOOST_TEST_THROWS((void)a.allocation_command(expand_fwd, a.max_capacity() + 1u, recvd, reuse), bad_alloc_t);
+
+   //Shrink decommits the tail
+   recvd = 1u;
+   BOOST_TEST(p == a.allocation_command(shrink_in_place, a.max_capacity(), recvd, reuse));
+   BOOST_TEST_EQ(recvd, cap);
+   BOOST_TEST_EQ(a.size(p), cap);
+   BOOST_TEST_EQ(p[cap - 1u], 42);
+   a.deallocate(p, cap);
+}
+
+void test_pinned_addresses()
+{
+   const std::size_t N = 1u << 20;
+   pinned_vector<int> v(N);
+   BOOST_TEST(v.max_capacity() >= N);
+   BOOST_TEST_EQ(v.max_size(), v.max_capacity());
+   BOOST_TEST(v.empty());
+
+   v.push_back(0);
+   const int *const d = v.data();
+   const int &first = v.front();
+   bool pinned = true;
+   for(std::size_t i = 1; i != N; ++i){
+      v.push_back(int(i));
+      pinned = pinned && v.data() == d;
+   }
+   BOOST_TEST(pinned);
+   BOOST_TEST(&first == d);
+   v.insert(v.begin() + 1, 5, -1);
+   v.reserve(v.max_capacity());
+   BOOST_TEST(v.data() == d);
+   BOOST_TEST_EQ(v.size(), N + 5u);
+   BOOST_TEST_EQ(v[1], -1);
+   BOOST_TEST_EQ(v.back(), int(N - 1u));
+
+   //shrink_to_fit keeps the address
+   v.resize(10u);
+   v.shrink_to_fit();
+   BOOST_TEST(v.data() == d);
+   BOOST_TEST(v.capacity() < N);
+   v.resize(N);
+   BOOST_TEST(v.data() == d);
+
+   //Exceeding the maximum capacity throws
+   BOOST_TEST_THROWS(v.resize(v.max_capacity() + 1u), length_error_t);
+   BOOST_TEST_THROWS(v.reserve(v.max_capacity() + 1u), length_error_t);
+   BOOST_TEST(v.data() == d);
+   BOOST_TEST_EQ(v.size(), N);
+
+   //A default constructed pinned_vector can't hold elements
+   pinned_vector<int> e;
+   BOOST_TEST_EQ(e.max_capacity(), 0u);
+   BOOST_TEST_THROWS(e.push_back(1), length_error_t);
+}
+
+void test_copy_move_swap()
+{
+   typedef pinned_vector<std::string> vector_t;
+   vector_t a(1000u, 10u, std::string("abc"));
+   BOOST_TEST_EQ(a.size(), 10u);
+
+   //Copies keep the maximum capacity
+   vector_t b(a);
+   BOOST_TEST_EQ(b.max_capacity(), a.max_capacity());
+   BOOST_TEST(b == a);
+
+   //Copy assignment keeps the destination's maximum capacity
+   vector_t c(20u);
+   c = a;
+   BOOST_TEST(c == a);
+   BOOST_TEST(c.max_capacity() < a.max_capacity());
+   a.resize(c.max_capacity() + 1u);
+   BOOST_TEST_THROWS(c = a, length_error_t);
+
+   //Moves transfer the buffer
+   const std::string *const d = a.data();
+   vector_t m(boost::move(a));
+   BOOST_TEST(m.data() == d);
+   BOOST_TEST(a.empty());
+   c = boost::move(m);
+   BOOST_TEST(c.data() == d);
+   BOOST_TEST_EQ(c.max_capacity(), b.max_capacity());
+
+   //Swap exchanges buffers and maximum capacities
+   vector_t s(10u);
+   s.push_back("x");
+   const std::size_t smax = s.max_capacity();
+   swap(s, c);
+   BOOST_TEST(s.data() == d);
+   BOOST_TEST_EQ(c.max_capacity(), smax);
+   BOOST_TEST_EQ(c.size(), 1u);
+
+   const int il_values[] = { 1, 2, 3 };
+   pinned_vector<int> r(10u, &il_values[0], &il_values[0] + 3);
+   BOOST_TEST_EQ(r.size(), 3u);
+   #if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+   pinned_vector<int> il(10u, { 1, 2, 3 });
+   BOOST_TEST(il == r);
+   #endif
+}
+
+int main()
+{
+   test_allocator();
+   test_pinned_addresses();
+   test_copy_move_swap();
+   return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+   return boost::report_errors();
+}
+
+#endif
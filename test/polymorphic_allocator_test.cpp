@@ -8,6 +8,7 @@
 //
 //////////////////////////////////////////////////////////////////////////////
 #include <boost/container/pmr/polymorphic_allocator.hpp>
+#include <boost/container/allocator_traits.hpp>
 #include <boost/container/pmr/global_resource.hpp>
 #include <boost/core/lightweight_test.hpp>
 
@@ -64,6 +65,21 @@ void test_allocate()
    p.deallocate(ptr, 2);   //To make [[nodiscard]] happy
 }
 
+void test_allocate_at_least()
+{
+   //Without BOOST_CONTAINER_PMR_ALLOCATE_AT_LEAST the resource is not queried
+   int dummy[3];
+   derived_from_memory_resource d;
+   polymorphic_allocator<int> p(&d);
+   d.reset();
+   d.do_allocate_return = dummy;
+   const allocation_result<int*, std::size_t> r = allocator_traits< polymorphic_allocator<int> >::allocate_at_least(p, 3u);
+   BOOST_TEST(r.ptr == dummy);
+   BOOST_TEST_EQ(r.count, 3u);
+   BOOST_TEST(d.do_allocate_bytes == 3*sizeof(int));
+   p.deallocate(r.ptr, r.count);
+}
+
 void test_deallocate()
 {
    int dummy;
@@ -187,6 +203,7 @@ int main()
    test_copy_constructor();
    test_copy_assignment();
    test_allocate();
+   test_allocate_at_least();
    test_deallocate();
    test_construct();
    test_destroy();
@@ -0,0 +1,310 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC)
+
+#include <boost/container/rope.hpp>
+#include <boost/container/instrumented_allocator.hpp>
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class basic_rope<char>;
+template class basic_rope<wchar_t, std::char_traits<wchar_t>, std::allocator<wchar_t> >;
+template class basic_rope<char, std::char_traits<char>, void, rope_options<block_size<8u> >::type>;
+
+}} //boost::container
+
+using namespace boost::container;
+
+//Small chunks to build deep trees with few characters
+typedef rope_options<block_size<8u> >::type small_chunks_t;
+typedef basic_rope<char, std::char_traits<char>, void, small_chunks_t> small_rope;
+typedef basic_rope<char, std::char_traits<char>, instrumented_allocator<char>, small_chunks_t> inst_rope;
+
+class lcg
+{
+   public:
+   lcg() : m_state(12345u) {}
+
+   std::size_t operator()(std::size_t n)
+   {
+      m_state = m_state*1103515245u + 12345u;
+      return std::size_t((m_state >> 16u) % n);
+   }
+
+   private:
+   unsigned m_state;
+};
+
+std::string random_string(lcg &rnd, std::size_t n)
+{
+   std::string s;
+   for(std::size_t i = 0; i != n; ++i)
+      s += char('a' + rnd(26u));
+   return s;
+}
+
+struct chunk_collector
+{
+   explicit chunk_collector(std::string &s) : m_s(&s), chunks(0u) {}
+
+   void operator()(const char *p, std::size_t n)
+   {
+      BOOST_TEST(n != 0u);
+      m_s->append(p, n);
+      ++chunks;
+   }
+
+   std::string *m_s;
+   std::size_t chunks;
+};
+
+template<class Rope>
+bool check_equal(const Rope &r, const std::string &s, lcg &rnd)
+{
+   if(r.size() != s.size() || r.empty() != s.empty())
+      return false;
+   if(std::string(r.str().c_str(), r.size()) != s)
+      return false;
+   //Iteration in both directions
+   if(!std::equal(r.begin(), r.end(), s.begin()) || !std::equal(r.rbegin(), r.rend(), s.rbegin()))
+      return false;
+   //Chunk iteration, full and partial
+   std::string c;
+   r.for_each_chunk(chunk_collector(c));
+   if(c != s)
+      return false;
+   const std::size_t pos = rnd(s.size() + 1u), n = rnd(s.size() + 2u);
+   c.clear();
+   r.for_each_chunk(pos, n, chunk_collector(c));
+   if(c != s.substr(pos, n))
+      return false;
+   //Random access
+   for(std::size_t i = 0; i != 8u && !s.empty(); ++i){
+      const std::size_t k = rnd(s.size());
+      if(r[k] != s[k] || r.begin()[std::ptrdiff_t(k)] != s[k])
+         return false;
+   }
+   return r.compare(s.c_str()) == 0 && r == s.c_str();
+}
+
+template<class Rope>
+void test_random_operations(const typename Rope::allocator_type &a)
+{
+   lcg rnd;
+   Rope r(a);
+   std::string s;
+   for(std::size_t it = 0; it != 3000u; ++it){
+      const std::string frag = random_string(rnd, rnd(30u));
+      const std::size_t pos = rnd(s.size() + 1u);
+      const std::size_t n = rnd(20u);
+      switch(rnd(11u)){
+         case 0:
+         case 1:
+            r.append(frag.c_str(), frag.size());
+            s.append(frag);
+         break;
+         case 2:
+            r.push_back(frag.empty() ? 'z' : frag[0]);
+            s.push_back(frag.empty() ? 'z' : frag[0]);
+         break;
+         case 3:
+            r.insert(pos, frag.c_str());
+            s.insert(pos, frag);
+         break;
+         case 4:
+            r.erase(pos, n);
+            s.erase(pos, n);
+         break;
+         case 5:
+            r.replace(pos, n, frag.c_str());
+            s.replace(pos, n, frag);
+         break;
+         case 6:
+         {
+            //Concatenation and insertion of (shared) substrings
+            const Rope sub = r.substr(pos, n*8u);
+            const std::string ssub = s.substr(pos, n*8u);
+            BOOST_TEST(sub == Rope(ssub.c_str(), a));
+            r.append(sub);
+            s.append(ssub);
+            const std::size_t ipos = rnd(s.size() + 1u);
+            r.insert(ipos, sub);
+            s.insert(ipos, ssub);
+         }
+         break;
+         case 7:
+         {
+            //Copies share chunks, but are independent
+            const Rope copy(r);
+            r += frag.c_str();
+            r.insert(pos, 2u, 'X');
+            BOOST_TEST(check_equal(copy, s, rnd));
+            s += frag;
+            s.insert(pos, 2u, 'X');
+         }
+         break;
+         case 8:
+            if(!s.empty()){
+               r.pop_back();
+               s.erase(s.size() - 1u);
+            }
+         break;
+         case 9:
+            //Self append
+            if(s.size() < 2000u){
+               r.append(r);
+               s.append(s);
+            }
+         break;
+         default:
+            if(s.size() > 4000u){
+               r.erase(0u, s.size()/2u);
+               s.erase(0u, s.size()/2u);
+            }
+      }
+      BOOST_TEST(check_equal(r, s, rnd));
+   }
+}
+
+void test_sharing_and_allocators()
+{
+   statistics_observer obs1, obs2;
+   {
+      const instrumented_allocator<char> a1(obs1), a2(obs2);
+      inst_rope r1("0123456789abcdefghijklmnopqrstuvwxyz", a1);
+      inst_rope r2(a2);
+      //Different allocators: characters are copied
+      r2.append(r1);
+      r2.insert(3u, r1);
+      BOOST_TEST(r2.substr(0u, 3u) == "012");
+      BOOST_TEST(r2.substr(3u, r1.size()) == r1);
+      inst_rope r3(r1, a2);
+      BOOST_TEST(r3 == r1);
+      r3 = r1;
+      BOOST_TEST(r3 == r1);
+      BOOST_TEST(r3.get_allocator() == a2);
+      //Equal allocators: copies and substrings share chunks
+      std::size_t allocs = obs1.statistics().allocations;
+      inst_rope r4(r1);
+      BOOST_TEST_EQ(obs1.statistics().allocations, allocs);
+      BOOST_TEST(r4 == r1);
+      //Only the nodes along the paths to the ends of the range are allocated
+      allocs = obs1.statistics().allocations;
+      inst_rope r5(r1.substr(8u, 16u));
+      BOOST_TEST(r5 == "89abcdefghijklmn");
+      BOOST_TEST(obs1.statistics().allocations - allocs <= 8u);
+      inst_rope r6(boost::move(r4), a2);
+      BOOST_TEST(r6 == r1);
+      r6.swap(r2);
+      BOOST_TEST(r2 == r1);
+   }
+   //No leaks
+   BOOST_TEST_EQ(obs1.statistics().live_bytes, 0u);
+   BOOST_TEST_EQ(obs2.statistics().live_bytes, 0u);
+}
+
+void test_append_cost()
+{
+   //Appending characters one by one only allocates when the tail is full
+   statistics_observer obs;
+   {
+      basic_rope<char, std::char_traits<char>, instrumented_allocator<char> > r((instrumented_allocator<char>(obs)));
+      for(std::size_t i = 0; i != 100000u; ++i){
+         r.push_back(char('a' + i % 26u));
+      }
+      BOOST_TEST_EQ(r.size(), 100000u);
+      BOOST_TEST(obs.statistics().allocations < 1000u);
+      std::size_t chunks = 0u;
+      std::string s;
+      chunk_collector c(s);
+      c = r.for_each_chunk(c);
+      chunks = c.chunks;
+      BOOST_TEST(chunks >= 90u && chunks <= 98u);
+      BOOST_TEST_EQ(r[99999u], char('a' + 99999u % 26u));
+   }
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 0u);
+}
+
+void test_interoperability()
+{
+   const string s("Hello, rope world");
+   rope r(s);
+   BOOST_TEST(r == "Hello, rope world");
+   BOOST_TEST(r.compare(s) == 0);
+   BOOST_TEST(r.str() == s);
+   r += s;
+   r += '!';
+   BOOST_TEST_EQ(r.size(), 2u*s.size() + 1u);
+   BOOST_TEST_EQ(r.find('r'), 7u);
+   BOOST_TEST_EQ(r.find("world", 13u), 29u);
+   BOOST_TEST_EQ(r.find("worlds"), rope::npos);
+   BOOST_TEST_EQ(r.find(""), 0u);
+   BOOST_TEST_EQ(r.back(), '!');
+   BOOST_TEST_EQ(r.front(), 'H');
+   BOOST_TEST_EQ(r.at(1u), 'e');
+   char buf[5];
+   BOOST_TEST_EQ(r.copy(buf, 5u, 7u), 5u);
+   BOOST_TEST(std::string(buf, 5u) == "rope ");
+   BOOST_TEST(rope("abc") < rope("abd"));
+   BOOST_TEST(rope("abc") < rope("abcd"));
+   BOOST_TEST(rope("b") > rope("abcd"));
+   BOOST_TEST(rope("abc") != "ab");
+   BOOST_TEST(rope(3u, 'x') == "xxx");
+   BOOST_TEST(rope("ab") + rope("cd") + "ef" == "abcdef");
+   std::ostringstream os;
+   os << r;
+   BOOST_TEST(os.str() == "Hello, rope worldHello, rope world!");
+   const char il[] = "range";
+   BOOST_TEST(rope(&il[0], &il[0] + 5) == "range");
+   r.assign(2u, 'y');
+   BOOST_TEST(r == "yy");
+   r = "assigned";
+   BOOST_TEST(r == "assigned");
+   r = s;
+   BOOST_TEST(r == s.c_str());
+   r.clear();
+   BOOST_TEST(r.empty());
+   BOOST_TEST(r.begin() == r.end());
+
+   BOOST_TEST_THROWS((void)r.at(0u), std::exception);
+   BOOST_TEST_THROWS(r.insert(1u, "x"), std::exception);
+   BOOST_TEST_THROWS(r.erase(1u), std::exception);
+   BOOST_TEST_THROWS((void)r.substr(1u), std::exception);
+}
+
+int main()
+{
+   test_random_operations<small_rope>(small_rope::allocator_type());
+   test_random_operations<rope>(rope::allocator_type());
+   statistics_observer obs;
+   test_random_operations<inst_rope>(instrumented_allocator<char>(obs));
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 0u);
+   test_sharing_and_allocators();
+   test_append_cost();
+   test_interoperability();
+   return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+   return boost::report_errors();
+}
+
+#endif
@@ -146,6 +146,26 @@ void test_stored_size_type()
    }
 }
 
+void test_stored_size_footprint()
+{
+   //A 32 bit stored_size packs size and capacity in a pointer-sized
+   //word on 64 bit platforms. Inline storage is detected comparing
+   //the data pointer with the internal buffer, so no extra flag is stored.
+   typedef small_vector_options< stored_size<unsigned int> >::type options_t;
+   typedef small_vector<unsigned int, 4u, void, options_t> small_vector_t;
+   BOOST_CONTAINER_STATIC_ASSERT(sizeof(small_vector_t) == sizeof(void*) + 2u*sizeof(unsigned int) + 4u*sizeof(unsigned int));
+   BOOST_CONTAINER_STATIC_ASSERT(sizeof(small_vector_t) < sizeof(small_vector<unsigned int, 4u>));
+
+   small_vector_t v(4u, 1u);
+   BOOST_TEST(v.is_small());
+   BOOST_TEST_EQ(v.capacity(), 4u);
+   v.push_back(2u);
+   BOOST_TEST(!v.is_small());
+   BOOST_TEST_EQ(v.size(), 5u);
+   BOOST_TEST(v.capacity() >= 5u);
+   BOOST_TEST_EQ(v.back(), 2u);
+}
+
 int main()
 {
    test_alignment();
@@ -154,5 +174,6 @@ int main()
    test_growth_factor_100();
    test_stored_size_type<unsigned char>();
    test_stored_size_type<unsigned short>();
+   test_stored_size_footprint();
    return ::boost::report_errors();
 }
@@ -0,0 +1,143 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/config.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC) && !defined(BOOST_NO_CXX11_HDR_THREAD) && !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+#include <boost/container/spsc_queue.hpp>
+#include <boost/container/string.hpp>
+#include <thread>
+#include <vector>
+
+using namespace boost::container;
+
+template<class Queue>
+void test_single_thread(Queue &q)
+{
+   const std::size_t cap = q.capacity();
+   BOOST_TEST(q.empty());
+   for(std::size_t i = 0; i != cap; ++i){
+      BOOST_TEST(q.try_push(string(i + 20u, char('a' + i % 26u))));
+   }
+   BOOST_TEST(!q.try_push(string("full")));
+   BOOST_TEST_EQ(q.size(), cap);
+
+   string s;
+   BOOST_TEST(q.try_pop(s));
+   BOOST_TEST_EQ(s, string(20u, 'a'));
+   BOOST_TEST(q.try_emplace(5u, 'z'));
+   BOOST_TEST(!q.try_emplace(5u, 'z'));
+
+   //Batch operations wrap around the buffer end
+   std::vector<string> out(cap);
+   BOOST_TEST_EQ(q.pop_n(out.begin(), 3u), 3u);
+   BOOST_TEST_EQ(out[0], string(21u, 'b'));
+   const string in[] = { string("x"), string("y"), string("z"), string("w") };
+   BOOST_TEST_EQ(q.push_n(in, 4u), 3u);
+   BOOST_TEST_EQ(q.size(), cap);
+   BOOST_TEST_EQ(q.pop_n(out.begin(), 2u*cap), cap);
+   BOOST_TEST_EQ(out[cap - 4u], string(5u, 'z'));
+   BOOST_TEST_EQ(out[cap - 1u], string("z"));
+   BOOST_TEST(q.empty());
+   BOOST_TEST_EQ(q.pop_n(out.begin(), 1u), 0u);
+   BOOST_TEST(!q.try_pop(s));
+
+   //Elements left in the queue are destroyed by the destructor
+   BOOST_TEST_EQ(q.push_n(in, 2u), 2u);
+}
+
+template<class Queue>
+void test_two_threads(Queue &q)
+{
+   const std::size_t N = 200000u;
+   std::thread producer([&q]{
+      std::size_t i = 0;
+      std::size_t batch[7];
+      while(i != N){
+         if(i % 3u){
+            if(q.try_push(i))
+               ++i;
+            else
+               std::this_thread::yield();
+         }
+         else{
+            const std::size_t n = N - i < 7u ? N - i : 7u;
+            for(std::size_t j = 0; j != n; ++j)
+               batch[j] = i + j;
+            const std::size_t pushed = q.push_n(batch, n);
+            if(!pushed)
+               std::this_thread::yield();
+            i += pushed;
+         }
+      }
+   });
+
+   std::size_t expected = 0;
+   bool in_order = true;
+   std::size_t batch[5];
+   while(expected != N){
+      std::size_t v;
+      if(expected % 2u){
+         if(q.try_pop(v)){
+            in_order = in_order && v == expected;
+            ++expected;
+         }
+         else{
+            std::this_thread::yield();
+         }
+      }
+      else{
+         const std::size_t n = q.pop_n(batch, 5u);
+         if(!n)
+            std::this_thread::yield();
+         for(std::size_t j = 0; j != n; ++j, ++expected)
+            in_order = in_order && batch[j] == expected;
+      }
+   }
+   producer.join();
+   BOOST_TEST(in_order);
+   BOOST_TEST(q.empty());
+}
+
+int main()
+{
+   {
+      spsc_queue<string, 8> q;
+      BOOST_TEST_EQ(q.capacity(), 8u);
+      test_single_thread(q);
+   }
+   {
+      spsc_queue<string> q(5u);
+      BOOST_TEST_EQ(q.capacity(), 8u);
+      test_single_thread(q);
+   }
+   #ifndef BOOST_NO_EXCEPTIONS
+   BOOST_TEST_THROWS(spsc_queue<int> q(0u), std::exception);
+   #endif
+   {
+      spsc_queue<std::size_t, 64> q;
+      test_two_threads(q);
+   }
+   {
+      spsc_queue<std::size_t, 0, std::allocator<std::size_t> > q(16u);
+      test_two_threads(q);
+   }
+   return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+   return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,134 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/static_vector.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_CONTAINER_HAS_CXX20_CONSTEXPR)
+
+using namespace boost::container;
+
+struct point
+{
+   int x, y;
+};
+
+typedef static_vector<int, 16> ivec_t;
+
+constexpr int sum(const ivec_t &v)
+{
+   int r = 0;
+   for(int i : v)
+      r += i;
+   return r;
+}
+
+constexpr bool test_construction()
+{
+   ivec_t a;
+   ivec_t b(3u);
+   ivec_t c(4u, 7);
+   ivec_t d({1, 2, 3});
+   ivec_t e(4u, 5);
+   ivec_t f(e);
+   ivec_t g(boost::move(f));
+   ivec_t h(5u, default_init);
+   return a.empty() && b.size() == 3u && sum(b) == 0 && sum(c) == 28 && sum(d) == 6
+      && sum(e) == 20 && sum(g) == 20 && h.size() == 5u && a.capacity() == 16u;
+}
+
+constexpr bool test_modifiers()
+{
+   ivec_t v;
+   for(int i = 0; i != 8; ++i)
+      v.push_back(i);
+   v.emplace_back(8);
+   v.insert(v.begin(), -1);
+   v.insert(v.begin() + 2, 2u, 100);
+   v.emplace(v.end() - 1, 50);
+   v.insert(v.begin() + 1, 2u, -5);
+   v.insert(v.begin(), 1000);
+   //1000, -1, -5, -5, 0, 100, 100, 1, 2, 3, 4, 5, 6, 7, 50, 8
+   if(v.size() != 16u || v.front() != 1000 || v.back() != 8 || v[5] != 100 || v.at(14u) != 50)
+      return false;
+   v.erase(v.begin());
+   v.erase(v.begin() + 1, v.begin() + 3);
+   v.pop_back();
+   //-1, 0, 100, 100, 1, 2, 3, 4, 5, 6, 7, 50
+   if(v.size() != 12u || sum(v) != 277)
+      return false;
+   v.resize(14u, 1);
+   v.resize(3u);
+   ivec_t w(2u, 9);
+   w.swap(v);
+   v = w;
+   v.resize(1u);
+   v.emplace_back(2);
+   w.clear();
+   return v.size() == 2u && sum(v) == 1 && w.empty() && !(v == w) && v != w;
+}
+
+constexpr bool test_iteration()
+{
+   static_vector<point, 4> v;
+   v.push_back(point{1, 2});
+   v.emplace_back();
+   v.back().x = 3;
+   int r = 0;
+   for(static_vector<point, 4>::const_iterator it = v.cbegin(); it != v.cend(); ++it)
+      r = r*10 + it->x;
+   return r == 13 && v.data()[0].y == 2 && v.nth(1u)->x == 3 && v.index_of(v.end() - 1) == 1u;
+}
+
+//Tables computed at compile time
+constexpr ivec_t make_squares(int n)
+{
+   ivec_t v;
+   for(int i = 0; i != n; ++i)
+      v.push_back(i*i);
+   return v;
+}
+
+constexpr ivec_t squares = make_squares(10);
+
+static_assert(test_construction(), "test_construction");
+static_assert(test_modifiers(), "test_modifiers");
+static_assert(test_iteration(), "test_iteration");
+static_assert(squares.size() == 10u && squares[9] == 81, "squares");
+
+int main()
+{
+   //The same code at runtime
+   BOOST_TEST(test_construction());
+   BOOST_TEST(test_modifiers());
+   BOOST_TEST(test_iteration());
+   BOOST_TEST_EQ(sum(squares), 285);
+   ivec_t v(squares);
+   BOOST_TEST(v == make_squares(10));
+   //Iterator range construction, insertion and assignment rely on iterator utilities that are not constexpr
+   const int arr[] = {-5, -6};
+   v.insert(v.begin() + 1, &arr[0], &arr[0] + 2);
+   BOOST_TEST_EQ(v.size(), 12u);
+   BOOST_TEST_EQ(sum(v), 274);
+   BOOST_TEST(ivec_t(&arr[0], &arr[0] + 2) == ivec_t(v.begin() + 1, v.begin() + 3));
+   v.assign(4u, 2);
+   BOOST_TEST_EQ(sum(v), 8);
+   v.assign({1, 2});
+   BOOST_TEST_EQ(sum(v), 3);
+   return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+   return 0;
+}
+
+#endif
@@ -0,0 +1,119 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#define BOOST_CONTAINER_STRING_LAZY_CONCAT
+#include <boost/container/string.hpp>
+#include <boost/container/instrumented_allocator.hpp>
+#include <boost/container/detail/type_traits.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <sstream>
+
+using namespace boost::container;
+
+typedef basic_string<char, std::char_traits<char>, instrumented_allocator<char> > inst_string;
+
+template<class T>
+bool is_string_type(const T &)
+{  return dtl::is_same<T, string>::value;  }
+
+string make_string(const char *s)
+{  return string(s);  }
+
+void test_single_allocation()
+{
+   statistics_observer obs;
+   const instrumented_allocator<char> a(obs);
+   {
+      const inst_string host("api.example.com/v1/service", a);
+      const inst_string path("items/collection/by-owner", a);
+      const inst_string query("id=42&sort=ascending&limit=100", a);
+      obs.reset();
+      //One allocation for the result, each operand is copied once
+      const inst_string url = host + "/" + path + '?' + query;
+      BOOST_TEST_EQ(obs.statistics().allocations, 1u);
+      BOOST_TEST_EQ(obs.statistics().reallocations, 0u);
+      BOOST_TEST(url == "api.example.com/v1/service/items/collection/by-owner?id=42&sort=ascending&limit=100");
+
+      //Results that fit in the internal buffer don't allocate
+      const inst_string k1("ab", a), k2("cd", a);
+      obs.reset();
+      const inst_string key = k1 + ':' + k2;
+      BOOST_TEST_EQ(obs.statistics().allocations, 0u);
+      BOOST_TEST(key == "ab:cd");
+
+      //Appending an expression grows the target at most once
+      inst_string s("prefix/", a);
+      obs.reset();
+      s += host + "/" + path + "/" + query;
+      BOOST_TEST_EQ(obs.statistics().allocations, 1u);
+      BOOST_TEST(s == "prefix/api.example.com/v1/service/items/collection/by-owner/id=42&sort=ascending&limit=100");
+   }
+}
+
+void test_operand_combinations()
+{
+   const string a("a"), b("bb"), c("ccc"), d("dddd");
+   BOOST_TEST(string(a + b) == "abb");
+   BOOST_TEST(string("x" + a) == "xa");
+   BOOST_TEST(string(a + "x") == "ax");
+   BOOST_TEST(string('x' + a) == "xa");
+   BOOST_TEST(string(a + 'x') == "ax");
+   BOOST_TEST(string((a + b) + (c + d)) == "abbcccdddd");
+   BOOST_TEST(string(a + (b + c)) == "abbccc");
+   BOOST_TEST(string("<" + (a + b)) == "<abb");
+   BOOST_TEST(string('<' + (a + b)) == "<abb");
+   BOOST_TEST(string((a + b) + '>') == "abb>");
+   BOOST_TEST(string((a + b) + ">>") == "abb>>");
+   BOOST_TEST_EQ((a + "/" + b + '/' + c).size(), 8u);
+   BOOST_TEST((a + "/" + b).str() == "a/bb");
+
+   //Temporary strings still return strings and are reused
+   BOOST_TEST(is_string_type(make_string("t") + "x"));
+   BOOST_TEST(is_string_type("x" + make_string("t")));
+   BOOST_TEST(is_string_type(make_string("t") + 'x'));
+   BOOST_TEST(is_string_type('x' + make_string("t")));
+   BOOST_TEST(is_string_type(make_string("t") + a));
+   BOOST_TEST(string(make_string("t") + "/" + a + "/" + b) == "t/a/bb");
+   BOOST_TEST(string(a + "/" + make_string("t")) == "a/t");
+
+   //Operands of a expression appended to themselves
+   string s("self");
+   s += "<" + s + ">" + s;
+   BOOST_TEST(s == "self<self>self");
+   s = s + "!" + s;
+   BOOST_TEST(s == "self<self>self!self<self>self");
+
+   std::ostringstream os;
+   os << a + '-' + b;
+   BOOST_TEST(os.str() == "a-bb");
+}
+
+void test_allocator_selection()
+{
+   statistics_observer obs1, obs2;
+   {
+      const inst_string x("first operand that is long enough", (instrumented_allocator<char>(obs1)));
+      const inst_string y("second operand that is long enough", (instrumented_allocator<char>(obs2)));
+      obs1.reset();
+      obs2.reset();
+      //The allocator of the leftmost string is used
+      const inst_string r = "[" + x + y;
+      BOOST_TEST(r.get_allocator() == x.get_allocator());
+      BOOST_TEST_EQ(obs1.statistics().allocations, 1u);
+      BOOST_TEST_EQ(obs2.statistics().allocations, 0u);
+   }
+}
+
+int main()
+{
+   test_single_allocation();
+   test_operand_combinations();
+   test_allocator_selection();
+   return boost::report_errors();
+}
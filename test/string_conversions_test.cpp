@@ -0,0 +1,252 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/string_conversions.hpp>
+#include <boost/container/instrumented_allocator.hpp>
+#include <boost/container/options.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+using namespace boost::container;
+
+class lcg
+{
+   public:
+   lcg() : m_state(12345u) {}
+
+   boost::ulong_long_type operator()()
+   {
+      m_state = m_state*6364136223846793005ull + 1442695040888963407ull;
+      return m_state;
+   }
+
+   private:
+   boost::ulong_long_type m_state;
+};
+
+template<class Integer>
+void test_integer_roundtrip(Integer value)
+{
+   for(int base = 2; base <= 36; base += (base < 10 ? 8 : 13)){
+      string s("x=");
+      append_integer(s, value, base);
+      Integer back = Integer(1);
+      const char *const last = s.data() + s.size();
+      BOOST_TEST(parse_integer(s.data() + 2, last, back, base) == last);
+      BOOST_TEST(back == value);
+   }
+}
+
+void test_integers()
+{
+   //Same output as printf
+   lcg rnd;
+   char buf[64];
+   for(std::size_t i = 0; i != 10000u; ++i){
+      const boost::long_long_type v = boost::long_long_type(rnd()) >> (i % 64u);
+      std::sprintf(buf, "%lld", v);
+      BOOST_TEST(to_string(v) == buf);
+      const unsigned u = unsigned(rnd() >> (i % 32u));
+      std::sprintf(buf, "%u", u);
+      BOOST_TEST(to_string(u) == buf);
+      std::sprintf(buf, "%x", u);
+      string s;
+      BOOST_TEST(append_integer(s, u, 16) == buf);
+      test_integer_roundtrip(v);
+      test_integer_roundtrip(u);
+      test_integer_roundtrip(short(v));
+   }
+   //Limits
+   BOOST_TEST(to_string(0) == "0");
+   BOOST_TEST(to_string(-7) == "-7");
+   BOOST_TEST(to_string((std::numeric_limits<boost::long_long_type>::min)()) == "-9223372036854775808");
+   BOOST_TEST(to_string((std::numeric_limits<boost::ulong_long_type>::max)()) == "18446744073709551615");
+   BOOST_TEST(to_string((std::numeric_limits<signed char>::min)()) == "-128");
+   BOOST_TEST(to_string((unsigned char)255) == "255");
+   BOOST_TEST(to_wstring(-1234567) == L"-1234567");
+   wstring ws(L"n=");
+   BOOST_TEST(append_integer(ws, 255, 2) == L"n=11111111");
+   test_integer_roundtrip((std::numeric_limits<int>::min)());
+   test_integer_roundtrip((std::numeric_limits<int>::max)());
+   test_integer_roundtrip((std::numeric_limits<boost::long_long_type>::min)());
+   test_integer_roundtrip((std::numeric_limits<boost::ulong_long_type>::max)());
+
+   //Parsing
+   int i = 5;
+   BOOST_TEST(!parse_integer(string("2147483648"), i));
+   BOOST_TEST(parse_integer(string("-2147483648"), i) && i == (std::numeric_limits<int>::min)());
+   BOOST_TEST(!parse_integer(string(""), i));
+   BOOST_TEST(!parse_integer(string("-"), i));
+   BOOST_TEST(!parse_integer(string("+1"), i));
+   BOOST_TEST(!parse_integer(string(" 1"), i));
+   BOOST_TEST(!parse_integer(string("12a"), i));
+   BOOST_TEST(parse_integer(string("7fffFFFF"), i, 16) && i == 0x7fffffff);
+   BOOST_TEST(parse_integer(wstring(L"-42"), i) && i == -42);
+   unsigned u = 3u;
+   BOOST_TEST(!parse_integer(string("-1"), u));
+   BOOST_TEST_EQ(u, 3u);
+   unsigned char uc = 0;
+   BOOST_TEST(!parse_integer(string("256"), uc));
+   BOOST_TEST(parse_integer(string("255"), uc) && uc == 255u);
+   const char fields[] = "123,456";
+   const char *p = parse_integer(fields, fields + 7, i);
+   BOOST_TEST(p == fields + 3 && *p == ',' && i == 123);
+   BOOST_TEST(parse_integer(p, fields + 7, i) == p);
+   BOOST_TEST(parse_integer(p + 1, fields + 7, i) == fields + 7 && i == 456);
+}
+
+template<class Float>
+void test_float_roundtrip(Float value)
+{
+   string s("v=");
+   append_float(s, value);
+   Float back = Float(1);
+   const char *const last = s.data() + s.size();
+   BOOST_TEST(parse_float(s.data() + 2, last, back) == last);
+   BOOST_TEST(back == value);
+}
+
+void test_floats()
+{
+   BOOST_TEST(to_string(0.0) == "0");
+   BOOST_TEST(to_string(-0.0) == "-0");
+   BOOST_TEST(to_string(0.1) == "0.1");
+   BOOST_TEST(to_string(0.1f) == "0.1");
+   BOOST_TEST(to_string(-1.5) == "-1.5");
+   BOOST_TEST(to_string(0.1 + 0.2) == "0.30000000000000004");
+   BOOST_TEST(to_string(1e300) == "1e+300");
+   BOOST_TEST(to_string(5e-324) == "5e-324");
+   BOOST_TEST(to_string(std::numeric_limits<double>::infinity()) == "inf");
+   BOOST_TEST(to_string(-std::numeric_limits<double>::infinity()) == "-inf");
+   BOOST_TEST(to_string(std::numeric_limits<double>::quiet_NaN()).find("nan") != string::npos);
+   BOOST_TEST(to_wstring(2.25) == L"2.25");
+   lcg rnd;
+   for(std::size_t i = 0; i != 10000u; ++i){
+      const boost::ulong_long_type bits = rnd();
+      double d;
+      std::memcpy(&d, &bits, sizeof(d));
+      float f;
+      std::memcpy(&f, &bits, sizeof(f));
+      if(!(std::isnan)(d))
+         test_float_roundtrip(d);
+      if(!(std::isnan)(f))
+         test_float_roundtrip(f);
+      test_float_roundtrip((long double)(i)/3.0L);
+   }
+
+   //Parsing
+   double d = 2.0;
+   BOOST_TEST(parse_float(string("1e5"), d) && d == 1e5);
+   BOOST_TEST(parse_float(string("-.5"), d) && d == -0.5);
+   BOOST_TEST(parse_float(string("3."), d) && d == 3.0);
+   BOOST_TEST(parse_float(string("INF"), d) && d == std::numeric_limits<double>::infinity());
+   BOOST_TEST(parse_float(string("-infinity"), d) && d == -std::numeric_limits<double>::infinity());
+   BOOST_TEST(parse_float(string("nan"), d) && d != d);
+   BOOST_TEST(parse_float(wstring(L"0.25"), d) && d == 0.25);
+   d = 2.0;
+   BOOST_TEST(!parse_float(string(""), d));
+   BOOST_TEST(!parse_float(string("."), d));
+   BOOST_TEST(!parse_float(string("+1"), d));
+   BOOST_TEST(!parse_float(string("1e999"), d));
+   BOOST_TEST(!parse_float(string("0x10"), d));
+   BOOST_TEST_EQ(d, 2.0);
+   //Exponents without digits are not part of the number
+   const char fields[] = "1.5e;2";
+   const char *p = parse_float(fields, fields + 6, d);
+   BOOST_TEST(p == fields + 3 && d == 1.5);
+   //Long numbers
+   string s("0.");
+   s.append(1000u, '0');
+   s.append("1e1003");
+   BOOST_TEST(parse_float(s, d) && d == 100.0);
+   wstring ws(s.begin(), s.end());
+   BOOST_TEST(parse_float(ws, d) && d == 100.0);
+}
+
+void test_locale_independence()
+{
+   //Formatting and parsing ignore the global C locale
+   if(std::setlocale(LC_ALL, "de_DE.UTF-8") || std::setlocale(LC_ALL, "fr_FR.UTF-8")){
+      BOOST_TEST(to_string(1.5) == "1.5");
+      double d = 0;
+      BOOST_TEST(parse_float(string("2.5"), d) && d == 2.5);
+      BOOST_TEST(!parse_float(string("2,5"), d));
+      std::setlocale(LC_ALL, "C");
+   }
+}
+
+void test_direct_append()
+{
+   statistics_observer obs;
+   {
+      typedef basic_string<char, std::char_traits<char>, instrumented_allocator<char> > inst_string;
+      inst_string s((instrumented_allocator<char>(obs)));
+      //Short results use the internal buffer
+      append_integer(s, 123);
+      append_float(s, 0.5);
+      BOOST_TEST(s == "1230.5");
+      BOOST_TEST_EQ(obs.statistics().allocations, 0u);
+      //Serialization appends directly, growing geometrically
+      s.clear();
+      for(int i = 0; i != 10000; ++i){
+         append_integer(s, i);
+         s.push_back(',');
+      }
+      BOOST_TEST(obs.statistics().allocations < 20u);
+      int i = -1;
+      const char *p = s.data();
+      const char *const last = p + s.size();
+      int expected = 0;
+      while(p != last){
+         p = parse_integer(p, last, i);
+         BOOST_TEST_EQ(i, expected++);
+         BOOST_TEST_EQ(*p, ',');
+         ++p;
+      }
+      BOOST_TEST_EQ(expected, 10000);
+   }
+   BOOST_TEST_EQ(obs.statistics().live_bytes, 0u);
+}
+
+void test_options_string()
+{
+   //basic_string instantiations with options are also supported
+   typedef string_options< growth_factor<growth_factor_100>, stored_size<unsigned short> >::type options_t;
+   typedef basic_string<char, std::char_traits<char>, void, options_t> options_string;
+   options_string s;
+   append_integer(s, -4096);
+   s.push_back(' ');
+   append_integer(s, 255u, 16);
+   s.push_back(' ');
+   append_float(s, 0.25);
+   BOOST_TEST(s == "-4096 ff 0.25");
+   int i = 0;
+   BOOST_TEST(parse_integer(options_string("-4096"), i));
+   BOOST_TEST_EQ(i, -4096);
+   BOOST_TEST(!parse_integer(options_string("12ab"), i));
+   BOOST_TEST_EQ(i, -4096);
+   double d = 0.0;
+   BOOST_TEST(parse_float(options_string("0.25"), d));
+   BOOST_TEST_EQ(d, 0.25);
+   BOOST_TEST(!parse_float(options_string("0.25x"), d));
+}
+
+int main()
+{
+   test_integers();
+   test_floats();
+   test_locale_independence();
+   test_direct_append();
+   test_options_string();
+   return boost::report_errors();
+}
@@ -0,0 +1,105 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/string.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+
+using namespace boost::container;
+
+//Searches are compared against std::basic_string. Haystacks are long enough
+//to use all SIMD block sizes and their tails, and include chars >= 0x80.
+static const char alphabet[] = { 'a', 'b', 'c', ' ', char(0xE1), char(0x80) };
+
+class lcg
+{
+   public:
+   lcg() : m_state(12345u) {}
+
+   std::size_t operator()(std::size_t n)
+   {
+      m_state = m_state*1103515245u + 12345u;
+      return std::size_t((m_state >> 16u) % n);
+   }
+
+   private:
+   unsigned m_state;
+};
+
+template<class CharT>
+std::basic_string<CharT> random_string(lcg &rnd, std::size_t n)
+{
+   std::basic_string<CharT> s;
+   for(std::size_t i = 0; i != n; ++i)
+      s += CharT(static_cast<unsigned char>(alphabet[rnd(sizeof(alphabet))]));
+   return s;
+}
+
+template<class CharT>
+void test_find(std::size_t iterations)
+{
+   typedef std::basic_string<CharT>  std_string_t;
+   typedef basic_string<CharT>       string_t;
+   lcg rnd;
+   for(std::size_t it = 0; it != iterations; ++it){
+      const std_string_t ss = random_string<CharT>(rnd, rnd(100u));
+      const std_string_t sn = random_string<CharT>(rnd, rnd(6u));
+      const string_t bs(ss.c_str(), ss.size());
+      const CharT *const n  = sn.c_str();
+      const std::size_t nl  = sn.size();
+      const std::size_t pos = rnd(5u) ? rnd(110u) : std_string_t::npos;
+      const std::size_t fpos = pos == std_string_t::npos ? 0u : pos;
+      const CharT c = n[0] ? n[0] : CharT('a');
+
+      BOOST_TEST_EQ(bs.find(n, fpos, nl), ss.find(n, fpos, nl));
+      BOOST_TEST_EQ(bs.rfind(n, pos, nl), ss.rfind(n, pos, nl));
+      BOOST_TEST_EQ(bs.find(c, pos), ss.find(c, pos));
+      BOOST_TEST_EQ(bs.rfind(c, pos), ss.rfind(c, pos));
+      BOOST_TEST_EQ(bs.find_first_of(n, pos, nl), ss.find_first_of(n, pos, nl));
+      BOOST_TEST_EQ(bs.find_last_of(n, pos, nl), ss.find_last_of(n, pos, nl));
+      BOOST_TEST_EQ(bs.find_first_not_of(n, pos, nl), ss.find_first_not_of(n, pos, nl));
+      BOOST_TEST_EQ(bs.find_last_not_of(n, pos, nl), ss.find_last_not_of(n, pos, nl));
+      BOOST_TEST_EQ(bs.find_first_not_of(c, pos), ss.find_first_not_of(c, pos));
+      BOOST_TEST_EQ(bs.find_last_not_of(c, pos), ss.find_last_not_of(c, pos));
+   }
+}
+
+void test_char_class()
+{
+   //All byte values, searched with sets that include and exclude them
+   string s;
+   for(unsigned i = 0; i != 256u; ++i)
+      s.push_back(char(i));
+   for(unsigned i = 0; i != 256u; ++i){
+      const char set[] = { char(i), char(255u - i), char((i + 128u) % 256u) };
+      std::size_t first = i;
+      if(255u - i < first)
+         first = 255u - i;
+      if((i + 128u) % 256u < first)
+         first = (i + 128u) % 256u;
+      BOOST_TEST_EQ(s.find_first_of(set, 0u, 3u), first);
+      BOOST_TEST_EQ(s.find(char(i)), std::size_t(i));
+      BOOST_TEST_EQ(s.rfind(char(i)), std::size_t(i));
+   }
+   const string all(s);
+   BOOST_TEST_EQ(s.find_first_not_of(all), string::npos);
+   BOOST_TEST_EQ(s.find_last_not_of(all), string::npos);
+   BOOST_TEST_EQ(s.find_first_of(all, 200u), 200u);
+   BOOST_TEST_EQ(s.find_last_of(all, 100u), 100u);
+   BOOST_TEST_EQ(s.find(s.c_str() + 100, 0u, 156u), 100u);
+   BOOST_TEST_EQ(s.rfind(s.c_str(), string::npos, 256u), 0u);
+}
+
+int main()
+{
+   test_find<char>(20000u);
+   test_find<wchar_t>(2000u);
+   test_char_class();
+   return boost::report_errors();
+}
@@ -0,0 +1,241 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/trivially_relocatable.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/container/devector.hpp>
+#include <boost/container/small_vector.hpp>
+#include <boost/container/static_vector.hpp>
+#include <boost/container/stable_vector.hpp>
+#include <boost/container/deque.hpp>
+#include <boost/container/string.hpp>
+#include <boost/container/list.hpp>
+#include <boost/container/options.hpp>
+#include <boost/container/pmr/polymorphic_allocator.hpp>
+#include <boost/move/unique_ptr.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <memory>
+#include <utility>
+
+using namespace boost::container;
+
+//A type that owns a heap resource and counts move constructions and destructions.
+//With Relocatable == true it declares itself trivially relocatable.
+template<bool Relocatable>
+class counted
+{
+   BOOST_COPYABLE_AND_MOVABLE(counted)
+
+   public:
+   static int moves;
+   static int destructions;
+   static int live;
+   static int throw_on_value;
+
+   explicit counted(int v = 0)
+      : p_(0)
+   {
+      if(v == throw_on_value)
+         throw v;
+      p_ = new int(v);
+      ++live;
+   }
+
+   counted(const counted &o)
+      : p_(new int(*o.p_))
+   {  ++live;  }
+
+   counted(BOOST_RV_REF(counted) o)
+      : p_(o.p_)
+   {  o.p_ = 0; ++moves;  }
+
+   counted &operator=(BOOST_COPY_ASSIGN_REF(counted) o)
+   {  *p_ = *o.p_; return *this;  }
+
+   counted &operator=(BOOST_RV_REF(counted) o)
+   {
+      if(this != &o){
+         delete p_;
+         if(p_) --live;
+         p_ = o.p_;
+         o.p_ = 0;
+      }
+      return *this;
+   }
+
+   ~counted()
+   {
+      ++destructions;
+      if(p_){
+         delete p_;
+         --live;
+      }
+   }
+
+   int value() const {  return *p_;  }
+
+   static void reset()
+   {  moves = destructions = 0;  }
+
+   private:
+   int *p_;
+};
+
+template<bool R> int counted<R>::moves = 0;
+template<bool R> int counted<R>::destructions = 0;
+template<bool R> int counted<R>::live = 0;
+template<bool R> int counted<R>::throw_on_value = -1;
+
+namespace boost {
+namespace container {
+
+template<>
+struct is_trivially_relocatable< counted<true> >
+{
+   BOOST_STATIC_CONSTEXPR bool value = true;
+};
+
+}}
+
+template<class Vector>
+bool check_sequence(const Vector &v, int first, int last)
+{
+   if(v.size() != std::size_t(last - first))
+      return false;
+   for(typename Vector::const_iterator it = v.begin(); it != v.end(); ++it, ++first){
+      if(it->value() != first)
+         return false;
+   }
+   return true;
+}
+
+void test_traits()
+{
+   BOOST_CONTAINER_STATIC_ASSERT(( is_trivially_relocatable<int>::value ));
+   BOOST_CONTAINER_STATIC_ASSERT(( is_trivially_relocatable<int*>::value ));
+   BOOST_CONTAINER_STATIC_ASSERT(( is_trivially_relocatable<const int>::value ));
+   BOOST_CONTAINER_STATIC_ASSERT(( is_trivially_relocatable<std::pair<int, double> >::value ));
+   BOOST_CONTAINER_STATIC_ASSERT(( !is_trivially_relocatable< counted<false> >::value ));
+   BOOST_CONTAINER_STATIC_ASSERT(( is_trivially_relocatable< counted<true> >::value ));
+   BOOST_CONTAINER_STATIC_ASSERT(( !is_trivially_relocatable<std::pair<int, counted<false> > >::value ));
+   BOOST_CONTAINER_STATIC_ASSERT(( is_trivially_relocatable< ::boost::movelib::unique_ptr<int> >::value ));
+
+   //Containers that only hold pointers are relocatable
+   BOOST_CONTAINER_STATIC_ASSERT(( is_trivially_relocatable< vector<counted<false> > >::value ));
+   BOOST_CONTAINER_STATIC_ASSERT(( is_trivially_relocatable< devector<counted<false> > >::value ));
+   BOOST_CONTAINER_STATIC_ASSERT(( is_trivially_relocatable< deque<counted<false> > >::value ));
+   BOOST_CONTAINER_STATIC_ASSERT(( is_trivially_relocatable< string >::value ));
+   BOOST_CONTAINER_STATIC_ASSERT(( is_trivially_relocatable
+      < basic_string<char, std::char_traits<char>, void, string_options<growth_factor<growth_factor_100> >::type> >::value ));
+   BOOST_CONTAINER_STATIC_ASSERT(( is_trivially_relocatable< vector<int, pmr::polymorphic_allocator<int> > >::value ));
+   BOOST_CONTAINER_STATIC_ASSERT(( is_trivially_relocatable< static_vector<int, 10> >::value ));
+   BOOST_CONTAINER_STATIC_ASSERT(( !is_trivially_relocatable< static_vector<counted<false>, 10> >::value ));
+
+   //Containers pointing to internal storage are not
+   BOOST_CONTAINER_STATIC_ASSERT(( !is_trivially_relocatable< small_vector<int, 10> >::value ));
+   BOOST_CONTAINER_STATIC_ASSERT(( !is_trivially_relocatable< stable_vector<int> >::value ));
+   BOOST_CONTAINER_STATIC_ASSERT(( !is_trivially_relocatable< list<int> >::value ));
+}
+
+template<class Vector>
+void test_relocation_sequence()
+{
+   typedef typename Vector::value_type value_type;
+   const bool relocatable = is_trivially_relocatable<value_type>::value;
+   {
+      Vector v;
+      for(int i = 0; i != 100; ++i){
+         v.emplace_back(i);
+      }
+      BOOST_TEST(check_sequence(v, 0, 100));
+
+      //Reallocation
+      value_type::reset();
+      v.reserve(v.capacity()*2u);
+      BOOST_TEST(check_sequence(v, 0, 100));
+      BOOST_TEST_EQ(value_type::moves == 0, relocatable);
+      BOOST_TEST_EQ(value_type::destructions == 0, relocatable);
+
+      //Middle insertion without reallocation
+      value_type::reset();
+      v.erase(v.begin() + 10, v.begin() + 20);
+      BOOST_TEST_EQ(value_type::destructions, 10);
+      BOOST_TEST_EQ(value_type::live, 90);
+      for(int i = 19; i != 9; --i){
+         v.emplace(v.begin() + 10, i);
+      }
+      BOOST_TEST(check_sequence(v, 0, 100));
+      if(relocatable){
+         BOOST_TEST_EQ(value_type::moves, 0);
+         BOOST_TEST_EQ(value_type::destructions, 10);
+      }
+
+      //Erase single element and range
+      v.erase(v.begin());
+      v.erase(v.end() - 1);
+      v.erase(v.begin(), v.begin() + 9);
+      BOOST_TEST(check_sequence(v, 10, 99));
+      BOOST_TEST_EQ(value_type::live, 89);
+
+      //Failed insertion leaves a relocatable sequence untouched
+      value_type::throw_on_value = -2;
+      BOOST_TEST_THROWS(v.emplace(v.begin() + 5, -2), int);
+      BOOST_TEST(!relocatable || check_sequence(v, 10, 99));
+      v.shrink_to_fit();
+      BOOST_TEST_THROWS(v.emplace(v.begin() + 5, -2), int);
+      BOOST_TEST(!relocatable || check_sequence(v, 10, 99));
+      value_type::throw_on_value = -1;
+   }
+   BOOST_TEST_EQ(value_type::live, 0);
+}
+
+void test_nested_containers()
+{
+   //vector of vectors leaks nothing when erasing ranges bigger than the tail
+   typedef vector<counted<false> > inner_t;
+   {
+      vector<inner_t> v(6u);
+      for(std::size_t i = 0; i != v.size(); ++i){
+         v[i].emplace_back(int(i));
+      }
+      v.erase(v.begin(), v.begin() + 5);
+      BOOST_TEST_EQ(v.size(), 1u);
+      BOOST_TEST_EQ(v[0][0].value(), 5);
+      BOOST_TEST_EQ(counted<false>::live, 1);
+      v.reserve(v.capacity()*2u);
+      BOOST_TEST_EQ(v[0][0].value(), 5);
+   }
+   BOOST_TEST_EQ(counted<false>::live, 0);
+
+   //devector erasing from the front
+   {
+      devector<inner_t> v(6u);
+      for(std::size_t i = 0; i != v.size(); ++i){
+         v[i].emplace_back(int(i));
+      }
+      v.erase(v.begin() + 1, v.end());
+      v.erase(v.begin(), v.begin());
+      BOOST_TEST_EQ(v.size(), 1u);
+      BOOST_TEST_EQ(counted<false>::live, 1);
+   }
+   BOOST_TEST_EQ(counted<false>::live, 0);
+}
+
+int main()
+{
+   test_traits();
+   test_relocation_sequence< vector< counted<true> > >();
+   test_relocation_sequence< vector< counted<false> > >();
+   test_relocation_sequence< devector< counted<true> > >();
+   test_relocation_sequence< devector< counted<false> > >();
+   test_relocation_sequence< small_vector< counted<true>, 5 > >();
+   test_relocation_sequence< small_vector< counted<false>, 5 > >();
+   test_nested_containers();
+   return boost::report_errors();
+}
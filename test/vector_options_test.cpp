@@ -115,11 +115,83 @@ void test_growth_factor_100()
    BOOST_TEST(new_capacity == 2*old_capacity);
 }
 
+struct adaptive_tag_a;
+struct adaptive_tag_b;
+
+template<class Tag>
+std::size_t adaptive_next_capacity(std::size_t initial_capacity)
+{
+   #if !defined(BOOST_NO_CXX11_TEMPLATE_ALIASES)
+   using options_t = vector_options_t< growth_factor<adaptive_growth_factor<Tag> > >;
+   #else
+   typedef typename vector_options
+      < growth_factor<adaptive_growth_factor<Tag> > >::type options_t;
+   #endif
+
+   vector<int, new_allocator<int>, options_t> v;
+   v.reserve(initial_capacity);
+   BOOST_TEST_EQ(v.capacity(), initial_capacity);
+   v.resize(v.capacity());
+   v.push_back(0);
+   return v.capacity();
+}
+
+void test_adaptive_growth_factor()
+{
+   typedef adaptive_growth_factor<adaptive_tag_a> growth_a;
+   typedef adaptive_growth_factor<adaptive_tag_b> growth_b;
+   growth_a::reset();
+   growth_b::reset();
+
+   //Size class rounding
+   BOOST_TEST_EQ((dtl::round_to_size_class<4u>(std::size_t(3u),   std::size_t(-1))), 4u);
+   BOOST_TEST_EQ((dtl::round_to_size_class<4u>(std::size_t(50u),  std::size_t(-1))), 56u);
+   BOOST_TEST_EQ((dtl::round_to_size_class<4u>(std::size_t(64u),  std::size_t(-1))), 64u);
+   BOOST_TEST_EQ((dtl::round_to_size_class<4u>(std::size_t(65u),  std::size_t(-1))), 80u);
+   BOOST_TEST_EQ((dtl::round_to_size_class<4u>(std::size_t(65u),  std::size_t(70u))), 70u);
+   BOOST_TEST_EQ((dtl::round_to_size_class<3u>(std::size_t(50u),  std::size_t(-1))), 53u);
+
+   //Starts doubling the capacity, rounded to the size class (50 ints -> 224 bytes)
+   BOOST_TEST_EQ(adaptive_next_capacity<adaptive_tag_a>(25u), 56u);
+
+   //shrink_to_fit with a lot of unused capacity backs off the growth
+   {
+      vector<int, new_allocator<int>, vector_options< growth_factor<growth_a> >::type> v(100u);
+      v.reserve(1000u);
+      v.shrink_to_fit();
+      BOOST_TEST_EQ(growth_a::backoff_level(), 1u);
+   }
+   BOOST_TEST_EQ(adaptive_next_capacity<adaptive_tag_a>(25u), 40u);
+   growth_a::on_shrink_to_fit(1000u, 900u);  //Not enough slack
+   BOOST_TEST_EQ(growth_a::backoff_level(), 1u);
+   growth_a::on_shrink_to_fit(1000u, 100u);
+   BOOST_TEST_EQ(adaptive_next_capacity<adaptive_tag_a>(100u), 160u);
+   growth_a::on_shrink_to_fit(1000u, 100u);
+   growth_a::on_shrink_to_fit(1000u, 100u);
+   BOOST_TEST_EQ(growth_a::backoff_level(), 3u);
+   BOOST_TEST_EQ(adaptive_next_capacity<adaptive_tag_a>(100u), 128u);
+
+   //Other tags are not affected
+   BOOST_TEST_EQ(growth_b::backoff_level(), 0u);
+   BOOST_TEST_EQ(adaptive_next_capacity<adaptive_tag_b>(25u), 56u);
+
+   //Growth becomes aggressive again after many growths without slack
+   {
+      for(int i = 0; i != 100 && growth_a::backoff_level(); ++i){
+         vector<int, new_allocator<int>, vector_options< growth_factor<growth_a> >::type> v;
+         for(int j = 0; j != 1000; ++j)
+            v.push_back(j);
+      }
+   }
+   BOOST_TEST_EQ(growth_a::backoff_level(), 0u);
+}
+
 int main()
 {
    test_growth_factor_50();
    test_growth_factor_60();
    test_growth_factor_100();
+   test_adaptive_growth_factor();
    test_stored_size_type<unsigned char>();
    test_stored_size_type<unsigned short>();
 